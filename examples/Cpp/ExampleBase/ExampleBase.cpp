@@ -8,6 +8,7 @@
 #include <ExampleBase.h>
 #include <LLGL/Utils/TypeNames.h>
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Utils/ProfileTraceWriter.h>
 #include "ImageReader.h"
 #include "FileUtils.h"
 #include <stdio.h>
@@ -638,7 +639,8 @@ void ExampleBase::MainLoop()
         LLGL::FrameProfile frameProfile;
         debuggerObj_->FlushProfile(&frameProfile);
 
-        if (showTimeRecords_)
+        // GPU times are resolved asynchronously, so wait for the first frame profile that contains time records
+        if (showTimeRecords_ && !frameProfile.timeRecords.empty())
         {
             LLGL::Log::Printf(
                 "\n"
@@ -647,15 +649,21 @@ void ExampleBase::MainLoop()
             );
             const double invTicksFreqMS = 1000.0 / LLGL::Timer::Frequency();
             for (const LLGL::ProfileTimeRecord& rec : frameProfile.timeRecords)
-                LLGL::Log::Printf("%s: GPU time: %" PRIu64 " ns\n", rec.annotation, rec.elapsedTime);
+            {
+                if (rec.resolveLatency == LLGL_UNRESOLVED_LATENCY)
+                    LLGL::Log::Printf("%s: GPU time: unresolved\n", rec.annotation);
+                else
+                    LLGL::Log::Printf("%s: GPU time: %" PRIu64 " ns (resolved after %u frames)\n", rec.annotation, rec.elapsedTime, rec.resolveLatency);
+            }
 
             debuggerObj_->SetTimeRecording(false);
             showTimeRecords_ = false;
 
-            // Write frame profile to JSON file to be viewed in Google Chrome's Trace Viewer
+            // Write frame profile to JSON file to be viewed in Google Chrome's Trace Viewer or the Perfetto UI
             const char* frameProfileFilename = "LLGL.trace.json";
-            WriteFrameProfileToJsonFile(frameProfile, frameProfileFilename);
-            LLGL::Log::Printf("Saved frame profile to file: %s\n", frameProfileFilename);
+            LLGL::ProfileTraceWriter traceWriter{ frameProfileFilename };
+            if (traceWriter.WriteFrame(frameProfile))
+                LLGL::Log::Printf("Saved frame profile to file: %s\n", frameProfileFilename);
         }
         else if (input.KeyDown(LLGL::Key::F1))
         {
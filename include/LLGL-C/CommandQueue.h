@@ -17,6 +17,7 @@
 
 
 LLGL_C_EXPORT void llglSubmitCommandBuffer(LLGLCommandBuffer commandBuffer);
+LLGL_C_EXPORT void llglSubmitCommandBuffers(uint32_t numCommandBuffers, const LLGLCommandBuffer* commandBuffers);
 LLGL_C_EXPORT bool llglQueryResult(LLGLQueryHeap queryHeap, uint32_t firstQuery, uint32_t numQueries, void* data, size_t dataSize);
 LLGL_C_EXPORT void llglSubmitFence(LLGLFence fence);
 LLGL_C_EXPORT bool llglWaitFence(LLGLFence fence, uint64_t timeout);
@@ -964,6 +964,7 @@ typedef enum LLGLMiscFlags
     LLGLMiscNoInitialData = (1 << 3),
     LLGLMiscAppend        = (1 << 4),
     LLGLMiscCounter       = (1 << 5),
+    LLGLMiscStreaming     = (1 << 6),
 }
 LLGLMiscFlags;
 
@@ -1145,10 +1146,11 @@ LLGLQueryPipelineStatistics;
 
 typedef struct LLGLProfileTimeRecord
 {
-    const char* annotation;    /* = "" */
-    uint64_t    cpuTicksStart; /* = 0 */
-    uint64_t    cpuTicksEnd;   /* = 0 */
-    uint64_t    elapsedTime;   /* = 0 */
+    const char* annotation;     /* = "" */
+    uint64_t    cpuTicksStart;  /* = 0 */
+    uint64_t    cpuTicksEnd;    /* = 0 */
+    uint64_t    elapsedTime;    /* = 0 */
+    uint32_t    resolveLatency; /* = 0 */
 }
 LLGLProfileTimeRecord;
 
@@ -1161,6 +1163,7 @@ typedef struct LLGLProfileCommandQueueRecord
     uint32_t textureReads;             /* = 0 */
     uint32_t commandBufferSubmittions; /* = 0 */
     uint32_t fenceSubmissions;         /* = 0 */
+    uint32_t transferSubmissions;      /* = 0 */
 }
 LLGLProfileCommandQueueRecord;
 
@@ -1190,6 +1193,10 @@ typedef struct LLGLProfileCommandBufferRecord
     uint32_t renderConditionSections;  /* = 0 */
     uint32_t drawCommands;             /* = 0 */
     uint32_t dispatchCommands;         /* = 0 */
+    uint32_t descriptorSetCacheHits;   /* = 0 */
+    uint32_t descriptorSetCacheMisses; /* = 0 */
+    uint32_t encodingStalls;           /* = 0 */
+    uint32_t eliminatedCommands;       /* = 0 */
 }
 LLGLProfileCommandBufferRecord;
 
@@ -291,6 +291,8 @@ struct CommandBufferDescriptor
     The benefit of having multiple native command buffers is that it reduces the time the GPU is idle
     because it waits for a command buffer to be completed before it can be reused.
     For command buffers that are only recorded once and submitted multiple times, it makes sense to allocate only a single native command buffer.
+    For the Vulkan backend, this specifies the number of frames in flight, each with its own transient command pool that is reset in its entirety when its native command buffer is encoded again.
+    If the GPU has not finished with that native command buffer yet, CommandBuffer::Begin blocks, which is recorded in ProfileCommandBufferRecord::encodingStalls.
     \see CommandBuffer::Begin
     */
     std::uint32_t       numNativeBuffers    = 0;
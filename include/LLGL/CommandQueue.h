@@ -11,6 +11,7 @@
 
 #include <LLGL/RenderSystemChild.h>
 #include <LLGL/ForwardDecls.h>
+#include <LLGL/Container/ArrayView.h>
 #include <cstdint>
 #include <cstddef>
 
@@ -47,17 +48,24 @@ class LLGL_EXPORT CommandQueue : public RenderSystemChild
         \endcode
         \see CommandBuffer::Begin
         \see CommandBuffer::End
-        \see Submit(std::uint32_t, CommandBuffer* const *)
+        \see Submit(const ArrayView<CommandBuffer*>&)
         */
         virtual void Submit(CommandBuffer& commandBuffer) = 0;
 
-        #if 0
         /**
         \brief Submits all command buffers in the specified array to the command queue at once.
+        \param[in] commandBuffers Specifies the array of command buffers that are to be submitted. None of these entries must be null.
+        The command buffers are executed in the order of this array and each of them must only occur once.
+        \remarks This is equivalent to submitting each command buffer individually with Submit(CommandBuffer&),
+        but backends that support it coalesce the entire batch into a single submission, which reduces the CPU overhead for many command buffers.
+        Currently, this is only the case for the Vulkan backend. All other backends submit the command buffers one after another.
+        \code
+        LLGL::CommandBuffer* myCmdBuffers[] = { myCmdBufferA, myCmdBufferB, myCmdBufferC };
+        myCmdQueue->Submit(myCmdBuffers);
+        \endcode
         \see Submit(CommandBuffer&)
         */
-        virtual void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers);
-        #endif
+        virtual void Submit(const ArrayView<CommandBuffer*>& commandBuffers);
 
         /* ----- Queries ----- */
 
@@ -57,6 +57,12 @@
 */
 #define LLGL_CURRENT_SWAP_INDEX             ( static_cast<std::uint32_t>(-1) )
 
+/**
+\brief Specifies that the elapsed GPU time of a time record could not be resolved.
+\see ProfileTimeRecord::resolveLatency
+*/
+#define LLGL_UNRESOLVED_LATENCY             ( static_cast<std::uint32_t>(-1) )
+
 
 namespace LLGL
 {
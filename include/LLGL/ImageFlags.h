@@ -15,6 +15,7 @@
 #include <LLGL/RenderSystemFlags.h>
 #include <LLGL/TextureFlags.h>
 #include <LLGL/Container/DynamicArray.h>
+#include <LLGL/Container/ArrayView.h>
 #include <LLGL/Deprecated.h>
 #include <memory>
 #include <cstdint>
@@ -321,6 +322,39 @@ LLGL_EXPORT DynamicByteArray GenerateImageBuffer(
     const float fillColor[4]
 );
 
+/**
+\brief Generates the MIP-map chain of an uncompressed image by successively downsampling each MIP-map level into the next one.
+\param[in] srcImageView Specifies the source image view of the base MIP-map level.
+All array layers must be tightly packed one after another, i.e. <code>extent.width * extent.height * extent.depth</code> pixels per array layer.
+\param[in] extent Specifies the extent of each array layer of the base MIP-map level.
+The depth is downsampled as well, so a depth greater than 1 denotes a 3D image. Use a depth of 1 for 1D, 2D, and cube images.
+\param[in] numArrayLayers Specifies the number of array layers. Each array layer is downsampled separately.
+\param[out] dstImageViews Specifies the destination image views for the MIP-map levels 1, 2, 3, etc.
+Each destination must have the same format and data type as the source and must be large enough for its MIP-map extent times the number of array layers.
+Each MIP-map extent is half the extent of the previous level (but at least 1), i.e. the same as \c GetMipExtent.
+\param[in] isSRGB Specifies whether the color components are in non-linear sRGB color space (e.g. for Format::RGBA8UNorm_sRGB).
+If true, the color components are averaged in linear color space. The alpha component is always treated as linear. By default false.
+\param[in] threadCount Specifies the number of threads to use for downsampling. Rows of all array layers and depth slices are distributed across the threads.
+If this is less than 2, no multi-threading is used. If this is equal to \c LLGL_MAX_THREAD_COUNT,
+the maximal count of threads the system supports will be used (e.g. 4 on a quad-core processor). By default 0.
+\remarks Even dimensions are reduced with a box filter. Odd dimensions are reduced with a 3-tap polyphase box filter, so non-power-of-two images are not undersampled.
+Integer data types are interpreted as normalized values.
+\throw std::invalid_argument If a compressed image format is specified.
+\throw std::invalid_argument If the image format is ImageFormat::DepthStencil or ImageFormat::Stencil.
+\throw std::invalid_argument If the source buffer is a null pointer or too small for the specified extent and number of array layers.
+\throw std::invalid_argument If a destination image view has a different format or data type than the source, or if its buffer is too small.
+\see LLGL_MAX_THREAD_COUNT
+\see NumMipLevels
+*/
+LLGL_EXPORT void GenerateMipChain(
+    const ImageView&                    srcImageView,
+    const Extent3D&                     extent,
+    std::uint32_t                       numArrayLayers,
+    const ArrayView<MutableImageView>&  dstImageViews,
+    bool                                isSRGB      = false,
+    unsigned                            threadCount = 0
+);
+
 /** @} */
 
 
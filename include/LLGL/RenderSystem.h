@@ -420,12 +420,34 @@ class LLGL_EXPORT RenderSystem : public Interface
         or <code>dstImageView.data</code> points to a buffer that is smaller than specified by <code>dstImageView.dataSize</code>,
         or <code>dstImageView.dataSize</code> is less than the required size.
 
+        \remarks This function blocks until the GPU has finished all previous commands that write to the texture.
+        To read back texture data without stalling the render thread (e.g. for screenshot captures), use ReadTextureAsync.
+
         \throws std::invalid_argument If <code>dstImageView.data</code> is null.
         \see Texture::GetDesc
         \see Texture::GetMipExtent
+        \see ReadTextureAsync
         */
         virtual void ReadTexture(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView) = 0;
 
+        /**
+        \brief Reads the image data from the specified texture asynchronously and submits the specified fence afterwards.
+        \param[in] texture Specifies the texture object to read from.
+        \param[in] textureRegion Specifies the region where the texture data is to be read.
+        \param[out] dstImageView Specifies the destination image view to write the texture data to.
+        The memory <code>dstImageView.data</code> points to must remain valid until the fence has been signaled.
+        \param[in] fence Specifies the fence that signals the completion of this read operation.
+        The texture data has been written to \c dstImageView once CommandQueue::WaitFence returns true for this fence.
+
+        \remarks With OpenGL, the texture data is read into a pooled pixel pack buffer and copied into \c dstImageView when CommandQueue::WaitFence finds the fence signaled.
+        All other backends read the texture data synchronously via ReadTexture and then submit the fence.
+
+        \throws std::invalid_argument If <code>dstImageView.data</code> is null.
+        \see ReadTexture
+        \see CommandQueue::WaitFence
+        */
+        virtual void ReadTextureAsync(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView, Fence& fence);
+
         /* ----- Samplers ---- */
 
         /**
@@ -594,6 +616,38 @@ class LLGL_EXPORT RenderSystem : public Interface
         */
         virtual PipelineState* CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache = nullptr) = 0;
 
+        /**
+        \brief Creates a batch of graphics pipeline state objects (PSOs) at once.
+
+        \param[in] numPipelineStates Specifies the number of PSOs that are to be created.
+        \param[in] pipelineStateDescs Pointer to an array of graphics PSO descriptors. This must point to at least \c numPipelineStates elements.
+        \param[out] outPipelineStates Pointer to an array that receives the new PSOs. This must point to at least \c numPipelineStates elements.
+
+        \remarks This is equivalent to calling CreatePipelineState for each descriptor,
+        but allows the backend to compile the shader pipelines of all PSOs concurrently before it waits for any of them.
+        For instance, the OpenGL backend issues all shader program links first and only queries their status afterwards,
+        which lets the driver link them in parallel if \c GL_KHR_parallel_shader_compile is supported.
+        \remarks Each created PSO must be released individually with Release(PipelineState&).
+
+        \see CreatePipelineState(const GraphicsPipelineDescriptor&, PipelineCache*)
+        */
+        virtual void CreatePipelineStates(
+            std::uint32_t                       numPipelineStates,
+            const GraphicsPipelineDescriptor*   pipelineStateDescs,
+            PipelineState**                     outPipelineStates
+        );
+
+        /**
+        \brief Creates a batch of compute pipeline state objects (PSOs) at once.
+        \see CreatePipelineStates(std::uint32_t, const GraphicsPipelineDescriptor*, PipelineState**)
+        \see CreatePipelineState(const ComputePipelineDescriptor&, PipelineCache*)
+        */
+        virtual void CreatePipelineStates(
+            std::uint32_t                       numPipelineStates,
+            const ComputePipelineDescriptor*    pipelineStateDescs,
+            PipelineState**                     outPipelineStates
+        );
+
         //! Releases the specified PipelineState object. After this call, the specified object must no longer be used.
         virtual void Release(PipelineState& pipelineState) = 0;
 
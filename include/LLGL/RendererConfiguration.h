@@ -106,10 +106,9 @@ struct RendererConfigurationVulkan
 
     /**
     \brief Specifies whether fragmentation of the device memory blocks shall be kept low. By default false.
-    \remarks If this is true, each buffer and image allocation first tries to find a reusable device memory block
-    within a single VkDeviceMemory chunk (which might be potentially slower).
-    Whenever a VkDeviceMemory chunk is full, the memory manager tries to reduce fragmentation anyways.
-    \todo Remove this as soon as Vulkan memory manage has been improved.
+    \remarks If this is true, each buffer and image allocation is placed into the fullest VkDeviceMemory chunk it fits into (best fit)
+    instead of the first one (first fit), which might be potentially slower but keeps more chunks free for release.
+    Within a chunk, free blocks are always reused and merged with their neighbors.
     */
     bool                        reduceDeviceMemoryFragmentation = false;
 };
@@ -143,6 +142,32 @@ struct RendererConfigurationOpenGL
     the respective extension and procedure name is printed to standard error output.
     */
     bool                    suppressFailedExtensions    = false;
+
+    /**
+    \brief Specifies whether deferred command buffers are optimized when their encoding ends. By default false.
+    \remarks If this is true, redundant state changes (such as binding the same pipeline state, vertex buffer, or resource heap twice)
+    are removed, consecutive viewport and scissor commands are merged, and consecutive buffer updates of the same buffer are coalesced.
+    Runs of non-instanced draw commands that end up with identical state are folded into a single \c glMultiDrawArrays or \c glMultiDrawElementsBaseVertex call.
+    This pass runs once in CommandBuffer::End, so it is most beneficial for command buffers with the CommandBufferFlags::MultiSubmit flag
+    that are submitted many times. It has no effect on command buffers with the CommandBufferFlags::ImmediateSubmit flag.
+    */
+    bool                    optimizeCommandBuffers      = false;
+};
+
+/**
+\brief Structure for a Null renderer specific configuration.
+\remarks The Null renderer executes all commands on the CPU and is mainly intended for testing and benchmarking.
+*/
+struct RendererConfigurationNull
+{
+    /**
+    \brief Specifies whether submitted command buffers are executed on a worker thread. By default false.
+    \remarks If this is true, CommandQueue::Submit only enqueues the command buffers and returns immediately,
+    similar to a hardware command queue. Fences and CommandQueue::WaitIdle must be used to synchronize with the submitted commands.
+    Command buffers are executed in the order they were submitted.
+    If this is false, command buffers are executed on the calling thread at submission.
+    */
+    bool deferredSubmission = false;
 };
 
 //! \deprecated Since 0.04b; Use RendererConfigurationOpenGL instead!
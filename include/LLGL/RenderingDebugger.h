@@ -59,6 +59,19 @@ class LLGL_EXPORT RenderingDebugger
         //! \retrun Returns whether time recording is enabled.
         bool GetTimeRecording() const;
 
+        /**
+        \brief Enables or disables validation in the debug layer. By default enabled.
+        \remarks If validation is disabled, the debug layer only records the frame profile counters and time records (see SetTimeRecording).
+        This is a low-overhead, profile-only mode that is meant for captures of production builds, where the validation of each command would distort the measurements.
+        \note This must be specified before the render system is loaded with this debugger,
+        because the debug layer only tracks the states for validation if validation is enabled when its objects are created.
+        \see RenderSystemDescriptor::debugger
+        */
+        void SetValidation(bool enabled);
+
+        //! \retrun Returns whether validation is enabled.
+        bool GetValidation() const;
+
         /**
         \brief Posts an error message.
         \param[in] type Specifies the type of error.
@@ -82,6 +95,7 @@ class LLGL_EXPORT RenderingDebugger
         /**
         \brief Records the specified profile with the current values.
         \param[in] profile Specifies the input profile whose values are to be merged with the current values.
+        \remarks This function is not thread-safe. Profiles must be recorded from a single thread, e.g. the one that submits to the command queue.
         \see MergeProfiles
         */
         void RecordProfile(const FrameProfile& profile);
@@ -10,6 +10,7 @@
 
 
 #include <LLGL/Export.h>
+#include <LLGL/Constants.h>
 #include <LLGL/Deprecated.h>
 #include <LLGL/Container/DynamicVector.h>
 #include <cstdint>
@@ -48,7 +49,11 @@ enum class WarningType
 */
 struct ProfileTimeRecord
 {
-    //! Time record annotation, e.g. function name that was recorded from the CommandBuffer.
+    /**
+    \brief Time record annotation, e.g. function name that was recorded from the CommandBuffer or the name of a debug group.
+    \remarks The name of a debug group is owned by the command buffer it was recorded with.
+    It remains valid until the records of the next encoding are taken from that command buffer, i.e. until the next call to CommandBuffer::End, or until the command buffer is released.
+    */
     const char*     annotation      = "";
 
     /**
@@ -65,9 +70,20 @@ struct ProfileTimeRecord
 
     /**
     \brief Elapsed time (in nanoseconds) to execute the respective command on the GPU.
-    \remarks If no GPU time has been recorded for this command (e.g. for the record of debug groups), this value remains zero.
+    \remarks If no GPU time has been recorded for this command, this value remains zero.
     */
     std::uint64_t   elapsedTime     = 0;
+
+    /**
+    \brief Number of command buffer encodings between recording this command and resolving its elapsed GPU time.
+    \remarks GPU times are resolved asynchronously to avoid stalling the pipeline,
+    so the time records of an encoding are reported in the frame profile of a later encoding of the same command buffer.
+    This value specifies that delay. It is zero for records that are not measured on the GPU.
+    If the query results were still not available when the debug layer had to reuse their queries,
+    this is \c LLGL_UNRESOLVED_LATENCY and \c elapsedTime is invalid (zero) for this record.
+    \see LLGL_UNRESOLVED_LATENCY
+    */
+    std::uint32_t   resolveLatency  = 0;
 };
 
 struct ProfileCommandQueueRecord
@@ -106,7 +122,7 @@ struct ProfileCommandQueueRecord
     /**
     \brief Counter for all command buffers that were submitted to the queue.
     \see CommandQueue::Submit(CommandBuffer&)
-    \see CommandQueue::Submit(std::uint32_t, CommandBuffer* const *)
+    \see CommandQueue::Submit(const ArrayView<CommandBuffer*>&)
     */
     std::uint32_t commandBufferSubmittions  = 0;
 
@@ -115,6 +131,15 @@ struct ProfileCommandQueueRecord
     \see CommandQueue::Submit(Fence&)
     */
     std::uint32_t fenceSubmissions          = 0;
+
+    /**
+    \brief Counter for all internal queue submissions of batched resource transfers.
+    \remarks This is only recorded by backends that batch buffer and texture writes into a separate transfer command buffer, i.e. Vulkan.
+    Ideally, this is at most one per submission of command buffers, regardless of the number of writes.
+    \see RenderSystem::WriteBuffer
+    \see RenderSystem::WriteTexture
+    */
+    std::uint32_t transferSubmissions       = 0;
 };
 
 struct ProfileCommandBufferRecord
@@ -272,6 +297,38 @@ struct ProfileCommandBufferRecord
     \see CommandBuffer::Dispatch
     */
     std::uint32_t dispatchCommands          = 0;
+
+    /**
+    \brief Counter for all descriptor sets that were reused because the same resources had already been bound in the current frame.
+    \remarks This is only recorded by backends that cache dynamic descriptor sets, i.e. Vulkan.
+    \see CommandBuffer::SetResource
+    */
+    std::uint32_t descriptorSetCacheHits    = 0;
+
+    /**
+    \brief Counter for all descriptor sets that had to be allocated and written because their resources had not been bound in the current frame.
+    \remarks This is only recorded by backends that cache dynamic descriptor sets, i.e. Vulkan.
+    \see CommandBuffer::SetResource
+    */
+    std::uint32_t descriptorSetCacheMisses  = 0;
+
+    /**
+    \brief Counter for all encodings that had to wait for the GPU because the next native command buffer was still in flight.
+    \remarks This is only recorded by backends that rotate through multiple native command buffers, i.e. Vulkan.
+    If time recording is enabled, each of these waits is also recorded as a time record with CPU ticks only.
+    \see CommandBuffer::Begin
+    \see CommandBufferDescriptor::numNativeBuffers
+    */
+    std::uint32_t encodingStalls            = 0;
+
+    /**
+    \brief Counter for all commands that were removed or merged by the backend when the encoding of a command buffer ended.
+    \remarks This is only recorded by backends that optimize their command buffers after encoding,
+    i.e. OpenGL with RendererConfigurationOpenGL::optimizeCommandBuffers enabled.
+    It is recorded once per encoding, even if the command buffer is submitted multiple times.
+    \see CommandBuffer::End
+    */
+    std::uint32_t eliminatedCommands        = 0;
 };
 
 LLGL_DEPRECATED_IGNORE_PUSH()
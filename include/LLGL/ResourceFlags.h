@@ -259,6 +259,20 @@ struct MiscFlags
         \see https://docs.microsoft.com/en-us/windows/win32/api/d3d11/ne-d3d11-d3d11_buffer_uav_flag
         */
         Counter         = (1 << 5),
+
+        /**
+        \brief Hint to the renderer that the entire content of a constant buffer is rewritten at least once per frame.
+        \remarks With OpenGL, all such buffers are sub-allocated from a single persistently mapped ring buffer that is shared by up to three frames in flight.
+        An update of a buffer that is bound writes the entire buffer content into a new range of the current frame and re-binds the buffer with the offset of that range,
+        which avoids stalling the driver while the buffer is still in use by previously submitted commands. Only a single fence is inserted per frame, when a swap-chain is presented.
+        Since the entire buffer content is written with each such update, this should only be used for small buffers. Buffers that exceed the capacity of the ring are allocated regularly.
+        \remarks This can only be used with buffers that have the binding flag BindFlags::ConstantBuffer and no other binding flags except BindFlags::CopySrc and BindFlags::CopyDst.
+        Otherwise, this flag is ignored.
+        \note Only supported with: OpenGL 4.4 or GL_ARB_buffer_storage. This flag is ignored by all other renderers.
+        \see RenderSystem::WriteBuffer
+        \see CommandBuffer::UpdateBuffer
+        */
+        Streaming       = (1 << 6),
     };
 };
 
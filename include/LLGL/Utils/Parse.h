@@ -146,6 +146,9 @@ class LLGL_EXPORT ParseContext
         );
         auto myLayout = myRenderer->CreatePipelineLayout(myLayoutDescUtil);
         \endcode
+        \remarks Parsed pipeline layouts are cached by the content hash of their source string,
+        so parsing the same layout signature again only decodes its cached binary representation (see EncodePipelineLayoutBinary).
+        The cache is thread-safe and it is cleared once it has reached several thousand entries.
         */
         PipelineLayoutDescriptor AsPipelineLayoutDesc() const;
 
@@ -324,7 +327,6 @@ class LLGL_EXPORT ParseContext
 
         UTF8String      data_;
         StringType      source_;
-        TokenArrayType  tokens_;
 
 };
 
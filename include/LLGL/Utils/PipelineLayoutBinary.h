@@ -0,0 +1,164 @@
+/*
+ * PipelineLayoutBinary.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_PIPELINE_LAYOUT_BINARY_H
+#define LLGL_PIPELINE_LAYOUT_BINARY_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/Blob.h>
+#include <LLGL/PipelineLayoutFlags.h>
+#include <LLGL/SamplerFlags.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\addtogroup group_util
+@{
+*/
+
+/**
+\brief Encodes the specified pipeline layout descriptor into a compact binary representation.
+\remarks The binary representation can be generated offline, e.g. from the output of LLGL::Parse, stored in a file, and memory-mapped at runtime.
+It consists of a fixed-size header, an array of fixed-size records for each list of the descriptor, and a table of null-terminated strings for all names.
+All values are stored in the native byte order and the entire representation is aligned to 4 bytes.
+\remarks The debug names of the pipeline layout and its static samplers are not encoded.
+\return Blob with the encoded pipeline layout. Use PipelineLayoutBinaryView to read it.
+\see PipelineLayoutBinaryView
+*/
+LLGL_EXPORT Blob EncodePipelineLayoutBinary(const PipelineLayoutDescriptor& pipelineLayoutDesc);
+
+/**
+\brief Encodes the specified sampler descriptor into a compact binary representation.
+\remarks The debug name of the sampler is not encoded.
+\see DecodeSamplerBinary
+*/
+LLGL_EXPORT Blob EncodeSamplerBinary(const SamplerDescriptor& samplerDesc);
+
+/**
+\brief Decodes the sampler descriptor from the specified binary representation without any memory allocation.
+\param[in] data Pointer to the binary representation that was generated by EncodeSamplerBinary. This must be aligned to 4 bytes.
+\param[in] dataSize Specifies the size (in bytes) of the binary representation.
+\param[out] outSamplerDesc Specifies the output sampler descriptor.
+\return True on success. Otherwise, the data is not a valid binary representation of a sampler descriptor and the output is not modified.
+\see EncodeSamplerBinary
+*/
+LLGL_EXPORT bool DecodeSamplerBinary(const void* data, std::size_t dataSize, SamplerDescriptor& outSamplerDesc);
+
+/**
+\brief Read-only view of a binary pipeline layout representation.
+\remarks This class does not copy the binary representation and it does not allocate any memory.
+All names of the returned descriptors point directly into the binary representation, which must remain valid for the lifetime of this view and the returned descriptors.
+\remarks Here is a usage example:
+\code
+// Offline: encode parsed pipeline layout and write it to a file
+LLGL::Blob layoutBinary = LLGL::EncodePipelineLayoutBinary(LLGL::Parse("heap{cbuffer(Scene@0):vert:frag},texture(colorMap@1):frag,sampler(linearSampler@2):frag"));
+
+// Runtime: read pipeline layout from a memory-mapped file
+LLGL::PipelineLayoutBinaryView layoutView{ myMappedFileData, myMappedFileSize };
+if (layoutView)
+{
+    LLGL::PipelineLayoutDescriptor layoutDesc;
+    layoutView.Decode(layoutDesc);
+    auto myLayout = myRenderer->CreatePipelineLayout(layoutDesc);
+}
+\endcode
+\see EncodePipelineLayoutBinary
+*/
+class LLGL_EXPORT PipelineLayoutBinaryView
+{
+
+    public:
+
+        PipelineLayoutBinaryView() = default;
+
+        PipelineLayoutBinaryView(const PipelineLayoutBinaryView&) = default;
+        PipelineLayoutBinaryView& operator = (const PipelineLayoutBinaryView&) = default;
+
+        /**
+        \brief Initializes the view with the specified binary representation and validates it.
+        \param[in] data Pointer to the binary representation that was generated by EncodePipelineLayoutBinary. This must be aligned to 4 bytes.
+        \param[in] dataSize Specifies the size (in bytes) of the binary representation.
+        \remarks If the validation fails, this view is empty.
+        \see IsValid
+        */
+        PipelineLayoutBinaryView(const void* data, std::size_t dataSize);
+
+        //! Returns true if this view refers to a valid binary representation.
+        bool IsValid() const;
+
+        //! Returns the number of heap bindings. \see PipelineLayoutDescriptor::heapBindings
+        std::uint32_t GetNumHeapBindings() const;
+
+        //! Returns the number of dynamic bindings. \see PipelineLayoutDescriptor::bindings
+        std::uint32_t GetNumBindings() const;
+
+        //! Returns the number of static samplers. \see PipelineLayoutDescriptor::staticSamplers
+        std::uint32_t GetNumStaticSamplers() const;
+
+        //! Returns the number of uniforms. \see PipelineLayoutDescriptor::uniforms
+        std::uint32_t GetNumUniforms() const;
+
+        //! Returns the number of combined texture-samplers. \see PipelineLayoutDescriptor::combinedTextureSamplers
+        std::uint32_t GetNumCombinedTextureSamplers() const;
+
+        //! Returns the barrier flags. \see PipelineLayoutDescriptor::barrierFlags
+        long GetBarrierFlags() const;
+
+        //! Returns the heap binding with the specified zero-based index. The index must be less than GetNumHeapBindings().
+        BindingDescriptor GetHeapBinding(std::uint32_t index) const;
+
+        //! Returns the dynamic binding with the specified zero-based index. The index must be less than GetNumBindings().
+        BindingDescriptor GetBinding(std::uint32_t index) const;
+
+        //! Returns the static sampler with the specified zero-based index. The index must be less than GetNumStaticSamplers().
+        StaticSamplerDescriptor GetStaticSampler(std::uint32_t index) const;
+
+        //! Returns the uniform with the specified zero-based index. The index must be less than GetNumUniforms().
+        UniformDescriptor GetUniform(std::uint32_t index) const;
+
+        //! Returns the combined texture-sampler with the specified zero-based index. The index must be less than GetNumCombinedTextureSamplers().
+        CombinedTextureSamplerDescriptor GetCombinedTextureSampler(std::uint32_t index) const;
+
+        /**
+        \brief Decodes the entire pipeline layout into the specified output descriptor.
+        \param[out] outPipelineLayoutDesc Specifies the output descriptor. Its previous lists are replaced.
+        \param[in] copyNames Specifies whether all names are copied into the output descriptor. By default false.
+        If this is false, the names refer to the binary representation and the only memory allocations are for the lists of the output descriptor.
+        \remarks If this view is empty, the output descriptor is reset to its default state.
+        */
+        void Decode(PipelineLayoutDescriptor& outPipelineLayoutDesc, bool copyNames = false) const;
+
+    public:
+
+        //! Returns true if this view refers to a valid binary representation.
+        inline operator bool () const
+        {
+            return IsValid();
+        }
+
+    private:
+
+        const char* data_ = nullptr;
+
+};
+
+/** @} */
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
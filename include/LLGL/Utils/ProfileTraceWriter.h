@@ -0,0 +1,89 @@
+/*
+ * ProfileTraceWriter.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_PROFILE_TRACE_WRITER_H
+#define LLGL_PROFILE_TRACE_WRITER_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/RenderingDebuggerFlags.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Utility class to stream frame profiles into files of the Chrome Trace Event format.
+
+This class is not required for any interaction with the render system.
+It can be used to inspect the profiles of a RenderingDebugger over a long period of time with \c chrome://tracing or the Perfetto UI (https://ui.perfetto.dev).
+\remarks Each frame is written to the file as soon as it is passed to WriteFrame, so the memory consumption of this class does not grow with the number of frames.
+For each frame, the following events are written:
+- An instant event that marks the beginning of the frame.
+- A complete event for each time record (see FrameProfile::timeRecords). Nested records, such as the records of debug groups, are nested by their CPU time range.
+The elapsed GPU time and resolve latency of each record are written as event arguments.
+- A counter event for the command queue record and the command buffer record respectively.
+\remarks All timestamps are relative to the beginning of the first frame. Hence, the files of a rotating writer share the same timeline.
+\see RenderingDebugger::FlushProfile
+\see RenderingDebugger::SetTimeRecording
+*/
+class LLGL_EXPORT ProfileTraceWriter : public NonCopyable
+{
+
+    public:
+
+        /**
+        \brief Opens the trace file for writing.
+        \param[in] filename Specifies the output filename, e.g. "Trace.json".
+        \param[in] framesPerFile Specifies the number of frames after which the writer switches to a new file. By default 0.
+        If this is zero, all frames are written into a single file with the specified name.
+        Otherwise, the file index is inserted before the file extension, e.g. "Trace.0.json", "Trace.1.json" etc.
+        \see IsOpen
+        */
+        ProfileTraceWriter(const char* filename, std::uint32_t framesPerFile = 0);
+
+        //! Closes the current trace file.
+        ~ProfileTraceWriter();
+
+        /**
+        \brief Writes the specified frame profile into the current trace file.
+        \remarks If the current file has reached the maximum number of frames, it is closed and the next file is opened first.
+        \return True on success. Otherwise, the current file could not be written.
+        */
+        bool WriteFrame(const FrameProfile& frameProfile);
+
+        /**
+        \brief Completes and closes the current trace file.
+        \remarks This is also called by the destructor. Subsequent calls to WriteFrame will open the next file.
+        */
+        void Close();
+
+        //! Returns true if a trace file is currently open.
+        bool IsOpen() const;
+
+        //! Returns the total number of frames that have been written.
+        std::uint64_t GetNumFrames() const;
+
+    private:
+
+        struct Pimpl;
+        Pimpl* pimpl_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -125,6 +125,14 @@ void RemoveFromSharedList(Container& cont, const T* entry)
     }
 }
 
+// Combines the seed with the hash of the specified value (64-bit variant of boost::hash_combine). Enumerations are hashed by their underlying type.
+template <typename T>
+void HashCombine(std::uint64_t& seed, const T& value)
+{
+    using THasher = typename std::conditional<std::is_enum<T>::value, EnumHasher<T>, std::hash<T>>::type;
+    seed ^= static_cast<std::uint64_t>(THasher{}(value)) + 0x9E3779B97F4A7C15ull + (seed << 6) + (seed >> 2);
+}
+
 // Resizes the specified container and throws an exception if the container would have to be re-allocated.
 // Returns the pointer to the first new element.
 template <typename Container>
@@ -0,0 +1,522 @@
+/*
+ * ImageConversionKernels.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "ImageConversionKernels.h"
+#include "Float16Compressor.h"
+#include "SIMD.h"
+#include <LLGL/Format.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/* ----- Internal structures ----- */
+
+// Lookup tables for 8-bit unsigned normalized components. These match the double-precision conversion of the generic path.
+struct UNorm8Tables
+{
+    UNorm8Tables()
+    {
+        for_range(i, 256)
+        {
+            const double value = static_cast<double>(i) / 255.0;
+            toFloat32[i] = static_cast<float>(value);
+            toFloat16[i] = CompressFloat16(static_cast<float>(value));
+        }
+    }
+
+    float           toFloat32[256];
+    std::uint16_t   toFloat16[256];
+};
+
+static const UNorm8Tables& GetUNorm8Tables()
+{
+    static const UNorm8Tables tables;
+    return tables;
+}
+
+static const std::uint16_t g_float16One = 0x3C00;
+
+
+/* ----- Scalar helpers ----- */
+
+// Converts a value from the normalized range [0, 1] to an 8-bit unsigned integer the same way the generic path truncates.
+// Values outside of that range are clamped and NaN is converted to zero.
+static inline std::uint8_t NormalizedToUNorm8(double value)
+{
+    value = std::max(0.0, std::min(value, 1.0));
+    return static_cast<std::uint8_t>(value * 255.0);
+}
+
+// Returns the source component at index 'I' or the default alpha value if 'I' is negative.
+template <int I>
+static inline std::uint8_t FetchUNorm8(const std::uint8_t* src)
+{
+    return (I >= 0 ? src[I] : 0xFF);
+}
+
+// Swizzles 8-bit components per pixel. Indices I0-I3 specify the source component for each destination component.
+template <std::size_t SrcComps, std::size_t DstComps, int I0, int I1, int I2, int I3>
+static void SwizzleUNorm8Scalar(std::uint8_t* dst, const std::uint8_t* src, std::size_t count)
+{
+    for_range(i, count)
+    {
+        dst[0] = FetchUNorm8<I0>(src);
+        dst[1] = FetchUNorm8<I1>(src);
+        dst[2] = FetchUNorm8<I2>(src);
+        if (DstComps > 3)
+            dst[3] = FetchUNorm8<I3>(src);
+        dst += DstComps;
+        src += SrcComps;
+    }
+}
+
+
+/* ----- Format conversion kernels (8-bit components) ----- */
+
+// RGBA <-> BGRA
+static void ConvertSwapRB_4xUNorm8(void* dst, const void* src, std::size_t count)
+{
+    auto        dst8    = static_cast<std::uint8_t*>(dst);
+    auto        src8    = static_cast<const std::uint8_t*>(src);
+    std::size_t i       = 0;
+
+    #if defined LLGL_SIMD_AVX2
+
+    const __m256i maskGA256 = _mm256_set1_epi32(static_cast<int>(0xFF00FF00u));
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256i v     = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src8 + i*4));
+        const __m256i ga    = _mm256_and_si256(v, maskGA256);
+        const __m256i rb    = _mm256_andnot_si256(maskGA256, v);
+        const __m256i br    = _mm256_or_si256(_mm256_slli_epi32(rb, 16), _mm256_srli_epi32(rb, 16));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst8 + i*4), _mm256_or_si256(ga, br));
+    }
+
+    #endif
+
+    #if defined LLGL_SIMD_SSE2
+
+    const __m128i maskGA = _mm_set1_epi32(static_cast<int>(0xFF00FF00u));
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i v     = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src8 + i*4));
+        const __m128i ga    = _mm_and_si128(v, maskGA);
+        const __m128i rb    = _mm_andnot_si128(maskGA, v);
+        const __m128i br    = _mm_or_si128(_mm_slli_epi32(rb, 16), _mm_srli_epi32(rb, 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst8 + i*4), _mm_or_si128(ga, br));
+    }
+
+    #elif defined LLGL_SIMD_NEON
+
+    for (; i + 16 <= count; i += 16)
+    {
+        uint8x16x4_t v = vld4q_u8(src8 + i*4);
+        std::swap(v.val[0], v.val[2]);
+        vst4q_u8(dst8 + i*4, v);
+    }
+
+    #endif
+
+    SwizzleUNorm8Scalar<4, 4, 2, 1, 0, 3>(dst8 + i*4, src8 + i*4, count - i);
+}
+
+// RGB -> RGBA, BGR -> BGRA (SwapRB = false); RGB -> BGRA, BGR -> RGBA (SwapRB = true)
+template <bool SwapRB>
+static void ConvertExpand_3xUNorm8(void* dst, const void* src, std::size_t count)
+{
+    auto        dst8    = static_cast<std::uint8_t*>(dst);
+    auto        src8    = static_cast<const std::uint8_t*>(src);
+    std::size_t i       = 0;
+
+    #if defined LLGL_SIMD_SSSE3
+
+    const __m128i shuffle = (SwapRB
+        ? _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1)
+        : _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1)
+    );
+    const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+
+    /* Each iteration reads 16 bytes but only consumes 12, so stop while the 4 byte overlap is still inside the range */
+    for (; i + 6 <= count; i += 4)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src8 + i*3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst8 + i*4), _mm_or_si128(_mm_shuffle_epi8(v, shuffle), alpha));
+    }
+
+    #elif defined LLGL_SIMD_NEON
+
+    for (; i + 16 <= count; i += 16)
+    {
+        const uint8x16x3_t v = vld3q_u8(src8 + i*3);
+        uint8x16x4_t r;
+        r.val[0] = (SwapRB ? v.val[2] : v.val[0]);
+        r.val[1] = v.val[1];
+        r.val[2] = (SwapRB ? v.val[0] : v.val[2]);
+        r.val[3] = vdupq_n_u8(0xFF);
+        vst4q_u8(dst8 + i*4, r);
+    }
+
+    #endif
+
+    if (SwapRB)
+        SwizzleUNorm8Scalar<3, 4, 2, 1, 0, -1>(dst8 + i*4, src8 + i*3, count - i);
+    else
+        SwizzleUNorm8Scalar<3, 4, 0, 1, 2, -1>(dst8 + i*4, src8 + i*3, count - i);
+}
+
+// RGBA -> RGB, BGRA -> BGR (SwapRB = false); RGBA -> BGR, BGRA -> RGB (SwapRB = true)
+template <bool SwapRB>
+static void ConvertShrink_4xUNorm8(void* dst, const void* src, std::size_t count)
+{
+    auto        dst8    = static_cast<std::uint8_t*>(dst);
+    auto        src8    = static_cast<const std::uint8_t*>(src);
+    std::size_t i       = 0;
+
+    #if defined LLGL_SIMD_SSSE3
+
+    const __m128i shuffle = (SwapRB
+        ? _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1)
+        : _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1)
+    );
+
+    /* Each iteration writes 16 bytes but only produces 12, so stop while the 4 byte overlap is still inside the range */
+    for (; i + 6 <= count; i += 4)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src8 + i*4));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst8 + i*3), _mm_shuffle_epi8(v, shuffle));
+    }
+
+    #elif defined LLGL_SIMD_NEON
+
+    for (; i + 16 <= count; i += 16)
+    {
+        const uint8x16x4_t v = vld4q_u8(src8 + i*4);
+        uint8x16x3_t r;
+        r.val[0] = (SwapRB ? v.val[2] : v.val[0]);
+        r.val[1] = v.val[1];
+        r.val[2] = (SwapRB ? v.val[0] : v.val[2]);
+        vst3q_u8(dst8 + i*3, r);
+    }
+
+    #endif
+
+    if (SwapRB)
+        SwizzleUNorm8Scalar<4, 3, 2, 1, 0, -1>(dst8 + i*3, src8 + i*4, count - i);
+    else
+        SwizzleUNorm8Scalar<4, 3, 0, 1, 2, -1>(dst8 + i*3, src8 + i*4, count - i);
+}
+
+// RGB <-> BGR
+static void ConvertSwapRB_3xUNorm8(void* dst, const void* src, std::size_t count)
+{
+    auto        dst8    = static_cast<std::uint8_t*>(dst);
+    auto        src8    = static_cast<const std::uint8_t*>(src);
+    std::size_t i       = 0;
+
+    #if defined LLGL_SIMD_SSSE3
+
+    const __m128i shuffle = _mm_setr_epi8(2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 14, 13, 12, 15);
+
+    /* Each iteration reads and writes 16 bytes but only converts 15, the last byte is rewritten by the next iteration */
+    for (; i + 6 <= count; i += 5)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src8 + i*3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst8 + i*3), _mm_shuffle_epi8(v, shuffle));
+    }
+
+    #elif defined LLGL_SIMD_NEON
+
+    for (; i + 16 <= count; i += 16)
+    {
+        uint8x16x3_t v = vld3q_u8(src8 + i*3);
+        std::swap(v.val[0], v.val[2]);
+        vst3q_u8(dst8 + i*3, v);
+    }
+
+    #endif
+
+    SwizzleUNorm8Scalar<3, 3, 2, 1, 0, -1>(dst8 + i*3, src8 + i*3, count - i);
+}
+
+
+/* ----- Data type conversion kernels (per component) ----- */
+
+static void ConvertUNorm8ToFloat32(void* dst, const void* src, std::size_t count)
+{
+    auto        dstF32  = static_cast<float*>(dst);
+    auto        src8    = static_cast<const std::uint8_t*>(src);
+    std::size_t i       = 0;
+
+    /* Dividing by 255 in single precision yields the same result as the double precision conversion for all 256 values */
+    #if defined LLGL_SIMD_AVX2
+
+    const __m256 scale256 = _mm256_set1_ps(255.0f);
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256i v = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src8 + i)));
+        _mm256_storeu_ps(dstF32 + i, _mm256_div_ps(_mm256_cvtepi32_ps(v), scale256));
+    }
+
+    #elif defined LLGL_SIMD_SSE2
+
+    const __m128i   zero    = _mm_setzero_si128();
+    const __m128    scale   = _mm_set1_ps(255.0f);
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i v     = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src8 + i));
+        const __m128i lo    = _mm_unpacklo_epi8(v, zero);
+        const __m128i hi    = _mm_unpackhi_epi8(v, zero);
+        _mm_storeu_ps(dstF32 + i     , _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), scale));
+        _mm_storeu_ps(dstF32 + i +  4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), scale));
+        _mm_storeu_ps(dstF32 + i +  8, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), scale));
+        _mm_storeu_ps(dstF32 + i + 12, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), scale));
+    }
+
+    #elif defined LLGL_SIMD_NEON_A64
+
+    const float32x4_t scale = vdupq_n_f32(255.0f);
+    for (; i + 16 <= count; i += 16)
+    {
+        const uint8x16_t v  = vld1q_u8(src8 + i);
+        const uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+        const uint16x8_t hi = vmovl_u8(vget_high_u8(v));
+        vst1q_f32(dstF32 + i     , vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo))), scale));
+        vst1q_f32(dstF32 + i +  4, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo))), scale));
+        vst1q_f32(dstF32 + i +  8, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi))), scale));
+        vst1q_f32(dstF32 + i + 12, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi))), scale));
+    }
+
+    #endif
+
+    const UNorm8Tables& tables = GetUNorm8Tables();
+    for (; i < count; ++i)
+        dstF32[i] = tables.toFloat32[src8[i]];
+}
+
+static void ConvertUNorm8ToFloat16(void* dst, const void* src, std::size_t count)
+{
+    auto dstF16 = static_cast<std::uint16_t*>(dst);
+    auto src8   = static_cast<const std::uint8_t*>(src);
+
+    const UNorm8Tables& tables = GetUNorm8Tables();
+    for_range(i, count)
+        dstF16[i] = tables.toFloat16[src8[i]];
+}
+
+static void ConvertFloat32ToUNorm8(void* dst, const void* src, std::size_t count)
+{
+    auto        dst8    = static_cast<std::uint8_t*>(dst);
+    auto        srcF32  = static_cast<const float*>(src);
+    std::size_t i       = 0;
+
+    /*
+    Scale in double precision to truncate exactly like the generic path.
+    MINPD/MAXPD return their second operand if either one is NaN, so the operand order maps NaN to zero like NormalizedToUNorm8().
+    */
+    #if defined LLGL_SIMD_SSE2
+
+    const __m128d zero  = _mm_setzero_pd();
+    const __m128d one   = _mm_set1_pd(1.0);
+    const __m128d scale = _mm_set1_pd(255.0);
+
+    auto ConvertQuad = [&](const float* p) -> __m128i
+    {
+        const __m128    v   = _mm_loadu_ps(p);
+        const __m128d   lo  = _mm_cvtps_pd(v);
+        const __m128d   hi  = _mm_cvtps_pd(_mm_movehl_ps(v, v));
+        const __m128i   ilo = _mm_cvttpd_epi32(_mm_mul_pd(_mm_max_pd(_mm_min_pd(one, lo), zero), scale));
+        const __m128i   ihi = _mm_cvttpd_epi32(_mm_mul_pd(_mm_max_pd(_mm_min_pd(one, hi), zero), scale));
+        return _mm_unpacklo_epi64(ilo, ihi);
+    };
+
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i v0 = _mm_packs_epi32(ConvertQuad(srcF32 + i     ), ConvertQuad(srcF32 + i +  4));
+        const __m128i v1 = _mm_packs_epi32(ConvertQuad(srcF32 + i +  8), ConvertQuad(srcF32 + i + 12));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst8 + i), _mm_packus_epi16(v0, v1));
+    }
+
+    #endif
+
+    for (; i < count; ++i)
+        dst8[i] = NormalizedToUNorm8(static_cast<double>(srcF32[i]));
+}
+
+static void ConvertFloat16ToUNorm8(void* dst, const void* src, std::size_t count)
+{
+    auto dst8   = static_cast<std::uint8_t*>(dst);
+    auto srcF16 = static_cast<const std::uint16_t*>(src);
+
+    for_range(i, count)
+        dst8[i] = NormalizedToUNorm8(static_cast<double>(DecompressFloat16(srcF16[i])));
+}
+
+static void ConvertFloat16ToFloat32(void* dst, const void* src, std::size_t count)
+{
+    auto dstF32 = static_cast<float*>(dst);
+    auto srcF16 = static_cast<const std::uint16_t*>(src);
+
+    for_range(i, count)
+        dstF32[i] = DecompressFloat16(srcF16[i]);
+}
+
+static void ConvertFloat32ToFloat16(void* dst, const void* src, std::size_t count)
+{
+    auto dstF16 = static_cast<std::uint16_t*>(dst);
+    auto srcF32 = static_cast<const float*>(src);
+
+    for_range(i, count)
+        dstF16[i] = CompressFloat16(srcF32[i]);
+}
+
+
+/* ----- Combined format and data type conversion kernels ----- */
+
+// RGB/UInt8 -> RGBA/Float16, BGR/UInt8 -> BGRA/Float16
+static void ConvertExpand_3xUNorm8To4xFloat16(void* dst, const void* src, std::size_t count)
+{
+    auto dstF16 = static_cast<std::uint16_t*>(dst);
+    auto src8   = static_cast<const std::uint8_t*>(src);
+
+    const UNorm8Tables& tables = GetUNorm8Tables();
+    for_range(i, count)
+    {
+        dstF16[0] = tables.toFloat16[src8[0]];
+        dstF16[1] = tables.toFloat16[src8[1]];
+        dstF16[2] = tables.toFloat16[src8[2]];
+        dstF16[3] = g_float16One;
+        dstF16 += 4;
+        src8 += 3;
+    }
+}
+
+// RGB/UInt8 -> RGBA/Float32, BGR/UInt8 -> BGRA/Float32
+static void ConvertExpand_3xUNorm8To4xFloat32(void* dst, const void* src, std::size_t count)
+{
+    auto dstF32 = static_cast<float*>(dst);
+    auto src8   = static_cast<const std::uint8_t*>(src);
+
+    const UNorm8Tables& tables = GetUNorm8Tables();
+    for_range(i, count)
+    {
+        dstF32[0] = tables.toFloat32[src8[0]];
+        dstF32[1] = tables.toFloat32[src8[1]];
+        dstF32[2] = tables.toFloat32[src8[2]];
+        dstF32[3] = 1.0f;
+        dstF32 += 4;
+        src8 += 3;
+    }
+}
+
+
+/* ----- Kernel tables ----- */
+
+struct FormatConversionKernelEntry
+{
+    ImageFormat                 srcFormat;
+    DataType                    srcDataType;
+    ImageFormat                 dstFormat;
+    DataType                    dstDataType;
+    PFN_ImageConversionKernel   kernel;
+};
+
+struct DataTypeConversionKernelEntry
+{
+    DataType                    srcDataType;
+    DataType                    dstDataType;
+    PFN_ImageConversionKernel   kernel;
+};
+
+// Kernels that operate on whole pixels.
+static const FormatConversionKernelEntry g_formatConversionKernels[] =
+{
+    { ImageFormat::RGBA, DataType::UInt8, ImageFormat::BGRA, DataType::UInt8,   ConvertSwapRB_4xUNorm8                  },
+    { ImageFormat::BGRA, DataType::UInt8, ImageFormat::RGBA, DataType::UInt8,   ConvertSwapRB_4xUNorm8                  },
+    { ImageFormat::RGB,  DataType::UInt8, ImageFormat::BGR,  DataType::UInt8,   ConvertSwapRB_3xUNorm8                  },
+    { ImageFormat::BGR,  DataType::UInt8, ImageFormat::RGB,  DataType::UInt8,   ConvertSwapRB_3xUNorm8                  },
+    { ImageFormat::RGB,  DataType::UInt8, ImageFormat::RGBA, DataType::UInt8,   ConvertExpand_3xUNorm8<false>           },
+    { ImageFormat::BGR,  DataType::UInt8, ImageFormat::BGRA, DataType::UInt8,   ConvertExpand_3xUNorm8<false>           },
+    { ImageFormat::RGB,  DataType::UInt8, ImageFormat::BGRA, DataType::UInt8,   ConvertExpand_3xUNorm8<true>            },
+    { ImageFormat::BGR,  DataType::UInt8, ImageFormat::RGBA, DataType::UInt8,   ConvertExpand_3xUNorm8<true>            },
+    { ImageFormat::RGBA, DataType::UInt8, ImageFormat::RGB,  DataType::UInt8,   ConvertShrink_4xUNorm8<false>           },
+    { ImageFormat::BGRA, DataType::UInt8, ImageFormat::BGR,  DataType::UInt8,   ConvertShrink_4xUNorm8<false>           },
+    { ImageFormat::RGBA, DataType::UInt8, ImageFormat::BGR,  DataType::UInt8,   ConvertShrink_4xUNorm8<true>            },
+    { ImageFormat::BGRA, DataType::UInt8, ImageFormat::RGB,  DataType::UInt8,   ConvertShrink_4xUNorm8<true>            },
+    { ImageFormat::RGB,  DataType::UInt8, ImageFormat::RGBA, DataType::Float16, ConvertExpand_3xUNorm8To4xFloat16       },
+    { ImageFormat::BGR,  DataType::UInt8, ImageFormat::BGRA, DataType::Float16, ConvertExpand_3xUNorm8To4xFloat16       },
+    { ImageFormat::RGB,  DataType::UInt8, ImageFormat::RGBA, DataType::Float32, ConvertExpand_3xUNorm8To4xFloat32       },
+    { ImageFormat::BGR,  DataType::UInt8, ImageFormat::BGRA, DataType::Float32, ConvertExpand_3xUNorm8To4xFloat32       },
+};
+
+// Kernels that operate on individual components and apply to all color formats.
+static const DataTypeConversionKernelEntry g_dataTypeConversionKernels[] =
+{
+    { DataType::UInt8,   DataType::Float32, ConvertUNorm8ToFloat32  },
+    { DataType::UInt8,   DataType::Float16, ConvertUNorm8ToFloat16  },
+    { DataType::Float32, DataType::UInt8,   ConvertFloat32ToUNorm8  },
+    { DataType::Float16, DataType::UInt8,   ConvertFloat16ToUNorm8  },
+    { DataType::Float16, DataType::Float32, ConvertFloat16ToFloat32 },
+    { DataType::Float32, DataType::Float16, ConvertFloat32ToFloat16 },
+};
+
+
+/* ----- Functions ----- */
+
+bool FindImageConversionKernel(
+    ImageConversionKernel&  outKernel,
+    ImageFormat             srcFormat,
+    DataType                srcDataType,
+    ImageFormat             dstFormat,
+    DataType                dstDataType)
+{
+    if (IsCompressedFormat(srcFormat) || IsDepthOrStencilFormat(srcFormat))
+        return false;
+
+    if (srcFormat == dstFormat)
+    {
+        /* Find per-component kernel for data type conversion */
+        for (const DataTypeConversionKernelEntry& entry : g_dataTypeConversionKernels)
+        {
+            if (entry.srcDataType == srcDataType && entry.dstDataType == dstDataType)
+            {
+                outKernel.convert       = entry.kernel;
+                outKernel.unitsPerPixel = ImageFormatSize(srcFormat);
+                return true;
+            }
+        }
+    }
+    else
+    {
+        /* Find per-pixel kernel for format conversion */
+        for (const FormatConversionKernelEntry& entry : g_formatConversionKernels)
+        {
+            if (entry.srcFormat     == srcFormat    &&
+                entry.srcDataType   == srcDataType  &&
+                entry.dstFormat     == dstFormat    &&
+                entry.dstDataType   == dstDataType)
+            {
+                outKernel.convert       = entry.kernel;
+                outKernel.unitsPerPixel = 1;
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
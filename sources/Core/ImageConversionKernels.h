@@ -0,0 +1,52 @@
+/*
+ * ImageConversionKernels.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_IMAGE_CONVERSION_KERNELS_H
+#define LLGL_IMAGE_CONVERSION_KERNELS_H
+
+
+#include <LLGL/ImageFlags.h>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+// Kernel function to convert 'count' elements from the source buffer into the destination buffer.
+typedef void (*PFN_ImageConversionKernel)(void* dst, const void* src, std::size_t count);
+
+// Fast-path kernel for a specific pair of image formats and data types.
+struct ImageConversionKernel
+{
+    PFN_ImageConversionKernel   convert         = nullptr;
+    std::size_t                 unitsPerPixel   = 1; // Number of kernel elements per pixel, e.g. 4 for a per-component kernel on RGBA images.
+};
+
+/*
+Finds a fast-path kernel for the specified image conversion.
+Returns false if there is no fast path and the generic (variant based) conversion must be used instead.
+The kernels produce the same results as the generic conversion for all values in the normalized range [0, 1].
+Conversions to UInt8 clamp values outside of that range and convert NaN to zero, regardless of which SIMD instruction set is used.
+*/
+bool FindImageConversionKernel(
+    ImageConversionKernel&  outKernel,
+    ImageFormat             srcFormat,
+    DataType                srcDataType,
+    ImageFormat             dstFormat,
+    DataType                dstDataType
+);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
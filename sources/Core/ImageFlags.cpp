@@ -13,6 +13,7 @@
 #include <thread>
 #include <cstring>
 #include "ImageUtils.h"
+#include "ImageConversionKernels.h"
 #include "../Core/CoreUtils.h"
 #include "../Core/Assertion.h"
 #include "../Core/Threading.h"
@@ -552,6 +553,45 @@ static void ConvertImageBufferFormat(
     );
 }
 
+// Converts the image buffer with a fast-path kernel if there is one for the source and destination format. Returns false otherwise.
+static bool ConvertImageBufferWithKernel(
+    const ImageView&        srcImageView,
+    const MutableImageView& dstImageView,
+    unsigned                threadCount)
+{
+    ImageConversionKernel kernel;
+    if (!FindImageConversionKernel(kernel, srcImageView.format, srcImageView.dataType, dstImageView.format, dstImageView.dataType))
+        return false;
+
+    /* Validate destination buffer size */
+    const std::size_t srcBytesPerPixel      = GetMemoryFootprint(srcImageView.format, srcImageView.dataType, 1);
+    const std::size_t dstBytesPerPixel      = GetMemoryFootprint(dstImageView.format, dstImageView.dataType, 1);
+    const std::size_t imageSize             = srcImageView.dataSize / srcBytesPerPixel;
+    const std::size_t requiredDstBufferSize = imageSize * dstBytesPerPixel;
+
+    if (dstImageView.dataSize != requiredDstBufferSize)
+        LLGL_TRAP("cannot convert image format with destination buffer size mismatch");
+
+    /* Run conversion kernel on pixel ranges */
+    const char* srcBuffer = static_cast<const char*>(srcImageView.data);
+    char*       dstBuffer = static_cast<char*>(dstImageView.data);
+
+    DoConcurrentRange(
+        [&kernel, srcBuffer, dstBuffer, srcBytesPerPixel, dstBytesPerPixel](std::size_t begin, std::size_t end)
+        {
+            kernel.convert(
+                dstBuffer + begin * dstBytesPerPixel,
+                srcBuffer + begin * srcBytesPerPixel,
+                (end - begin) * kernel.unitsPerPixel
+            );
+        },
+        imageSize,
+        threadCount
+    );
+
+    return true;
+}
+
 static void ValidateSourceImageView(const ImageView& imageView)
 {
     LLGL_ASSERT_PTR(imageView.data);
@@ -605,6 +645,11 @@ LLGL_EXPORT bool ConvertImageBuffer(
         /* Convert depth-stencil image format */
         ConvertImageBufferFormat(srcImageView, dstImageView, threadCount);
     }
+    else if (ConvertImageBufferWithKernel(srcImageView, dstImageView, threadCount))
+    {
+        /* Image has been converted with a fast-path kernel */
+        return true;
+    }
     else if (srcImageView.dataType != dstImageView.dataType && srcImageView.format != dstImageView.format)
     {
         /* Convert image data type with intermediate buffer */
@@ -688,6 +733,10 @@ LLGL_EXPORT DynamicByteArray ConvertImageBuffer(
         /* Convert depth-stencil image format */
         ConvertImageBufferFormat(srcImageView, dstImageView, threadCount);
     }
+    else if (ConvertImageBufferWithKernel(srcImageView, dstImageView, threadCount))
+    {
+        /* Image has been converted with a fast-path kernel */
+    }
     else if (srcImageView.dataType != dstDataType && srcImageView.format != dstFormat)
     {
         /* Convert image data type with intermediate buffer */
@@ -0,0 +1,665 @@
+/*
+ * MipMapGenerator.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/ImageFlags.h>
+#include "Float16Compressor.h"
+#include "Threading.h"
+#include "Exception.h"
+#include "SIMD.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <vector>
+#include <thread>
+#include <cmath>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/* ----- Internal structures ----- */
+
+// Filter taps of a single destination coordinate along one axis. Even source sizes use a 2-tap box filter, odd source sizes a 3-tap polyphase box filter.
+struct MipFilterTaps
+{
+    std::uint32_t   first;
+    std::uint32_t   count;
+    float           weights[3];
+};
+
+// Lookup tables for 8-bit sRGB components.
+struct SRGB8Tables
+{
+    SRGB8Tables()
+    {
+        for_range(i, 256)
+            toLinear[i] = static_cast<float>(SRGBToLinear(static_cast<double>(i) / 255.0));
+
+        /* Linear values at the midpoints between two adjacent sRGB codes determine the rounding thresholds */
+        for_range(i, 255)
+            thresholds[i] = static_cast<float>(SRGBToLinear((static_cast<double>(i) + 0.5) / 255.0));
+
+        /* Store the smallest code for each linear value bucket as initial guess for the threshold search */
+        std::uint32_t code = 0;
+        for_range(i, numGuesses)
+        {
+            const float bucketStart = static_cast<float>(i) / static_cast<float>(numGuesses);
+            while (code < 255 && thresholds[code] <= bucketStart)
+                ++code;
+            guesses[i] = static_cast<std::uint8_t>(code);
+        }
+    }
+
+    static double SRGBToLinear(double value)
+    {
+        if (value <= 0.04045)
+            return value / 12.92;
+        else
+            return std::pow((value + 0.055) / 1.055, 2.4);
+    }
+
+    // Returns the sRGB code that is nearest (in sRGB space) to the specified linear value.
+    inline std::uint8_t FromLinear(float value) const
+    {
+        value = std::max(0.0f, std::min(value, 1.0f));
+        std::uint32_t code = guesses[std::min(static_cast<std::uint32_t>(value * static_cast<float>(numGuesses)), numGuesses - 1)];
+        while (code < 255 && value >= thresholds[code])
+            ++code;
+        return static_cast<std::uint8_t>(code);
+    }
+
+    static constexpr std::uint32_t numGuesses = 4096;
+
+    float           toLinear[256];
+    float           thresholds[255];
+    std::uint8_t    guesses[numGuesses];
+};
+
+static const SRGB8Tables& GetSRGB8Tables()
+{
+    static const SRGB8Tables tables;
+    return tables;
+}
+
+// Common parameters to downsample one MIP-map level into the next one.
+struct MipLevelParams
+{
+    const char*         src;
+    char*               dst;
+    Extent3D            srcExtent;
+    Extent3D            dstExtent;
+    std::size_t         numComponents;
+    std::size_t         bpp;
+    DataType            dataType;
+    bool                isSRGB;
+    int                 alphaIndex;
+    const MipFilterTaps* tapsX;
+    const MipFilterTaps* tapsY;
+    const MipFilterTaps* tapsZ;
+};
+
+
+/* ----- Internal functions ----- */
+
+static std::uint32_t GetDownsampledSize(std::uint32_t size)
+{
+    return std::max(1u, size / 2);
+}
+
+static void BuildFilterTaps(std::vector<MipFilterTaps>& outTaps, std::uint32_t srcSize)
+{
+    const std::uint32_t dstSize = GetDownsampledSize(srcSize);
+    outTaps.resize(dstSize);
+
+    for_range(i, dstSize)
+    {
+        MipFilterTaps& taps = outTaps[i];
+        if (srcSize == 1)
+        {
+            taps.first      = 0;
+            taps.count      = 1;
+            taps.weights[0] = 1.0f;
+        }
+        else if (srcSize % 2 == 0)
+        {
+            taps.first      = i * 2;
+            taps.count      = 2;
+            taps.weights[0] = 0.5f;
+            taps.weights[1] = 0.5f;
+        }
+        else
+        {
+            /* Each destination texel covers 'srcSize/dstSize' source texels, so the outer texels only contribute partially */
+            const float invSrcSize = 1.0f / static_cast<float>(srcSize);
+            taps.first      = i * 2;
+            taps.count      = 3;
+            taps.weights[0] = static_cast<float>(dstSize - i) * invSrcSize;
+            taps.weights[1] = static_cast<float>(dstSize) * invSrcSize;
+            taps.weights[2] = static_cast<float>(i + 1) * invSrcSize;
+        }
+    }
+}
+
+// Returns the index of the alpha component or -1 if the format has no alpha channel. Alpha is never stored in sRGB space.
+static int GetAlphaComponentIndex(ImageFormat format)
+{
+    switch (format)
+    {
+        case ImageFormat::Alpha:
+        case ImageFormat::ARGB:
+        case ImageFormat::ABGR:
+            return 0;
+        case ImageFormat::RGBA:
+        case ImageFormat::BGRA:
+            return 3;
+        default:
+            return -1;
+    }
+}
+
+static float ReadNormalizedComponent(const char* src, std::size_t idx, DataType dataType)
+{
+    switch (dataType)
+    {
+        case DataType::Int8:    return std::max(static_cast<float>(reinterpret_cast<const std::int8_t*>(src)[idx]) / 127.0f, -1.0f);
+        case DataType::UInt8:   return static_cast<float>(reinterpret_cast<const std::uint8_t*>(src)[idx]) / 255.0f;
+        case DataType::Int16:   return std::max(static_cast<float>(reinterpret_cast<const std::int16_t*>(src)[idx]) / 32767.0f, -1.0f);
+        case DataType::UInt16:  return static_cast<float>(reinterpret_cast<const std::uint16_t*>(src)[idx]) / 65535.0f;
+        case DataType::Int32:   return static_cast<float>(static_cast<double>(reinterpret_cast<const std::int32_t*>(src)[idx]) / 2147483647.0);
+        case DataType::UInt32:  return static_cast<float>(static_cast<double>(reinterpret_cast<const std::uint32_t*>(src)[idx]) / 4294967295.0);
+        case DataType::Float16: return DecompressFloat16(reinterpret_cast<const std::uint16_t*>(src)[idx]);
+        case DataType::Float32: return reinterpret_cast<const float*>(src)[idx];
+        case DataType::Float64: return static_cast<float>(reinterpret_cast<const double*>(src)[idx]);
+        default:                return 0.0f;
+    }
+}
+
+template <typename T>
+static T DenormalizeComponent(float value, float minValue, double maxValue)
+{
+    const double scaled = static_cast<double>(std::max(minValue, std::min(value, 1.0f))) * maxValue;
+    return static_cast<T>(scaled < 0.0 ? scaled - 0.5 : scaled + 0.5);
+}
+
+static void WriteNormalizedComponent(char* dst, std::size_t idx, DataType dataType, float value)
+{
+    switch (dataType)
+    {
+        case DataType::Int8:    reinterpret_cast<std::int8_t*   >(dst)[idx] = DenormalizeComponent<std::int8_t   >(value, -1.0f, 127.0);           break;
+        case DataType::UInt8:   reinterpret_cast<std::uint8_t*  >(dst)[idx] = DenormalizeComponent<std::uint8_t  >(value,  0.0f, 255.0);           break;
+        case DataType::Int16:   reinterpret_cast<std::int16_t*  >(dst)[idx] = DenormalizeComponent<std::int16_t  >(value, -1.0f, 32767.0);         break;
+        case DataType::UInt16:  reinterpret_cast<std::uint16_t* >(dst)[idx] = DenormalizeComponent<std::uint16_t >(value,  0.0f, 65535.0);         break;
+        case DataType::Int32:   reinterpret_cast<std::int32_t*  >(dst)[idx] = DenormalizeComponent<std::int32_t  >(value, -1.0f, 2147483647.0);    break;
+        case DataType::UInt32:  reinterpret_cast<std::uint32_t* >(dst)[idx] = DenormalizeComponent<std::uint32_t >(value,  0.0f, 4294967295.0);    break;
+        case DataType::Float16: reinterpret_cast<std::uint16_t* >(dst)[idx] = CompressFloat16(value);                                               break;
+        case DataType::Float32: reinterpret_cast<float*         >(dst)[idx] = value;                                                                break;
+        case DataType::Float64: reinterpret_cast<double*        >(dst)[idx] = static_cast<double>(value);                                           break;
+        default:                                                                                                                                    break;
+    }
+}
+
+// Decodes a row of pixels into linear floating-point components.
+static void DecodeRow(float* dst, const char* src, std::size_t numPixels, const MipLevelParams& params)
+{
+    const std::size_t numComponents = numPixels * params.numComponents;
+    if (params.isSRGB && params.dataType == DataType::UInt8)
+    {
+        const SRGB8Tables& tables = GetSRGB8Tables();
+        const std::uint8_t* srcBytes = reinterpret_cast<const std::uint8_t*>(src);
+        for_range(i, numComponents)
+        {
+            if (static_cast<int>(i % params.numComponents) == params.alphaIndex)
+                dst[i] = static_cast<float>(srcBytes[i]) / 255.0f;
+            else
+                dst[i] = tables.toLinear[srcBytes[i]];
+        }
+    }
+    else
+    {
+        for_range(i, numComponents)
+            dst[i] = ReadNormalizedComponent(src, i, params.dataType);
+
+        if (params.isSRGB)
+        {
+            for_range(i, numComponents)
+            {
+                if (static_cast<int>(i % params.numComponents) != params.alphaIndex)
+                    dst[i] = static_cast<float>(SRGB8Tables::SRGBToLinear(static_cast<double>(dst[i])));
+            }
+        }
+    }
+}
+
+static float LinearToSRGB(float value)
+{
+    if (value <= 0.0031308f)
+        return value * 12.92f;
+    else
+        return 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+}
+
+// Encodes a row of linear floating-point components into the destination format.
+static void EncodeRow(char* dst, const float* src, std::size_t numPixels, const MipLevelParams& params)
+{
+    const std::size_t numComponents = numPixels * params.numComponents;
+    if (params.isSRGB && params.dataType == DataType::UInt8)
+    {
+        const SRGB8Tables& tables = GetSRGB8Tables();
+        std::uint8_t* dstBytes = reinterpret_cast<std::uint8_t*>(dst);
+        for_range(i, numComponents)
+        {
+            if (static_cast<int>(i % params.numComponents) == params.alphaIndex)
+                WriteNormalizedComponent(dst, i, DataType::UInt8, src[i]);
+            else
+                dstBytes[i] = tables.FromLinear(src[i]);
+        }
+    }
+    else if (params.isSRGB)
+    {
+        for_range(i, numComponents)
+        {
+            if (static_cast<int>(i % params.numComponents) == params.alphaIndex)
+                WriteNormalizedComponent(dst, i, params.dataType, src[i]);
+            else
+                WriteNormalizedComponent(dst, i, params.dataType, LinearToSRGB(src[i]));
+        }
+    }
+    else
+    {
+        for_range(i, numComponents)
+            WriteNormalizedComponent(dst, i, params.dataType, src[i]);
+    }
+}
+
+
+/* ----- Fast-path row kernels for 2x2 box filters ----- */
+
+// Downsamples two rows of 8-bit unsigned normalized RGBA pixels with a 2x2 box filter and rounding to nearest.
+static void DownsampleRowUNorm8x4(std::uint8_t* dst, const std::uint8_t* src0, const std::uint8_t* src1, std::size_t dstWidth)
+{
+    std::size_t x = 0;
+
+    #if defined LLGL_SIMD_SSE2
+
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i bias = _mm_set1_epi16(2);
+
+    for (; x + 4 <= dstWidth; x += 4)
+    {
+        /* Load 8 source pixels of each row */
+        const __m128i a0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src0 + x*8));
+        const __m128i a1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src0 + x*8 + 16));
+        const __m128i b0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src1 + x*8));
+        const __m128i b1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src1 + x*8 + 16));
+
+        /* Sum up both rows in 16-bit components, two pixels per register */
+        const __m128i s0 = _mm_add_epi16(_mm_unpacklo_epi8(a0, zero), _mm_unpacklo_epi8(b0, zero));
+        const __m128i s1 = _mm_add_epi16(_mm_unpackhi_epi8(a0, zero), _mm_unpackhi_epi8(b0, zero));
+        const __m128i s2 = _mm_add_epi16(_mm_unpacklo_epi8(a1, zero), _mm_unpacklo_epi8(b1, zero));
+        const __m128i s3 = _mm_add_epi16(_mm_unpackhi_epi8(a1, zero), _mm_unpackhi_epi8(b1, zero));
+
+        /* Sum up adjacent pixels, divide by 4 with rounding, and pack 4 destination pixels */
+        __m128i d0 = _mm_add_epi16(_mm_unpacklo_epi64(s0, s1), _mm_unpackhi_epi64(s0, s1));
+        __m128i d1 = _mm_add_epi16(_mm_unpacklo_epi64(s2, s3), _mm_unpackhi_epi64(s2, s3));
+        d0 = _mm_srli_epi16(_mm_add_epi16(d0, bias), 2);
+        d1 = _mm_srli_epi16(_mm_add_epi16(d1, bias), 2);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x*4), _mm_packus_epi16(d0, d1));
+    }
+
+    #elif defined LLGL_SIMD_NEON
+
+    for (; x + 8 <= dstWidth; x += 8)
+    {
+        /* Load 16 source pixels of each row de-interleaved into their components */
+        const uint8x16x4_t a = vld4q_u8(src0 + x*8);
+        const uint8x16x4_t b = vld4q_u8(src1 + x*8);
+
+        /* Sum up adjacent pixels of both rows and divide by 4 with rounding */
+        uint8x8x4_t d;
+        for_range(c, 4)
+            d.val[c] = vrshrn_n_u16(vaddq_u16(vpaddlq_u8(a.val[c]), vpaddlq_u8(b.val[c])), 2);
+
+        vst4_u8(dst + x*4, d);
+    }
+
+    #endif
+
+    for (; x < dstWidth; ++x)
+    {
+        for_range(c, 4)
+        {
+            const unsigned sum = src0[x*8 + c] + src0[x*8 + 4 + c] + src1[x*8 + c] + src1[x*8 + 4 + c];
+            dst[x*4 + c] = static_cast<std::uint8_t>((sum + 2) / 4);
+        }
+    }
+}
+
+// Downsamples two rows of 8-bit unsigned normalized pixels with an arbitrary number of components with a 2x2 box filter.
+static void DownsampleRowUNorm8(std::uint8_t* dst, const std::uint8_t* src0, const std::uint8_t* src1, std::size_t dstWidth, std::size_t numComponents)
+{
+    const std::size_t srcStride = numComponents * 2;
+    for_range(x, dstWidth)
+    {
+        for_range(c, numComponents)
+        {
+            const unsigned sum = src0[x*srcStride + c] + src0[x*srcStride + numComponents + c] + src1[x*srcStride + c] + src1[x*srcStride + numComponents + c];
+            dst[x*numComponents + c] = static_cast<std::uint8_t>((sum + 2) / 4);
+        }
+    }
+}
+
+// Downsamples two rows of 8-bit sRGB pixels with a 2x2 box filter in linear color space.
+static void DownsampleRowSRGB8(std::uint8_t* dst, const std::uint8_t* src0, const std::uint8_t* src1, std::size_t dstWidth, std::size_t numComponents, int alphaIndex)
+{
+    const SRGB8Tables& tables = GetSRGB8Tables();
+    const std::size_t srcStride = numComponents * 2;
+    for_range(x, dstWidth)
+    {
+        for_range(c, numComponents)
+        {
+            const std::uint8_t* p0 = src0 + x*srcStride + c;
+            const std::uint8_t* p1 = src1 + x*srcStride + c;
+            if (static_cast<int>(c) == alphaIndex)
+            {
+                const unsigned sum = p0[0] + p0[numComponents] + p1[0] + p1[numComponents];
+                dst[x*numComponents + c] = static_cast<std::uint8_t>((sum + 2) / 4);
+            }
+            else
+            {
+                const float sum = tables.toLinear[p0[0]] + tables.toLinear[p0[numComponents]] + tables.toLinear[p1[0]] + tables.toLinear[p1[numComponents]];
+                dst[x*numComponents + c] = tables.FromLinear(sum * 0.25f);
+            }
+        }
+    }
+}
+
+// Downsamples two rows of 32-bit floating-point pixels with a 2x2 box filter.
+static void DownsampleRowFloat32(float* dst, const float* src0, const float* src1, std::size_t dstWidth, std::size_t numComponents)
+{
+    std::size_t x = 0;
+
+    #if defined LLGL_SIMD_SSE2
+
+    if (numComponents == 4)
+    {
+        const __m128 quarter = _mm_set1_ps(0.25f);
+        for (; x < dstWidth; ++x)
+        {
+            const __m128 a = _mm_add_ps(_mm_loadu_ps(src0 + x*8), _mm_loadu_ps(src0 + x*8 + 4));
+            const __m128 b = _mm_add_ps(_mm_loadu_ps(src1 + x*8), _mm_loadu_ps(src1 + x*8 + 4));
+            _mm_storeu_ps(dst + x*4, _mm_mul_ps(_mm_add_ps(a, b), quarter));
+        }
+    }
+    else if (numComponents == 1)
+    {
+        const __m128 quarter = _mm_set1_ps(0.25f);
+        for (; x + 4 <= dstWidth; x += 4)
+        {
+            /* Sum up both rows, then sum up adjacent pixels by separating even and odd pixels */
+            const __m128 s0 = _mm_add_ps(_mm_loadu_ps(src0 + x*2), _mm_loadu_ps(src1 + x*2));
+            const __m128 s1 = _mm_add_ps(_mm_loadu_ps(src0 + x*2 + 4), _mm_loadu_ps(src1 + x*2 + 4));
+            const __m128 even = _mm_shuffle_ps(s0, s1, _MM_SHUFFLE(2, 0, 2, 0));
+            const __m128 odd = _mm_shuffle_ps(s0, s1, _MM_SHUFFLE(3, 1, 3, 1));
+            _mm_storeu_ps(dst + x, _mm_mul_ps(_mm_add_ps(even, odd), quarter));
+        }
+    }
+
+    #elif defined LLGL_SIMD_NEON
+
+    if (numComponents == 4)
+    {
+        const float32x4_t quarter = vdupq_n_f32(0.25f);
+        for (; x < dstWidth; ++x)
+        {
+            const float32x4_t a = vaddq_f32(vld1q_f32(src0 + x*8), vld1q_f32(src0 + x*8 + 4));
+            const float32x4_t b = vaddq_f32(vld1q_f32(src1 + x*8), vld1q_f32(src1 + x*8 + 4));
+            vst1q_f32(dst + x*4, vmulq_f32(vaddq_f32(a, b), quarter));
+        }
+    }
+
+    #endif
+
+    const std::size_t srcStride = numComponents * 2;
+    for (; x < dstWidth; ++x)
+    {
+        for_range(c, numComponents)
+        {
+            const float sum = (src0[x*srcStride + c] + src0[x*srcStride + numComponents + c]) + (src1[x*srcStride + c] + src1[x*srcStride + numComponents + c]);
+            dst[x*numComponents + c] = sum * 0.25f;
+        }
+    }
+}
+
+// Returns true if the specified MIP-map level can be downsampled with one of the 2x2 box filter row kernels.
+static bool IsBox2x2FastPath(const MipLevelParams& params)
+{
+    if (params.srcExtent.width % 2 != 0 || params.srcExtent.height % 2 != 0 || params.srcExtent.depth != 1)
+        return false;
+    if (params.dataType == DataType::UInt8)
+        return true;
+    if (params.dataType == DataType::Float32)
+        return !params.isSRGB;
+    return false;
+}
+
+static void DownsampleRowBox2x2(char* dst, const char* src0, const char* src1, const MipLevelParams& params)
+{
+    const std::size_t dstWidth = params.dstExtent.width;
+    if (params.dataType == DataType::Float32)
+    {
+        DownsampleRowFloat32(
+            reinterpret_cast<float*>(dst),
+            reinterpret_cast<const float*>(src0),
+            reinterpret_cast<const float*>(src1),
+            dstWidth,
+            params.numComponents
+        );
+    }
+    else if (params.isSRGB)
+    {
+        DownsampleRowSRGB8(
+            reinterpret_cast<std::uint8_t*>(dst),
+            reinterpret_cast<const std::uint8_t*>(src0),
+            reinterpret_cast<const std::uint8_t*>(src1),
+            dstWidth,
+            params.numComponents,
+            params.alphaIndex
+        );
+    }
+    else if (params.numComponents == 4)
+    {
+        DownsampleRowUNorm8x4(
+            reinterpret_cast<std::uint8_t*>(dst),
+            reinterpret_cast<const std::uint8_t*>(src0),
+            reinterpret_cast<const std::uint8_t*>(src1),
+            dstWidth
+        );
+    }
+    else
+    {
+        DownsampleRowUNorm8(
+            reinterpret_cast<std::uint8_t*>(dst),
+            reinterpret_cast<const std::uint8_t*>(src0),
+            reinterpret_cast<const std::uint8_t*>(src1),
+            dstWidth,
+            params.numComponents
+        );
+    }
+}
+
+
+/* ----- Generic downsampling ----- */
+
+// Downsamples all destination rows in the range [begin, end). Rows are enumerated across all depth slices and array layers of the destination level.
+static void DownsampleRows(const MipLevelParams& params, std::size_t begin, std::size_t end)
+{
+    const std::size_t srcRowStride      = params.srcExtent.width * params.bpp;
+    const std::size_t srcDepthStride    = params.srcExtent.height * srcRowStride;
+    const std::size_t srcLayerStride    = params.srcExtent.depth * srcDepthStride;
+    const std::size_t dstRowStride      = params.dstExtent.width * params.bpp;
+    const std::size_t dstHeight         = params.dstExtent.height;
+    const std::size_t dstDepth          = params.dstExtent.depth;
+
+    if (IsBox2x2FastPath(params))
+    {
+        for_subrange(row, begin, end)
+        {
+            const std::size_t   y       = row % dstHeight;
+            const std::size_t   layer   = row / dstHeight;
+            const char*         src     = params.src + layer * srcLayerStride + (y * 2) * srcRowStride;
+            DownsampleRowBox2x2(params.dst + row * dstRowStride, src, src + srcRowStride, params);
+        }
+        return;
+    }
+
+    /* Decode each contributing source row into linear components and accumulate its weighted horizontal taps */
+    const std::size_t numSrcComponents = params.srcExtent.width * params.numComponents;
+    const std::size_t numDstComponents = params.dstExtent.width * params.numComponents;
+
+    std::vector<float> scratch(numSrcComponents + numDstComponents);
+    float* srcRow = scratch.data();
+    float* dstRow = scratch.data() + numSrcComponents;
+
+    for_subrange(row, begin, end)
+    {
+        const std::size_t y     = row % dstHeight;
+        const std::size_t z     = (row / dstHeight) % dstDepth;
+        const std::size_t layer = row / (dstHeight * dstDepth);
+
+        std::fill(dstRow, dstRow + numDstComponents, 0.0f);
+
+        const MipFilterTaps& tapsZ = params.tapsZ[z];
+        const MipFilterTaps& tapsY = params.tapsY[y];
+
+        for_range(tz, tapsZ.count)
+        {
+            for_range(ty, tapsY.count)
+            {
+                const char* src = params.src + layer * srcLayerStride + (tapsZ.first + tz) * srcDepthStride + (tapsY.first + ty) * srcRowStride;
+                DecodeRow(srcRow, src, params.srcExtent.width, params);
+
+                const float weightYZ = tapsZ.weights[tz] * tapsY.weights[ty];
+                for_range(x, params.dstExtent.width)
+                {
+                    const MipFilterTaps& tapsX = params.tapsX[x];
+                    for_range(tx, tapsX.count)
+                    {
+                        const float     weight  = weightYZ * tapsX.weights[tx];
+                        const float*    texel   = srcRow + (tapsX.first + tx) * params.numComponents;
+                        for_range(c, params.numComponents)
+                            dstRow[x * params.numComponents + c] += weight * texel[c];
+                    }
+                }
+            }
+        }
+
+        EncodeRow(params.dst + row * dstRowStride, dstRow, params.dstExtent.width, params);
+    }
+}
+
+static std::size_t GetRequiredImageSize(const Extent3D& extent, std::uint32_t numArrayLayers, std::size_t bpp)
+{
+    return static_cast<std::size_t>(extent.width) * extent.height * extent.depth * numArrayLayers * bpp;
+}
+
+
+/* ----- Public functions ----- */
+
+LLGL_EXPORT void GenerateMipChain(
+    const ImageView&                    srcImageView,
+    const Extent3D&                     extent,
+    std::uint32_t                       numArrayLayers,
+    const ArrayView<MutableImageView>&  dstImageViews,
+    bool                                isSRGB,
+    unsigned                            threadCount)
+{
+    /* Validate input parameters */
+    if (IsCompressedFormat(srcImageView.format))
+        LLGL_TRAP("cannot generate MIP-maps for compressed image formats");
+    if (srcImageView.format == ImageFormat::DepthStencil || srcImageView.format == ImageFormat::Stencil)
+        LLGL_TRAP("cannot generate MIP-maps for stencil image formats");
+    if (srcImageView.dataType < DataType::Int8 || srcImageView.dataType > DataType::Float64)
+        LLGL_TRAP("invalid value for source data type: 0x%08X", static_cast<unsigned>(srcImageView.dataType));
+    if (srcImageView.data == nullptr)
+        LLGL_TRAP("source image data must not be null");
+    if (extent.width == 0 || extent.height == 0 || extent.depth == 0 || numArrayLayers == 0)
+        return;
+
+    const std::size_t numComponents = ImageFormatSize(srcImageView.format);
+    const std::size_t bpp           = numComponents * DataTypeSize(srcImageView.dataType);
+
+    if (srcImageView.dataSize < GetRequiredImageSize(extent, numArrayLayers, bpp))
+        LLGL_TRAP("source image data size is too small for the specified extent and number of array layers");
+
+    if (threadCount == LLGL_MAX_THREAD_COUNT)
+        threadCount = std::thread::hardware_concurrency();
+
+    MipLevelParams params;
+    {
+        params.src              = static_cast<const char*>(srcImageView.data);
+        params.srcExtent        = extent;
+        params.numComponents    = numComponents;
+        params.bpp              = bpp;
+        params.dataType         = srcImageView.dataType;
+        params.isSRGB           = isSRGB;
+        params.alphaIndex       = GetAlphaComponentIndex(srcImageView.format);
+    }
+
+    std::vector<MipFilterTaps> tapsX, tapsY, tapsZ;
+
+    for (const MutableImageView& dstImageView : dstImageViews)
+    {
+        if (dstImageView.format != srcImageView.format || dstImageView.dataType != srcImageView.dataType)
+            LLGL_TRAP("cannot generate MIP-maps with mismatching destination image format or data type");
+
+        params.dstExtent = Extent3D
+        {
+            GetDownsampledSize(params.srcExtent.width),
+            GetDownsampledSize(params.srcExtent.height),
+            GetDownsampledSize(params.srcExtent.depth)
+        };
+
+        if (dstImageView.data == nullptr || dstImageView.dataSize < GetRequiredImageSize(params.dstExtent, numArrayLayers, bpp))
+            LLGL_TRAP("destination image data size is too small for MIP-map extent %ux%ux%u", params.dstExtent.width, params.dstExtent.height, params.dstExtent.depth);
+
+        BuildFilterTaps(tapsX, params.srcExtent.width);
+        BuildFilterTaps(tapsY, params.srcExtent.height);
+        BuildFilterTaps(tapsZ, params.srcExtent.depth);
+
+        params.dst      = static_cast<char*>(dstImageView.data);
+        params.tapsX    = tapsX.data();
+        params.tapsY    = tapsY.data();
+        params.tapsZ    = tapsZ.data();
+
+        /* Downsample all rows of all slices and array layers concurrently; split small levels into fewer tasks */
+        const std::size_t numRows       = static_cast<std::size_t>(params.dstExtent.height) * params.dstExtent.depth * numArrayLayers;
+        const unsigned    rowsPerThread = std::max(1u, 4096u / params.dstExtent.width);
+
+        DoConcurrentRange(
+            [&params](std::size_t begin, std::size_t end)
+            {
+                DownsampleRows(params, begin, end);
+            },
+            numRows,
+            threadCount,
+            rowsPerThread
+        );
+
+        /* Next level is downsampled from this level */
+        params.src          = params.dst;
+        params.srcExtent    = params.dstExtent;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -6,11 +6,15 @@
  */
 
 #include <LLGL/Utils/Parse.h>
+#include <LLGL/Utils/PipelineLayoutBinary.h>
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Container/Strings.h>
 #include <LLGL/Report.h>
 #include <vector>
 #include <string>
+#include <unordered_map>
+#include <mutex>
+#include <algorithm>
 #include <cstring>
 #include <cmath>
 #include "Exception.h"
@@ -107,12 +111,15 @@ static void ScanTokens(const char* start, const char* end, ParseContext::TokenAr
     }
 }
 
-static void ReserveAndScanTokens(ParseContext::StringType& source, ParseContext::TokenArrayType& outTokens)
+// Scans the tokens of the specified source. This is done per conversion, so cached conversions don't have to scan the source at all.
+static ParseContext::TokenArrayType ReserveAndScanTokens(const ParseContext::StringType& source)
 {
     /* Reserve token array with average token length */
     constexpr std::size_t averageTokenLength = 8;
-    outTokens.reserve(source.size() / averageTokenLength);
-    ScanTokens(source.begin(), source.end(), outTokens);
+    ParseContext::TokenArrayType tokens;
+    tokens.reserve(source.size() / averageTokenLength);
+    ScanTokens(source.begin(), source.end(), tokens);
+    return tokens;
 }
 
 
@@ -305,14 +312,12 @@ bool Parser::Fork(const StringView& matchEnd, Parser& outForkedParser)
 ParseContext::ParseContext(const StringView& source) :
     source_ { source.begin(), source.end() }
 {
-    ReserveAndScanTokens(source_, tokens_);
 }
 
 ParseContext::ParseContext(UTF8String&& source) :
     data_   { std::move(source)          },
     source_ { data_.begin(), data_.end() }
 {
-    ReserveAndScanTokens(source_, tokens_);
 }
 
 template <typename T>
@@ -985,12 +990,97 @@ static void RaiseParsingError(const Parser& parser, const char* descName)
     }
 }
 
+/*
+Cache of parsed pipeline layouts, keyed by the content hash of their source.
+Each layout is stored in its compact binary representation, so thousands of layouts only take a few allocations.
+*/
+struct PipelineLayoutCacheEntry
+{
+    std::string source;
+    Blob        binary;
+};
+
+struct PipelineLayoutCache
+{
+    std::mutex                                                  mutex;
+    std::unordered_map<std::uint64_t, PipelineLayoutCacheEntry> entries;
+};
+
+// Maximum number of entries in the pipeline layout cache. The cache is cleared when this limit is reached.
+static constexpr std::size_t g_maxCachedPipelineLayouts = 4096;
+
+static PipelineLayoutCache& GetPipelineLayoutCache()
+{
+    static PipelineLayoutCache cache;
+    return cache;
+}
+
+// Returns the 64-bit FNV-1a hash of the specified source.
+static std::uint64_t HashParseSource(const ParseContext::StringType& source)
+{
+    std::uint64_t hash = 0xCBF29CE484222325ull;
+    for (char c : source)
+    {
+        hash ^= static_cast<std::uint8_t>(c);
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+static bool IsParseSourceEqual(const ParseContext::StringType& source, const std::string& str)
+{
+    return (source.size() == str.size() && std::equal(source.begin(), source.end(), str.begin()));
+}
+
+static bool FindCachedPipelineLayoutDesc(std::uint64_t hash, const ParseContext::StringType& source, PipelineLayoutDescriptor& outDesc)
+{
+    PipelineLayoutCache& cache = GetPipelineLayoutCache();
+    std::lock_guard<std::mutex> guard{ cache.mutex };
+
+    auto it = cache.entries.find(hash);
+    if (it == cache.entries.end() || !IsParseSourceEqual(source, it->second.source))
+        return false;
+
+    /* Copy names, because the cache entry might be cleared while the descriptor is still in use */
+    PipelineLayoutBinaryView view{ it->second.binary.GetData(), it->second.binary.GetSize() };
+    view.Decode(outDesc, /*copyNames:*/ true);
+    return true;
+}
+
+static void CachePipelineLayoutDesc(std::uint64_t hash, const ParseContext::StringType& source, const PipelineLayoutDescriptor& desc)
+{
+    Blob binary = EncodePipelineLayoutBinary(desc);
+
+    PipelineLayoutCache& cache = GetPipelineLayoutCache();
+    std::lock_guard<std::mutex> guard{ cache.mutex };
+
+    if (cache.entries.size() >= g_maxCachedPipelineLayouts)
+        cache.entries.clear();
+
+    /* Keep previous entry on hash collision */
+    PipelineLayoutCacheEntry entry;
+    {
+        entry.source = std::string{ source.begin(), source.end() };
+        entry.binary = std::move(binary);
+    }
+    cache.entries.emplace(hash, std::move(entry));
+}
+
 PipelineLayoutDescriptor ParseContext::AsPipelineLayoutDesc() const
 {
     PipelineLayoutDescriptor desc;
-    Parser parser{ tokens_ };
+
+    /* Return previously parsed layout with the same source before the source is tokenized */
+    const std::uint64_t hash = HashParseSource(source_);
+    if (FindCachedPipelineLayoutDesc(hash, source_, desc))
+        return desc;
+
+    const TokenArrayType tokens = ReserveAndScanTokens(source_);
+    Parser parser{ tokens };
     if (!ParsePipelineLayoutDesc(parser, desc))
         RaiseParsingError(parser, "PipelineLayoutDescriptor");
+
+    CachePipelineLayoutDesc(hash, source_, desc);
     return desc;
 }
 
@@ -1342,7 +1432,8 @@ static bool ParseSamplerDesc(Parser& parser, SamplerDescriptor& outDesc)
 SamplerDescriptor ParseContext::AsSamplerDesc() const
 {
     SamplerDescriptor desc;
-    Parser parser{ tokens_ };
+    const TokenArrayType tokens = ReserveAndScanTokens(source_);
+    Parser parser{ tokens };
     if (!ParseSamplerDesc(parser, desc))
         RaiseParsingError(parser, "SamplerDescriptor");
     return desc;
@@ -1397,7 +1488,8 @@ static bool ParseDepthDesc(Parser& parser, DepthDescriptor& outDesc)
 DepthDescriptor ParseContext::AsDepthDesc() const
 {
     DepthDescriptor desc;
-    Parser parser{ tokens_ };
+    const TokenArrayType tokens = ReserveAndScanTokens(source_);
+    Parser parser{ tokens };
     if (!ParseDepthDesc(parser, desc))
         RaiseParsingError(parser, "DepthDescriptor");
     return desc;
@@ -1514,7 +1606,8 @@ static bool ParseStencilFaceDesc(Parser& parser, StencilFaceDescriptor& outDesc)
 StencilFaceDescriptor ParseContext::AsStencilFaceDesc() const
 {
     StencilFaceDescriptor desc;
-    Parser parser{ tokens_ };
+    const TokenArrayType tokens = ReserveAndScanTokens(source_);
+    Parser parser{ tokens };
     if (!ParseStencilFaceDesc(parser, desc))
         RaiseParsingError(parser, "StencilFaceDescriptor");
     return desc;
@@ -1583,7 +1676,8 @@ static bool ParseStencilDesc(Parser& parser, StencilDescriptor& outDesc)
 StencilDescriptor ParseContext::AsStencilDesc() const
 {
     StencilDescriptor desc;
-    Parser parser{ tokens_ };
+    const TokenArrayType tokens = ReserveAndScanTokens(source_);
+    Parser parser{ tokens };
     if (!ParseStencilDesc(parser, desc))
         RaiseParsingError(parser, "StencilDescriptor");
     return desc;
@@ -1607,9 +1701,10 @@ static TextureSwizzle ParseTextureSwizzle(const char* s, char c)
 TextureSwizzleRGBA ParseContext::AsTextureSwizzleRGBA() const
 {
     TextureSwizzleRGBA swizzle;
-    if (!(tokens_.size() == 1 && tokens_.front().size() == 4))
+    const TokenArrayType tokens = ReserveAndScanTokens(source_);
+    if (!(tokens.size() == 1 && tokens.front().size() == 4))
         LLGL_TRAP("parsing %s failed: texture swizzle must consist of four characters in {1,2,R,G,B,A}", source_.data());
-    const char* tok = tokens_.front().data();
+    const char* tok = tokens.front().data();
     swizzle.r = ParseTextureSwizzle(tok, tok[0]);
     swizzle.g = ParseTextureSwizzle(tok, tok[1]);
     swizzle.b = ParseTextureSwizzle(tok, tok[2]);
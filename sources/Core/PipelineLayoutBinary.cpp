@@ -0,0 +1,618 @@
+/*
+ * PipelineLayoutBinary.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/PipelineLayoutBinary.h>
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/Container/StringView.h>
+#include "Assertion.h"
+#include <vector>
+#include <string>
+#include <map>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Binary records
+ */
+
+static constexpr std::uint32_t g_binaryPipelineLayoutMagic  = 0x4C504C4C; // "LLPL" in little-endian byte order
+static constexpr std::uint32_t g_binarySamplerMagic         = 0x4D534C4C; // "LLSM" in little-endian byte order
+static constexpr std::uint32_t g_binaryVersion              = 1;
+
+struct BinaryPipelineLayoutHeader
+{
+    std::uint32_t   magic;
+    std::uint32_t   version;
+    std::uint32_t   size;                       // Total size of the binary representation (in bytes)
+    std::uint32_t   barrierFlags;
+    std::uint32_t   numHeapBindings;
+    std::uint32_t   numBindings;
+    std::uint32_t   numStaticSamplers;
+    std::uint32_t   numUniforms;
+    std::uint32_t   numCombinedTextureSamplers;
+    std::uint32_t   stringTableSize;            // Size of the string table (in bytes), padded to 4 bytes
+};
+
+// All names are stored as byte offsets into the string table; offset 0 always refers to an empty string.
+struct BinaryBinding
+{
+    std::uint32_t   name;
+    std::uint32_t   type;
+    std::uint32_t   bindFlags;
+    std::uint32_t   stageFlags;
+    std::uint32_t   slotIndex;
+    std::uint32_t   slotSet;
+    std::uint32_t   arraySize;
+};
+
+struct BinarySampler
+{
+    std::uint8_t    addressModes[3];
+    std::uint8_t    filters[3];                 // Minification, magnification, and MIP-map filter
+    std::uint8_t    flags;                      // Bit 0: mipMapEnabled, Bit 1: compareEnabled
+    std::uint8_t    compareOp;
+    float           mipMapLODBias;
+    float           minLOD;
+    float           maxLOD;
+    std::uint32_t   maxAnisotropy;
+    float           borderColor[4];
+};
+
+struct BinaryStaticSampler
+{
+    std::uint32_t   name;
+    std::uint32_t   stageFlags;
+    std::uint32_t   slotIndex;
+    std::uint32_t   slotSet;
+    BinarySampler   sampler;
+};
+
+struct BinaryUniform
+{
+    std::uint32_t   name;
+    std::uint32_t   type;
+    std::uint32_t   arraySize;
+};
+
+struct BinaryCombinedTextureSampler
+{
+    std::uint32_t   name;
+    std::uint32_t   textureName;
+    std::uint32_t   samplerName;
+    std::uint32_t   slotIndex;
+    std::uint32_t   slotSet;
+};
+
+struct BinarySamplerHeader
+{
+    std::uint32_t   magic;
+    std::uint32_t   version;
+    std::uint32_t   size;
+    BinarySampler   sampler;
+};
+
+static_assert(sizeof(BinaryPipelineLayoutHeader)    == 40, "BinaryPipelineLayoutHeader must not contain any padding");
+static_assert(sizeof(BinaryBinding)                 == 28, "BinaryBinding must not contain any padding");
+static_assert(sizeof(BinarySampler)                 == 40, "BinarySampler must not contain any padding");
+static_assert(sizeof(BinaryStaticSampler)           == 56, "BinaryStaticSampler must not contain any padding");
+static_assert(sizeof(BinaryUniform)                 == 12, "BinaryUniform must not contain any padding");
+static_assert(sizeof(BinaryCombinedTextureSampler)  == 20, "BinaryCombinedTextureSampler must not contain any padding");
+static_assert(sizeof(BinarySamplerHeader)           == 52, "BinarySamplerHeader must not contain any padding");
+
+// Byte offsets of each record array within the binary representation.
+struct BinaryPipelineLayoutOffsets
+{
+    std::uint64_t heapBindings;
+    std::uint64_t bindings;
+    std::uint64_t staticSamplers;
+    std::uint64_t uniforms;
+    std::uint64_t combinedTextureSamplers;
+    std::uint64_t stringTable;
+    std::uint64_t end;
+};
+
+static BinaryPipelineLayoutOffsets GetBinaryPipelineLayoutOffsets(const BinaryPipelineLayoutHeader& header)
+{
+    /* Use 64-bit offsets, so corrupted record counts cannot overflow */
+    BinaryPipelineLayoutOffsets offsets;
+    offsets.heapBindings            = sizeof(BinaryPipelineLayoutHeader);
+    offsets.bindings                = offsets.heapBindings            + sizeof(BinaryBinding)                 * static_cast<std::uint64_t>(header.numHeapBindings);
+    offsets.staticSamplers          = offsets.bindings                + sizeof(BinaryBinding)                 * static_cast<std::uint64_t>(header.numBindings);
+    offsets.uniforms                = offsets.staticSamplers          + sizeof(BinaryStaticSampler)           * static_cast<std::uint64_t>(header.numStaticSamplers);
+    offsets.combinedTextureSamplers = offsets.uniforms                + sizeof(BinaryUniform)                 * static_cast<std::uint64_t>(header.numUniforms);
+    offsets.stringTable             = offsets.combinedTextureSamplers + sizeof(BinaryCombinedTextureSampler)  * static_cast<std::uint64_t>(header.numCombinedTextureSamplers);
+    offsets.end                     = offsets.stringTable             + header.stringTableSize;
+    return offsets;
+}
+
+static std::uint32_t GetAlignedSize(std::size_t size, std::size_t alignment)
+{
+    return static_cast<std::uint32_t>(((size + alignment - 1) / alignment) * alignment);
+}
+
+
+/*
+ * Encoding
+ */
+
+// Builds the string table with unique entries. The first entry is always the empty string.
+class BinaryStringTableBuilder
+{
+
+    public:
+
+        BinaryStringTableBuilder() :
+            table_ { '\0' }
+        {
+        }
+
+        std::uint32_t Append(const StringLiteral& str)
+        {
+            if (str.empty())
+                return 0;
+
+            auto it = offsets_.find(str.c_str());
+            if (it != offsets_.end())
+                return it->second;
+
+            const std::uint32_t offset = static_cast<std::uint32_t>(table_.size());
+            table_.insert(table_.end(), str.c_str(), str.c_str() + str.size() + 1);
+            offsets_[str.c_str()] = offset;
+            return offset;
+        }
+
+        const std::vector<char>& GetTable() const
+        {
+            return table_;
+        }
+
+    private:
+
+        std::vector<char>                       table_;
+        std::map<std::string, std::uint32_t>    offsets_;
+
+};
+
+static void EncodeBinarySampler(BinarySampler& dst, const SamplerDescriptor& src)
+{
+    dst.addressModes[0] = static_cast<std::uint8_t>(src.addressModeU);
+    dst.addressModes[1] = static_cast<std::uint8_t>(src.addressModeV);
+    dst.addressModes[2] = static_cast<std::uint8_t>(src.addressModeW);
+    dst.filters[0]      = static_cast<std::uint8_t>(src.minFilter);
+    dst.filters[1]      = static_cast<std::uint8_t>(src.magFilter);
+    dst.filters[2]      = static_cast<std::uint8_t>(src.mipMapFilter);
+    dst.flags           = ((src.mipMapEnabled ? 0x1 : 0x0) | (src.compareEnabled ? 0x2 : 0x0));
+    dst.compareOp       = static_cast<std::uint8_t>(src.compareOp);
+    dst.mipMapLODBias   = src.mipMapLODBias;
+    dst.minLOD          = src.minLOD;
+    dst.maxLOD          = src.maxLOD;
+    dst.maxAnisotropy   = src.maxAnisotropy;
+    for_range(i, 4)
+        dst.borderColor[i] = src.borderColor[i];
+}
+
+static void EncodeBinaryBinding(BinaryBinding& dst, const BindingDescriptor& src, BinaryStringTableBuilder& stringTable)
+{
+    dst.name        = stringTable.Append(src.name);
+    dst.type        = static_cast<std::uint32_t>(src.type);
+    dst.bindFlags   = static_cast<std::uint32_t>(src.bindFlags);
+    dst.stageFlags  = static_cast<std::uint32_t>(src.stageFlags);
+    dst.slotIndex   = src.slot.index;
+    dst.slotSet     = src.slot.set;
+    dst.arraySize   = src.arraySize;
+}
+
+template <typename TRecord>
+TRecord* NextBinaryRecords(char*& dst, std::size_t count)
+{
+    TRecord* records = reinterpret_cast<TRecord*>(dst);
+    dst += sizeof(TRecord) * count;
+    return records;
+}
+
+LLGL_EXPORT Blob EncodePipelineLayoutBinary(const PipelineLayoutDescriptor& pipelineLayoutDesc)
+{
+    BinaryPipelineLayoutHeader header;
+    {
+        header.magic                        = g_binaryPipelineLayoutMagic;
+        header.version                      = g_binaryVersion;
+        header.size                         = 0;
+        header.barrierFlags                 = static_cast<std::uint32_t>(pipelineLayoutDesc.barrierFlags);
+        header.numHeapBindings              = static_cast<std::uint32_t>(pipelineLayoutDesc.heapBindings.size());
+        header.numBindings                  = static_cast<std::uint32_t>(pipelineLayoutDesc.bindings.size());
+        header.numStaticSamplers            = static_cast<std::uint32_t>(pipelineLayoutDesc.staticSamplers.size());
+        header.numUniforms                  = static_cast<std::uint32_t>(pipelineLayoutDesc.uniforms.size());
+        header.numCombinedTextureSamplers   = static_cast<std::uint32_t>(pipelineLayoutDesc.combinedTextureSamplers.size());
+        header.stringTableSize              = 0;
+    }
+
+    /* Encode all records with a temporary string table */
+    BinaryStringTableBuilder stringTable;
+
+    std::vector<char> records(static_cast<std::size_t>(GetBinaryPipelineLayoutOffsets(header).stringTable - sizeof(header)));
+    char* dst = records.data();
+
+    BinaryBinding* heapBindings = NextBinaryRecords<BinaryBinding>(dst, header.numHeapBindings);
+    for_range(i, header.numHeapBindings)
+        EncodeBinaryBinding(heapBindings[i], pipelineLayoutDesc.heapBindings[i], stringTable);
+
+    BinaryBinding* bindings = NextBinaryRecords<BinaryBinding>(dst, header.numBindings);
+    for_range(i, header.numBindings)
+        EncodeBinaryBinding(bindings[i], pipelineLayoutDesc.bindings[i], stringTable);
+
+    BinaryStaticSampler* staticSamplers = NextBinaryRecords<BinaryStaticSampler>(dst, header.numStaticSamplers);
+    for_range(i, header.numStaticSamplers)
+    {
+        const StaticSamplerDescriptor& src = pipelineLayoutDesc.staticSamplers[i];
+        staticSamplers[i].name          = stringTable.Append(src.name);
+        staticSamplers[i].stageFlags    = static_cast<std::uint32_t>(src.stageFlags);
+        staticSamplers[i].slotIndex     = src.slot.index;
+        staticSamplers[i].slotSet       = src.slot.set;
+        EncodeBinarySampler(staticSamplers[i].sampler, src.sampler);
+    }
+
+    BinaryUniform* uniforms = NextBinaryRecords<BinaryUniform>(dst, header.numUniforms);
+    for_range(i, header.numUniforms)
+    {
+        const UniformDescriptor& src = pipelineLayoutDesc.uniforms[i];
+        uniforms[i].name        = stringTable.Append(src.name);
+        uniforms[i].type        = static_cast<std::uint32_t>(src.type);
+        uniforms[i].arraySize   = src.arraySize;
+    }
+
+    BinaryCombinedTextureSampler* combinedTextureSamplers = NextBinaryRecords<BinaryCombinedTextureSampler>(dst, header.numCombinedTextureSamplers);
+    for_range(i, header.numCombinedTextureSamplers)
+    {
+        const CombinedTextureSamplerDescriptor& src = pipelineLayoutDesc.combinedTextureSamplers[i];
+        combinedTextureSamplers[i].name         = stringTable.Append(src.name);
+        combinedTextureSamplers[i].textureName  = stringTable.Append(src.textureName);
+        combinedTextureSamplers[i].samplerName  = stringTable.Append(src.samplerName);
+        combinedTextureSamplers[i].slotIndex    = src.slot.index;
+        combinedTextureSamplers[i].slotSet      = src.slot.set;
+    }
+
+    /* Concatenate header, records, and string table; the padding of the string table is filled with null characters */
+    const std::vector<char>& strings = stringTable.GetTable();
+    header.stringTableSize  = GetAlignedSize(strings.size(), 4);
+    header.size             = static_cast<std::uint32_t>(GetBinaryPipelineLayoutOffsets(header).end);
+
+    std::vector<char> data(header.size, '\0');
+    ::memcpy(data.data(), &header, sizeof(header));
+    ::memcpy(data.data() + sizeof(header), records.data(), records.size());
+    ::memcpy(data.data() + sizeof(header) + records.size(), strings.data(), strings.size());
+
+    return Blob::CreateStrongRef(std::move(data));
+}
+
+LLGL_EXPORT Blob EncodeSamplerBinary(const SamplerDescriptor& samplerDesc)
+{
+    BinarySamplerHeader header;
+    {
+        header.magic    = g_binarySamplerMagic;
+        header.version  = g_binaryVersion;
+        header.size     = sizeof(BinarySamplerHeader);
+        EncodeBinarySampler(header.sampler, samplerDesc);
+    }
+    return Blob::CreateCopy(&header, sizeof(header));
+}
+
+
+/*
+ * Decoding
+ */
+
+static void DecodeBinarySampler(SamplerDescriptor& dst, const BinarySampler& src)
+{
+    dst.addressModeU    = static_cast<SamplerAddressMode>(src.addressModes[0]);
+    dst.addressModeV    = static_cast<SamplerAddressMode>(src.addressModes[1]);
+    dst.addressModeW    = static_cast<SamplerAddressMode>(src.addressModes[2]);
+    dst.minFilter       = static_cast<SamplerFilter>(src.filters[0]);
+    dst.magFilter       = static_cast<SamplerFilter>(src.filters[1]);
+    dst.mipMapFilter    = static_cast<SamplerFilter>(src.filters[2]);
+    dst.mipMapEnabled   = ((src.flags & 0x1) != 0);
+    dst.compareEnabled  = ((src.flags & 0x2) != 0);
+    dst.compareOp       = static_cast<CompareOp>(src.compareOp);
+    dst.mipMapLODBias   = src.mipMapLODBias;
+    dst.minLOD          = src.minLOD;
+    dst.maxLOD          = src.maxLOD;
+    dst.maxAnisotropy   = src.maxAnisotropy;
+    for_range(i, 4)
+        dst.borderColor[i] = src.borderColor[i];
+}
+
+static bool IsBinaryDataAligned(const void* data)
+{
+    return (reinterpret_cast<std::uintptr_t>(data) % alignof(std::uint32_t) == 0);
+}
+
+LLGL_EXPORT bool DecodeSamplerBinary(const void* data, std::size_t dataSize, SamplerDescriptor& outSamplerDesc)
+{
+    if (data == nullptr || !IsBinaryDataAligned(data) || dataSize < sizeof(BinarySamplerHeader))
+        return false;
+
+    const BinarySamplerHeader& header = *reinterpret_cast<const BinarySamplerHeader*>(data);
+    if (header.magic != g_binarySamplerMagic || header.version != g_binaryVersion || header.size != sizeof(BinarySamplerHeader))
+        return false;
+
+    DecodeBinarySampler(outSamplerDesc, header.sampler);
+    return true;
+}
+
+
+/*
+ * PipelineLayoutBinaryView class
+ */
+
+// Returns true if the name offsets of all specified records are within the string table.
+template <typename TRecord, typename TPredicate>
+bool AreBinaryRecordsValid(const char* data, std::uint64_t offset, std::uint32_t count, TPredicate pred)
+{
+    const TRecord* records = reinterpret_cast<const TRecord*>(data + offset);
+    for_range(i, count)
+    {
+        if (!pred(records[i]))
+            return false;
+    }
+    return true;
+}
+
+static bool IsBinaryPipelineLayoutValid(const char* data, std::size_t dataSize)
+{
+    if (data == nullptr || !IsBinaryDataAligned(data) || dataSize < sizeof(BinaryPipelineLayoutHeader))
+        return false;
+
+    /* Validate header */
+    const BinaryPipelineLayoutHeader& header = *reinterpret_cast<const BinaryPipelineLayoutHeader*>(data);
+    if (header.magic != g_binaryPipelineLayoutMagic || header.version != g_binaryVersion || header.size > dataSize)
+        return false;
+
+    const BinaryPipelineLayoutOffsets offsets = GetBinaryPipelineLayoutOffsets(header);
+    if (offsets.end != header.size || header.stringTableSize == 0)
+        return false;
+
+    /* String table must start with the empty string and end with a null terminator, so every offset within the table refers to a null-terminated string */
+    const char* stringTable = data + offsets.stringTable;
+    if (stringTable[0] != '\0' || stringTable[header.stringTableSize - 1] != '\0')
+        return false;
+
+    /* Validate all name offsets */
+    const std::uint32_t stringTableSize = header.stringTableSize;
+
+    auto IsBindingValid = [stringTableSize](const BinaryBinding& record) -> bool
+    {
+        return (record.name < stringTableSize);
+    };
+    auto IsStaticSamplerValid = [stringTableSize](const BinaryStaticSampler& record) -> bool
+    {
+        return (record.name < stringTableSize);
+    };
+    auto IsUniformValid = [stringTableSize](const BinaryUniform& record) -> bool
+    {
+        return (record.name < stringTableSize);
+    };
+    auto IsCombinedTextureSamplerValid = [stringTableSize](const BinaryCombinedTextureSampler& record) -> bool
+    {
+        return (record.name < stringTableSize && record.textureName < stringTableSize && record.samplerName < stringTableSize);
+    };
+
+    return
+    (
+        AreBinaryRecordsValid<BinaryBinding>(data, offsets.heapBindings, header.numHeapBindings, IsBindingValid)                                                             &&
+        AreBinaryRecordsValid<BinaryBinding>(data, offsets.bindings, header.numBindings, IsBindingValid)                                                                     &&
+        AreBinaryRecordsValid<BinaryStaticSampler>(data, offsets.staticSamplers, header.numStaticSamplers, IsStaticSamplerValid)                                             &&
+        AreBinaryRecordsValid<BinaryUniform>(data, offsets.uniforms, header.numUniforms, IsUniformValid)                                                                     &&
+        AreBinaryRecordsValid<BinaryCombinedTextureSampler>(data, offsets.combinedTextureSamplers, header.numCombinedTextureSamplers, IsCombinedTextureSamplerValid)
+    );
+}
+
+PipelineLayoutBinaryView::PipelineLayoutBinaryView(const void* data, std::size_t dataSize)
+{
+    if (IsBinaryPipelineLayoutValid(reinterpret_cast<const char*>(data), dataSize))
+        data_ = reinterpret_cast<const char*>(data);
+}
+
+bool PipelineLayoutBinaryView::IsValid() const
+{
+    return (data_ != nullptr);
+}
+
+static const BinaryPipelineLayoutHeader& GetBinaryHeader(const char* data)
+{
+    return *reinterpret_cast<const BinaryPipelineLayoutHeader*>(data);
+}
+
+std::uint32_t PipelineLayoutBinaryView::GetNumHeapBindings() const
+{
+    return (data_ != nullptr ? GetBinaryHeader(data_).numHeapBindings : 0);
+}
+
+std::uint32_t PipelineLayoutBinaryView::GetNumBindings() const
+{
+    return (data_ != nullptr ? GetBinaryHeader(data_).numBindings : 0);
+}
+
+std::uint32_t PipelineLayoutBinaryView::GetNumStaticSamplers() const
+{
+    return (data_ != nullptr ? GetBinaryHeader(data_).numStaticSamplers : 0);
+}
+
+std::uint32_t PipelineLayoutBinaryView::GetNumUniforms() const
+{
+    return (data_ != nullptr ? GetBinaryHeader(data_).numUniforms : 0);
+}
+
+std::uint32_t PipelineLayoutBinaryView::GetNumCombinedTextureSamplers() const
+{
+    return (data_ != nullptr ? GetBinaryHeader(data_).numCombinedTextureSamplers : 0);
+}
+
+long PipelineLayoutBinaryView::GetBarrierFlags() const
+{
+    return (data_ != nullptr ? static_cast<long>(GetBinaryHeader(data_).barrierFlags) : 0);
+}
+
+template <typename TRecord>
+const TRecord& GetBinaryRecord(const char* data, std::uint64_t offset, std::uint32_t index)
+{
+    return reinterpret_cast<const TRecord*>(data + offset)[index];
+}
+
+static StringLiteral GetBinaryName(const char* data, std::uint32_t name)
+{
+    /* Refer to the string table without copying the string */
+    return StringLiteral{ data + GetBinaryPipelineLayoutOffsets(GetBinaryHeader(data)).stringTable + name };
+}
+
+static BindingDescriptor DecodeBinaryBinding(const char* data, const BinaryBinding& src)
+{
+    BindingDescriptor dst;
+    {
+        dst.name        = GetBinaryName(data, src.name);
+        dst.type        = static_cast<ResourceType>(src.type);
+        dst.bindFlags   = static_cast<long>(src.bindFlags);
+        dst.stageFlags  = static_cast<long>(src.stageFlags);
+        dst.slot.index  = src.slotIndex;
+        dst.slot.set    = src.slotSet;
+        dst.arraySize   = src.arraySize;
+    }
+    return dst;
+}
+
+BindingDescriptor PipelineLayoutBinaryView::GetHeapBinding(std::uint32_t index) const
+{
+    LLGL_ASSERT_UPPER_BOUND(index, GetNumHeapBindings());
+    const BinaryPipelineLayoutOffsets offsets = GetBinaryPipelineLayoutOffsets(GetBinaryHeader(data_));
+    return DecodeBinaryBinding(data_, GetBinaryRecord<BinaryBinding>(data_, offsets.heapBindings, index));
+}
+
+BindingDescriptor PipelineLayoutBinaryView::GetBinding(std::uint32_t index) const
+{
+    LLGL_ASSERT_UPPER_BOUND(index, GetNumBindings());
+    const BinaryPipelineLayoutOffsets offsets = GetBinaryPipelineLayoutOffsets(GetBinaryHeader(data_));
+    return DecodeBinaryBinding(data_, GetBinaryRecord<BinaryBinding>(data_, offsets.bindings, index));
+}
+
+StaticSamplerDescriptor PipelineLayoutBinaryView::GetStaticSampler(std::uint32_t index) const
+{
+    LLGL_ASSERT_UPPER_BOUND(index, GetNumStaticSamplers());
+    const BinaryPipelineLayoutOffsets offsets = GetBinaryPipelineLayoutOffsets(GetBinaryHeader(data_));
+    const BinaryStaticSampler& src = GetBinaryRecord<BinaryStaticSampler>(data_, offsets.staticSamplers, index);
+
+    StaticSamplerDescriptor dst;
+    {
+        dst.name        = GetBinaryName(data_, src.name);
+        dst.stageFlags  = static_cast<long>(src.stageFlags);
+        dst.slot.index  = src.slotIndex;
+        dst.slot.set    = src.slotSet;
+        DecodeBinarySampler(dst.sampler, src.sampler);
+    }
+    return dst;
+}
+
+UniformDescriptor PipelineLayoutBinaryView::GetUniform(std::uint32_t index) const
+{
+    LLGL_ASSERT_UPPER_BOUND(index, GetNumUniforms());
+    const BinaryPipelineLayoutOffsets offsets = GetBinaryPipelineLayoutOffsets(GetBinaryHeader(data_));
+    const BinaryUniform& src = GetBinaryRecord<BinaryUniform>(data_, offsets.uniforms, index);
+
+    UniformDescriptor dst;
+    {
+        dst.name        = GetBinaryName(data_, src.name);
+        dst.type        = static_cast<UniformType>(src.type);
+        dst.arraySize   = src.arraySize;
+    }
+    return dst;
+}
+
+CombinedTextureSamplerDescriptor PipelineLayoutBinaryView::GetCombinedTextureSampler(std::uint32_t index) const
+{
+    LLGL_ASSERT_UPPER_BOUND(index, GetNumCombinedTextureSamplers());
+    const BinaryPipelineLayoutOffsets offsets = GetBinaryPipelineLayoutOffsets(GetBinaryHeader(data_));
+    const BinaryCombinedTextureSampler& src = GetBinaryRecord<BinaryCombinedTextureSampler>(data_, offsets.combinedTextureSamplers, index);
+
+    CombinedTextureSamplerDescriptor dst;
+    {
+        dst.name        = GetBinaryName(data_, src.name);
+        dst.textureName = GetBinaryName(data_, src.textureName);
+        dst.samplerName = GetBinaryName(data_, src.samplerName);
+        dst.slot.index  = src.slotIndex;
+        dst.slot.set    = src.slotSet;
+    }
+    return dst;
+}
+
+// Replaces the specified name by a managed copy of itself.
+static void CopyBinaryName(StringLiteral& name)
+{
+    if (!name.empty())
+        name = StringLiteral{ name.c_str(), /*isManaged:*/ true };
+}
+
+void PipelineLayoutBinaryView::Decode(PipelineLayoutDescriptor& outPipelineLayoutDesc, bool copyNames) const
+{
+    outPipelineLayoutDesc.heapBindings.resize(GetNumHeapBindings());
+    for_range(i, outPipelineLayoutDesc.heapBindings.size())
+    {
+        BindingDescriptor& dst = outPipelineLayoutDesc.heapBindings[i];
+        dst = GetHeapBinding(static_cast<std::uint32_t>(i));
+        if (copyNames)
+            CopyBinaryName(dst.name);
+    }
+
+    outPipelineLayoutDesc.bindings.resize(GetNumBindings());
+    for_range(i, outPipelineLayoutDesc.bindings.size())
+    {
+        BindingDescriptor& dst = outPipelineLayoutDesc.bindings[i];
+        dst = GetBinding(static_cast<std::uint32_t>(i));
+        if (copyNames)
+            CopyBinaryName(dst.name);
+    }
+
+    outPipelineLayoutDesc.staticSamplers.resize(GetNumStaticSamplers());
+    for_range(i, outPipelineLayoutDesc.staticSamplers.size())
+    {
+        StaticSamplerDescriptor& dst = outPipelineLayoutDesc.staticSamplers[i];
+        dst = GetStaticSampler(static_cast<std::uint32_t>(i));
+        if (copyNames)
+            CopyBinaryName(dst.name);
+    }
+
+    outPipelineLayoutDesc.uniforms.resize(GetNumUniforms());
+    for_range(i, outPipelineLayoutDesc.uniforms.size())
+    {
+        UniformDescriptor& dst = outPipelineLayoutDesc.uniforms[i];
+        dst = GetUniform(static_cast<std::uint32_t>(i));
+        if (copyNames)
+            CopyBinaryName(dst.name);
+    }
+
+    outPipelineLayoutDesc.combinedTextureSamplers.resize(GetNumCombinedTextureSamplers());
+    for_range(i, outPipelineLayoutDesc.combinedTextureSamplers.size())
+    {
+        CombinedTextureSamplerDescriptor& dst = outPipelineLayoutDesc.combinedTextureSamplers[i];
+        dst = GetCombinedTextureSampler(static_cast<std::uint32_t>(i));
+        if (copyNames)
+        {
+            CopyBinaryName(dst.name);
+            CopyBinaryName(dst.textureName);
+            CopyBinaryName(dst.samplerName);
+        }
+    }
+
+    outPipelineLayoutDesc.barrierFlags = GetBarrierFlags();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
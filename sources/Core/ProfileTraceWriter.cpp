@@ -0,0 +1,325 @@
+/*
+ * ProfileTraceWriter.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/ProfileTraceWriter.h>
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/Timer.h>
+#include "StringUtils.h"
+#include <fstream>
+#include <string>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal functions
+ */
+
+template <typename TRecord>
+struct ProfileCounterField
+{
+    const char*                 name;
+    std::uint32_t TRecord::*    member;
+};
+
+#define LLGL_PROFILE_COUNTER_FIELD(RECORD, NAME) \
+    { #NAME, &RECORD::NAME }
+
+static const ProfileCounterField<ProfileCommandQueueRecord> g_commandQueueCounters[] =
+{
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandQueueRecord, bufferWrites),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandQueueRecord, bufferReads),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandQueueRecord, bufferMappings),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandQueueRecord, textureWrites),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandQueueRecord, textureReads),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandQueueRecord, commandBufferSubmittions),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandQueueRecord, fenceSubmissions),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandQueueRecord, transferSubmissions),
+};
+
+static const ProfileCounterField<ProfileCommandBufferRecord> g_commandBufferCounters[] =
+{
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandBufferRecord, encodings),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandBufferRecord, mipMapsGenerations),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandBufferRecord, vertexBufferBindings),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandBufferRecord, indexBufferBindings),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandBufferRecord, constantBufferBindings),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandBufferRecord, sampledBufferBindings),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandBufferRecord, storageBufferBindings),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandBufferRecord, sampledTextureBindings),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandBufferRecord, storageTextureBindings),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandBufferRecord, samplerBindings),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandBufferRecord, resourceHeapBindings),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandBufferRecord, graphicsPipelineBindings),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandBufferRecord, computePipelineBindings),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandBufferRecord, attachmentClears),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandBufferRecord, bufferUpdates),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandBufferRecord, bufferCopies),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandBufferRecord, bufferFills),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandBufferRecord, textureCopies),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandBufferRecord, renderPassSections),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandBufferRecord, streamOutputSections),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandBufferRecord, querySections),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandBufferRecord, renderConditionSections),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandBufferRecord, drawCommands),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandBufferRecord, dispatchCommands),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandBufferRecord, descriptorSetCacheHits),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandBufferRecord, descriptorSetCacheMisses),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandBufferRecord, encodingStalls),
+    LLGL_PROFILE_COUNTER_FIELD(ProfileCommandBufferRecord, eliminatedCommands),
+};
+
+#undef LLGL_PROFILE_COUNTER_FIELD
+
+static void AppendFormat(std::string& s, const char* format, ...)
+{
+    LLGL_STRING_PRINTF(s, format);
+}
+
+// Appends the specified string with JSON escape sequences.
+static void AppendJsonString(std::string& s, const char* str)
+{
+    s += '\"';
+    for (; str != nullptr && *str != '\0'; ++str)
+    {
+        const char c = *str;
+        switch (c)
+        {
+            case '\"':  s += "\\\"";    break;
+            case '\\':  s += "\\\\";    break;
+            case '\n':  s += "\\n";     break;
+            case '\r':  s += "\\r";     break;
+            case '\t':  s += "\\t";     break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                    AppendFormat(s, "\\u%04x", static_cast<unsigned>(c));
+                else
+                    s += c;
+                break;
+        }
+    }
+    s += '\"';
+}
+
+template <typename TRecord, std::size_t N>
+static void AppendCounterArgs(std::string& s, const TRecord& record, const ProfileCounterField<TRecord> (&fields)[N])
+{
+    s += '{';
+    for_range(i, N)
+    {
+        if (i > 0)
+            s += ',';
+        AppendFormat(s, "\"%s\":%u", fields[i].name, record.*(fields[i].member));
+    }
+    s += '}';
+}
+
+// Returns the filename of the specified trace file index, e.g. "Trace.1.json" for "Trace.json".
+static std::string GetIndexedFilename(const std::string& filename, std::uint32_t fileIndex)
+{
+    const std::size_t pathPos = filename.find_last_of("/\\");
+    const std::size_t extPos = filename.find_last_of('.');
+    const std::string index = '.' + std::to_string(fileIndex);
+
+    if (extPos == std::string::npos || (pathPos != std::string::npos && extPos < pathPos))
+        return filename + index;
+    else
+        return filename.substr(0, extPos) + index + filename.substr(extPos);
+}
+
+
+/*
+ * ProfileTraceWriter::Pimpl struct
+ */
+
+struct ProfileTraceWriter::Pimpl
+{
+    std::string     filename;
+    std::uint32_t   framesPerFile       = 0;
+    std::uint32_t   fileIndex           = 0;
+    std::uint32_t   fileFrames          = 0;
+    std::uint64_t   numFrames           = 0;
+    std::uint64_t   ticksBase           = 0;
+    double          ticksToMicroseconds = 0.0;
+    std::ofstream   file;
+    std::string     buffer;             // Event buffer of a single frame, which is reused to avoid frequent allocations
+
+    bool OpenNextFile();
+    void CloseFile();
+
+    // Converts the specified CPU ticks into microseconds relative to the beginning of the first frame.
+    double TicksToTimestamp(std::uint64_t ticks) const;
+
+    void AppendFrameEvents(const FrameProfile& frameProfile);
+};
+
+bool ProfileTraceWriter::Pimpl::OpenNextFile()
+{
+    /* Only append file index if frames are distributed across multiple files */
+    const std::string currentFilename = (framesPerFile == 0 && fileIndex == 0 ? filename : GetIndexedFilename(filename, fileIndex));
+    ++fileIndex;
+
+    file.open(currentFilename, std::ios::out | std::ios::trunc);
+    if (!file.good())
+        return false;
+
+    /* Write header with process and thread names as metadata events */
+    file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+    file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"LLGL\"}},\n";
+    file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"CommandBuffer\"}}";
+
+    fileFrames = 0;
+
+    return file.good();
+}
+
+void ProfileTraceWriter::Pimpl::CloseFile()
+{
+    if (file.is_open())
+    {
+        file << "\n]}\n";
+        file.close();
+    }
+}
+
+double ProfileTraceWriter::Pimpl::TicksToTimestamp(std::uint64_t ticks) const
+{
+    /* Records of later frames might precede the first frame, e.g. with multiple command queues, so the relative ticks must be signed */
+    const std::int64_t relativeTicks = static_cast<std::int64_t>(ticks - ticksBase);
+    return static_cast<double>(relativeTicks) * ticksToMicroseconds;
+}
+
+void ProfileTraceWriter::Pimpl::AppendFrameEvents(const FrameProfile& frameProfile)
+{
+    /* Frame begins with its earliest time record; fall back to the current time if time recording is disabled */
+    std::uint64_t frameTicks = 0;
+    if (frameProfile.timeRecords.empty())
+        frameTicks = Timer::Tick();
+    else
+    {
+        frameTicks = frameProfile.timeRecords.front().cpuTicksStart;
+        for (const ProfileTimeRecord& rec : frameProfile.timeRecords)
+            frameTicks = std::min(frameTicks, rec.cpuTicksStart);
+    }
+
+    if (numFrames == 0)
+        ticksBase = frameTicks;
+
+    const double frameTimestamp = TicksToTimestamp(frameTicks);
+
+    /* Append instant event to mark the beginning of this frame */
+    AppendFormat(
+        buffer,
+        ",\n{\"name\":\"Frame\",\"ph\":\"i\",\"s\":\"p\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"args\":{\"frame\":%llu}}",
+        frameTimestamp, static_cast<unsigned long long>(numFrames)
+    );
+
+    /* Append complete event for each time record; the trace viewer nests them by their time range */
+    for (const ProfileTimeRecord& rec : frameProfile.timeRecords)
+    {
+        const std::uint64_t cpuTicksEnd = std::max(rec.cpuTicksStart, rec.cpuTicksEnd);
+        buffer += ",\n{\"name\":";
+        AppendJsonString(buffer, rec.annotation);
+        AppendFormat(
+            buffer,
+            ",\"cat\":\"LLGL\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f,\"args\":",
+            TicksToTimestamp(rec.cpuTicksStart),
+            static_cast<double>(cpuTicksEnd - rec.cpuTicksStart) * ticksToMicroseconds
+        );
+
+        /* Don't report a GPU time for records whose query results could not be resolved */
+        if (rec.resolveLatency == LLGL_UNRESOLVED_LATENCY)
+            buffer += "{\"gpuTimeNs\":null,\"resolveLatency\":null}}";
+        else
+        {
+            AppendFormat(
+                buffer,
+                "{\"gpuTimeNs\":%llu,\"resolveLatency\":%u}}",
+                static_cast<unsigned long long>(rec.elapsedTime),
+                rec.resolveLatency
+            );
+        }
+    }
+
+    /* Append counter events for command queue and command buffer records */
+    AppendFormat(buffer, ",\n{\"name\":\"CommandQueue\",\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"args\":", frameTimestamp);
+    AppendCounterArgs(buffer, frameProfile.commandQueueRecord, g_commandQueueCounters);
+    buffer += '}';
+
+    AppendFormat(buffer, ",\n{\"name\":\"CommandBuffer\",\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"args\":", frameTimestamp);
+    AppendCounterArgs(buffer, frameProfile.commandBufferRecord, g_commandBufferCounters);
+    buffer += '}';
+}
+
+
+/*
+ * ProfileTraceWriter class
+ */
+
+ProfileTraceWriter::ProfileTraceWriter(const char* filename, std::uint32_t framesPerFile) :
+    pimpl_ { new Pimpl{} }
+{
+    pimpl_->filename            = (filename != nullptr ? filename : "");
+    pimpl_->framesPerFile       = framesPerFile;
+    pimpl_->ticksToMicroseconds = 1000000.0 / static_cast<double>(Timer::Frequency());
+    pimpl_->OpenNextFile();
+}
+
+ProfileTraceWriter::~ProfileTraceWriter()
+{
+    pimpl_->CloseFile();
+    delete pimpl_;
+}
+
+bool ProfileTraceWriter::WriteFrame(const FrameProfile& frameProfile)
+{
+    /* Switch to next file if the current one is complete */
+    if (pimpl_->framesPerFile > 0 && pimpl_->fileFrames >= pimpl_->framesPerFile)
+        pimpl_->CloseFile();
+
+    if (!pimpl_->file.is_open())
+    {
+        if (!pimpl_->OpenNextFile())
+            return false;
+    }
+
+    /* Write all events of this frame at once and flush them, so a trace remains usable if the application terminates unexpectedly */
+    pimpl_->buffer.clear();
+    pimpl_->AppendFrameEvents(frameProfile);
+    pimpl_->file.write(pimpl_->buffer.data(), static_cast<std::streamsize>(pimpl_->buffer.size()));
+    pimpl_->file.flush();
+
+    ++pimpl_->fileFrames;
+    ++pimpl_->numFrames;
+
+    return pimpl_->file.good();
+}
+
+void ProfileTraceWriter::Close()
+{
+    pimpl_->CloseFile();
+}
+
+bool ProfileTraceWriter::IsOpen() const
+{
+    return pimpl_->file.is_open();
+}
+
+std::uint64_t ProfileTraceWriter::GetNumFrames() const
+{
+    return pimpl_->numFrames;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,54 @@
+/*
+ * SIMD.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_SIMD_H
+#define LLGL_SIMD_H
+
+
+/*
+Selects the SIMD instruction sets the compiler was configured for.
+There is no runtime CPU dispatch: the fast paths are only enabled when the respective instruction set
+is part of the compile target, e.g. via "-mavx2" for GCC/Clang or "/arch:AVX2" for MSVC.
+*/
+
+#if defined __AVX2__
+#   define LLGL_SIMD_AVX2
+#endif
+
+#if defined __SSSE3__ || defined __AVX__
+#   define LLGL_SIMD_SSSE3
+#endif
+
+#if defined __SSE2__ || defined _M_X64 || defined _M_AMD64 || (defined _M_IX86_FP && _M_IX86_FP >= 2)
+#   define LLGL_SIMD_SSE2
+#endif
+
+#if defined __ARM_NEON || defined __ARM_NEON__
+#   define LLGL_SIMD_NEON
+#   if defined __aarch64__ || defined _M_ARM64
+#       define LLGL_SIMD_NEON_A64
+#   endif
+#endif
+
+#if defined LLGL_SIMD_AVX2
+#   include <immintrin.h>
+#elif defined LLGL_SIMD_SSSE3
+#   include <tmmintrin.h>
+#elif defined LLGL_SIMD_SSE2
+#   include <emmintrin.h>
+#endif
+
+#if defined LLGL_SIMD_NEON
+#   include <arm_neon.h>
+#endif
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,27 @@
+/*
+ * CommandQueue.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/CommandQueue.h>
+
+
+namespace LLGL
+{
+
+
+void CommandQueue::Submit(const ArrayView<CommandBuffer*>& commandBuffers)
+{
+    /* Submit command buffers one after another by default; backends that can batch submissions override this */
+    for (CommandBuffer* commandBuffer : commandBuffers)
+        Submit(*commandBuffer);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -80,6 +80,7 @@ DbgCommandBuffer::DbgCommandBuffer(
     CommandBuffer&                  commandBufferInstance,
     FrameProfile&                   commonProfile,
     RenderingDebugger*              debugger,
+    RenderingDebugger*              profiler,
     const CommandBufferDescriptor&  desc,
     const RenderingCapabilities&    caps)
 :
@@ -87,6 +88,7 @@ DbgCommandBuffer::DbgCommandBuffer(
     desc            { desc                                                              },
     label           { LLGL_DBG_LABEL(desc)                                              },
     debugger_       { debugger                                                          },
+    profiler_       { profiler                                                          },
     commonProfile_  { commonProfile                                                     },
     features_       { caps.features                                                     },
     limits_         { caps.limits                                                       },
@@ -108,7 +110,7 @@ void DbgCommandBuffer::Begin()
     ResetRecords();
 
     /* Enable performance timer if it was scheduled */
-    perfProfilerEnabled_ = (debugger_ != nullptr && debugger_->GetTimeRecording());
+    perfProfilerEnabled_ = (profiler_ != nullptr && profiler_->GetTimeRecording());
     if (perfProfilerEnabled_)
         queryTimerPool_.Reset();
 
@@ -131,8 +133,11 @@ void DbgCommandBuffer::End()
     LLGL_DBG_END_TIMER();
     instance.End();
 
-    /* Resolve timer query results for performance profiler */
-    if (perfProfilerEnabled_)
+    /*
+    Take timer query results of previous encodings for performance profiler.
+    This is also done when time recording has been disabled in the meantime, so pending records are not lost.
+    */
+    if (profiler_ != nullptr)
         queryTimerPool_.TakeRecords(profile_.timeRecords);
 
     if ((desc.flags & CommandBufferFlags::ImmediateSubmit) != 0)
@@ -1313,9 +1318,12 @@ void DbgCommandBuffer::PushDebugGroup(const char* name)
     if (!name)
         name = "<null pointer>";
 
-    debugGroups_.push(name);
+    /* Debug group names are only needed for validation reports */
+    if (debugger_)
+        debugGroups_.push(name);
 
-    LLGL_DBG_START_TIMER("PushDebugGroup");
+    /* Time records only store their annotation pointer, so the name is interned until these records have been flushed */
+    LLGL_DBG_START_TIMER(queryTimerPool_.InternAnnotation(name));
     instance.PushDebugGroup(name);
 }
 
@@ -1324,10 +1332,9 @@ void DbgCommandBuffer::PopDebugGroup()
     instance.PopDebugGroup();
     LLGL_DBG_END_TIMER();
 
-    debugGroups_.pop();
-
     if (LLGL_DBG_SOURCE())
     {
+        debugGroups_.pop();
         if (debugGroups_.empty())
             debugger_->SetDebugGroup(nullptr);
         else
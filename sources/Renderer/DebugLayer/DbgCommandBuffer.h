@@ -51,6 +51,7 @@ class DbgCommandBuffer final : public CommandBuffer
             CommandBuffer&                  commandBufferInstance,
             FrameProfile&                   commonProfile,
             RenderingDebugger*              debugger,
+            RenderingDebugger*              profiler,
             const CommandBufferDescriptor&  desc,
             const RenderingCapabilities&    caps
         );
@@ -218,7 +219,8 @@ class DbgCommandBuffer final : public CommandBuffer
 
         /* ----- Common objects ----- */
 
-        RenderingDebugger*          debugger_               = nullptr;
+        RenderingDebugger*          debugger_               = nullptr; // Null if validation is disabled
+        RenderingDebugger*          profiler_               = nullptr; // Enables time recording, even if validation is disabled
         FrameProfile&               commonProfile_;
 
         const RenderingFeatures&    features_;
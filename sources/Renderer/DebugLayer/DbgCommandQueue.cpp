@@ -43,6 +43,40 @@ void DbgCommandQueue::Submit(CommandBuffer& commandBuffer)
     profile_.commandQueueRecord.commandBufferSubmittions++;
 }
 
+void DbgCommandQueue::Submit(const ArrayView<CommandBuffer*>& commandBuffers)
+{
+    if (LLGL_DBG_SOURCE())
+    {
+        /* Don't forward a batch with invalid entries, since neither the backend nor the profile merge below can handle them */
+        if (!ValidateSubmitBatch(commandBuffers))
+            return;
+    }
+
+    /* Forward the entire batch to the backend, so it can be submitted at once */
+    batchInstances_.clear();
+    batchInstances_.reserve(commandBuffers.size());
+
+    for (CommandBuffer* commandBuffer : commandBuffers)
+    {
+        auto* commandBufferDbg = LLGL_CAST(DbgCommandBuffer*, commandBuffer);
+        batchInstances_.push_back(&(commandBufferDbg->instance));
+    }
+
+    instance.Submit(batchInstances_);
+
+    /* Merge frame profile values of all command buffers into rendering profiler */
+    for (CommandBuffer* commandBuffer : commandBuffers)
+    {
+        auto* commandBufferDbg = LLGL_CAST(DbgCommandBuffer*, commandBuffer);
+
+        FrameProfile profile;
+        commandBufferDbg->FlushProfile(profile);
+
+        RenderingDebugger::MergeProfiles(profile_, profile);
+        profile_.commandQueueRecord.commandBufferSubmittions++;
+    }
+}
+
 /* ----- Queries ----- */
 
 bool DbgCommandQueue::QueryResult(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, void* data, std::size_t dataSize)
@@ -78,6 +112,39 @@ void DbgCommandQueue::WaitIdle()
  * ======= Private: =======
  */
 
+bool DbgCommandQueue::ValidateSubmitBatch(const ArrayView<CommandBuffer*>& commandBuffers)
+{
+    bool isValid = true;
+
+    /* Validate all command buffers before any of them is submitted, since the batch is submitted as a unit */
+    for_range(i, commandBuffers.size())
+    {
+        if (commandBuffers[i] == nullptr)
+        {
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "null pointer passed for command buffer [%zu] in batch submission", i);
+            isValid = false;
+            continue;
+        }
+
+        auto* commandBufferDbg = LLGL_CAST(DbgCommandBuffer*, commandBuffers[i]);
+        commandBufferDbg->ValidateSubmit();
+
+        for_range(j, i)
+        {
+            if (commandBuffers[j] == commandBuffers[i])
+            {
+                LLGL_DBG_ERROR(
+                    ErrorType::InvalidArgument,
+                    "command buffer [%zu] occurs more than once in batch submission; first occurrence at [%zu]", i, j
+                );
+                break;
+            }
+        }
+    }
+
+    return isValid;
+}
+
 void DbgCommandQueue::ValidateQueryResult(
     DbgQueryHeap&   queryHeap,
     std::uint32_t   firstQuery,
@@ -11,6 +11,7 @@
 
 #include <LLGL/CommandQueue.h>
 #include <LLGL/RenderingDebugger.h>
+#include <vector>
 
 
 namespace LLGL
@@ -18,6 +19,7 @@ namespace LLGL
 
 
 class DbgQueryHeap;
+class DbgCommandBuffer;
 
 class DbgCommandQueue final : public CommandQueue
 {
@@ -26,6 +28,8 @@ class DbgCommandQueue final : public CommandQueue
 
         #include <LLGL/Backend/CommandQueue.inl>
 
+        void Submit(const ArrayView<CommandBuffer*>& commandBuffers) override;
+
     public:
 
         DbgCommandQueue(CommandQueue& instance, FrameProfile& profile, RenderingDebugger* debugger);
@@ -36,6 +40,9 @@ class DbgCommandQueue final : public CommandQueue
 
     private:
 
+        // Returns false if the batch contains null pointers and must not be submitted.
+        bool ValidateSubmitBatch(const ArrayView<CommandBuffer*>& commandBuffers);
+
         void ValidateQueryResult(
             DbgQueryHeap&   queryHeap,
             std::uint32_t   firstQuery,
@@ -46,8 +53,10 @@ class DbgCommandQueue final : public CommandQueue
 
     private:
 
-        RenderingDebugger*  debugger_ = nullptr;
-        FrameProfile&       profile_;
+        RenderingDebugger*              debugger_ = nullptr;
+        FrameProfile&                   profile_;
+
+        std::vector<CommandBuffer*>     batchInstances_;
 
 };
 
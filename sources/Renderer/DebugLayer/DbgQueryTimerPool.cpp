@@ -13,28 +13,18 @@
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Timer.h>
 #include <thread>
+#include <algorithm>
 
 
 namespace LLGL
 {
 
 
+// Number of queries per heap
 static constexpr std::uint32_t g_queryTimerHeapSize = 64;
 
-struct DbgQueryTimerIndices
-{
-    std::uint32_t heapIndex;
-    std::uint32_t queryIndex;
-};
-
-static DbgQueryTimerIndices GetQueryForRecord(std::size_t recordIndex)
-{
-    return DbgQueryTimerIndices
-    {
-        static_cast<std::uint32_t>(recordIndex / g_queryTimerHeapSize),
-        static_cast<std::uint32_t>(recordIndex % g_queryTimerHeapSize)
-    };
-}
+// Number of encodings whose query results can be in flight before the oldest one must be resolved
+static constexpr std::size_t g_queryTimerRingSize = 4;
 
 DbgQueryTimerPool::DbgQueryTimerPool(
     RenderSystem&   renderSystemInstance,
@@ -43,99 +33,217 @@ DbgQueryTimerPool::DbgQueryTimerPool(
 :
     renderSystem_  { renderSystemInstance  },
     commandQueue_  { commandQueueInstance  },
-    commandBuffer_ { commandBufferInstance }
+    commandBuffer_ { commandBufferInstance },
+    batches_       { g_queryTimerRingSize  }
 {
 }
 
 void DbgQueryTimerPool::Reset()
 {
     LLGL_ASSERT(pendingRecordStack_.empty(), "unbalanced calls to Start()/Stop() in query timer pool");
-    records_.clear();
-    currentQuery_       = 0;
-    currentQueryHeap_   = 0;
-    cpuTicksBase_       = Timer::Tick();
+
+    /* Move on to the next batch in the ring */
+    currentBatch_ = (currentBatch_ + 1) % batches_.size();
+    Batch& batch = batches_[currentBatch_];
+
+    /*
+    If this batch has not been taken yet, it was recorded several encodings ago and its results are most likely available by now.
+    Resolve it with a bounded wait and keep its records until the next call to TakeRecords().
+    If the wait times out, the records are flagged as unresolved since their queries are about to be reused.
+    */
+    if (batch.pending)
+    {
+        if (!ResolveBatch(batch, true))
+            InvalidateBatch(batch);
+        FlushBatch(batch, resolvedRecords_, resolvedAnnotations_);
+    }
+
+    batch.encoding = encodingCounter_;
 }
 
 void DbgQueryTimerPool::Start(const char* annotation)
 {
-    pendingRecordStack_.push(records_.size());
+    Batch& batch = batches_[currentBatch_];
 
-    /* Store annotation only first */
+    /* End the segment of the enclosing record, so only a single query is active at a time */
+    if (!pendingRecordStack_.empty())
+        EndSegment();
+
+    pendingRecordStack_.push(batch.records.size());
+
+    /* Store annotation only first; this record starts with the next segment */
     ProfileTimeRecord record;
     {
         record.annotation       = annotation;
-        record.cpuTicksStart    = Timer::Tick() - cpuTicksBase_;
+        record.cpuTicksStart    = Timer::Tick();
+    }
+    batch.records.push_back(record);
+    batch.recordSegments.push_back(batch.numSegments);
+    batch.recordSegments.push_back(batch.numSegments);
+    batch.pending = true;
+
+    BeginSegment();
+}
+
+const char* DbgQueryTimerPool::InternAnnotation(const char* annotation)
+{
+    Batch& batch = batches_[currentBatch_];
+    return batch.annotations.insert(annotation).first->c_str();
+}
+
+void DbgQueryTimerPool::Stop()
+{
+    Batch& batch = batches_[currentBatch_];
+
+    EndSegment();
+
+    /* Get index to the current pending record */
+    const std::size_t recordIndex = pendingRecordStack_.top();
+    pendingRecordStack_.pop();
+
+    /* Record CPU ticks and last segment at end */
+    batch.records[recordIndex].cpuTicksEnd = Timer::Tick();
+    batch.recordSegments[recordIndex * 2 + 1] = batch.numSegments;
+
+    /* Continue measuring the enclosing record */
+    if (!pendingRecordStack_.empty())
+        BeginSegment();
+}
+
+void DbgQueryTimerPool::TakeRecords(DynamicVector<ProfileTimeRecord>& outRecords)
+{
+    /* Release annotations of previously taken records, which have been flushed by now, and take over those of the already resolved records */
+    takenAnnotations_ = std::move(resolvedAnnotations_);
+    resolvedAnnotations_.clear();
+
+    /* Take records that have already been resolved when their batch was reused */
+    if (!resolvedRecords_.empty())
+    {
+        outRecords.insert(outRecords.end(), resolvedRecords_.begin(), resolvedRecords_.end());
+        resolvedRecords_.clear();
     }
-    records_.push_back(record);
 
-    /* Check if end of query heap has been reached */
-    if (currentQuery_ == g_queryTimerHeapSize)
+    /* Take records of previous encodings from oldest to newest until the first batch whose results are not available yet */
+    for_range(i, batches_.size())
     {
-        currentQuery_ = 0;
-        ++currentQueryHeap_;
+        Batch& batch = batches_[(currentBatch_ + 1 + i) % batches_.size()];
+        if (!batch.pending || batch.encoding == encodingCounter_)
+            continue;
+        if (!ResolveBatch(batch, false))
+            break;
+        FlushBatch(batch, outRecords, takenAnnotations_);
     }
 
+    ++encodingCounter_;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void DbgQueryTimerPool::BeginSegment()
+{
+    Batch& batch = batches_[currentBatch_];
+
     /* Check if new query heap must be created */
-    if (currentQueryHeap_ == queryHeaps_.size())
+    const std::uint32_t heapIndex = batch.numSegments / g_queryTimerHeapSize;
+    if (heapIndex == batch.queryHeaps.size())
     {
         QueryHeapDescriptor queryDesc;
         {
             queryDesc.type          = QueryType::TimeElapsed;
             queryDesc.numQueries    = g_queryTimerHeapSize;
         }
-        queryHeaps_.push_back(renderSystem_.CreateQueryHeap(queryDesc));
+        batch.queryHeaps.push_back(renderSystem_.CreateQueryHeap(queryDesc));
     }
 
     /* Begin timer query */
-    commandBuffer_.BeginQuery(*queryHeaps_[currentQueryHeap_], currentQuery_);
-    ++currentQuery_;
+    commandBuffer_.BeginQuery(*batch.queryHeaps[heapIndex], batch.numSegments % g_queryTimerHeapSize);
 }
 
-void DbgQueryTimerPool::Stop()
+void DbgQueryTimerPool::EndSegment()
 {
-    /* Get index to the current pending record */
-    const std::size_t recordIndex = pendingRecordStack_.top();
-    pendingRecordStack_.pop();
-    ProfileTimeRecord& rec = records_[recordIndex];
-
-    /* Record CPU ticks at end */
-    rec.cpuTicksEnd = Timer::Tick() - cpuTicksBase_;
+    Batch& batch = batches_[currentBatch_];
 
-    /* Stop timer query */
-    const DbgQueryTimerIndices indices = GetQueryForRecord(recordIndex);
-    commandBuffer_.EndQuery(*queryHeaps_[indices.heapIndex], indices.queryIndex);
+    /* End timer query */
+    commandBuffer_.EndQuery(*batch.queryHeaps[batch.numSegments / g_queryTimerHeapSize], batch.numSegments % g_queryTimerHeapSize);
+    ++batch.numSegments;
 }
 
-void DbgQueryTimerPool::TakeRecords(DynamicVector<ProfileTimeRecord>& outRecords)
+bool DbgQueryTimerPool::ResolveBatch(Batch& batch, bool wait)
 {
-    ResolveQueryResults();
-    outRecords = std::move(records_);
-}
+    if (batch.numSegments == 0)
+        return true;
 
+    /* Segments are resolved as prefix sums, so the first entry is zero */
+    segmentResults_.resize(batch.numSegments + 1);
+    segmentResults_[0] = 0;
 
-/*
- * ======= Private: =======
- */
+    /* Poll the last segment first, which is the last one to become available */
+    const std::uint32_t lastSegment = batch.numSegments - 1;
+    QueryHeap& lastQueryHeap = *batch.queryHeaps[lastSegment / g_queryTimerHeapSize];
 
-void DbgQueryTimerPool::ResolveQueryResults()
-{
     constexpr int maxAttempts = 100;
+    for (int attempt = 0; !commandQueue_.QueryResult(lastQueryHeap, lastSegment % g_queryTimerHeapSize, 1, &segmentResults_[batch.numSegments], sizeof(std::uint64_t)); ++attempt)
+    {
+        if (!wait || attempt + 1 == maxAttempts)
+            return false;
+        std::this_thread::yield();
+    }
 
-    for_range(i, records_.size())
+    /* Read all segments heap by heap */
+    for (std::uint32_t firstSegment = 0; firstSegment < batch.numSegments; firstSegment += g_queryTimerHeapSize)
     {
-        ProfileTimeRecord& rec = records_[i];
-        const DbgQueryTimerIndices indices = GetQueryForRecord(i);
+        const std::uint32_t numQueries = std::min(g_queryTimerHeapSize, batch.numSegments - firstSegment);
+        QueryHeap& queryHeap = *batch.queryHeaps[firstSegment / g_queryTimerHeapSize];
+        if (!commandQueue_.QueryResult(queryHeap, 0, numQueries, &segmentResults_[firstSegment + 1], numQueries * sizeof(std::uint64_t)))
+            return false;
+    }
 
-        for_range(i, maxAttempts)
-        {
-            if (!commandQueue_.QueryResult(*queryHeaps_[indices.heapIndex], indices.queryIndex, 1, &(rec.elapsedTime), sizeof(rec.elapsedTime)))
-                std::this_thread::yield();
-            else
-                break;
-        }
+    for_subrange(i, 1, segmentResults_.size())
+        segmentResults_[i] += segmentResults_[i - 1];
+
+    /* The GPU time of each record is the sum of its segments */
+    const std::uint32_t resolveLatency = static_cast<std::uint32_t>(encodingCounter_ - batch.encoding);
+
+    for_range(i, batch.records.size())
+    {
+        ProfileTimeRecord& rec = batch.records[i];
+        rec.elapsedTime     = segmentResults_[batch.recordSegments[i * 2 + 1]] - segmentResults_[batch.recordSegments[i * 2]];
+        rec.resolveLatency  = resolveLatency;
+    }
+
+    return true;
+}
+
+void DbgQueryTimerPool::InvalidateBatch(Batch& batch)
+{
+    for (ProfileTimeRecord& rec : batch.records)
+    {
+        rec.elapsedTime     = 0;
+        rec.resolveLatency  = LLGL_UNRESOLVED_LATENCY;
     }
 }
 
+void DbgQueryTimerPool::FlushBatch(Batch& batch, DynamicVector<ProfileTimeRecord>& outRecords, std::vector<std::set<std::string>>& outAnnotations)
+{
+    outRecords.insert(outRecords.end(), batch.records.begin(), batch.records.end());
+
+    /* Move annotations along with their records; moving the set keeps the interned strings in place */
+    if (!batch.annotations.empty())
+    {
+        outAnnotations.push_back(std::move(batch.annotations));
+        batch.annotations.clear();
+    }
+
+    /* Clear batch but keep its query heaps for the next encoding */
+    batch.records.clear();
+    batch.recordSegments.clear();
+    batch.numSegments   = 0;
+    batch.pending       = false;
+}
+
 
 } // /namespace LLGL
 
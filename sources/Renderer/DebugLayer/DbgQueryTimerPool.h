@@ -13,12 +13,22 @@
 #include <LLGL/RenderingDebugger.h>
 #include <vector>
 #include <stack>
+#include <set>
+#include <string>
 
 
 namespace LLGL
 {
 
 
+/*
+Pool of timer queries for the time records of a command buffer.
+Instead of nesting elapsed-time queries (which is not supported by all backends, e.g. GL_TIME_ELAPSED),
+only a single query is active at a time and each Start() and Stop() call ends the current query segment and begins the next one.
+The segment boundaries serve as GPU timestamps, i.e. the GPU time of a record is the sum of all segments between its Start() and Stop() calls.
+The queries of each encoding are stored in a ring of batches and resolved in a later encoding once their results are available,
+so reading back the results does not stall the pipeline.
+*/
 class DbgQueryTimerPool
 {
 
@@ -30,22 +40,54 @@ class DbgQueryTimerPool
             CommandBuffer&  commandBufferInstance
         );
 
-        // Resets all records in this timer manager.
+        // Begins a new batch of records for the next encoding of the command buffer.
         void Reset();
 
         // Starts measuring the time with the specified annotation.
         void Start(const char* annotation);
 
+        /*
+        Returns a copy of the specified annotation that is owned by the current batch, for annotations that do not outlive the command (e.g. debug group names).
+        The copy remains valid until the second call to TakeRecords() after the batch has been flushed, i.e. until the next records are taken after its own records have been handed out.
+        */
+        const char* InternAnnotation(const char* annotation);
+
         // Stops measing the time and stores the current record.
         void Stop();
 
-        // Moves the internal records to the specified output container.
+        /*
+        Ends the current encoding and appends the records of all previous batches, whose results are available, to the specified output container.
+        This also releases all interned annotations of the records that were taken with the previous call.
+        */
         void TakeRecords(DynamicVector<ProfileTimeRecord>& outRecords);
 
     private:
 
-        // Resolves all timer values into the output records.
-        void ResolveQueryResults();
+        // Records of a single encoding and the query heaps they are measured with.
+        struct Batch
+        {
+            std::vector<QueryHeap*>             queryHeaps;
+            std::uint32_t                       numSegments = 0;
+            DynamicVector<ProfileTimeRecord>    records;
+            std::vector<std::uint32_t>          recordSegments;     // Pairs of first and end segment index for each record
+            std::set<std::string>               annotations;        // Interned annotations of this batch's records
+            std::uint64_t                       encoding    = 0;    // Index of the encoding this batch was recorded in
+            bool                                pending     = false;
+        };
+
+    private:
+
+        void BeginSegment();
+        void EndSegment();
+
+        // Resolves the query results of the specified batch and returns true on success. Returns false if the results are not available yet.
+        bool ResolveBatch(Batch& batch, bool wait);
+
+        // Flags all records of the specified batch as unresolved, i.e. their GPU time is invalid.
+        void InvalidateBatch(Batch& batch);
+
+        // Moves the resolved records and interned annotations of the specified batch into the output containers.
+        void FlushBatch(Batch& batch, DynamicVector<ProfileTimeRecord>& outRecords, std::vector<std::set<std::string>>& outAnnotations);
 
     private:
 
@@ -53,13 +95,15 @@ class DbgQueryTimerPool
         CommandQueue&                       commandQueue_;
         CommandBuffer&                      commandBuffer_;
 
-        std::vector<QueryHeap*>             queryHeaps_;
-        std::stack<std::size_t>             pendingRecordStack_;
-        std::uint32_t                       currentQuery_       = 0;
-        std::uint32_t                       currentQueryHeap_   = 0;
+        std::vector<Batch>                  batches_;
+        std::size_t                         currentBatch_       = 0;
+        std::uint64_t                       encodingCounter_    = 0;
 
-        DynamicVector<ProfileTimeRecord>    records_;
-        std::uint64_t                       cpuTicksBase_       = 0;
+        std::stack<std::size_t>             pendingRecordStack_;
+        std::vector<std::uint64_t>          segmentResults_;
+        DynamicVector<ProfileTimeRecord>    resolvedRecords_;       // Records of batches that had to be resolved before they were taken
+        std::vector<std::set<std::string>>  resolvedAnnotations_;   // Interned annotations of 'resolvedRecords_'
+        std::vector<std::set<std::string>>  takenAnnotations_;      // Interned annotations of the records that were taken with the last call to TakeRecords()
 
 };
 
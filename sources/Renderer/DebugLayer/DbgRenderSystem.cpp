@@ -36,15 +36,16 @@ All the actual render system objects are stored in the members named "instance",
 
 DbgRenderSystem::DbgRenderSystem(RenderSystemPtr&& instance, RenderingDebugger* debugger) :
     instance_     { std::forward<RenderSystemPtr&&>(instance)                                         },
-    debugger_     { debugger                                                                          },
+    debugger_     { debugger != nullptr && debugger->GetValidation() ? debugger : nullptr             },
+    profiler_     { debugger                                                                          },
     commandQueue_ { MakeUnique<DbgCommandQueue>(*(instance_->GetCommandQueue()), profile_, debugger_) }
 {
 }
 
 void DbgRenderSystem::FlushProfile()
 {
-    if (debugger_ != nullptr)
-        debugger_->RecordProfile(profile_);
+    if (profiler_ != nullptr)
+        profiler_->RecordProfile(profile_);
     profile_ = {};
 }
 
@@ -97,6 +98,7 @@ CommandBuffer* DbgRenderSystem::CreateCommandBuffer(const CommandBufferDescripto
         *instance_->CreateCommandBuffer(instanceCommandBufferDesc),
         profile_,
         debugger_,
+        profiler_,
         commandBufferDesc,
         GetRenderingCaps()
     );
@@ -295,6 +297,21 @@ void DbgRenderSystem::ReadTexture(Texture& texture, const TextureRegion& texture
     profile_.commandQueueRecord.textureReads++;
 }
 
+void DbgRenderSystem::ReadTextureAsync(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView, Fence& fence)
+{
+    auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
+
+    if (LLGL_DBG_SOURCE())
+    {
+        ValidateTextureRegion(textureDbg, textureRegion);
+        ValidateImageDataSize(textureDbg, textureRegion, dstImageView.format, dstImageView.dataType, dstImageView.dataSize);
+    }
+
+    instance_->ReadTextureAsync(textureDbg.instance, textureRegion, dstImageView, fence);
+
+    profile_.commandQueueRecord.textureReads++;
+}
+
 /* ----- Sampler States ---- */
 
 Sampler* DbgRenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
@@ -494,11 +511,9 @@ void DbgRenderSystem::Release(PipelineCache& pipelineCache)
 
 /* ----- Pipeline States ----- */
 
-PipelineState* DbgRenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
+// Returns a copy of the specified PSO descriptor with all debug layer objects replaced by their instances.
+static GraphicsPipelineDescriptor GetInstancePipelineDesc(const GraphicsPipelineDescriptor& pipelineStateDesc)
 {
-    if (LLGL_DBG_SOURCE())
-        ValidateGraphicsPipelineDesc(pipelineStateDesc);
-
     GraphicsPipelineDescriptor instanceDesc = pipelineStateDesc;
     {
         if (pipelineStateDesc.pipelineLayout != nullptr)
@@ -511,14 +526,12 @@ PipelineState* DbgRenderSystem::CreatePipelineState(const GraphicsPipelineDescri
         instanceDesc.geometryShader         = DbgGetInstance<DbgShader>(pipelineStateDesc.geometryShader);
         instanceDesc.fragmentShader         = DbgGetInstance<DbgShader>(pipelineStateDesc.fragmentShader);
     }
-    return pipelineStates_.emplace<DbgPipelineState>(*instance_->CreatePipelineState(instanceDesc, pipelineCache), pipelineStateDesc);
+    return instanceDesc;
 }
 
-PipelineState* DbgRenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
+// Returns a copy of the specified PSO descriptor with all debug layer objects replaced by their instances.
+static ComputePipelineDescriptor GetInstancePipelineDesc(const ComputePipelineDescriptor& pipelineStateDesc)
 {
-    if (LLGL_DBG_SOURCE())
-        ValidateComputePipelineDesc(pipelineStateDesc);
-
     ComputePipelineDescriptor instanceDesc = pipelineStateDesc;
     {
         if (pipelineStateDesc.pipelineLayout != nullptr)
@@ -526,9 +539,63 @@ PipelineState* DbgRenderSystem::CreatePipelineState(const ComputePipelineDescrip
 
         instanceDesc.computeShader = DbgGetInstance<DbgShader>(pipelineStateDesc.computeShader);
     }
+    return instanceDesc;
+}
+
+PipelineState* DbgRenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
+{
+    if (LLGL_DBG_SOURCE())
+        ValidateGraphicsPipelineDesc(pipelineStateDesc);
+
+    const GraphicsPipelineDescriptor instanceDesc = GetInstancePipelineDesc(pipelineStateDesc);
+    return pipelineStates_.emplace<DbgPipelineState>(*instance_->CreatePipelineState(instanceDesc, pipelineCache), pipelineStateDesc);
+}
+
+PipelineState* DbgRenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
+{
+    if (LLGL_DBG_SOURCE())
+        ValidateComputePipelineDesc(pipelineStateDesc);
+
+    const ComputePipelineDescriptor instanceDesc = GetInstancePipelineDesc(pipelineStateDesc);
     return pipelineStates_.emplace<DbgPipelineState>(*instance_->CreatePipelineState(instanceDesc, pipelineCache), pipelineStateDesc);
 }
 
+void DbgRenderSystem::CreatePipelineStates(std::uint32_t numPipelineStates, const GraphicsPipelineDescriptor* pipelineStateDescs, PipelineState** outPipelineStates)
+{
+    /* Forward entire batch to the instance, so the backend can still create all PSOs at once */
+    std::vector<GraphicsPipelineDescriptor> instanceDescs;
+    instanceDescs.reserve(numPipelineStates);
+    for_range(i, numPipelineStates)
+    {
+        if (LLGL_DBG_SOURCE())
+            ValidateGraphicsPipelineDesc(pipelineStateDescs[i]);
+        instanceDescs.push_back(GetInstancePipelineDesc(pipelineStateDescs[i]));
+    }
+
+    instance_->CreatePipelineStates(numPipelineStates, instanceDescs.data(), outPipelineStates);
+
+    for_range(i, numPipelineStates)
+        outPipelineStates[i] = pipelineStates_.emplace<DbgPipelineState>(*outPipelineStates[i], pipelineStateDescs[i]);
+}
+
+void DbgRenderSystem::CreatePipelineStates(std::uint32_t numPipelineStates, const ComputePipelineDescriptor* pipelineStateDescs, PipelineState** outPipelineStates)
+{
+    /* Forward entire batch to the instance (see graphics PSOs) */
+    std::vector<ComputePipelineDescriptor> instanceDescs;
+    instanceDescs.reserve(numPipelineStates);
+    for_range(i, numPipelineStates)
+    {
+        if (LLGL_DBG_SOURCE())
+            ValidateComputePipelineDesc(pipelineStateDescs[i]);
+        instanceDescs.push_back(GetInstancePipelineDesc(pipelineStateDescs[i]));
+    }
+
+    instance_->CreatePipelineStates(numPipelineStates, instanceDescs.data(), outPipelineStates);
+
+    for_range(i, numPipelineStates)
+        outPipelineStates[i] = pipelineStates_.emplace<DbgPipelineState>(*outPipelineStates[i], pipelineStateDescs[i]);
+}
+
 void DbgRenderSystem::Release(PipelineState& pipelineState)
 {
     ReleaseDbg(pipelineStates_, pipelineState);
@@ -708,7 +775,15 @@ void DbgRenderSystem::ValidateBufferDesc(const BufferDescriptor& bufferDesc, std
     /* Validate flags */
     ValidateBindFlags(bufferDesc.bindFlags);
     ValidateCPUAccessFlags(bufferDesc.cpuAccessFlags, CPUAccessFlags::ReadWrite, "buffer");
-    ValidateMiscFlags(bufferDesc.miscFlags, (MiscFlags::DynamicUsage | MiscFlags::NoInitialData), "buffer");
+    ValidateMiscFlags(bufferDesc.miscFlags, (MiscFlags::DynamicUsage | MiscFlags::NoInitialData | MiscFlags::Streaming), "buffer");
+
+    /* Validate streaming buffers are only used as constant buffers */
+    if ((bufferDesc.miscFlags & MiscFlags::Streaming) != 0)
+    {
+        const long streamingBindFlags = (BindFlags::ConstantBuffer | BindFlags::CopySrc | BindFlags::CopyDst);
+        if ((bufferDesc.bindFlags & BindFlags::ConstantBuffer) == 0 || (bufferDesc.bindFlags & ~streamingBindFlags) != 0)
+            LLGL_DBG_WARN(WarningType::ImproperArgument, "'LLGL::MiscFlags::Streaming' is ignored for buffers with binding flags other than constant buffer and copy source/destination");
+    }
 
     /* Validate (constant-) buffer size */
     if ((bufferDesc.bindFlags & BindFlags::ConstantBuffer) != 0)
@@ -42,6 +42,20 @@ class DbgRenderSystem final : public RenderSystem
 
         #include <LLGL/Backend/RenderSystem.inl>
 
+        void ReadTextureAsync(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView, Fence& fence) override;
+
+        void CreatePipelineStates(
+            std::uint32_t                       numPipelineStates,
+            const GraphicsPipelineDescriptor*   pipelineStateDescs,
+            PipelineState**                     outPipelineStates
+        ) override;
+
+        void CreatePipelineStates(
+            std::uint32_t                       numPipelineStates,
+            const ComputePipelineDescriptor*    pipelineStateDescs,
+            PipelineState**                     outPipelineStates
+        ) override;
+
     public:
 
         DbgRenderSystem(RenderSystemPtr&& instance, RenderingDebugger* debugger);
@@ -128,7 +142,8 @@ class DbgRenderSystem final : public RenderSystem
 
         RenderSystemPtr                         instance_;
 
-        RenderingDebugger*                      debugger_   = nullptr;
+        RenderingDebugger*                      debugger_   = nullptr; // Null if validation is disabled
+        RenderingDebugger*                      profiler_   = nullptr; // Receives the frame profiles, even if validation is disabled
         FrameProfile                            profile_;
 
         /* ----- Hardware object containers ----- */
@@ -6,6 +6,7 @@
  */
 
 #include "NullBuffer.h"
+#include "../Texture/NullTexture.h"
 #include "../../ResourceUtils.h"
 #include "../../../Core/CoreUtils.h"
 #include <algorithm>
@@ -92,6 +93,32 @@ bool NullBuffer::CopyFromBuffer(std::uint64_t dstOffset, const NullBuffer& srcBu
     return false;
 }
 
+bool NullBuffer::CopyFromTexture(
+    std::uint64_t       dstOffset,
+    const NullTexture&  srcTexture,
+    std::uint32_t       srcMipLevel,
+    std::uint32_t       srcArrayLayer,
+    const Offset3D&     srcOffset,
+    const Extent3D&     extent,
+    std::uint32_t       rowStride,
+    std::uint32_t       layerStride)
+{
+    if (dstOffset < desc.size)
+    {
+        return srcTexture.CopyToBufferData(
+            srcMipLevel,
+            srcArrayLayer,
+            srcOffset,
+            extent,
+            GetBytesAt(dstOffset),
+            static_cast<std::size_t>(desc.size - dstOffset),
+            rowStride,
+            layerStride
+        );
+    }
+    return false;
+}
+
 bool NullBuffer::CpuAccessRead(std::uint64_t offset, void* data, std::uint64_t size)
 {
     if ((desc.cpuAccessFlags & CPUAccessFlags::Read) != 0)
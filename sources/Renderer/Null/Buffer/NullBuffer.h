@@ -10,6 +10,7 @@
 
 
 #include <LLGL/Buffer.h>
+#include <LLGL/Types.h>
 #include <vector>
 #include <string>
 
@@ -18,6 +19,8 @@ namespace LLGL
 {
 
 
+class NullTexture;
+
 class NullBuffer final : public Buffer
 {
 
@@ -41,9 +44,27 @@ class NullBuffer final : public Buffer
 
         bool CopyFromBuffer(std::uint64_t dstOffset, const NullBuffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size);
 
+        // Copies the specified texture region into this buffer. A row or layer stride of zero denotes tightly packed data.
+        bool CopyFromTexture(
+            std::uint64_t       dstOffset,
+            const NullTexture&  srcTexture,
+            std::uint32_t       srcMipLevel,
+            std::uint32_t       srcArrayLayer,
+            const Offset3D&     srcOffset,
+            const Extent3D&     extent,
+            std::uint32_t       rowStride,
+            std::uint32_t       layerStride
+        );
+
         void* Map(const CPUAccess access, std::uint64_t offset, std::uint64_t length);
         void Unmap();
 
+        // Returns a constant pointer to the internal buffer data. The buffer size is specified by desc.size.
+        inline const void* GetData() const
+        {
+            return GetBytes();
+        }
+
     public:
 
         // Data type for the internal buffer data.
@@ -10,6 +10,10 @@
 
 
 #include <LLGL/IndirectArguments.h>
+#include <LLGL/CommandBufferFlags.h>
+#include <LLGL/PipelineStateFlags.h>
+#include <LLGL/Constants.h>
+#include "../Texture/NullRenderTarget.h"
 #include <cstddef>
 #include <cstdint>
 
@@ -20,6 +24,9 @@ namespace LLGL
 
 class NullBuffer;
 class NullTexture;
+class NullSwapChain;
+class NullPipelineState;
+class NullQueryHeap;
 
 
 struct NullCmdBufferWrite
@@ -58,7 +65,50 @@ struct NullCmdGenerateMips
     std::uint32_t   numMipLevels;
 };
 
-//TODO...
+struct NullCmdCopyTextureFromFramebuffer
+{
+    NullTexture*    dstTexture;
+    TextureRegion   dstRegion;
+    Offset2D        srcOffset;
+};
+
+struct NullCmdSetViewports
+{
+    std::uint32_t   numViewports;
+//  Viewport        viewports[numViewports];
+};
+
+struct NullCmdSetScissors
+{
+    std::uint32_t   numScissors;
+//  Scissor         scissors[numScissors];
+};
+
+struct NullCmdBeginRenderPass
+{
+    const NullSwapChain*    swapChain;  // Swap-chain buffers are resolved at execution time, since they are replaced when the swap-chain is resized.
+    std::uint32_t           numColorAttachments;
+    NullAttachment          colorAttachments[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    NullAttachment          depthStencilAttachment;
+};
+
+//struct NullCmdEndRenderPass {};
+
+struct NullCmdClearAttachments
+{
+    std::uint32_t   numAttachments;
+//  AttachmentClear attachments[numAttachments];
+};
+
+struct NullCmdSetPipelineState
+{
+    const NullPipelineState* pipelineState;
+};
+
+struct NullCmdSetBlendFactor
+{
+    float color[4];
+};
 
 struct NullCmdDraw
 {
@@ -77,6 +127,12 @@ struct NullCmdDrawIndexed
 //  const NullBuffer*               vertexBuffers[numVertexBuffers];
 };
 
+struct NullCmdQuery
+{
+    NullQueryHeap*  queryHeap;
+    std::uint32_t   query;
+};
+
 struct NullCmdPushDebugGroup
 {
     std::size_t length;
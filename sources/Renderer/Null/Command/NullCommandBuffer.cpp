@@ -7,6 +7,7 @@
 
 #include "NullCommandBuffer.h"
 #include "NullCommandExecutor.h"
+#include "NullCommandQueue.h"
 #include "NullCommand.h"
 #include "../../CheckedCast.h"
 #include "../../../Core/CoreUtils.h"
@@ -18,19 +19,24 @@
 #include "../RenderState/NullQueryHeap.h"
 #include "../RenderState/NullPipelineState.h"
 #include "../RenderState/NullResourceHeap.h"
+#include "../RenderState/NullRenderPass.h"
 #include "../Texture/NullTexture.h"
 #include "../Texture/NullRenderTarget.h"
 
 #include <LLGL/RenderingDebugger.h>
 #include <LLGL/IndirectArguments.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
 
 
 namespace LLGL
 {
 
 
-NullCommandBuffer::NullCommandBuffer(const CommandBufferDescriptor& desc) :
-    desc { desc }
+NullCommandBuffer::NullCommandBuffer(NullCommandQueue& commandQueue, VirtualCommandBufferPool& commandBufferPool, const CommandBufferDescriptor& desc) :
+    desc          { desc                  },
+    commandQueue_ { commandQueue          },
+    buffer_       { 0, &commandBufferPool }
 {
 }
 
@@ -38,13 +44,15 @@ NullCommandBuffer::NullCommandBuffer(const CommandBufferDescriptor& desc) :
 
 void NullCommandBuffer::Begin()
 {
+    /* Wait until the previous submission of this command buffer has been executed before it is re-encoded */
+    commandQueue_.WaitForSubmission(pendingSubmissionID_);
     buffer_.Clear();
 }
 
 void NullCommandBuffer::End()
 {
     if ((desc.flags & CommandBufferFlags::ImmediateSubmit) != 0)
-        ExecuteVirtualCommands();
+        commandQueue_.SubmitCommandBuffer(*this);
 }
 
 void NullCommandBuffer::Execute(CommandBuffer& secondaryCommandBuffer)
@@ -106,6 +114,7 @@ static Extent3D GetSubresourceExtent(TextureType type, const Extent3D& extent, s
         case TextureType::Texture1DArray:
             return Extent3D{ extent.width, numArrayLayers, 1 };
         case TextureType::Texture2DArray:
+        case TextureType::TextureCube:
         case TextureType::TextureCubeArray:
         case TextureType::Texture2DMSArray:
             return Extent3D{ extent.width, extent.height, numArrayLayers };
@@ -171,7 +180,7 @@ void NullCommandBuffer::CopyTexture(
         cmd->srcY           = srcLocation.offset.y;
         cmd->srcZ           = srcLocation.offset.z;
         cmd->dstResource    = &dstTextureNull;
-        cmd->dstSubresource = dstTextureNull.PackSubresourceIndex(srcLocation.mipLevel, srcLocation.arrayLayer);
+        cmd->dstSubresource = dstTextureNull.PackSubresourceIndex(dstLocation.mipLevel, dstLocation.arrayLayer);
         cmd->dstX           = dstLocation.offset.x;
         cmd->dstY           = dstLocation.offset.y;
         cmd->dstZ           = dstLocation.offset.z;
@@ -218,7 +227,13 @@ void NullCommandBuffer::CopyTextureFromFramebuffer(
     const TextureRegion&    dstRegion,
     const Offset2D&         srcOffset)
 {
-    //todo
+    auto& dstTextureNull = LLGL_CAST(NullTexture&, dstTexture);
+    auto cmd = AllocCommand<NullCmdCopyTextureFromFramebuffer>(NullOpcodeCopyTextureFromFramebuffer);
+    {
+        cmd->dstTexture = &dstTextureNull;
+        cmd->dstRegion  = dstRegion;
+        cmd->srcOffset  = srcOffset;
+    }
 }
 
 void NullCommandBuffer::GenerateMips(Texture& texture)
@@ -252,21 +267,29 @@ void NullCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource&
 void NullCommandBuffer::SetViewport(const Viewport& viewport)
 {
     renderState_.viewports = { viewport };
+    AllocViewportsCommand(1, &viewport);
 }
 
 void NullCommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport* viewports)
 {
+    numViewports = std::min(numViewports, LLGL_MAX_NUM_VIEWPORTS_AND_SCISSORS);
     renderState_.viewports = SmallVector<Viewport>(viewports, viewports + numViewports);
+    if (numViewports > 0)
+        AllocViewportsCommand(numViewports, viewports);
 }
 
 void NullCommandBuffer::SetScissor(const Scissor& scissor)
 {
     renderState_.scissors = { scissor };
+    AllocScissorsCommand(1, &scissor);
 }
 
 void NullCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* scissors)
 {
+    numScissors = std::min(numScissors, LLGL_MAX_NUM_VIEWPORTS_AND_SCISSORS);
     renderState_.scissors = SmallVector<Scissor>(scissors, scissors + numScissors);
+    if (numScissors > 0)
+        AllocScissorsCommand(numScissors, scissors);
 }
 
 /* ----- Buffers ------ */
@@ -321,44 +344,124 @@ void NullCommandBuffer::BeginRenderPass(
     const ClearValue*   clearValues,
     std::uint32_t       /*swapBufferIndex*/)
 {
-    if (LLGL::IsInstanceOf<SwapChain>(renderTarget))
+    auto cmd = AllocCommand<NullCmdBeginRenderPass>(NullOpcodeBeginRenderPass);
     {
-        //auto& swapChainNull = LLGL_CAST(NullSwapChain&, renderTarget);
-        //todo
+        if (LLGL::IsInstanceOf<SwapChain>(renderTarget))
+        {
+            cmd->swapChain              = LLGL_CAST(const NullSwapChain*, &renderTarget);
+            cmd->numColorAttachments    = 1;
+        }
+        else
+        {
+            auto& renderTargetNull = LLGL_CAST(NullRenderTarget&, renderTarget);
+            cmd->swapChain = nullptr;
+            const auto& colorAttachments = renderTargetNull.GetColorAttachments();
+            cmd->numColorAttachments = std::min(static_cast<std::uint32_t>(colorAttachments.size()), LLGL_MAX_NUM_COLOR_ATTACHMENTS);
+            for_range(i, cmd->numColorAttachments)
+                cmd->colorAttachments[i] = colorAttachments[i];
+            cmd->depthStencilAttachment = renderTargetNull.GetDepthStencilAttachment();
+        }
     }
-    else
+    renderState_.numColorAttachments = cmd->numColorAttachments;
+
+    /* Clear attachments with load operation 'Clear'; clear values are consumed in order for the color attachments first, then for depth-stencil */
+    if (renderPass != nullptr)
     {
-        //auto& renderTargetNull = LLGL_CAST(NullRenderTarget&, renderTarget);
-        //todo
+        auto& renderPassNull = LLGL_CAST(const NullRenderPass&, *renderPass);
+        const RenderPassDescriptor& renderPassDesc = renderPassNull.desc;
+
+        AttachmentClear attachments[LLGL_MAX_NUM_ATTACHMENTS];
+        std::uint32_t numAttachments = 0, clearValueIndex = 0;
+
+        for_range(i, renderState_.numColorAttachments)
+        {
+            if (renderPassDesc.colorAttachments[i].loadOp == AttachmentLoadOp::Clear)
+            {
+                AttachmentClear& attachment = attachments[numAttachments++];
+                attachment.flags            = ClearFlags::Color;
+                attachment.colorAttachment  = i;
+                if (clearValueIndex < numClearValues)
+                    attachment.clearValue = clearValues[clearValueIndex++];
+            }
+        }
+
+        long depthStencilFlags = 0;
+        if (renderPassDesc.depthAttachment.loadOp == AttachmentLoadOp::Clear)
+            depthStencilFlags |= ClearFlags::Depth;
+        if (renderPassDesc.stencilAttachment.loadOp == AttachmentLoadOp::Clear)
+            depthStencilFlags |= ClearFlags::Stencil;
+
+        if (depthStencilFlags != 0)
+        {
+            AttachmentClear& attachment = attachments[numAttachments++];
+            attachment.flags = depthStencilFlags;
+            if (clearValueIndex < numClearValues)
+                attachment.clearValue = clearValues[clearValueIndex];
+        }
+
+        if (numAttachments > 0)
+            AllocClearAttachmentsCommand(numAttachments, attachments);
     }
 }
 
 void NullCommandBuffer::EndRenderPass()
 {
-    //todo
+    AllocOpcode(NullOpcodeEndRenderPass);
+    renderState_.numColorAttachments = 0;
 }
 
 void NullCommandBuffer::Clear(long flags, const ClearValue& clearValue)
 {
-    //todo
+    AttachmentClear attachments[LLGL_MAX_NUM_ATTACHMENTS];
+    std::uint32_t numAttachments = 0;
+
+    /* Clear all color attachments of the current render pass */
+    if ((flags & ClearFlags::Color) != 0)
+    {
+        for_range(i, renderState_.numColorAttachments)
+        {
+            AttachmentClear& attachment = attachments[numAttachments++];
+            attachment.flags            = ClearFlags::Color;
+            attachment.colorAttachment  = i;
+            attachment.clearValue       = clearValue;
+        }
+    }
+
+    /* Clear depth-stencil attachment */
+    if ((flags & ClearFlags::DepthStencil) != 0)
+    {
+        AttachmentClear& attachment = attachments[numAttachments++];
+        attachment.flags        = (flags & ClearFlags::DepthStencil);
+        attachment.clearValue   = clearValue;
+    }
+
+    if (numAttachments > 0)
+        AllocClearAttachmentsCommand(numAttachments, attachments);
 }
 
 void NullCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments)
 {
-    //todo
+    if (numAttachments > 0)
+        AllocClearAttachmentsCommand(numAttachments, attachments);
 }
 
 /* ----- Pipeline States ----- */
 
 void NullCommandBuffer::SetPipelineState(PipelineState& pipelineState)
 {
-    //auto& pipelineStateNull = LLGL_CAST(NullPipelineState&, pipelineState);
-    //todo
+    auto& pipelineStateNull = LLGL_CAST(NullPipelineState&, pipelineState);
+    auto cmd = AllocCommand<NullCmdSetPipelineState>(NullOpcodeSetPipelineState);
+    {
+        cmd->pipelineState = &pipelineStateNull;
+    }
 }
 
 void NullCommandBuffer::SetBlendFactor(const float color[4])
 {
-    //todo
+    auto cmd = AllocCommand<NullCmdSetBlendFactor>(NullOpcodeSetBlendFactor);
+    {
+        ::memcpy(cmd->color, color, sizeof(cmd->color));
+    }
 }
 
 void NullCommandBuffer::SetStencilReference(std::uint32_t reference, const StencilFace stencilFace)
@@ -375,14 +478,22 @@ void NullCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::
 
 void NullCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
-    //auto& queryHeapNull = LLGL_CAST(NullQueryHeap&, queryHeap);
-    //todo
+    auto& queryHeapNull = LLGL_CAST(NullQueryHeap&, queryHeap);
+    auto cmd = AllocCommand<NullCmdQuery>(NullOpcodeBeginQuery);
+    {
+        cmd->queryHeap  = &queryHeapNull;
+        cmd->query      = query;
+    }
 }
 
 void NullCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
-    //auto& queryHeapNull = LLGL_CAST(NullQueryHeap&, queryHeap);
-    //todo
+    auto& queryHeapNull = LLGL_CAST(NullQueryHeap&, queryHeap);
+    auto cmd = AllocCommand<NullCmdQuery>(NullOpcodeEndQuery);
+    {
+        cmd->queryHeap  = &queryHeapNull;
+        cmd->query      = query;
+    }
 }
 
 void NullCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode)
@@ -575,6 +686,7 @@ void NullCommandBuffer::PushDebugGroup(const char* name)
     const std::size_t length = ::strlen(name);
     auto cmd = AllocCommand<NullCmdPushDebugGroup>(NullOpcodePushDebugGroup, length + 1);
     {
+        cmd->length = length;
         ::memcpy(cmd + 1, name, length + 1);
     }
 }
@@ -624,6 +736,33 @@ TCommand* NullCommandBuffer::AllocCommand(const NullOpcode opcode, std::size_t p
     return buffer_.AllocCommand<TCommand>(opcode, payloadSize);
 }
 
+void NullCommandBuffer::AllocViewportsCommand(std::uint32_t numViewports, const Viewport* viewports)
+{
+    auto cmd = AllocCommand<NullCmdSetViewports>(NullOpcodeSetViewports, sizeof(Viewport) * numViewports);
+    {
+        cmd->numViewports = numViewports;
+        ::memcpy(cmd + 1, viewports, sizeof(Viewport) * numViewports);
+    }
+}
+
+void NullCommandBuffer::AllocScissorsCommand(std::uint32_t numScissors, const Scissor* scissors)
+{
+    auto cmd = AllocCommand<NullCmdSetScissors>(NullOpcodeSetScissors, sizeof(Scissor) * numScissors);
+    {
+        cmd->numScissors = numScissors;
+        ::memcpy(cmd + 1, scissors, sizeof(Scissor) * numScissors);
+    }
+}
+
+void NullCommandBuffer::AllocClearAttachmentsCommand(std::uint32_t numAttachments, const AttachmentClear* attachments)
+{
+    auto cmd = AllocCommand<NullCmdClearAttachments>(NullOpcodeClearAttachments, sizeof(AttachmentClear) * numAttachments);
+    {
+        cmd->numAttachments = numAttachments;
+        ::memcpy(cmd + 1, attachments, sizeof(AttachmentClear) * numAttachments);
+    }
+}
+
 void NullCommandBuffer::AllocDrawCommand(const DrawIndirectArguments& args)
 {
     auto cmd = AllocCommand<NullCmdDraw>(NullOpcodeDraw, sizeof(const NullBuffer*) * renderState_.vertexBuffers.size());
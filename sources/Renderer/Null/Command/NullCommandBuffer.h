@@ -20,6 +20,7 @@ namespace LLGL
 
 
 class NullBuffer;
+class NullCommandQueue;
 
 using NullVirtualCommandBuffer = VirtualCommandBuffer<NullOpcode>;
 
@@ -32,13 +33,19 @@ class NullCommandBuffer final : public CommandBuffer
 
     public:
 
-        NullCommandBuffer(const CommandBufferDescriptor& desc);
+        NullCommandBuffer(NullCommandQueue& commandQueue, VirtualCommandBufferPool& commandBufferPool, const CommandBufferDescriptor& desc);
 
     public:
 
         // Executes the internal virtual command buffer.
         void ExecuteVirtualCommands();
 
+        // Stores the ID of the most recent submission of this command buffer. Begin() waits for this submission before the buffer is re-encoded.
+        inline void SetPendingSubmission(std::uint64_t submissionID)
+        {
+            pendingSubmissionID_ = submissionID;
+        }
+
     public:
 
         const CommandBufferDescriptor desc;
@@ -53,6 +60,7 @@ class NullCommandBuffer final : public CommandBuffer
             const NullBuffer*               indexBuffer         = nullptr;
             Format                          indexBufferFormat   = Format::Undefined;
             std::uint64_t                   indexBufferOffset   = 0;
+            std::uint32_t                   numColorAttachments = 0;
         };
 
     private:
@@ -64,11 +72,18 @@ class NullCommandBuffer final : public CommandBuffer
         template <typename TCommand>
         TCommand* AllocCommand(const NullOpcode opcode, std::size_t payloadSize = 0);
 
+        void AllocViewportsCommand(std::uint32_t numViewports, const Viewport* viewports);
+        void AllocScissorsCommand(std::uint32_t numScissors, const Scissor* scissors);
+        void AllocClearAttachmentsCommand(std::uint32_t numAttachments, const AttachmentClear* attachments);
+
         void AllocDrawCommand(const DrawIndirectArguments& args);
         void AllocDrawIndexedCommand(const DrawIndexedIndirectArguments& args);
 
     private:
 
+        NullCommandQueue&           commandQueue_;
+        std::uint64_t               pendingSubmissionID_    = 0;
+
         NullVirtualCommandBuffer    buffer_;
         RenderState                 renderState_;
 
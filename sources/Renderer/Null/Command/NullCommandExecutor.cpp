@@ -7,6 +7,8 @@
 
 #include "NullCommandExecutor.h"
 #include "NullCommand.h"
+#include "NullRasterizer.h"
+#include "../NullSwapChain.h"
 
 #include "../Texture/NullTexture.h"
 #include "../Texture/NullSampler.h"
@@ -26,7 +28,7 @@ namespace LLGL
 {
 
 
-static std::size_t ExecuteNullCommand(const NullOpcode opcode, const void* pc)
+static std::size_t ExecuteNullCommand(const NullOpcode opcode, const void* pc, NullRasterizer& rasterizer)
 {
     switch (opcode)
     {
@@ -39,6 +41,7 @@ static std::size_t ExecuteNullCommand(const NullOpcode opcode, const void* pc)
         case NullOpcodeCopySubresource:
         {
             auto cmd = reinterpret_cast<const NullCmdCopySubresource*>(pc);
+            rasterizer.Flush();
             auto* dst = cmd->dstResource;
             auto* src = cmd->srcResource;
             if (dst->GetResourceType() == ResourceType::Buffer)
@@ -51,35 +54,163 @@ static std::size_t ExecuteNullCommand(const NullOpcode opcode, const void* pc)
                 }
                 else if (src->GetResourceType() == ResourceType::Texture)
                 {
-                    //TODO
+                    auto* srcTexture = LLGL_CAST(const NullTexture*, src);
+                    std::uint32_t srcMipLevel = 0, srcArrayLayer = 0;
+                    srcTexture->UnpackSubresourceIndex(cmd->srcSubresource, srcMipLevel, srcArrayLayer);
+                    dstBuffer->CopyFromTexture(
+                        cmd->dstX,
+                        *srcTexture,
+                        srcMipLevel,
+                        srcArrayLayer,
+                        Offset3D{ static_cast<std::int32_t>(cmd->srcX), static_cast<std::int32_t>(cmd->srcY), static_cast<std::int32_t>(cmd->srcZ) },
+                        Extent3D{ static_cast<std::uint32_t>(cmd->width), cmd->height, cmd->depth },
+                        cmd->rowStride,
+                        cmd->layerStride
+                    );
                 }
             }
             else if (dst->GetResourceType() == ResourceType::Texture)
             {
-                //TODO
+                auto* dstTexture = LLGL_CAST(NullTexture*, dst);
+                std::uint32_t dstMipLevel = 0, dstArrayLayer = 0;
+                dstTexture->UnpackSubresourceIndex(cmd->dstSubresource, dstMipLevel, dstArrayLayer);
+
+                const Offset3D dstOffset{ static_cast<std::int32_t>(cmd->dstX), static_cast<std::int32_t>(cmd->dstY), static_cast<std::int32_t>(cmd->dstZ) };
+                const Extent3D extent{ static_cast<std::uint32_t>(cmd->width), cmd->height, cmd->depth };
+
+                if (src->GetResourceType() == ResourceType::Buffer)
+                {
+                    auto* srcBuffer = LLGL_CAST(const NullBuffer*, src);
+                    if (cmd->srcX < srcBuffer->desc.size)
+                    {
+                        dstTexture->CopyFromBufferData(
+                            dstMipLevel,
+                            dstArrayLayer,
+                            dstOffset,
+                            extent,
+                            static_cast<const char*>(srcBuffer->GetData()) + cmd->srcX,
+                            static_cast<std::size_t>(srcBuffer->desc.size - cmd->srcX),
+                            cmd->rowStride,
+                            cmd->layerStride
+                        );
+                    }
+                }
+                else if (src->GetResourceType() == ResourceType::Texture)
+                {
+                    auto* srcTexture = LLGL_CAST(const NullTexture*, src);
+                    std::uint32_t srcMipLevel = 0, srcArrayLayer = 0;
+                    srcTexture->UnpackSubresourceIndex(cmd->srcSubresource, srcMipLevel, srcArrayLayer);
+                    dstTexture->CopyFromTexture(
+                        dstMipLevel,
+                        dstArrayLayer,
+                        dstOffset,
+                        *srcTexture,
+                        srcMipLevel,
+                        srcArrayLayer,
+                        Offset3D{ static_cast<std::int32_t>(cmd->srcX), static_cast<std::int32_t>(cmd->srcY), static_cast<std::int32_t>(cmd->srcZ) },
+                        extent
+                    );
+                }
             }
             return sizeof(*cmd);
         }
         case NullOpcodeGenerateMips:
         {
             auto cmd = reinterpret_cast<const NullCmdGenerateMips*>(pc);
+            rasterizer.Flush();
             const TextureSubresource subresource{ cmd->baseArrayLayer, cmd->numArrayLayers, cmd->baseMipLevel, cmd->numMipLevels };
             cmd->texture->GenerateMips(&subresource);
             return sizeof(*cmd);
         }
-        //TODO...
+        case NullOpcodeCopyTextureFromFramebuffer:
+        {
+            auto cmd = reinterpret_cast<const NullCmdCopyTextureFromFramebuffer*>(pc);
+            rasterizer.CopyFramebuffer(*(cmd->dstTexture), cmd->dstRegion, cmd->srcOffset);
+            return sizeof(*cmd);
+        }
+        case NullOpcodeSetViewports:
+        {
+            auto cmd = reinterpret_cast<const NullCmdSetViewports*>(pc);
+            rasterizer.SetViewports(cmd->numViewports, reinterpret_cast<const Viewport*>(cmd + 1));
+            return (sizeof(*cmd) + cmd->numViewports * sizeof(Viewport));
+        }
+        case NullOpcodeSetScissors:
+        {
+            auto cmd = reinterpret_cast<const NullCmdSetScissors*>(pc);
+            rasterizer.SetScissors(cmd->numScissors, reinterpret_cast<const Scissor*>(cmd + 1));
+            return (sizeof(*cmd) + cmd->numScissors * sizeof(Scissor));
+        }
+        case NullOpcodeBeginRenderPass:
+        {
+            auto cmd = reinterpret_cast<const NullCmdBeginRenderPass*>(pc);
+            if (cmd->swapChain != nullptr)
+            {
+                NullAttachment colorAttachment;
+                colorAttachment.texture = cmd->swapChain->GetColorBuffer();
+                NullAttachment depthStencilAttachment;
+                depthStencilAttachment.texture = cmd->swapChain->GetDepthStencilBuffer();
+                rasterizer.BeginRenderPass(1, &colorAttachment, depthStencilAttachment);
+            }
+            else
+                rasterizer.BeginRenderPass(cmd->numColorAttachments, cmd->colorAttachments, cmd->depthStencilAttachment);
+            return sizeof(*cmd);
+        }
+        case NullOpcodeEndRenderPass:
+        {
+            rasterizer.EndRenderPass();
+            return 0;
+        }
+        case NullOpcodeClearAttachments:
+        {
+            auto cmd = reinterpret_cast<const NullCmdClearAttachments*>(pc);
+            rasterizer.ClearAttachments(cmd->numAttachments, reinterpret_cast<const AttachmentClear*>(cmd + 1));
+            return (sizeof(*cmd) + cmd->numAttachments * sizeof(AttachmentClear));
+        }
+        case NullOpcodeSetPipelineState:
+        {
+            auto cmd = reinterpret_cast<const NullCmdSetPipelineState*>(pc);
+            rasterizer.SetPipelineState(cmd->pipelineState);
+            return sizeof(*cmd);
+        }
+        case NullOpcodeSetBlendFactor:
+        {
+            auto cmd = reinterpret_cast<const NullCmdSetBlendFactor*>(pc);
+            rasterizer.SetBlendFactor(cmd->color);
+            return sizeof(*cmd);
+        }
         case NullOpcodeDraw:
         {
             auto cmd = reinterpret_cast<const NullCmdDraw*>(pc);
-            //TODO
+            rasterizer.Draw(cmd->args, cmd->numVertexBuffers, reinterpret_cast<const NullBuffer* const *>(cmd + 1));
             return (sizeof(*cmd) + cmd->numVertexBuffers * sizeof(const NullBuffer*));
         }
         case NullOpcodeDrawIndexed:
         {
             auto cmd = reinterpret_cast<const NullCmdDrawIndexed*>(pc);
-            //TODO
+            rasterizer.DrawIndexed(
+                cmd->args,
+                cmd->indexBuffer,
+                cmd->indexBufferFormat,
+                cmd->indexBufferOffset,
+                cmd->numVertexBuffers,
+                reinterpret_cast<const NullBuffer* const *>(cmd + 1)
+            );
             return (sizeof(*cmd) + cmd->numVertexBuffers * sizeof(const NullBuffer*));
         }
+        case NullOpcodeBeginQuery:
+        {
+            auto cmd = reinterpret_cast<const NullCmdQuery*>(pc);
+            cmd->queryHeap->BeginQuery(cmd->query);
+            return sizeof(*cmd);
+        }
+        case NullOpcodeEndQuery:
+        {
+            /* Rasterize pending primitives first, so the elapsed time includes all draw commands inside the query */
+            auto cmd = reinterpret_cast<const NullCmdQuery*>(pc);
+            rasterizer.Flush();
+            cmd->queryHeap->EndQuery(cmd->query);
+            return sizeof(*cmd);
+        }
         case NullOpcodePushDebugGroup:
         {
             auto cmd = reinterpret_cast<const NullCmdPushDebugGroup*>(pc);
@@ -98,7 +229,9 @@ static std::size_t ExecuteNullCommand(const NullOpcode opcode, const void* pc)
 
 void ExecuteNullVirtualCommandBuffer(const NullVirtualCommandBuffer& virtualCmdBuffer)
 {
-    virtualCmdBuffer.Run(ExecuteNullCommand);
+    NullRasterizer rasterizer;
+    virtualCmdBuffer.Run(ExecuteNullCommand, rasterizer);
+    rasterizer.Flush();
 }
 
 
@@ -21,9 +21,18 @@ enum NullOpcode : std::uint8_t
     NullOpcodeBufferWrite = 1,
     NullOpcodeCopySubresource,
     NullOpcodeGenerateMips,
-    //TODO
+    NullOpcodeCopyTextureFromFramebuffer,
+    NullOpcodeSetViewports,
+    NullOpcodeSetScissors,
+    NullOpcodeBeginRenderPass,
+    NullOpcodeEndRenderPass,
+    NullOpcodeClearAttachments,
+    NullOpcodeSetPipelineState,
+    NullOpcodeSetBlendFactor,
     NullOpcodeDraw,
     NullOpcodeDrawIndexed,
+    NullOpcodeBeginQuery,
+    NullOpcodeEndQuery,
     NullOpcodePushDebugGroup,
     NullOpcodePopDebugGroup,
 };
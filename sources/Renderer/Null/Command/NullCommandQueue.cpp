@@ -9,6 +9,7 @@
 #include "NullCommandBuffer.h"
 #include "NullCommandExecutor.h"
 #include "../RenderState/NullQueryHeap.h"
+#include "../RenderState/NullFence.h"
 #include "../../CheckedCast.h"
 
 
@@ -16,39 +17,146 @@ namespace LLGL
 {
 
 
+NullCommandQueue::NullCommandQueue(bool isDeferred)
+{
+    if (isDeferred)
+        worker_ = std::thread{ &NullCommandQueue::WorkerThreadMain, this };
+}
+
+NullCommandQueue::~NullCommandQueue()
+{
+    if (IsDeferred())
+    {
+        /* Let the worker thread process all remaining submissions before it quits */
+        {
+            std::lock_guard<std::mutex> guard{ mutex_ };
+            isQuitting_ = true;
+        }
+        submittedCV_.notify_one();
+        worker_.join();
+    }
+}
+
 /* ----- Command Buffers ----- */
 
 void NullCommandQueue::Submit(CommandBuffer& commandBuffer)
 {
     auto& commandBufferNull = LLGL_CAST(NullCommandBuffer&, commandBuffer);
     if ((commandBufferNull.desc.flags & (CommandBufferFlags::ImmediateSubmit | CommandBufferFlags::Secondary)) == 0)
-        commandBufferNull.ExecuteVirtualCommands();
+        SubmitCommandBuffer(commandBufferNull);
 }
 
 /* ----- Queries ----- */
 
 bool NullCommandQueue::QueryResult(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, void* data, std::size_t dataSize)
 {
-    //auto& queryHeapNull = LLGL_CAST(NullQueryHeap&, queryHeap);
-    //todo
-    return false;
+    auto& queryHeapNull = LLGL_CAST(NullQueryHeap&, queryHeap);
+    return queryHeapNull.QueryResult(firstQuery, numQueries, data, dataSize);
 }
 
 /* ----- Fences ----- */
 
 void NullCommandQueue::Submit(Fence& fence)
 {
-    //todo
+    auto& fenceNull = LLGL_CAST(NullFence&, fence);
+    if (IsDeferred())
+    {
+        /* Signal the fence once the worker thread has processed all previous submissions */
+        EnqueueSubmission(nullptr, &fenceNull, fenceNull.NextValue());
+    }
+    else
+    {
+        /* Commands are executed at submission, so the fence can be signaled right away */
+        fenceNull.Signal(fenceNull.NextValue());
+    }
 }
 
 bool NullCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
 {
-    return false; //todo
+    auto& fenceNull = LLGL_CAST(NullFence&, fence);
+    return fenceNull.WaitForValue(fenceNull.GetPendingValue(), timeout);
 }
 
 void NullCommandQueue::WaitIdle()
 {
-    //todo
+    if (IsDeferred())
+    {
+        std::uint64_t submissionID = 0;
+        {
+            std::lock_guard<std::mutex> guard{ mutex_ };
+            submissionID = lastSubmissionID_;
+        }
+        WaitForSubmission(submissionID);
+    }
+}
+
+
+/*
+ * ======= Internal: =======
+ */
+
+void NullCommandQueue::SubmitCommandBuffer(NullCommandBuffer& commandBuffer)
+{
+    if (IsDeferred())
+        commandBuffer.SetPendingSubmission(EnqueueSubmission(&commandBuffer, nullptr, 0));
+    else
+        commandBuffer.ExecuteVirtualCommands();
+}
+
+void NullCommandQueue::WaitForSubmission(std::uint64_t submissionID)
+{
+    if (IsDeferred())
+    {
+        std::unique_lock<std::mutex> lock{ mutex_ };
+        completedCV_.wait(lock, [this, submissionID]() -> bool { return (lastCompletedID_ >= submissionID); });
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+std::uint64_t NullCommandQueue::EnqueueSubmission(NullCommandBuffer* commandBuffer, NullFence* fence, std::uint64_t fenceValue)
+{
+    std::uint64_t submissionID = 0;
+    {
+        std::lock_guard<std::mutex> guard{ mutex_ };
+        submissionID = ++lastSubmissionID_;
+        submissions_.push_back(Submission{ submissionID, commandBuffer, fence, fenceValue });
+    }
+    submittedCV_.notify_one();
+    return submissionID;
+}
+
+void NullCommandQueue::WorkerThreadMain()
+{
+    std::unique_lock<std::mutex> lock{ mutex_ };
+
+    for (;;)
+    {
+        submittedCV_.wait(lock, [this]() -> bool { return (isQuitting_ || !submissions_.empty()); });
+
+        /* Only quit once all submissions have been processed */
+        if (submissions_.empty())
+            break;
+
+        const Submission submission = submissions_.front();
+        submissions_.pop_front();
+
+        /* Process submission without holding the lock, so the submitting thread can keep enqueuing work */
+        lock.unlock();
+        {
+            if (submission.commandBuffer != nullptr)
+                submission.commandBuffer->ExecuteVirtualCommands();
+            if (submission.fence != nullptr)
+                submission.fence->Signal(submission.fenceValue);
+        }
+        lock.lock();
+
+        lastCompletedID_ = submission.id;
+        completedCV_.notify_all();
+    }
 }
 
 
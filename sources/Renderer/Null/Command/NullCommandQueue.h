@@ -10,12 +10,25 @@
 
 
 #include <LLGL/CommandQueue.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <cstdint>
 
 
 namespace LLGL
 {
 
 
+class NullCommandBuffer;
+class NullFence;
+
+/*
+Command queue for the Null renderer.
+With deferred submission, command buffers and fences are enqueued and processed in submission order by a worker thread.
+Otherwise, command buffers are executed on the calling thread at submission.
+*/
 class NullCommandQueue final : public CommandQueue
 {
 
@@ -23,6 +36,53 @@ class NullCommandQueue final : public CommandQueue
 
         #include <LLGL/Backend/CommandQueue.inl>
 
+    public:
+
+        NullCommandQueue(bool isDeferred = false);
+        ~NullCommandQueue();
+
+        // Executes the specified command buffer or enqueues it for the worker thread if deferred submission is enabled.
+        void SubmitCommandBuffer(NullCommandBuffer& commandBuffer);
+
+        // Waits until the specified submission and all submissions before it have been processed.
+        void WaitForSubmission(std::uint64_t submissionID);
+
+        // Returns true if submissions are processed by a worker thread.
+        inline bool IsDeferred() const
+        {
+            return worker_.joinable();
+        }
+
+    private:
+
+        struct Submission
+        {
+            std::uint64_t       id;
+            NullCommandBuffer*  commandBuffer;
+            NullFence*          fence;
+            std::uint64_t       fenceValue;
+        };
+
+    private:
+
+        // Enqueues the specified command buffer or fence and returns the new submission ID.
+        std::uint64_t EnqueueSubmission(NullCommandBuffer* commandBuffer, NullFence* fence, std::uint64_t fenceValue);
+
+        // Main function of the worker thread. Processes submissions until the queue is destroyed.
+        void WorkerThreadMain();
+
+    private:
+
+        std::thread                 worker_;
+
+        std::mutex                  mutex_;
+        std::condition_variable     submittedCV_;
+        std::condition_variable     completedCV_;
+        std::deque<Submission>      submissions_;
+        std::uint64_t               lastSubmissionID_       = 0;
+        std::uint64_t               lastCompletedID_        = 0;
+        bool                        isQuitting_             = false;
+
 };
 
 
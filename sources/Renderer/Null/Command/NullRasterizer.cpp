@@ -0,0 +1,1292 @@
+/*
+ * NullRasterizer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "NullRasterizer.h"
+#include "../Buffer/NullBuffer.h"
+#include "../Shader/NullShader.h"
+#include "../Texture/NullTexture.h"
+#include "../RenderState/NullPipelineState.h"
+#include "../../CheckedCast.h"
+#include "../../../Core/Threading.h"
+#include "../../../Core/Float16Compressor.h"
+#include <LLGL/Utils/ForRange.h>
+#include <atomic>
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+// Number of fractional bits for the fixed-point sub-pixel coordinates.
+static constexpr std::int64_t   k_subPixelBits      = 4;
+static constexpr std::int64_t   k_subPixelScale     = (1 << k_subPixelBits);
+
+// Screen coordinates are clamped to this guard band (in pixels) so the fixed-point edge equations cannot overflow.
+static constexpr float          k_guardBand         = static_cast<float>(1 << 20);
+
+// Minimal clip space W coordinate of the near plane.
+static constexpr float          k_nearPlaneW        = 1.0e-5f;
+
+/*
+ * Pixel format helpers
+ */
+
+static float SRGBToLinear(float value)
+{
+    if (value <= 0.04045f)
+        return value / 12.92f;
+    else
+        return std::pow((value + 0.055f) / 1.055f, 2.4f);
+}
+
+static float LinearToSRGB(float value)
+{
+    if (value <= 0.0031308f)
+        return value * 12.92f;
+    else
+        return 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+}
+
+static float Saturate(float value)
+{
+    return std::max(0.0f, std::min(value, 1.0f));
+}
+
+// Returns the component index in memory for each of the four RGBA color channels or -1 if the channel does not exist.
+static void GetComponentIndices(ImageFormat format, int (&outIndices)[4])
+{
+    switch (format)
+    {
+        case ImageFormat::Alpha:    outIndices[0] = -1; outIndices[1] = -1; outIndices[2] = -1; outIndices[3] =  0; break;
+        case ImageFormat::R:        outIndices[0] =  0; outIndices[1] = -1; outIndices[2] = -1; outIndices[3] = -1; break;
+        case ImageFormat::RG:       outIndices[0] =  0; outIndices[1] =  1; outIndices[2] = -1; outIndices[3] = -1; break;
+        case ImageFormat::RGB:      outIndices[0] =  0; outIndices[1] =  1; outIndices[2] =  2; outIndices[3] = -1; break;
+        case ImageFormat::BGR:      outIndices[0] =  2; outIndices[1] =  1; outIndices[2] =  0; outIndices[3] = -1; break;
+        case ImageFormat::RGBA:     outIndices[0] =  0; outIndices[1] =  1; outIndices[2] =  2; outIndices[3] =  3; break;
+        case ImageFormat::BGRA:     outIndices[0] =  2; outIndices[1] =  1; outIndices[2] =  0; outIndices[3] =  3; break;
+        case ImageFormat::ARGB:     outIndices[0] =  1; outIndices[1] =  2; outIndices[2] =  3; outIndices[3] =  0; break;
+        case ImageFormat::ABGR:     outIndices[0] =  3; outIndices[1] =  2; outIndices[2] =  1; outIndices[3] =  0; break;
+        default:                    outIndices[0] = -1; outIndices[1] = -1; outIndices[2] = -1; outIndices[3] = -1; break;
+    }
+}
+
+static float ReadComponent(const char* data, std::size_t index, DataType dataType, bool isNormalized)
+{
+    switch (dataType)
+    {
+        case DataType::Int8:
+        {
+            const float value = static_cast<float>(reinterpret_cast<const std::int8_t*>(data)[index]);
+            return (isNormalized ? std::max(value / 127.0f, -1.0f) : value);
+        }
+        case DataType::UInt8:
+        {
+            const float value = static_cast<float>(reinterpret_cast<const std::uint8_t*>(data)[index]);
+            return (isNormalized ? value / 255.0f : value);
+        }
+        case DataType::Int16:
+        {
+            const float value = static_cast<float>(reinterpret_cast<const std::int16_t*>(data)[index]);
+            return (isNormalized ? std::max(value / 32767.0f, -1.0f) : value);
+        }
+        case DataType::UInt16:
+        {
+            const float value = static_cast<float>(reinterpret_cast<const std::uint16_t*>(data)[index]);
+            return (isNormalized ? value / 65535.0f : value);
+        }
+        case DataType::Int32:
+            return static_cast<float>(reinterpret_cast<const std::int32_t*>(data)[index]);
+        case DataType::UInt32:
+            return static_cast<float>(reinterpret_cast<const std::uint32_t*>(data)[index]);
+        case DataType::Float16:
+            return DecompressFloat16(reinterpret_cast<const std::uint16_t*>(data)[index]);
+        case DataType::Float32:
+            return reinterpret_cast<const float*>(data)[index];
+        case DataType::Float64:
+            return static_cast<float>(reinterpret_cast<const double*>(data)[index]);
+        default:
+            return 0.0f;
+    }
+}
+
+template <typename T>
+static T NormalizeComponent(float value, float minValue, float maxValue)
+{
+    const float scaled = std::max(minValue, std::min(value, 1.0f)) * maxValue;
+    return static_cast<T>(scaled < 0.0f ? scaled - 0.5f : scaled + 0.5f);
+}
+
+static void WriteComponent(char* data, std::size_t index, DataType dataType, bool isNormalized, float value)
+{
+    switch (dataType)
+    {
+        case DataType::Int8:
+            reinterpret_cast<std::int8_t*>(data)[index] = (isNormalized ? NormalizeComponent<std::int8_t>(value, -1.0f, 127.0f) : static_cast<std::int8_t>(value));
+            break;
+        case DataType::UInt8:
+            reinterpret_cast<std::uint8_t*>(data)[index] = (isNormalized ? NormalizeComponent<std::uint8_t>(value, 0.0f, 255.0f) : static_cast<std::uint8_t>(value));
+            break;
+        case DataType::Int16:
+            reinterpret_cast<std::int16_t*>(data)[index] = (isNormalized ? NormalizeComponent<std::int16_t>(value, -1.0f, 32767.0f) : static_cast<std::int16_t>(value));
+            break;
+        case DataType::UInt16:
+            reinterpret_cast<std::uint16_t*>(data)[index] = (isNormalized ? NormalizeComponent<std::uint16_t>(value, 0.0f, 65535.0f) : static_cast<std::uint16_t>(value));
+            break;
+        case DataType::Int32:
+            reinterpret_cast<std::int32_t*>(data)[index] = static_cast<std::int32_t>(value);
+            break;
+        case DataType::UInt32:
+            reinterpret_cast<std::uint32_t*>(data)[index] = static_cast<std::uint32_t>(std::max(0.0f, value));
+            break;
+        case DataType::Float16:
+            reinterpret_cast<std::uint16_t*>(data)[index] = CompressFloat16(value);
+            break;
+        case DataType::Float32:
+            reinterpret_cast<float*>(data)[index] = value;
+            break;
+        case DataType::Float64:
+            reinterpret_cast<double*>(data)[index] = static_cast<double>(value);
+            break;
+        default:
+            break;
+    }
+}
+
+// Returns true if the specified surface has linear 8-bit normalized unsigned integer components, which is the most common render target format.
+static bool IsLinearUNorm8Surface(const NullRasterizer::Surface& surface)
+{
+    return (surface.dataType == DataType::UInt8 && surface.isNormalized && !surface.isSRGB);
+}
+
+static void LoadColor(const NullRasterizer::Surface& surface, const char* pixel, float (&outColor)[4])
+{
+    if (IsLinearUNorm8Surface(surface))
+    {
+        const std::uint8_t* bytes = reinterpret_cast<const std::uint8_t*>(pixel);
+        for_range(c, 4)
+            outColor[c] = (surface.channels[c] >= 0 ? static_cast<float>(bytes[surface.channels[c]]) * (1.0f / 255.0f) : (c < 3 ? 0.0f : 1.0f));
+        return;
+    }
+
+    for_range(c, 4)
+    {
+        if (surface.channels[c] >= 0)
+        {
+            outColor[c] = ReadComponent(pixel, static_cast<std::size_t>(surface.channels[c]), surface.dataType, surface.isNormalized);
+            if (surface.isSRGB && c < 3)
+                outColor[c] = SRGBToLinear(outColor[c]);
+        }
+        else
+            outColor[c] = (c < 3 ? 0.0f : 1.0f);
+    }
+}
+
+static void StoreColor(const NullRasterizer::Surface& surface, char* pixel, const float (&color)[4], std::uint8_t colorMask)
+{
+    if (IsLinearUNorm8Surface(surface))
+    {
+        std::uint8_t* bytes = reinterpret_cast<std::uint8_t*>(pixel);
+        for_range(c, 4)
+        {
+            if (surface.channels[c] >= 0 && (colorMask & (1u << c)) != 0)
+                bytes[surface.channels[c]] = static_cast<std::uint8_t>(Saturate(color[c]) * 255.0f + 0.5f);
+        }
+        return;
+    }
+
+    for_range(c, 4)
+    {
+        if (surface.channels[c] >= 0 && (colorMask & (1u << c)) != 0)
+        {
+            const float value = (surface.isSRGB && c < 3 ? LinearToSRGB(Saturate(color[c])) : color[c]);
+            WriteComponent(pixel, static_cast<std::size_t>(surface.channels[c]), surface.dataType, surface.isNormalized, value);
+        }
+    }
+}
+
+static bool HasDepthComponent(const NullRasterizer::Surface& surface)
+{
+    return (surface.data != nullptr && (surface.format == ImageFormat::Depth || surface.format == ImageFormat::DepthStencil));
+}
+
+// Reads the depth value with the same encoding as the generic image conversion for depth-stencil formats.
+static float LoadDepth(const NullRasterizer::Surface& surface, const char* pixel)
+{
+    if (surface.format == ImageFormat::Depth && surface.dataType == DataType::UInt16)
+        return DecompressFloat16(*reinterpret_cast<const std::uint16_t*>(pixel));
+    if (surface.format == ImageFormat::DepthStencil && surface.dataType == DataType::UInt32)
+        return static_cast<float>(*reinterpret_cast<const std::uint32_t*>(pixel) & 0x00FFFFFFu) / static_cast<float>(0x00FFFFFFu);
+    if (surface.dataType == DataType::Float32)
+        return *reinterpret_cast<const float*>(pixel);
+    return 1.0f;
+}
+
+// Writes the depth and/or stencil value (selected by 'flags') with the same encoding as the generic image conversion for depth-stencil formats.
+static void StoreDepthStencil(const NullRasterizer::Surface& surface, char* pixel, long flags, float depth, std::uint32_t stencil)
+{
+    const bool writeDepth   = ((flags & ClearFlags::Depth) != 0);
+    const bool writeStencil = ((flags & ClearFlags::Stencil) != 0);
+
+    depth = Saturate(depth);
+
+    switch (surface.format)
+    {
+        case ImageFormat::Depth:
+        {
+            if (writeDepth)
+            {
+                if (surface.dataType == DataType::UInt16)
+                    *reinterpret_cast<std::uint16_t*>(pixel) = CompressFloat16(depth);
+                else if (surface.dataType == DataType::Float32)
+                    *reinterpret_cast<float*>(pixel) = depth;
+            }
+        }
+        break;
+
+        case ImageFormat::DepthStencil:
+        {
+            if (surface.dataType == DataType::UInt32)
+            {
+                std::uint32_t& value = *reinterpret_cast<std::uint32_t*>(pixel);
+                if (writeDepth)
+                    value = (value & 0xFF000000u) | (static_cast<std::uint32_t>(depth * static_cast<float>(0x00FFFFFFu)) & 0x00FFFFFFu);
+                if (writeStencil)
+                    value = (value & 0x00FFFFFFu) | ((stencil & 0x000000FFu) << 24);
+            }
+            else if (surface.dataType == DataType::Float32)
+            {
+                if (writeDepth)
+                    reinterpret_cast<float*>(pixel)[0] = depth;
+                if (writeStencil)
+                    reinterpret_cast<std::uint32_t*>(pixel)[1] = ((stencil & 0x000000FFu) << 24);
+            }
+        }
+        break;
+
+        case ImageFormat::Stencil:
+        {
+            if (writeStencil)
+            {
+                if (surface.dataType == DataType::UInt8)
+                    *reinterpret_cast<std::uint8_t*>(pixel) = static_cast<std::uint8_t>(stencil & 0xFFu);
+                else if (surface.dataType == DataType::UInt32)
+                    *reinterpret_cast<std::uint32_t*>(pixel) = (stencil & 0xFFu);
+            }
+        }
+        break;
+
+        default:
+        break;
+    }
+}
+
+/*
+ * Pixel stage helpers
+ */
+
+static bool PassesCompareOp(CompareOp compareOp, float src, float dst)
+{
+    switch (compareOp)
+    {
+        case CompareOp::NeverPass:      return false;
+        case CompareOp::Less:           return (src <  dst);
+        case CompareOp::Equal:          return (src == dst);
+        case CompareOp::LessEqual:      return (src <= dst);
+        case CompareOp::Greater:        return (src >  dst);
+        case CompareOp::NotEqual:       return (src != dst);
+        case CompareOp::GreaterEqual:   return (src >= dst);
+        case CompareOp::AlwaysPass:     return true;
+    }
+    return true;
+}
+
+// Returns the blend factors for the specified channels. Dual-source blend operations use the primary source, since the fixed-function pixel stage has only one output.
+static void GetBlendOpFactors(
+    BlendOp         op,
+    const float     (&src)[4],
+    const float     (&dst)[4],
+    const float     (&constant)[4],
+    int             firstChannel,
+    int             numChannels,
+    float*          outFactors)
+{
+    for (int c = firstChannel; c < firstChannel + numChannels; ++c)
+    {
+        float factor = 1.0f;
+        switch (op)
+        {
+            case BlendOp::Zero:             factor = 0.0f;                  break;
+            case BlendOp::One:              factor = 1.0f;                  break;
+            case BlendOp::SrcColor:         factor = src[c];                break;
+            case BlendOp::InvSrcColor:      factor = 1.0f - src[c];         break;
+            case BlendOp::SrcAlpha:         factor = src[3];                break;
+            case BlendOp::InvSrcAlpha:      factor = 1.0f - src[3];         break;
+            case BlendOp::DstColor:         factor = dst[c];                break;
+            case BlendOp::InvDstColor:      factor = 1.0f - dst[c];         break;
+            case BlendOp::DstAlpha:         factor = dst[3];                break;
+            case BlendOp::InvDstAlpha:      factor = 1.0f - dst[3];         break;
+            case BlendOp::SrcAlphaSaturate: factor = (c < 3 ? std::min(src[3], 1.0f - dst[3]) : 1.0f); break;
+            case BlendOp::BlendFactor:      factor = constant[c];           break;
+            case BlendOp::InvBlendFactor:   factor = 1.0f - constant[c];    break;
+            case BlendOp::Src1Color:        factor = src[c];                break;
+            case BlendOp::InvSrc1Color:     factor = 1.0f - src[c];         break;
+            case BlendOp::Src1Alpha:        factor = src[3];                break;
+            case BlendOp::InvSrc1Alpha:     factor = 1.0f - src[3];         break;
+        }
+        outFactors[c] = factor;
+    }
+}
+
+static float ApplyBlendArithmetic(BlendArithmetic arithmetic, float src, float srcFactor, float dst, float dstFactor)
+{
+    switch (arithmetic)
+    {
+        case BlendArithmetic::Add:          return (src * srcFactor + dst * dstFactor);
+        case BlendArithmetic::Subtract:     return (src * srcFactor - dst * dstFactor);
+        case BlendArithmetic::RevSubtract:  return (dst * dstFactor - src * srcFactor);
+        case BlendArithmetic::Min:          return std::min(src, dst);
+        case BlendArithmetic::Max:          return std::max(src, dst);
+    }
+    return src;
+}
+
+static void BlendColor(
+    const BlendTargetDescriptor&    target,
+    const float                     (&src)[4],
+    const float                     (&dst)[4],
+    const float                     (&constant)[4],
+    float                           (&outColor)[4])
+{
+    float srcFactors[4], dstFactors[4];
+    GetBlendOpFactors(target.srcColor, src, dst, constant, 0, 3, srcFactors);
+    GetBlendOpFactors(target.dstColor, src, dst, constant, 0, 3, dstFactors);
+    GetBlendOpFactors(target.srcAlpha, src, dst, constant, 3, 1, srcFactors);
+    GetBlendOpFactors(target.dstAlpha, src, dst, constant, 3, 1, dstFactors);
+
+    for_range(c, 3)
+        outColor[c] = ApplyBlendArithmetic(target.colorArithmetic, src[c], srcFactors[c], dst[c], dstFactors[c]);
+    outColor[3] = ApplyBlendArithmetic(target.alphaArithmetic, src[3], srcFactors[3], dst[3], dstFactors[3]);
+}
+
+/*
+ * Vertex stage helpers
+ */
+
+static bool StartsWithCaseInsensitive(const char* str, const char* prefix)
+{
+    for (; *prefix != '\0'; ++str, ++prefix)
+    {
+        if (std::tolower(static_cast<unsigned char>(*str)) != *prefix)
+            return false;
+    }
+    return true;
+}
+
+static bool ContainsCaseInsensitive(const char* str, const char* substr)
+{
+    for (; *str != '\0'; ++str)
+    {
+        if (StartsWithCaseInsensitive(str, substr))
+            return true;
+    }
+    return false;
+}
+
+// Reads up to four components of the specified vertex attribute. Components that are not available keep their previous value.
+static void FetchVertexAttribute(
+    const VertexAttribute&      attrib,
+    std::uint64_t               vertexID,
+    std::uint64_t               instanceID,
+    std::size_t                 numVertexBuffers,
+    const NullBuffer* const *   vertexBuffers,
+    float                       (&outValue)[4])
+{
+    if (attrib.slot >= numVertexBuffers || vertexBuffers[attrib.slot] == nullptr)
+        return;
+
+    const FormatAttributes& formatAttribs = GetFormatAttribs(attrib.format);
+    if ((formatAttribs.flags & (FormatFlags::IsPacked | FormatFlags::IsCompressed)) != 0 || formatAttribs.components == 0)
+        return;
+
+    /* Determine byte offset of the attribute within its vertex buffer */
+    const NullBuffer& buffer = *vertexBuffers[attrib.slot];
+    const std::uint64_t element = (attrib.instanceDivisor > 0 ? instanceID / attrib.instanceDivisor : vertexID);
+    const std::uint64_t offset  = attrib.offset + element * attrib.stride;
+    if (offset + formatAttribs.bitSize / 8 > buffer.desc.size)
+        return;
+
+    const char* data = reinterpret_cast<const char*>(buffer.GetData()) + offset;
+    const bool isNormalized = ((formatAttribs.flags & FormatFlags::IsNormalized) != 0);
+
+    for_range(c, std::min<std::uint32_t>(formatAttribs.components, 4))
+        outValue[c] = ReadComponent(data, c, formatAttribs.dataType, isNormalized);
+}
+
+static NullRasterizer::Vertex LerpVertex(const NullRasterizer::Vertex& a, const NullRasterizer::Vertex& b, float t)
+{
+    NullRasterizer::Vertex v;
+    for_range(i, 4)
+    {
+        v.position[i]   = a.position[i] + (b.position[i] - a.position[i]) * t;
+        v.color[i]      = a.color[i]    + (b.color[i]    - a.color[i]   ) * t;
+    }
+    v.viewportIndex = a.viewportIndex;
+    return v;
+}
+
+static std::int64_t FloorDivSubPixel(std::int64_t value)
+{
+    return (value >= 0 ? value / k_subPixelScale : -((-value + k_subPixelScale - 1) / k_subPixelScale));
+}
+
+static bool MakeSurface(NullRasterizer::Surface& surface, const NullAttachment& attachment)
+{
+    surface = NullRasterizer::Surface{};
+
+    NullTexture* texture = attachment.texture;
+    if (texture == nullptr)
+        return false;
+
+    const FormatAttributes& formatAttribs = GetFormatAttribs(texture->desc.format);
+    if ((formatAttribs.flags & (FormatFlags::IsPacked | FormatFlags::IsCompressed)) != 0)
+        return false;
+
+    /* Select array layer within the MIP-map image */
+    Image& image = texture->GetMipImage(attachment.mipLevel);
+    const Extent3D& extent = image.GetExtent();
+
+    std::size_t layerOffset = 0;
+    std::uint32_t height = extent.height;
+
+    if (texture->GetType() == TextureType::Texture1DArray)
+    {
+        layerOffset = static_cast<std::size_t>(std::min(attachment.arrayLayer, extent.height - 1)) * image.GetRowStride();
+        height      = 1;
+    }
+    else
+        layerOffset = static_cast<std::size_t>(std::min(attachment.arrayLayer, extent.depth - 1)) * image.GetDepthStride();
+
+    surface.data            = reinterpret_cast<char*>(image.GetData()) + layerOffset;
+    surface.rowStride       = image.GetRowStride();
+    surface.bpp             = image.GetBytesPerPixel();
+    surface.width           = static_cast<std::int32_t>(extent.width);
+    surface.height          = static_cast<std::int32_t>(height);
+    surface.format          = image.GetFormat();
+    surface.dataType        = image.GetDataType();
+    surface.isNormalized    = ((formatAttribs.flags & FormatFlags::IsNormalized) != 0);
+    surface.isSRGB          = ((formatAttribs.flags & FormatFlags::IsColorSpace_sRGB) != 0);
+    GetComponentIndices(surface.format, surface.channels);
+
+    return true;
+}
+
+static void ClearColorSurface(const NullRasterizer::Surface& surface, const float (&color)[4])
+{
+    /* Encode clear color once and replicate it across all pixels */
+    std::uint64_t pixelData[4] = {};
+    if (surface.bpp > sizeof(pixelData))
+        return;
+
+    char* pixel = reinterpret_cast<char*>(pixelData);
+    StoreColor(surface, pixel, color, ColorMaskFlags::All);
+
+    DoConcurrentRange(
+        [&surface, pixel](std::size_t begin, std::size_t end)
+        {
+            for_subrange(y, begin, end)
+            {
+                char* row = surface.data + y * surface.rowStride;
+                for_range(x, static_cast<std::size_t>(surface.width))
+                    ::memcpy(row + x * surface.bpp, pixel, surface.bpp);
+            }
+        },
+        static_cast<std::size_t>(surface.height)
+    );
+}
+
+static void ClearDepthStencilSurface(const NullRasterizer::Surface& surface, long flags, float depth, std::uint32_t stencil)
+{
+    DoConcurrentRange(
+        [&surface, flags, depth, stencil](std::size_t begin, std::size_t end)
+        {
+            for_subrange(y, begin, end)
+            {
+                char* row = surface.data + y * surface.rowStride;
+                for_range(x, static_cast<std::size_t>(surface.width))
+                    StoreDepthStencil(surface, row + x * surface.bpp, flags, depth, stencil);
+            }
+        },
+        static_cast<std::size_t>(surface.height)
+    );
+}
+
+
+/*
+ * NullRasterizer class
+ */
+
+void NullRasterizer::BeginRenderPass(
+    std::uint32_t           numColorAttachments,
+    const NullAttachment*   colorAttachments,
+    const NullAttachment&   depthStencilAttachment)
+{
+    Flush();
+
+    /* Bind attachment surfaces and determine render area */
+    renderWidth_    = 0;
+    renderHeight_   = 0;
+
+    bool hasRenderArea = false;
+    auto UpdateRenderArea = [this, &hasRenderArea](const Surface& surface)
+    {
+        renderWidth_    = (hasRenderArea ? std::min(renderWidth_, surface.width) : surface.width);
+        renderHeight_   = (hasRenderArea ? std::min(renderHeight_, surface.height) : surface.height);
+        hasRenderArea   = true;
+    };
+
+    numColorSurfaces_ = std::min<std::uint32_t>(numColorAttachments, LLGL_MAX_NUM_COLOR_ATTACHMENTS);
+    framebufferAttachment_ = (numColorSurfaces_ > 0 ? colorAttachments[0] : NullAttachment{});
+    for_range(i, numColorSurfaces_)
+    {
+        if (MakeSurface(colorSurfaces_[i], colorAttachments[i]))
+            UpdateRenderArea(colorSurfaces_[i]);
+    }
+
+    if (MakeSurface(depthStencilSurface_, depthStencilAttachment))
+        UpdateRenderArea(depthStencilSurface_);
+
+    /* Allocate one bin per screen tile */
+    numTilesX_ = (renderWidth_  + tileSize - 1) / tileSize;
+    numTilesY_ = (renderHeight_ + tileSize - 1) / tileSize;
+    ResetBins();
+
+    isDrawStateDirty_ = true;
+}
+
+void NullRasterizer::EndRenderPass()
+{
+    Flush();
+
+    numColorSurfaces_       = 0;
+    depthStencilSurface_    = Surface{};
+    framebufferAttachment_  = NullAttachment{};
+    renderWidth_            = 0;
+    renderHeight_           = 0;
+    numTilesX_              = 0;
+    numTilesY_              = 0;
+    ResetBins();
+}
+
+void NullRasterizer::ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments)
+{
+    /* Pending primitives must be rasterized before their attachments are cleared */
+    Flush();
+
+    for_range(i, numAttachments)
+    {
+        const AttachmentClear& attachment = attachments[i];
+        if ((attachment.flags & ClearFlags::Color) != 0)
+        {
+            if (attachment.colorAttachment < numColorSurfaces_)
+            {
+                const Surface& surface = colorSurfaces_[attachment.colorAttachment];
+                if (surface.data != nullptr && !IsDepthOrStencilFormat(surface.format))
+                    ClearColorSurface(surface, attachment.clearValue.color);
+            }
+        }
+        else if (depthStencilSurface_.data != nullptr && (attachment.flags & ClearFlags::DepthStencil) != 0)
+            ClearDepthStencilSurface(depthStencilSurface_, attachment.flags, attachment.clearValue.depth, attachment.clearValue.stencil);
+    }
+}
+
+void NullRasterizer::CopyFramebuffer(NullTexture& dstTexture, const TextureRegion& dstRegion, const Offset2D& srcOffset)
+{
+    if (framebufferAttachment_.texture == nullptr)
+        return;
+
+    /* Pending primitives must be rasterized before the framebuffer is read */
+    Flush();
+
+    dstTexture.CopyFromTexture(
+        dstRegion.subresource.baseMipLevel,
+        dstRegion.subresource.baseArrayLayer,
+        dstRegion.offset,
+        *(framebufferAttachment_.texture),
+        framebufferAttachment_.mipLevel,
+        framebufferAttachment_.arrayLayer,
+        Offset3D{ srcOffset.x, srcOffset.y, 0 },
+        Extent3D{ dstRegion.extent.width, dstRegion.extent.height, 1 }
+    );
+}
+
+void NullRasterizer::SetViewports(std::uint32_t numViewports, const Viewport* viewports)
+{
+    numViewports_ = std::min(numViewports, LLGL_MAX_NUM_VIEWPORTS_AND_SCISSORS);
+    std::copy(viewports, viewports + numViewports_, viewports_);
+    isDrawStateDirty_ = true;
+}
+
+void NullRasterizer::SetScissors(std::uint32_t numScissors, const Scissor* scissors)
+{
+    std::copy(scissors, scissors + std::min(numScissors, LLGL_MAX_NUM_VIEWPORTS_AND_SCISSORS), scissors_);
+    isDrawStateDirty_ = true;
+}
+
+void NullRasterizer::SetPipelineState(const NullPipelineState* pipelineState)
+{
+    pipelineState_      = pipelineState;
+    isDrawStateDirty_   = true;
+}
+
+void NullRasterizer::SetBlendFactor(const float color[4])
+{
+    std::copy(color, color + 4, blendFactor_);
+    isDrawStateDirty_ = true;
+}
+
+void NullRasterizer::Draw(
+    const DrawIndirectArguments&    args,
+    std::size_t                     numVertexBuffers,
+    const NullBuffer* const *       vertexBuffers)
+{
+    if (args.numVertices == 0 || args.numInstances == 0 || !PrepareDraw())
+        return;
+
+    ProcessDraw(args.numVertices, args.numInstances, args.firstInstance, nullptr, args.firstVertex, numVertexBuffers, vertexBuffers);
+}
+
+void NullRasterizer::DrawIndexed(
+    const DrawIndexedIndirectArguments& args,
+    const NullBuffer*                   indexBuffer,
+    Format                              indexFormat,
+    std::uint64_t                       indexBufferOffset,
+    std::size_t                         numVertexBuffers,
+    const NullBuffer* const *           vertexBuffers)
+{
+    if (indexBuffer == nullptr || args.numIndices == 0 || args.numInstances == 0 || !PrepareDraw())
+        return;
+
+    /* Determine index size and primitive restart index */
+    std::uint64_t indexSize = 0;
+    switch (indexFormat)
+    {
+        case Format::R8UInt:    indexSize = 1; restartIndex_ = 0xFFu;       break;
+        case Format::R16UInt:   indexSize = 2; restartIndex_ = 0xFFFFu;     break;
+        case Format::R32UInt:   indexSize = 4; restartIndex_ = 0xFFFFFFFFu; break;
+        default:                return;
+    }
+
+    /* Read indices within the bounds of the index buffer */
+    const std::uint64_t startOffset = indexBufferOffset + args.firstIndex * indexSize;
+    if (startOffset >= indexBuffer->desc.size)
+        return;
+
+    const std::uint32_t numIndices = static_cast<std::uint32_t>(std::min<std::uint64_t>(args.numIndices, (indexBuffer->desc.size - startOffset) / indexSize));
+    const char* indexData = reinterpret_cast<const char*>(indexBuffer->GetData()) + startOffset;
+
+    indexCache_.resize(numIndices);
+    for_range(i, numIndices)
+    {
+        switch (indexSize)
+        {
+            case 1: indexCache_[i] = reinterpret_cast<const std::uint8_t*>(indexData)[i];  break;
+            case 2: indexCache_[i] = reinterpret_cast<const std::uint16_t*>(indexData)[i]; break;
+            case 4: indexCache_[i] = reinterpret_cast<const std::uint32_t*>(indexData)[i]; break;
+        }
+    }
+
+    ProcessDraw(numIndices, args.numInstances, args.firstInstance, indexCache_.data(), args.vertexOffset, numVertexBuffers, vertexBuffers);
+}
+
+void NullRasterizer::Flush()
+{
+    if (triangles_.empty())
+        return;
+
+    /* Gather all tiles that have at least one triangle */
+    activeTiles_.clear();
+    for_range(i, tileBins_.size())
+    {
+        if (!tileBins_[i].empty())
+            activeTiles_.push_back(static_cast<std::uint32_t>(i));
+    }
+
+    /*
+    Rasterize tiles concurrently; each tile is owned by exactly one worker, so no synchronization is required for the surfaces.
+    Workers pull the next tile from a shared counter instead of processing their assigned range,
+    because the triangle load is usually distributed very unevenly across the screen.
+    */
+    std::atomic<std::size_t> nextTile{ 0 };
+    DoConcurrentRange(
+        [this, &nextTile](std::size_t /*begin*/, std::size_t /*end*/)
+        {
+            for (std::size_t i = nextTile++; i < activeTiles_.size(); i = nextTile++)
+                RasterizeTile(activeTiles_[i]);
+        },
+        activeTiles_.size(),
+        LLGL_MAX_THREAD_COUNT,
+        1
+    );
+
+    /* Reset bins but keep the current draw state for the draw command that might still be in progress */
+    for (std::uint32_t tileIndex : activeTiles_)
+        tileBins_[tileIndex].clear();
+
+    triangles_.clear();
+
+    if (!drawStates_.empty())
+    {
+        drawStates_.erase(drawStates_.begin(), drawStates_.begin() + firstDrawState_);
+        firstDrawState_ = 0;
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool NullRasterizer::PrepareDraw()
+{
+    if (pipelineState_ == nullptr || !pipelineState_->isGraphicsPSO || renderWidth_ <= 0 || renderHeight_ <= 0)
+        return false;
+
+    const GraphicsPipelineDescriptor& pipelineDesc = pipelineState_->graphicsDesc;
+    if (pipelineDesc.rasterizer.discardEnabled)
+        return false;
+
+    if (isDrawStateDirty_)
+    {
+        /* Select vertex attributes for the fixed-function vertex stage */
+        positionAttrib_         = nullptr;
+        colorAttrib_            = nullptr;
+        viewportIndexAttrib_    = nullptr;
+
+        if (pipelineDesc.vertexShader != nullptr)
+        {
+            auto* vertexShaderNull = LLGL_CAST(const NullShader*, pipelineDesc.vertexShader);
+            for (const VertexAttribute& attrib : vertexShaderNull->desc.vertex.inputAttribs)
+            {
+                if (positionAttrib_ == nullptr && StartsWithCaseInsensitive(attrib.name.c_str(), "pos"))
+                    positionAttrib_ = &attrib;
+                else if (colorAttrib_ == nullptr && ContainsCaseInsensitive(attrib.name.c_str(), "color"))
+                    colorAttrib_ = &attrib;
+                else if (viewportIndexAttrib_ == nullptr && ContainsCaseInsensitive(attrib.name.c_str(), "viewport"))
+                    viewportIndexAttrib_ = &attrib;
+            }
+            if (positionAttrib_ == nullptr && !vertexShaderNull->desc.vertex.inputAttribs.empty())
+                positionAttrib_ = &(vertexShaderNull->desc.vertex.inputAttribs.front());
+        }
+
+        /* Use entire render area if no viewport has been set */
+        if (numViewports_ > 0)
+        {
+            numDrawViewports_ = numViewports_;
+            std::copy(viewports_, viewports_ + numViewports_, drawViewports_);
+        }
+        else
+        {
+            numDrawViewports_ = 1;
+            drawViewports_[0] = Viewport{ 0.0f, 0.0f, static_cast<float>(renderWidth_), static_cast<float>(renderHeight_) };
+        }
+
+        /* Append one pixel stage state per viewport */
+        firstDrawState_ = static_cast<std::uint32_t>(drawStates_.size());
+
+        for_range(i, numDrawViewports_)
+        {
+            const Viewport& viewport = drawViewports_[i];
+
+            /* Clip viewport against render area and scissor rectangle */
+            std::int32_t (&clipRect)[4] = clipRects_[i];
+            clipRect[0] = std::max(0, static_cast<std::int32_t>(std::floor(viewport.x)));
+            clipRect[1] = std::max(0, static_cast<std::int32_t>(std::floor(viewport.y)));
+            clipRect[2] = std::min(renderWidth_,  static_cast<std::int32_t>(std::ceil(viewport.x + viewport.width)));
+            clipRect[3] = std::min(renderHeight_, static_cast<std::int32_t>(std::ceil(viewport.y + viewport.height)));
+
+            if (pipelineDesc.rasterizer.scissorTestEnabled)
+            {
+                const Scissor& scissor = scissors_[i];
+                clipRect[0] = std::max(clipRect[0], scissor.x);
+                clipRect[1] = std::max(clipRect[1], scissor.y);
+                clipRect[2] = std::min(clipRect[2], scissor.x + scissor.width);
+                clipRect[3] = std::min(clipRect[3], scissor.y + scissor.height);
+            }
+
+            DrawState state;
+            {
+                state.depth         = &(pipelineDesc.depth);
+                state.blend         = &(pipelineDesc.blend);
+                state.minDepth      = viewport.minDepth;
+                state.maxDepth      = viewport.maxDepth;
+                state.depthClamp    = pipelineDesc.rasterizer.depthClampEnabled;
+                const float* blendFactor = (pipelineDesc.blend.blendFactorDynamic ? blendFactor_ : pipelineDesc.blend.blendFactor);
+                std::copy(blendFactor, blendFactor + 4, state.blendFactor);
+            }
+            drawStates_.push_back(state);
+        }
+
+        isDrawStateDirty_ = false;
+    }
+
+    if (positionAttrib_ == nullptr)
+        return false;
+
+    /* Skip draw commands whose viewports are all clipped entirely */
+    for_range(i, numDrawViewports_)
+    {
+        if (clipRects_[i][0] < clipRects_[i][2] && clipRects_[i][1] < clipRects_[i][3])
+            return true;
+    }
+    return false;
+}
+
+void NullRasterizer::ProcessVertices(
+    std::size_t                 begin,
+    std::size_t                 end,
+    std::uint32_t               numVerticesPerInstance,
+    std::uint32_t               firstInstance,
+    const std::uint32_t*        indices,
+    std::int64_t                baseVertex,
+    std::size_t                 numVertexBuffers,
+    const NullBuffer* const *   vertexBuffers)
+{
+    for_subrange(i, begin, end)
+    {
+        const std::size_t   localIndex  = i % numVerticesPerInstance;
+        const std::uint64_t instanceID  = firstInstance + i / numVerticesPerInstance;
+        const std::int64_t  vertexID    = baseVertex + (indices != nullptr ? indices[localIndex] : static_cast<std::int64_t>(localIndex));
+
+        Vertex& vertex = vertexCache_[i];
+        vertex.position[0]  = 0.0f;
+        vertex.position[1]  = 0.0f;
+        vertex.position[2]  = 0.0f;
+        vertex.position[3]  = 1.0f;
+        vertex.color[0]     = 1.0f;
+        vertex.color[1]     = 1.0f;
+        vertex.color[2]     = 1.0f;
+        vertex.color[3]     = 1.0f;
+        vertex.viewportIndex = 0;
+
+        /* Skip invalid vertex IDs and primitive restart indices */
+        if (vertexID < 0 || (indices != nullptr && indices[localIndex] == restartIndex_))
+            continue;
+
+        FetchVertexAttribute(*positionAttrib_, static_cast<std::uint64_t>(vertexID), instanceID, numVertexBuffers, vertexBuffers, vertex.position);
+        if (colorAttrib_ != nullptr)
+            FetchVertexAttribute(*colorAttrib_, static_cast<std::uint64_t>(vertexID), instanceID, numVertexBuffers, vertexBuffers, vertex.color);
+        if (viewportIndexAttrib_ != nullptr)
+        {
+            float viewportIndex[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            FetchVertexAttribute(*viewportIndexAttrib_, static_cast<std::uint64_t>(vertexID), instanceID, numVertexBuffers, vertexBuffers, viewportIndex);
+            vertex.viewportIndex = static_cast<std::uint32_t>(std::max(0.0f, viewportIndex[0]));
+        }
+    }
+}
+
+void NullRasterizer::ProcessDraw(
+    std::uint32_t               numVerticesPerInstance,
+    std::uint32_t               numInstances,
+    std::uint32_t               firstInstance,
+    const std::uint32_t*        indices,
+    std::int64_t                baseVertex,
+    std::size_t                 numVertexBuffers,
+    const NullBuffer* const *   vertexBuffers)
+{
+    /* Run vertex stage for all vertices of all instances */
+    const std::size_t numVertices = static_cast<std::size_t>(numVerticesPerInstance) * numInstances;
+    vertexCache_.resize(numVertices);
+
+    DoConcurrentRange(
+        [&](std::size_t begin, std::size_t end)
+        {
+            ProcessVertices(begin, end, numVerticesPerInstance, firstInstance, indices, baseVertex, numVertexBuffers, vertexBuffers);
+        },
+        numVertices
+    );
+
+    /* Assemble and bin primitives in submission order */
+    AssemblePrimitives(numVerticesPerInstance, numInstances, indices);
+}
+
+void NullRasterizer::AssemblePrimitives(std::uint32_t numVerticesPerInstance, std::uint32_t numInstances, const std::uint32_t* indices)
+{
+    const PrimitiveTopology topology = pipelineState_->graphicsDesc.primitiveTopology;
+
+    for_range(instance, numInstances)
+    {
+        const Vertex* vertices = &(vertexCache_[static_cast<std::size_t>(instance) * numVerticesPerInstance]);
+
+        if (topology == PrimitiveTopology::TriangleList)
+        {
+            for (std::uint32_t i = 0; i + 2 < numVerticesPerInstance; i += 3)
+                ClipAndBinTriangle(vertices[i], vertices[i + 1], vertices[i + 2]);
+        }
+        else if (topology == PrimitiveTopology::TriangleStrip)
+        {
+            /* Restart strip at each primitive restart index */
+            std::uint32_t stripStart = 0;
+            for (std::uint32_t i = 0; i < numVerticesPerInstance; ++i)
+            {
+                if (indices != nullptr && indices[i] == restartIndex_)
+                {
+                    stripStart = i + 1;
+                    continue;
+                }
+
+                const std::uint32_t stripIndex = i - stripStart;
+                if (stripIndex < 2)
+                    continue;
+
+                /* Alternate winding for every other triangle in the strip */
+                if (stripIndex % 2 == 0)
+                    ClipAndBinTriangle(vertices[i - 2], vertices[i - 1], vertices[i]);
+                else
+                    ClipAndBinTriangle(vertices[i - 1], vertices[i - 2], vertices[i]);
+            }
+        }
+        else
+        {
+            /* Points, lines, and patches are not rasterized by the fixed-function pipeline */
+            return;
+        }
+    }
+}
+
+void NullRasterizer::ClipAndBinTriangle(const Vertex& v0, const Vertex& v1, const Vertex& v2)
+{
+    const Vertex* vertices[3] = { &v0, &v1, &v2 };
+
+    /* Select viewport by the first vertex of the original triangle, since clipping might remove that vertex */
+    const std::uint32_t viewportIndex = (v0.viewportIndex < numDrawViewports_ ? v0.viewportIndex : 0);
+
+    /* Count vertices in front of the near plane */
+    int numInside = 0;
+    for (const Vertex* v : vertices)
+    {
+        if (v->position[3] > k_nearPlaneW)
+            ++numInside;
+    }
+
+    if (numInside == 3)
+    {
+        SetupAndBinTriangle(v0, v1, v2, viewportIndex);
+        return;
+    }
+    if (numInside == 0)
+        return;
+
+    /* Clip triangle against near plane (W = epsilon), which yields a convex polygon with at most 4 vertices */
+    Vertex polygon[4];
+    int numPolygonVertices = 0;
+
+    for_range(i, 3)
+    {
+        const Vertex& curr = *vertices[i];
+        const Vertex& next = *vertices[(i + 1) % 3];
+
+        const bool isCurrInside = (curr.position[3] > k_nearPlaneW);
+        const bool isNextInside = (next.position[3] > k_nearPlaneW);
+
+        if (isCurrInside)
+            polygon[numPolygonVertices++] = curr;
+
+        if (isCurrInside != isNextInside)
+        {
+            const float t = (k_nearPlaneW - curr.position[3]) / (next.position[3] - curr.position[3]);
+            polygon[numPolygonVertices++] = LerpVertex(curr, next, t);
+        }
+    }
+
+    /* Triangulate clipped polygon as triangle fan, which preserves the winding order */
+    for (int i = 1; i + 1 < numPolygonVertices; ++i)
+        SetupAndBinTriangle(polygon[0], polygon[i], polygon[i + 1], viewportIndex);
+}
+
+void NullRasterizer::SetupAndBinTriangle(const Vertex& v0, const Vertex& v1, const Vertex& v2, std::uint32_t viewportIndex)
+{
+    const RasterizerDescriptor& rasterizerDesc = pipelineState_->graphicsDesc.rasterizer;
+    const Vertex* vertices[3] = { &v0, &v1, &v2 };
+    const Viewport& viewport = drawViewports_[viewportIndex];
+    const std::int32_t (&clipRect)[4] = clipRects_[viewportIndex];
+
+    Triangle triangle;
+    std::int64_t pos[3][2];
+
+    /* Transform vertices into screen space and snap them to the sub-pixel grid */
+    for_range(i, 3)
+    {
+        const Vertex& v = *vertices[i];
+        const float invW = 1.0f / v.position[3];
+        const float ndcX = v.position[0] * invW;
+        const float ndcY = v.position[1] * invW;
+        const float ndcZ = v.position[2] * invW;
+
+        const float screenX = viewport.x + (ndcX + 1.0f) * 0.5f * viewport.width;
+        const float screenY = viewport.y + (1.0f - ndcY) * 0.5f * viewport.height;
+
+        pos[i][0] = static_cast<std::int64_t>(std::lround(std::max(-k_guardBand, std::min(screenX, k_guardBand)) * k_subPixelScale));
+        pos[i][1] = static_cast<std::int64_t>(std::lround(std::max(-k_guardBand, std::min(screenY, k_guardBand)) * k_subPixelScale));
+
+        triangle.depth[i]   = viewport.minDepth + ndcZ * (viewport.maxDepth - viewport.minDepth);
+        triangle.invW[i]    = invW;
+        for_range(c, 4)
+            triangle.color[i][c] = v.color[c] * invW;
+    }
+
+    /* Determine facing; a positive area denotes a clockwise triangle on screen since the Y-axis points downwards */
+    std::int64_t area = (pos[1][0] - pos[0][0]) * (pos[2][1] - pos[0][1]) - (pos[2][0] - pos[0][0]) * (pos[1][1] - pos[0][1]);
+    if (area == 0)
+        return;
+
+    const bool isFrontFacing = (rasterizerDesc.frontCCW ? area < 0 : area > 0);
+    if ((rasterizerDesc.cullMode == CullMode::Front && isFrontFacing) || (rasterizerDesc.cullMode == CullMode::Back && !isFrontFacing))
+        return;
+
+    /* Ensure clockwise order so all edge equations are positive inside the triangle */
+    if (area < 0)
+    {
+        std::swap(pos[1], pos[2]);
+        std::swap(triangle.depth[1], triangle.depth[2]);
+        std::swap(triangle.invW[1], triangle.invW[2]);
+        std::swap(triangle.color[1], triangle.color[2]);
+        area = -area;
+    }
+
+    triangle.invArea = 1.0f / static_cast<float>(area);
+
+    /* Set up edge equations; edge i is opposite to vertex i, so its equation yields the barycentric coordinate of vertex i */
+    for_range(i, 3)
+    {
+        const std::int64_t* a = pos[(i + 1) % 3];
+        const std::int64_t* b = pos[(i + 2) % 3];
+        const std::int64_t dx = b[0] - a[0];
+        const std::int64_t dy = b[1] - a[1];
+        triangle.edgeOrigin[i][0]   = a[0];
+        triangle.edgeOrigin[i][1]   = a[1];
+        triangle.edgeDelta[i][0]    = dx;
+        triangle.edgeDelta[i][1]    = dy;
+        triangle.edgeBias[i]        = ((dy < 0 || (dy == 0 && dx > 0)) ? 0 : 1);
+    }
+
+    /* Determine bounding box clipped against the clipping rectangle */
+    const std::int64_t minX = std::min({ pos[0][0], pos[1][0], pos[2][0] });
+    const std::int64_t minY = std::min({ pos[0][1], pos[1][1], pos[2][1] });
+    const std::int64_t maxX = std::max({ pos[0][0], pos[1][0], pos[2][0] });
+    const std::int64_t maxY = std::max({ pos[0][1], pos[1][1], pos[2][1] });
+
+    triangle.minX   = static_cast<std::int32_t>(std::max<std::int64_t>(FloorDivSubPixel(minX), clipRect[0]));
+    triangle.minY   = static_cast<std::int32_t>(std::max<std::int64_t>(FloorDivSubPixel(minY), clipRect[1]));
+    triangle.maxX   = static_cast<std::int32_t>(std::min<std::int64_t>(FloorDivSubPixel(maxX) + 1, clipRect[2]));
+    triangle.maxY   = static_cast<std::int32_t>(std::min<std::int64_t>(FloorDivSubPixel(maxY) + 1, clipRect[3]));
+    triangle.state  = firstDrawState_ + viewportIndex;
+
+    if (triangle.minX >= triangle.maxX || triangle.minY >= triangle.maxY)
+        return;
+
+    /* Bin triangle into all tiles its bounding box overlaps */
+    const std::uint32_t triangleIndex = static_cast<std::uint32_t>(triangles_.size());
+    triangles_.push_back(triangle);
+
+    for (std::int32_t tileY = triangle.minY / tileSize; tileY <= (triangle.maxY - 1) / tileSize; ++tileY)
+    {
+        for (std::int32_t tileX = triangle.minX / tileSize; tileX <= (triangle.maxX - 1) / tileSize; ++tileX)
+            tileBins_[tileY * numTilesX_ + tileX].push_back(triangleIndex);
+    }
+
+    /* Limit memory footprint of binned triangles */
+    if (triangles_.size() >= maxNumBinnedTriangles)
+        Flush();
+}
+
+void NullRasterizer::RasterizeTile(std::size_t tileIndex)
+{
+    const std::int32_t tileX    = static_cast<std::int32_t>(tileIndex % numTilesX_);
+    const std::int32_t tileY    = static_cast<std::int32_t>(tileIndex / numTilesX_);
+    const std::int32_t minX     = tileX * tileSize;
+    const std::int32_t minY     = tileY * tileSize;
+    const std::int32_t maxX     = std::min(minX + tileSize, renderWidth_);
+    const std::int32_t maxY     = std::min(minY + tileSize, renderHeight_);
+
+    for (std::uint32_t triangleIndex : tileBins_[tileIndex])
+        RasterizeTriangleInTile(triangles_[triangleIndex], minX, minY, maxX, maxY);
+}
+
+void NullRasterizer::RasterizeTriangleInTile(
+    const Triangle& triangle,
+    std::int32_t    tileMinX,
+    std::int32_t    tileMinY,
+    std::int32_t    tileMaxX,
+    std::int32_t    tileMaxY)
+{
+    const DrawState& state = drawStates_[triangle.state];
+
+    const std::int32_t minX = std::max(triangle.minX, tileMinX);
+    const std::int32_t minY = std::max(triangle.minY, tileMinY);
+    const std::int32_t maxX = std::min(triangle.maxX, tileMaxX);
+    const std::int32_t maxY = std::min(triangle.maxY, tileMaxY);
+
+    const bool  depthTest   = (state.depth->testEnabled && HasDepthComponent(depthStencilSurface_));
+    const bool  depthWrite  = (depthTest && state.depth->writeEnabled);
+    const float depthLower  = std::min(state.minDepth, state.maxDepth);
+    const float depthUpper  = std::max(state.minDepth, state.maxDepth);
+
+    /* Copy per-triangle data into locals, since pixel writes through char pointers would otherwise force reloads */
+    const Triangle tri = triangle;
+
+    const Surface* colorSurfaces[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    const BlendTargetDescriptor* blendTargets[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    std::uint32_t numColorTargets = 0;
+
+    for_range(i, numColorSurfaces_)
+    {
+        const BlendTargetDescriptor& target = state.blend->targets[state.blend->independentBlendEnabled ? i : 0];
+        if (colorSurfaces_[i].data != nullptr && target.colorMask != 0)
+        {
+            colorSurfaces[numColorTargets]  = &(colorSurfaces_[i]);
+            blendTargets[numColorTargets]   = &target;
+            ++numColorTargets;
+        }
+    }
+
+    const Surface&      depthSurface    = depthStencilSurface_;
+    const CompareOp     depthCompareOp  = state.depth->compareOp;
+    const bool          depthClamp      = state.depthClamp;
+
+    /* Edge equations are stepped by one pixel (in sub-pixel units) along the X-axis */
+    const std::int64_t stepX[3] =
+    {
+        -tri.edgeDelta[0][1] * k_subPixelScale,
+        -tri.edgeDelta[1][1] * k_subPixelScale,
+        -tri.edgeDelta[2][1] * k_subPixelScale,
+    };
+
+    for (std::int32_t y = minY; y < maxY; ++y)
+    {
+        /* Evaluate edge equations at the center of the first pixel in this row */
+        const std::int64_t centerX = static_cast<std::int64_t>(minX) * k_subPixelScale + k_subPixelScale / 2;
+        const std::int64_t centerY = static_cast<std::int64_t>(y) * k_subPixelScale + k_subPixelScale / 2;
+
+        std::int64_t edges[3];
+        for_range(i, 3)
+        {
+            edges[i] =
+            (
+                tri.edgeDelta[i][0] * (centerY - tri.edgeOrigin[i][1]) -
+                tri.edgeDelta[i][1] * (centerX - tri.edgeOrigin[i][0])
+            );
+        }
+
+        /*
+        Determine the span of covered pixels in this row: the triangle is convex, so each edge equation (E + stepX * dx >= bias)
+        limits the span from one side. This is exact and equivalent to testing the top-left fill rule per pixel.
+        */
+        std::int64_t spanBegin = 0, spanEnd = maxX - minX;
+        for_range(i, 3)
+        {
+            const std::int64_t distance = edges[i] - tri.edgeBias[i];
+            if (stepX[i] > 0)
+            {
+                if (distance < 0)
+                    spanBegin = std::max(spanBegin, (-distance + stepX[i] - 1) / stepX[i]);
+            }
+            else if (stepX[i] < 0)
+            {
+                if (distance < 0)
+                    spanEnd = 0;
+                else
+                    spanEnd = std::min(spanEnd, distance / -stepX[i] + 1);
+            }
+            else if (distance < 0)
+                spanEnd = 0;
+        }
+
+        if (spanBegin >= spanEnd)
+            continue;
+
+        for_range(i, 3)
+            edges[i] += stepX[i] * spanBegin;
+
+        const std::int32_t spanMinX = minX + static_cast<std::int32_t>(spanBegin);
+        const std::int32_t spanMaxX = minX + static_cast<std::int32_t>(spanEnd);
+
+        char* depthRow = (depthTest ? depthSurface.data + static_cast<std::size_t>(y) * depthSurface.rowStride : nullptr);
+
+        for (std::int32_t x = spanMinX; x < spanMaxX; ++x, edges[0] += stepX[0], edges[1] += stepX[1], edges[2] += stepX[2])
+        {
+            const float b0 = static_cast<float>(edges[0]) * tri.invArea;
+            const float b1 = static_cast<float>(edges[1]) * tri.invArea;
+            const float b2 = static_cast<float>(edges[2]) * tri.invArea;
+
+            /* Clip or clamp fragment depth against depth range */
+            float depth = b0 * tri.depth[0] + b1 * tri.depth[1] + b2 * tri.depth[2];
+            if (depth < depthLower || depth > depthUpper)
+            {
+                if (!depthClamp)
+                    continue;
+                depth = std::max(depthLower, std::min(depth, depthUpper));
+            }
+
+            /* Depth test */
+            if (depthTest)
+            {
+                char* depthPixel = depthRow + static_cast<std::size_t>(x) * depthSurface.bpp;
+                if (!PassesCompareOp(depthCompareOp, depth, LoadDepth(depthSurface, depthPixel)))
+                    continue;
+                if (depthWrite)
+                    StoreDepthStencil(depthSurface, depthPixel, ClearFlags::Depth, depth, 0);
+            }
+
+            /* Interpolate perspective correct vertex color */
+            const float w = 1.0f / (b0 * tri.invW[0] + b1 * tri.invW[1] + b2 * tri.invW[2]);
+            float color[4];
+            for_range(c, 4)
+                color[c] = (b0 * tri.color[0][c] + b1 * tri.color[1][c] + b2 * tri.color[2][c]) * w;
+
+            /* Blend and write color to all attachments */
+            for_range(i, numColorTargets)
+            {
+                const Surface& surface = *colorSurfaces[i];
+                const BlendTargetDescriptor& target = *blendTargets[i];
+
+                char* colorPixel = surface.data + static_cast<std::size_t>(y) * surface.rowStride + static_cast<std::size_t>(x) * surface.bpp;
+                if (target.blendEnabled)
+                {
+                    float dstColor[4], blendedColor[4];
+                    LoadColor(surface, colorPixel, dstColor);
+                    BlendColor(target, color, dstColor, state.blendFactor, blendedColor);
+                    StoreColor(surface, colorPixel, blendedColor, target.colorMask);
+                }
+                else
+                    StoreColor(surface, colorPixel, color, target.colorMask);
+            }
+        }
+    }
+}
+
+void NullRasterizer::ResetBins()
+{
+    const std::size_t numTiles = static_cast<std::size_t>(numTilesX_) * static_cast<std::size_t>(numTilesY_);
+    tileBins_.resize(numTiles);
+    for (auto& bin : tileBins_)
+        bin.clear();
+    triangles_.clear();
+    drawStates_.clear();
+    firstDrawState_ = 0;
+    isDrawStateDirty_ = true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
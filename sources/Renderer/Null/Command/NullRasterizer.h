@@ -0,0 +1,252 @@
+/*
+ * NullRasterizer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_NULL_RASTERIZER_H
+#define LLGL_NULL_RASTERIZER_H
+
+
+#include <LLGL/PipelineStateFlags.h>
+#include <LLGL/CommandBufferFlags.h>
+#include <LLGL/IndirectArguments.h>
+#include <LLGL/Constants.h>
+#include "../Texture/NullRenderTarget.h"
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class NullBuffer;
+class NullTexture;
+class NullPipelineState;
+struct VertexAttribute;
+struct TextureRegion;
+
+/*
+Tile-binned software rasterizer for the Null renderer.
+Draw commands run through a fixed-function vertex stage and the resulting triangles are binned into screen tiles.
+The bins are rasterized concurrently (one tile per worker at a time) whenever the rasterizer is flushed,
+i.e. at the end of a render pass, before attachments are cleared, or when too many triangles have been binned.
+Primitives within each tile are rasterized in submission order, so blending and depth testing match the draw order.
+
+Fixed-function behavior:
+ - The vertex position is read from the vertex attribute whose name starts with "pos" (or the first attribute) and is interpreted in clip space.
+ - The vertex color is read from the vertex attribute whose name contains "color" (or white if there is none) and is written to all color attachments.
+ - The viewport index is read from the vertex attribute whose name contains "viewport" (or zero if there is none) of the first vertex of each triangle.
+   It selects both the viewport and the scissor rectangle. Indices outside the bound viewport array select the first viewport.
+ - Only triangle lists and triangle strips are rasterized; points, lines, patches, and stencil operations are ignored.
+*/
+class NullRasterizer
+{
+
+    public:
+
+        NullRasterizer() = default;
+
+        NullRasterizer(const NullRasterizer&) = delete;
+        NullRasterizer& operator = (const NullRasterizer&) = delete;
+
+        // Binds the specified attachments. Any pending primitives of the previous render pass are rasterized first.
+        void BeginRenderPass(
+            std::uint32_t           numColorAttachments,
+            const NullAttachment*   colorAttachments,
+            const NullAttachment&   depthStencilAttachment
+        );
+
+        // Rasterizes all pending primitives and unbinds the attachments.
+        void EndRenderPass();
+
+        // Clears the specified attachments of the current render pass.
+        void ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments);
+
+        // Copies the specified region of the first color attachment of the current render pass into the destination texture.
+        void CopyFramebuffer(NullTexture& dstTexture, const TextureRegion& dstRegion, const Offset2D& srcOffset);
+
+        void SetViewports(std::uint32_t numViewports, const Viewport* viewports);
+        void SetScissors(std::uint32_t numScissors, const Scissor* scissors);
+        void SetPipelineState(const NullPipelineState* pipelineState);
+        void SetBlendFactor(const float color[4]);
+
+        void Draw(
+            const DrawIndirectArguments&    args,
+            std::size_t                     numVertexBuffers,
+            const NullBuffer* const *       vertexBuffers
+        );
+
+        void DrawIndexed(
+            const DrawIndexedIndirectArguments& args,
+            const NullBuffer*                   indexBuffer,
+            Format                              indexFormat,
+            std::uint64_t                       indexBufferOffset,
+            std::size_t                         numVertexBuffers,
+            const NullBuffer* const *           vertexBuffers
+        );
+
+        // Rasterizes all binned primitives into the bound attachments.
+        void Flush();
+
+    public:
+
+        // Width and height (in pixels) of each screen tile.
+        static constexpr std::int32_t tileSize = 64;
+
+    public:
+
+        // Color or depth-stencil surface of a bound attachment.
+        struct Surface
+        {
+            char*           data            = nullptr;
+            std::size_t     rowStride       = 0;
+            std::size_t     bpp             = 0;
+            std::int32_t    width           = 0;
+            std::int32_t    height          = 0;
+            ImageFormat     format          = ImageFormat::RGBA;
+            DataType        dataType        = DataType::UInt8;
+            bool            isNormalized    = true;
+            bool            isSRGB          = false;
+            int             channels[4]     = { -1, -1, -1, -1 }; // Component index for each RGBA channel or -1 if the channel does not exist.
+        };
+
+        // Vertex in clip space after the vertex stage.
+        struct Vertex
+        {
+            float           position[4];
+            float           color[4];
+            std::uint32_t   viewportIndex;
+        };
+
+        // Screen space triangle with its edge equations in fixed-point sub-pixel coordinates.
+        struct Triangle
+        {
+            std::int64_t    edgeOrigin[3][2];   // Start point of each edge.
+            std::int64_t    edgeDelta[3][2];    // Direction of each edge.
+            std::int64_t    edgeBias[3];        // Bias for the top-left fill rule: 0 for top or left edges, 1 otherwise.
+            float           invArea;            // Reciprocal of the doubled triangle area in sub-pixel units.
+            float           depth[3];           // Depth values after the depth range transformation.
+            float           invW[3];            // Reciprocal of the clip space W coordinates.
+            float           color[3][4];        // Vertex colors pre-multiplied by invW for perspective correct interpolation.
+            std::int32_t    minX;
+            std::int32_t    minY;
+            std::int32_t    maxX;               // Exclusive
+            std::int32_t    maxY;               // Exclusive
+            std::uint32_t   state;              // Index into the list of draw states.
+        };
+
+        // Pixel stage state that is shared between all triangles of one or more draw commands.
+        struct DrawState
+        {
+            const DepthDescriptor*  depth           = nullptr;
+            const BlendDescriptor*  blend           = nullptr;
+            float                   blendFactor[4]  = { 0.0f, 0.0f, 0.0f, 0.0f };
+            float                   minDepth        = 0.0f;
+            float                   maxDepth        = 1.0f;
+            bool                    depthClamp      = false;
+        };
+
+    private:
+
+        // Returns true if the current pipeline state can be used to draw triangles.
+        bool PrepareDraw();
+
+        // Runs the vertex stage for all vertex cache entries in [begin, end). Vertex IDs are either 'baseVertex + index' or 'baseVertex + indices[index]'.
+        void ProcessVertices(
+            std::size_t                 begin,
+            std::size_t                 end,
+            std::uint32_t               numVerticesPerInstance,
+            std::uint32_t               firstInstance,
+            const std::uint32_t*        indices,
+            std::int64_t                baseVertex,
+            std::size_t                 numVertexBuffers,
+            const NullBuffer* const *   vertexBuffers
+        );
+
+        // Runs the vertex stage in parallel and assembles the primitives of all instances.
+        void ProcessDraw(
+            std::uint32_t               numVerticesPerInstance,
+            std::uint32_t               numInstances,
+            std::uint32_t               firstInstance,
+            const std::uint32_t*        indices,
+            std::int64_t                baseVertex,
+            std::size_t                 numVertexBuffers,
+            const NullBuffer* const *   vertexBuffers
+        );
+
+        // Assembles the primitives from the vertex cache and bins them into the tiles. Strips are restarted at the restart index.
+        void AssemblePrimitives(std::uint32_t numVerticesPerInstance, std::uint32_t numInstances, const std::uint32_t* indices);
+
+        // Clips the specified triangle against the near plane and bins the resulting triangles.
+        void ClipAndBinTriangle(const Vertex& v0, const Vertex& v1, const Vertex& v2);
+
+        // Sets up the edge equations of the specified clip-space triangle for the specified viewport and bins it into all covered tiles.
+        void SetupAndBinTriangle(const Vertex& v0, const Vertex& v1, const Vertex& v2, std::uint32_t viewportIndex);
+
+        // Rasterizes all triangles that were binned into the specified tile.
+        void RasterizeTile(std::size_t tileIndex);
+
+        void RasterizeTriangleInTile(
+            const Triangle& triangle,
+            std::int32_t    tileMinX,
+            std::int32_t    tileMinY,
+            std::int32_t    tileMaxX,
+            std::int32_t    tileMaxY
+        );
+
+        void ResetBins();
+
+    private:
+
+        static constexpr std::size_t maxNumBinnedTriangles = 65536;
+
+        Surface                             colorSurfaces_[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+        std::uint32_t                       numColorSurfaces_           = 0;
+        Surface                             depthStencilSurface_;
+        NullAttachment                      framebufferAttachment_;     // First color attachment for CopyFramebuffer().
+
+        std::int32_t                        renderWidth_                = 0;
+        std::int32_t                        renderHeight_               = 0;
+        std::int32_t                        numTilesX_                  = 0;
+        std::int32_t                        numTilesY_                  = 0;
+
+        const NullPipelineState*            pipelineState_              = nullptr;
+        Viewport                            viewports_[LLGL_MAX_NUM_VIEWPORTS_AND_SCISSORS];
+        std::uint32_t                       numViewports_               = 0;
+        Scissor                             scissors_[LLGL_MAX_NUM_VIEWPORTS_AND_SCISSORS];
+        float                               blendFactor_[4]             = { 0.0f, 0.0f, 0.0f, 0.0f };
+        bool                                isDrawStateDirty_           = true;
+
+        const VertexAttribute*              positionAttrib_             = nullptr;
+        const VertexAttribute*              colorAttrib_                = nullptr;
+        const VertexAttribute*              viewportIndexAttrib_        = nullptr;
+
+        // Viewports of the current draw state. Each viewport has its own draw state, starting at 'firstDrawState_'.
+        Viewport                            drawViewports_[LLGL_MAX_NUM_VIEWPORTS_AND_SCISSORS];
+        std::int32_t                        clipRects_[LLGL_MAX_NUM_VIEWPORTS_AND_SCISSORS][4]; // MinX, MinY, MaxX, MaxY
+        std::uint32_t                       numDrawViewports_           = 1;
+        std::uint32_t                       firstDrawState_             = 0;
+        std::uint32_t                       restartIndex_               = 0;
+
+        std::vector<Vertex>                 vertexCache_;
+        std::vector<std::uint32_t>          indexCache_;
+        std::vector<DrawState>              drawStates_;
+        std::vector<Triangle>               triangles_;
+        std::vector<std::vector<std::uint32_t>> tileBins_;
+        std::vector<std::uint32_t>          activeTiles_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
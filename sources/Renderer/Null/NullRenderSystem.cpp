@@ -6,7 +6,9 @@
  */
 
 #include "NullRenderSystem.h"
+#include "../RenderSystemUtils.h"
 #include "../../Core/CoreUtils.h"
+#include <LLGL/RendererConfiguration.h>
 #include <LLGL/Utils/ForRange.h>
 #include <limits.h>
 
@@ -114,21 +116,36 @@ static void GetNullRendererInfo(RendererInfo& info)
     info.shadingLanguageName    = "Dummy";
 }
 
+static bool IsDeferredSubmission(const RenderSystemDescriptor& renderSystemDesc)
+{
+    if (auto* rendererConfigNull = GetRendererConfiguration<RendererConfigurationNull>(renderSystemDesc))
+        return rendererConfigNull->deferredSubmission;
+    else
+        return false;
+}
+
 NullRenderSystem::NullRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
-    desc_         { renderSystemDesc               },
-    commandQueue_ { MakeUnique<NullCommandQueue>() }
+    desc_         { renderSystemDesc                                                     },
+    commandQueue_ { MakeUnique<NullCommandQueue>(IsDeferredSubmission(renderSystemDesc)) }
+{
+}
+
+NullRenderSystem::~NullRenderSystem()
 {
+    /* Wait for deferred submissions before any of the resources they refer to are released */
+    commandQueue_->WaitIdle();
 }
 
 /* ----- Swap-chain ----- */
 
 SwapChain* NullRenderSystem::CreateSwapChain(const SwapChainDescriptor& swapChainDesc, const std::shared_ptr<Surface>& surface)
 {
-    return swapChains_.emplace<NullSwapChain>(swapChainDesc, surface, GetRendererInfo());
+    return swapChains_.emplace<NullSwapChain>(swapChainDesc, surface, GetRendererInfo(), *commandQueue_);
 }
 
 void NullRenderSystem::Release(SwapChain& swapChain)
 {
+    commandQueue_->WaitIdle();
     swapChains_.erase(&swapChain);
 }
 
@@ -143,11 +160,12 @@ CommandQueue* NullRenderSystem::GetCommandQueue()
 
 CommandBuffer* NullRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& commandBufferDesc)
 {
-    return commandBuffers_.emplace<NullCommandBuffer>(commandBufferDesc);
+    return commandBuffers_.emplace<NullCommandBuffer>(*commandQueue_, commandBufferPool_, commandBufferDesc);
 }
 
 void NullRenderSystem::Release(CommandBuffer& commandBuffer)
 {
+    commandQueue_->WaitIdle();
     commandBuffers_.erase(&commandBuffer);
 }
 
@@ -167,34 +185,41 @@ BufferArray* NullRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffe
 
 void NullRenderSystem::Release(Buffer& buffer)
 {
+    /* Resources might still be referenced by deferred submissions that have not been executed yet */
+    commandQueue_->WaitIdle();
     buffers_.erase(&buffer);
 }
 
 void NullRenderSystem::Release(BufferArray& bufferArray)
 {
+    commandQueue_->WaitIdle();
     bufferArrays_.erase(&bufferArray);
 }
 
 void NullRenderSystem::WriteBuffer(Buffer& buffer, std::uint64_t offset, const void* data, std::uint64_t dataSize)
 {
+    commandQueue_->WaitIdle();
     auto& bufferNull = LLGL_CAST(NullBuffer&, buffer);
     bufferNull.Write(offset, data, dataSize);
 }
 
 void NullRenderSystem::ReadBuffer(Buffer& buffer, std::uint64_t offset, void* data, std::uint64_t dataSize)
 {
+    commandQueue_->WaitIdle();
     auto& bufferNull = LLGL_CAST(NullBuffer&, buffer);
     bufferNull.Read(offset, data, dataSize);
 }
 
 void* NullRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
 {
+    commandQueue_->WaitIdle();
     auto& bufferNull = LLGL_CAST(NullBuffer&, buffer);
     return bufferNull.Map(access, 0, bufferNull.desc.size);
 }
 
 void* NullRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access, std::uint64_t offset, std::uint64_t length)
 {
+    commandQueue_->WaitIdle();
     auto& bufferNull = LLGL_CAST(NullBuffer&, buffer);
     return bufferNull.Map(access, offset, length);
 }
@@ -214,17 +239,20 @@ Texture* NullRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, c
 
 void NullRenderSystem::Release(Texture& texture)
 {
+    commandQueue_->WaitIdle();
     textures_.erase(&texture);
 }
 
 void NullRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageDesc)
 {
+    commandQueue_->WaitIdle();
     auto& textureNull = LLGL_CAST(NullTexture&, texture);
     textureNull.Write(textureRegion, srcImageDesc);
 }
 
 void NullRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView)
 {
+    commandQueue_->WaitIdle();
     auto& textureNull = LLGL_CAST(NullTexture&, texture);
     textureNull.Read(textureRegion, dstImageView);
 }
@@ -238,6 +266,7 @@ Sampler* NullRenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
 
 void NullRenderSystem::Release(Sampler& sampler)
 {
+    commandQueue_->WaitIdle();
     samplers_.erase(&sampler);
 }
 
@@ -250,6 +279,7 @@ ResourceHeap* NullRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor&
 
 void NullRenderSystem::Release(ResourceHeap& resourceHeap)
 {
+    commandQueue_->WaitIdle();
     resourceHeaps_.erase(&resourceHeap);
 }
 
@@ -268,6 +298,7 @@ RenderPass* NullRenderSystem::CreateRenderPass(const RenderPassDescriptor& rende
 
 void NullRenderSystem::Release(RenderPass& renderPass)
 {
+    commandQueue_->WaitIdle();
     renderPasses_.erase(&renderPass);
 }
 
@@ -280,6 +311,7 @@ RenderTarget* NullRenderSystem::CreateRenderTarget(const RenderTargetDescriptor&
 
 void NullRenderSystem::Release(RenderTarget& renderTarget)
 {
+    commandQueue_->WaitIdle();
     renderTargets_.erase(&renderTarget);
 }
 
@@ -304,6 +336,7 @@ PipelineLayout* NullRenderSystem::CreatePipelineLayout(const PipelineLayoutDescr
 
 void NullRenderSystem::Release(PipelineLayout& pipelineLayout)
 {
+    commandQueue_->WaitIdle();
     pipelineLayouts_.erase(&pipelineLayout);
 }
 
@@ -333,6 +366,7 @@ PipelineState* NullRenderSystem::CreatePipelineState(const ComputePipelineDescri
 
 void NullRenderSystem::Release(PipelineState& pipelineState)
 {
+    commandQueue_->WaitIdle();
     pipelineStates_.erase(&pipelineState);
 }
 
@@ -345,6 +379,7 @@ QueryHeap* NullRenderSystem::CreateQueryHeap(const QueryHeapDescriptor& queryHea
 
 void NullRenderSystem::Release(QueryHeap& queryHeap)
 {
+    commandQueue_->WaitIdle();
     queryHeaps_.erase(&queryHeap);
 }
 
@@ -357,6 +392,7 @@ Fence* NullRenderSystem::CreateFence()
 
 void NullRenderSystem::Release(Fence& fence)
 {
+    commandQueue_->WaitIdle();
     fences_.erase(&fence);
 }
 
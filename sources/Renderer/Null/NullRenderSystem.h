@@ -26,6 +26,7 @@
 #include "Texture/NullRenderTarget.h"
 #include "Texture/NullSampler.h"
 #include "../ProxyPipelineCache.h"
+#include "../VirtualCommandBufferPool.h"
 
 #include "../ContainerTypes.h"
 
@@ -44,6 +45,7 @@ class NullRenderSystem final : public RenderSystem
     public:
 
         NullRenderSystem(const RenderSystemDescriptor& renderSystemDesc);
+        ~NullRenderSystem();
 
     private:
 
@@ -54,6 +56,7 @@ class NullRenderSystem final : public RenderSystem
         /* ----- Common objects ----- */
 
         const RenderSystemDescriptor            desc_;
+        VirtualCommandBufferPool                commandBufferPool_;
 
         /* ----- Hardware object containers ----- */
 
@@ -6,6 +6,7 @@
  */
 
 #include "NullSwapChain.h"
+#include "../../Core/CoreUtils.h"
 
 
 namespace LLGL
@@ -38,14 +39,18 @@ static Format ChooseDepthStencilFormat(int depthBits, int stencilBits)
 NullSwapChain::NullSwapChain(
     const SwapChainDescriptor&      desc,
     const std::shared_ptr<Surface>& surface,
-    const RendererInfo&             rendererInfo)
+    const RendererInfo&             rendererInfo,
+    NullCommandQueue&               commandQueue)
 :
     SwapChain           { desc                                                       },
+    commandQueue_       { commandQueue                                               },
     samples_            { desc.samples                                               },
     colorFormat_        { ChooseColorFormat(desc.colorBits)                          },
-    depthStencilFormat_ { ChooseDepthStencilFormat(desc.depthBits, desc.stencilBits) }
+    depthStencilFormat_ { ChooseDepthStencilFormat(desc.depthBits, desc.stencilBits) },
+    hasDepthStencil_    { (desc.depthBits > 0 || desc.stencilBits > 0)               }
 {
     SetOrCreateSurface(surface, SwapChain::BuildDefaultSurfaceTitle(rendererInfo), desc.resolution, desc.fullscreen);
+    CreateBuffers(GetResolution());
 
     if (desc.debugName != nullptr)
         SetDebugName(desc.debugName);
@@ -109,11 +114,38 @@ const RenderPass* NullSwapChain::GetRenderPass() const
     return renderPass_;
 }
 
-bool NullSwapChain::ResizeBuffersPrimary(const Extent2D& /*resolution*/)
+bool NullSwapChain::ResizeBuffersPrimary(const Extent2D& resolution)
 {
+    /* Wait for deferred submissions that might still render into the current buffers */
+    commandQueue_.WaitIdle();
+    CreateBuffers(resolution);
     return true;
 }
 
+void NullSwapChain::CreateBuffers(const Extent2D& resolution)
+{
+    TextureDescriptor textureDesc;
+    {
+        textureDesc.type            = TextureType::Texture2D;
+        textureDesc.extent.width    = resolution.width;
+        textureDesc.extent.height   = resolution.height;
+        textureDesc.mipLevels       = 1;
+    }
+
+    /* Create color buffer */
+    textureDesc.bindFlags   = BindFlags::ColorAttachment;
+    textureDesc.format      = colorFormat_;
+    colorBuffer_ = MakeUnique<NullTexture>(textureDesc);
+
+    /* Create depth-stencil buffer if a depth or stencil component was requested */
+    if (hasDepthStencil_)
+    {
+        textureDesc.bindFlags   = BindFlags::DepthStencilAttachment;
+        textureDesc.format      = depthStencilFormat_;
+        depthStencilBuffer_ = MakeUnique<NullTexture>(textureDesc);
+    }
+}
+
 
 } // /namespace LLGL
 
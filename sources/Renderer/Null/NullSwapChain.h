@@ -10,6 +10,9 @@
 
 
 #include <LLGL/SwapChain.h>
+#include "Texture/NullTexture.h"
+#include "Command/NullCommandQueue.h"
+#include <memory>
 #include <string>
 
 
@@ -33,21 +36,42 @@ class NullSwapChain final : public SwapChain
         NullSwapChain(
             const SwapChainDescriptor&      desc,
             const std::shared_ptr<Surface>& surface,
-            const RendererInfo&             rendererInfo
+            const RendererInfo&             rendererInfo,
+            NullCommandQueue&               commandQueue
         );
 
+        // Returns the texture of the color buffer.
+        inline NullTexture* GetColorBuffer() const
+        {
+            return colorBuffer_.get();
+        }
+
+        // Returns the texture of the depth-stencil buffer or null if this swap chain has no depth-stencil buffer.
+        inline NullTexture* GetDepthStencilBuffer() const
+        {
+            return depthStencilBuffer_.get();
+        }
+
     private:
 
         bool ResizeBuffersPrimary(const Extent2D& resolution) override;
 
+        void CreateBuffers(const Extent2D& resolution);
+
     private:
 
-        std::string         label_;
-        std::uint32_t       samples_            = 1;
-        Format              colorFormat_        = Format::Undefined;
-        Format              depthStencilFormat_ = Format::Undefined;
-        std::uint32_t       vsyncInterval_      = 0;
-        const RenderPass*   renderPass_         = nullptr;
+        NullCommandQueue&               commandQueue_;
+
+        std::string                     label_;
+        std::uint32_t                   samples_            = 1;
+        Format                          colorFormat_        = Format::Undefined;
+        Format                          depthStencilFormat_ = Format::Undefined;
+        bool                            hasDepthStencil_    = false;
+        std::uint32_t                   vsyncInterval_      = 0;
+        const RenderPass*               renderPass_         = nullptr;
+
+        std::unique_ptr<NullTexture>    colorBuffer_;
+        std::unique_ptr<NullTexture>    depthStencilBuffer_;
 
 };
 
@@ -6,7 +6,7 @@
  */
 
 #include "NullFence.h"
-#include <thread>
+#include <algorithm>
 #include <chrono>
 
 
@@ -14,6 +14,12 @@ namespace LLGL
 {
 
 
+NullFence::NullFence(std::uint64_t initialValue) :
+    pendingValue_   { initialValue },
+    completedValue_ { initialValue }
+{
+}
+
 void NullFence::SetDebugName(const char* name)
 {
     if (name != nullptr)
@@ -22,20 +28,56 @@ void NullFence::SetDebugName(const char* name)
         label_.clear();
 }
 
-void NullFence::Signal(std::uint64_t signal)
+std::uint64_t NullFence::NextValue()
 {
-    signal_ = signal;
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    return ++pendingValue_;
+}
+
+void NullFence::Signal(std::uint64_t value)
+{
+    {
+        std::lock_guard<std::mutex> guard{ mutex_ };
+        completedValue_ = std::max(completedValue_, value);
+    }
+    signaledCV_.notify_all();
+}
+
+bool NullFence::WaitForValue(std::uint64_t value, std::uint64_t timeout)
+{
+    std::unique_lock<std::mutex> lock{ mutex_ };
+
+    auto IsSignaled = [this, value]() -> bool
+    {
+        return (completedValue_ >= value);
+    };
+
+    if (IsSignaled())
+        return true;
+    if (timeout == 0)
+        return false;
+
+    /* Treat timeouts that cannot be represented by the clock as infinite */
+    const std::uint64_t maxTimeout = static_cast<std::uint64_t>(std::chrono::nanoseconds::max().count() / 2);
+    if (timeout >= maxTimeout)
+    {
+        signaledCV_.wait(lock, IsSignaled);
+        return true;
+    }
+
+    return signaledCV_.wait_for(lock, std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(timeout)), IsSignaled);
 }
 
-void NullFence::WaitForSignal(std::uint64_t signal)
+std::uint64_t NullFence::GetPendingValue() const
 {
-    while (signal_ != signal)
-        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    return pendingValue_;
 }
 
-NullFence::NullFence(std::uint64_t initialSignal) :
-    signal_ { initialSignal }
+std::uint64_t NullFence::GetCompletedValue() const
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    return completedValue_;
 }
 
 
@@ -11,7 +11,8 @@
 
 #include <LLGL/Fence.h>
 #include <string>
-#include <atomic>
+#include <mutex>
+#include <condition_variable>
 #include <cstdint>
 
 
@@ -19,6 +20,10 @@ namespace LLGL
 {
 
 
+/*
+Fence with a monotonically increasing counter.
+Each submission of the fence increments the pending value and the command queue signals that value once all previously submitted commands have been executed.
+*/
 class NullFence final : public Fence
 {
 
@@ -28,16 +33,31 @@ class NullFence final : public Fence
 
     public:
 
-        NullFence(std::uint64_t initialSignal = 0);
+        NullFence(std::uint64_t initialValue = 0);
+
+        // Increments the pending value of this fence and returns the new value that will be signaled next.
+        std::uint64_t NextValue();
+
+        // Signals the specified value and wakes up all threads that wait for a value less than or equal to it.
+        void Signal(std::uint64_t value);
 
-        void Signal(std::uint64_t signal);
+        // Waits until the specified value has been signaled or the timeout (in nanoseconds) expired. Returns false on timeout.
+        bool WaitForValue(std::uint64_t value, std::uint64_t timeout);
 
-        void WaitForSignal(std::uint64_t signal);
+        // Returns the most recent value that was scheduled with NextValue().
+        std::uint64_t GetPendingValue() const;
+
+        // Returns the most recent value that has been signaled.
+        std::uint64_t GetCompletedValue() const;
 
     private:
 
-        std::string             label_;
-        std::atomic_uint64_t    signal_;
+        std::string                 label_;
+
+        mutable std::mutex          mutex_;
+        std::condition_variable     signaledCV_;
+        std::uint64_t               pendingValue_   = 0;
+        std::uint64_t               completedValue_ = 0;
 
 };
 
@@ -6,6 +6,9 @@
  */
 
 #include "NullQueryHeap.h"
+#include <LLGL/Timer.h>
+#include <LLGL/Utils/ForRange.h>
+#include <cstring>
 
 
 namespace LLGL
@@ -16,6 +19,7 @@ NullQueryHeap::NullQueryHeap(const QueryHeapDescriptor& desc) :
     QueryHeap { desc.type },
     desc      { desc      }
 {
+    queries_.resize(desc.numQueries);
     if (desc.debugName != nullptr)
         SetDebugName(desc.debugName);
 }
@@ -28,6 +32,72 @@ void NullQueryHeap::SetDebugName(const char* name)
         label_.clear();
 }
 
+void NullQueryHeap::BeginQuery(std::uint32_t query)
+{
+    if (query < queries_.size())
+    {
+        std::lock_guard<std::mutex> guard{ mutex_ };
+        Query& entry = queries_[query];
+        entry.beginTick = Timer::Tick();
+        entry.available = false;
+    }
+}
+
+void NullQueryHeap::EndQuery(std::uint32_t query)
+{
+    if (query < queries_.size())
+    {
+        const std::uint64_t endTick = Timer::Tick();
+        std::lock_guard<std::mutex> guard{ mutex_ };
+        Query& entry = queries_[query];
+        if (desc.type == QueryType::TimeElapsed)
+        {
+            /* Convert elapsed ticks to nanoseconds */
+            const double ticksToNanoseconds = 1.0e9 / static_cast<double>(Timer::Frequency());
+            entry.result = static_cast<std::uint64_t>(static_cast<double>(endTick - entry.beginTick) * ticksToNanoseconds);
+        }
+        else
+            entry.result = 0;
+        entry.available = true;
+    }
+}
+
+bool NullQueryHeap::QueryResult(std::uint32_t firstQuery, std::uint32_t numQueries, void* data, std::size_t dataSize) const
+{
+    if (numQueries == 0 || firstQuery >= queries_.size() || numQueries > queries_.size() - firstQuery)
+        return false;
+
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    for_range(i, numQueries)
+    {
+        if (!queries_[firstQuery + i].available)
+            return false;
+    }
+
+    if (dataSize == numQueries * sizeof(std::uint32_t))
+    {
+        auto* results = reinterpret_cast<std::uint32_t*>(data);
+        for_range(i, numQueries)
+            results[i] = static_cast<std::uint32_t>(queries_[firstQuery + i].result);
+    }
+    else if (dataSize == numQueries * sizeof(std::uint64_t))
+    {
+        auto* results = reinterpret_cast<std::uint64_t*>(data);
+        for_range(i, numQueries)
+            results[i] = queries_[firstQuery + i].result;
+    }
+    else if (dataSize == numQueries * sizeof(QueryPipelineStatistics))
+    {
+        /* Pipeline statistics are not tracked */
+        ::memset(data, 0, dataSize);
+    }
+    else
+        return false;
+
+    return true;
+}
+
 
 } // /namespace LLGL
 
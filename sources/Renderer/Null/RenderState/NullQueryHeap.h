@@ -12,12 +12,19 @@
 #include <LLGL/QueryHeap.h>
 #include <vector>
 #include <string>
+#include <mutex>
+#include <cstdint>
 
 
 namespace LLGL
 {
 
 
+/*
+Query heap that records the CPU timer when the query commands are executed.
+TimeElapsed queries report the elapsed time between BeginQuery and EndQuery in nanoseconds.
+All other query types report zero, since the Null backend does not track samples, primitives, or shader invocations.
+*/
 class NullQueryHeap final : public QueryHeap
 {
 
@@ -29,13 +36,34 @@ class NullQueryHeap final : public QueryHeap
 
         NullQueryHeap(const QueryHeapDescriptor& desc);
 
+        // Records the start of the specified query and invalidates its previous result.
+        void BeginQuery(std::uint32_t query);
+
+        // Records the end of the specified query and makes its result available.
+        void EndQuery(std::uint32_t query);
+
+        // Copies the results of the specified query range into the output data. Returns false if any of the results is unavailable.
+        bool QueryResult(std::uint32_t firstQuery, std::uint32_t numQueries, void* data, std::size_t dataSize) const;
+
     public:
 
         const QueryHeapDescriptor desc;
 
     private:
 
-        std::string label_;
+        struct Query
+        {
+            std::uint64_t   beginTick   = 0;
+            std::uint64_t   result      = 0;
+            bool            available   = false;
+        };
+
+    private:
+
+        std::string         label_;
+
+        mutable std::mutex  mutex_;
+        std::vector<Query>  queries_;
 
 };
 
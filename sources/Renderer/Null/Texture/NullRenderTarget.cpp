@@ -74,11 +74,8 @@ void NullRenderTarget::BuildAttachmentArray()
     {
         if (IsAttachmentEnabled(attachment))
         {
-            if (auto texture = attachment.texture)
-            {
-                auto textureNull = LLGL_CAST(NullTexture*, texture);
-                colorAttachments_.push_back(textureNull);
-            }
+            if (attachment.texture != nullptr)
+                colorAttachments_.push_back(MakeAttachment(attachment));
             else
                 colorAttachments_.push_back(MakeIntermediateAttachment(attachment.format, desc.samples));
         }
@@ -89,11 +86,8 @@ void NullRenderTarget::BuildAttachmentArray()
     {
         if (IsAttachmentEnabled(attachment))
         {
-            if (auto texture = attachment.texture)
-            {
-                auto textureNull = LLGL_CAST(NullTexture*, texture);
-                resolveAttachments_.push_back(textureNull);
-            }
+            if (attachment.texture != nullptr)
+                resolveAttachments_.push_back(MakeAttachment(attachment));
             else
                 resolveAttachments_.push_back(MakeIntermediateAttachment(attachment.format));
         }
@@ -102,23 +96,36 @@ void NullRenderTarget::BuildAttachmentArray()
     /* Cache depth-stencil attachment */
     if (IsAttachmentEnabled(desc.depthStencilAttachment))
     {
-        if (auto* texture = desc.depthStencilAttachment.texture)
+        if (desc.depthStencilAttachment.texture != nullptr)
         {
-            auto* textureNull = LLGL_CAST(NullTexture*, texture);
-            depthStencilAttachment_ = textureNull;
-            depthStencilFormat_     = textureNull->desc.format;
+            depthStencilAttachment_ = MakeAttachment(desc.depthStencilAttachment);
+            depthStencilFormat_     = depthStencilAttachment_.texture->desc.format;
         }
         else
-            depthStencilFormat_ = desc.depthStencilAttachment.format;
+        {
+            depthStencilFormat_     = desc.depthStencilAttachment.format;
+            depthStencilAttachment_ = MakeIntermediateAttachment(depthStencilFormat_, desc.samples);
+        }
+    }
+}
+
+NullAttachment NullRenderTarget::MakeAttachment(const AttachmentDescriptor& attachmentDesc)
+{
+    NullAttachment attachment;
+    {
+        attachment.texture      = LLGL_CAST(NullTexture*, attachmentDesc.texture);
+        attachment.mipLevel     = attachmentDesc.mipLevel;
+        attachment.arrayLayer   = attachmentDesc.arrayLayer;
     }
+    return attachment;
 }
 
-NullTexture* NullRenderTarget::MakeIntermediateAttachment(const Format format, std::uint32_t samples)
+NullAttachment NullRenderTarget::MakeIntermediateAttachment(const Format format, std::uint32_t samples)
 {
     TextureDescriptor textureDesc;
     {
         textureDesc.type            = (samples > 1 ? TextureType::Texture2DMS : TextureType::Texture2D);
-        textureDesc.bindFlags       = BindFlags::ColorAttachment;
+        textureDesc.bindFlags       = (IsDepthOrStencilFormat(format) ? BindFlags::DepthStencilAttachment : BindFlags::ColorAttachment);
         textureDesc.miscFlags       = MiscFlags::FixedSamples;
         textureDesc.format          = format;
         textureDesc.extent.width    = desc.resolution.width;
@@ -127,7 +134,10 @@ NullTexture* NullRenderTarget::MakeIntermediateAttachment(const Format format, s
         textureDesc.samples         = samples;
     };
     intermediateAttachments_.push_back(MakeUnique<NullTexture>(textureDesc));
-    return intermediateAttachments_.back().get();
+
+    NullAttachment attachment;
+    attachment.texture = intermediateAttachments_.back().get();
+    return attachment;
 }
 
 
@@ -19,6 +19,14 @@ namespace LLGL
 {
 
 
+// Texture attachment with the MIP-map level and array layer that is rendered into.
+struct NullAttachment
+{
+    NullTexture*    texture     = nullptr;
+    std::uint32_t   mipLevel    = 0;
+    std::uint32_t   arrayLayer  = 0;
+};
+
 class NullRenderTarget final : public RenderTarget
 {
 
@@ -34,6 +42,18 @@ class NullRenderTarget final : public RenderTarget
 
         NullRenderTarget(const RenderTargetDescriptor& desc);
 
+        // Returns the list of color attachments this render target renders into.
+        inline const std::vector<NullAttachment>& GetColorAttachments() const
+        {
+            return colorAttachments_;
+        }
+
+        // Returns the depth-stencil attachment. Its texture is null if this render target has no depth-stencil attachment.
+        inline const NullAttachment& GetDepthStencilAttachment() const
+        {
+            return depthStencilAttachment_;
+        }
+
     public:
 
         const RenderTargetDescriptor desc;
@@ -42,14 +62,15 @@ class NullRenderTarget final : public RenderTarget
 
         void BuildAttachmentArray();
 
-        NullTexture* MakeIntermediateAttachment(const Format format, std::uint32_t samples = 1);
+        NullAttachment MakeAttachment(const AttachmentDescriptor& attachmentDesc);
+        NullAttachment MakeIntermediateAttachment(const Format format, std::uint32_t samples = 1);
 
     private:
 
         std::string                                 label_;
-        std::vector<NullTexture*>                   colorAttachments_;
-        std::vector<NullTexture*>                   resolveAttachments_;
-        NullTexture*                                depthStencilAttachment_     = nullptr;
+        std::vector<NullAttachment>                 colorAttachments_;
+        std::vector<NullAttachment>                 resolveAttachments_;
+        NullAttachment                              depthStencilAttachment_;
         Format                                      depthStencilFormat_         = Format::Undefined;
         std::vector<std::unique_ptr<NullTexture>>   intermediateAttachments_;
 
@@ -7,9 +7,12 @@
 
 #include "NullTexture.h"
 #include "../../TextureUtils.h"
+#include "../../../Core/ImageUtils.h"
 #include <LLGL/TextureFlags.h>
+#include <LLGL/ImageFlags.h>
 #include <LLGL/Utils/ForRange.h>
 #include <algorithm>
+#include <vector>
 
 
 namespace LLGL
@@ -103,20 +106,256 @@ void NullTexture::Read(const TextureRegion& textureRegion, const MutableImageVie
     }
 }
 
+// Returns the byte offset of the specified texel within the image.
+static std::size_t GetImageDataOffset(const Image& image, const Offset3D& offset)
+{
+    return
+    (
+        static_cast<std::size_t>(offset.z) * image.GetDepthStride() +
+        static_cast<std::size_t>(offset.y) * image.GetRowStride() +
+        static_cast<std::size_t>(offset.x) * image.GetBytesPerPixel()
+    );
+}
+
+// Clamps the row and layer strides to the tightly packed sizes of the specified extent and returns the number of bytes that are accessed.
+static std::size_t ClampBufferStrides(const Extent3D& extent, std::uint32_t bpp, std::uint32_t& rowStride, std::uint32_t& layerStride)
+{
+    rowStride   = std::max(rowStride, extent.width * bpp);
+    layerStride = std::max(layerStride, rowStride * extent.height);
+    return
+    (
+        static_cast<std::size_t>(extent.depth - 1) * layerStride +
+        static_cast<std::size_t>(extent.height - 1) * rowStride +
+        static_cast<std::size_t>(extent.width) * bpp
+    );
+}
+
+bool NullTexture::CopyFromBufferData(
+    std::uint32_t   mipLevel,
+    std::uint32_t   arrayLayer,
+    const Offset3D& offset,
+    const Extent3D& extent,
+    const void*     data,
+    std::size_t     dataSize,
+    std::uint32_t   rowStride,
+    std::uint32_t   layerStride)
+{
+    if (mipLevel >= images_.size() || IsCompressedFormat(desc.format) || extent.width == 0 || extent.height == 0 || extent.depth == 0)
+        return false;
+
+    Image& image = images_[mipLevel];
+    const Offset3D imageOffset = CalcTextureOffset(GetType(), offset, arrayLayer);
+    if (!image.IsRegionInside(imageOffset, extent))
+        return false;
+
+    /* Buffer data has the same format as the texture, so rows can be copied directly */
+    rowStride = GetBufferRowStride(rowStride, layerStride);
+    if (ClampBufferStrides(extent, image.GetBytesPerPixel(), rowStride, layerStride) > dataSize)
+        return false;
+
+    BitBlit(
+        extent,
+        image.GetBytesPerPixel(),
+        static_cast<char*>(image.GetData()) + GetImageDataOffset(image, imageOffset),
+        image.GetRowStride(),
+        image.GetDepthStride(),
+        static_cast<const char*>(data),
+        rowStride,
+        layerStride
+    );
+
+    return true;
+}
+
+bool NullTexture::CopyToBufferData(
+    std::uint32_t   mipLevel,
+    std::uint32_t   arrayLayer,
+    const Offset3D& offset,
+    const Extent3D& extent,
+    void*           data,
+    std::size_t     dataSize,
+    std::uint32_t   rowStride,
+    std::uint32_t   layerStride) const
+{
+    if (mipLevel >= images_.size() || IsCompressedFormat(desc.format) || extent.width == 0 || extent.height == 0 || extent.depth == 0)
+        return false;
+
+    const Image& image = images_[mipLevel];
+    const Offset3D imageOffset = CalcTextureOffset(GetType(), offset, arrayLayer);
+    if (!image.IsRegionInside(imageOffset, extent))
+        return false;
+
+    rowStride = GetBufferRowStride(rowStride, layerStride);
+    if (ClampBufferStrides(extent, image.GetBytesPerPixel(), rowStride, layerStride) > dataSize)
+        return false;
+
+    BitBlit(
+        extent,
+        image.GetBytesPerPixel(),
+        static_cast<char*>(data),
+        rowStride,
+        layerStride,
+        static_cast<const char*>(image.GetData()) + GetImageDataOffset(image, imageOffset),
+        image.GetRowStride(),
+        image.GetDepthStride()
+    );
+
+    return true;
+}
+
+bool NullTexture::CopyFromTexture(
+    std::uint32_t       mipLevel,
+    std::uint32_t       arrayLayer,
+    const Offset3D&     offset,
+    const NullTexture&  srcTexture,
+    std::uint32_t       srcMipLevel,
+    std::uint32_t       srcArrayLayer,
+    const Offset3D&     srcOffset,
+    const Extent3D&     extent)
+{
+    if (mipLevel >= images_.size() || srcMipLevel >= srcTexture.images_.size() || extent.width == 0 || extent.height == 0 || extent.depth == 0)
+        return false;
+    if (IsCompressedFormat(desc.format) || IsCompressedFormat(srcTexture.desc.format))
+        return false;
+
+    Image& dstImage = images_[mipLevel];
+    const Image& srcImage = srcTexture.images_[srcMipLevel];
+
+    const Offset3D dstImageOffset = CalcTextureOffset(GetType(), offset, arrayLayer);
+    const Offset3D srcImageOffset = CalcTextureOffset(srcTexture.GetType(), srcOffset, srcArrayLayer);
+
+    if (!dstImage.IsRegionInside(dstImageOffset, extent) || !srcImage.IsRegionInside(srcImageOffset, extent))
+        return false;
+
+    char* dstData = static_cast<char*>(dstImage.GetData()) + GetImageDataOffset(dstImage, dstImageOffset);
+
+    if (&dstImage != &srcImage && dstImage.GetFormat() == srcImage.GetFormat() && dstImage.GetDataType() == srcImage.GetDataType())
+    {
+        /* Copy rows directly between images of the same format */
+        BitBlit(
+            extent,
+            dstImage.GetBytesPerPixel(),
+            dstData,
+            dstImage.GetRowStride(),
+            dstImage.GetDepthStride(),
+            static_cast<const char*>(srcImage.GetData()) + GetImageDataOffset(srcImage, srcImageOffset),
+            srcImage.GetRowStride(),
+            srcImage.GetDepthStride()
+        );
+    }
+    else
+    {
+        /* Read region with destination format into intermediate buffer (this also handles overlapping regions within the same image) */
+        const std::uint32_t bpp                 = dstImage.GetBytesPerPixel();
+        const std::size_t   intermediateSize    = static_cast<std::size_t>(extent.width) * extent.height * extent.depth * bpp;
+        DynamicByteArray    intermediateData    = DynamicByteArray{ intermediateSize, UninitializeTag{} };
+
+        const MutableImageView intermediateView{ dstImage.GetFormat(), dstImage.GetDataType(), intermediateData.get(), intermediateSize };
+        srcImage.ReadPixels(srcImageOffset, extent, intermediateView);
+
+        BitBlit(
+            extent,
+            bpp,
+            dstData,
+            dstImage.GetRowStride(),
+            dstImage.GetDepthStride(),
+            intermediateData.get(),
+            0,
+            0
+        );
+    }
+
+    return true;
+}
+
 void NullTexture::GenerateMips(const TextureSubresource* subresource)
 {
-    //todo
+    /* Compressed, depth-stencil, and multi-sampled images cannot be downsampled */
+    const FormatAttributes& formatAttribs = GetFormatAttribs(desc.format);
+    if (IsCompressedFormat(desc.format) || formatAttribs.format == ImageFormat::DepthStencil || IsMultiSampleTexture(GetType()))
+        return;
+
+    /* Determine range of MIP-map levels and array layers; array layers are tightly packed in each MIP-map image */
+    const std::uint32_t numArrayLayersTotal = GetNumArrayLayers();
+
+    std::uint32_t baseMipLevel      = 0;
+    std::uint32_t numMipLevels      = desc.mipLevels;
+    std::uint32_t baseArrayLayer    = 0;
+    std::uint32_t numArrayLayers    = numArrayLayersTotal;
+
+    if (subresource != nullptr)
+    {
+        baseMipLevel    = subresource->baseMipLevel;
+        numMipLevels    = subresource->numMipLevels;
+        baseArrayLayer  = subresource->baseArrayLayer;
+        numArrayLayers  = subresource->numArrayLayers;
+    }
+
+    if (baseMipLevel >= desc.mipLevels || baseArrayLayer >= numArrayLayersTotal)
+        return;
+
+    numMipLevels    = std::min(numMipLevels, desc.mipLevels - baseMipLevel);
+    numArrayLayers  = std::min(numArrayLayers, numArrayLayersTotal - baseArrayLayer);
+
+    if (numMipLevels < 2 || numArrayLayers == 0)
+        return;
+
+    /* Downsample base MIP-map level into all subsequent levels within the selected array layers */
+    const std::size_t bpp = GetMemoryFootprint(formatAttribs.format, formatAttribs.dataType, 1);
+
+    auto GetLayerOffset = [this, baseArrayLayer, bpp](std::uint32_t mipLevel) -> std::size_t
+    {
+        const Extent3D layerExtent = GetMipLayerExtent(mipLevel);
+        return static_cast<std::size_t>(layerExtent.width) * layerExtent.height * layerExtent.depth * bpp * baseArrayLayer;
+    };
+
+    Image& baseImage = images_[baseMipLevel];
+    const std::size_t srcOffset = GetLayerOffset(baseMipLevel);
+    const ImageView srcImageView
+    {
+        baseImage.GetFormat(),
+        baseImage.GetDataType(),
+        static_cast<const char*>(baseImage.GetData()) + srcOffset,
+        baseImage.GetDataSize() - srcOffset
+    };
+
+    std::vector<MutableImageView> dstImageViews;
+    dstImageViews.reserve(numMipLevels - 1);
+
+    for_subrange(mipLevel, baseMipLevel + 1, baseMipLevel + numMipLevels)
+    {
+        Image& mipImage = images_[mipLevel];
+        const std::size_t dstOffset = GetLayerOffset(mipLevel);
+        dstImageViews.push_back(
+            MutableImageView
+            {
+                mipImage.GetFormat(),
+                mipImage.GetDataType(),
+                static_cast<char*>(mipImage.GetData()) + dstOffset,
+                mipImage.GetDataSize() - dstOffset
+            }
+        );
+    }
+
+    const bool isSRGB = ((formatAttribs.flags & FormatFlags::IsColorSpace_sRGB) != 0);
+    GenerateMipChain(srcImageView, GetMipLayerExtent(baseMipLevel), numArrayLayers, dstImageViews, isSRGB, LLGL_MAX_THREAD_COUNT);
+}
+
+Image& NullTexture::GetMipImage(std::uint32_t mipLevel)
+{
+    return images_[ClampMipLevel(mipLevel)];
 }
 
 std::uint32_t NullTexture::PackSubresourceIndex(std::uint32_t mipLevel, std::uint32_t arrayLayer) const
 {
-    return (mipLevel * desc.mipLevels + arrayLayer);
+    return (mipLevel * GetNumArrayLayers() + arrayLayer);
 }
 
 void NullTexture::UnpackSubresourceIndex(std::uint32_t subresource, std::uint32_t& outMipLevel, std::uint32_t& outArrayLayer) const
 {
-    outMipLevel     = subresource / desc.mipLevels;
-    outArrayLayer   = subresource % desc.mipLevels;
+    const std::uint32_t numArrayLayers = GetNumArrayLayers();
+    outMipLevel     = subresource / numArrayLayers;
+    outArrayLayer   = subresource % numArrayLayers;
 }
 
 
@@ -124,6 +363,36 @@ void NullTexture::UnpackSubresourceIndex(std::uint32_t subresource, std::uint32_
  * ======= Private: =======
  */
 
+std::uint32_t NullTexture::GetNumArrayLayers() const
+{
+    switch (GetType())
+    {
+        case TextureType::Texture1DArray:   return extent_.height;
+        case TextureType::Texture3D:        return 1;
+        default:                            return extent_.depth;
+    }
+}
+
+Extent3D NullTexture::GetMipLayerExtent(std::uint32_t mipLevel) const
+{
+    const Extent3D& extent = images_[mipLevel].GetExtent();
+    switch (GetType())
+    {
+        case TextureType::Texture1DArray:   return Extent3D{ extent.width, 1, 1 };
+        case TextureType::Texture3D:        return extent;
+        default:                            return Extent3D{ extent.width, extent.height, 1 };
+    }
+}
+
+std::uint32_t NullTexture::GetBufferRowStride(std::uint32_t rowStride, std::uint32_t layerStride) const
+{
+    /* Each array layer of a 1D array texture is a single row in its MIP-map image, so rows must advance by the layer stride */
+    if (GetType() == TextureType::Texture1DArray && layerStride != 0)
+        return layerStride;
+    else
+        return rowStride;
+}
+
 void NullTexture::AllocImages()
 {
     const auto& formatAttribs = GetFormatAttribs(desc.format);
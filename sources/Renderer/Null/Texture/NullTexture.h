@@ -40,9 +40,51 @@ class NullTexture final : public Texture
         void Write(const TextureRegion& textureRegion, const ImageView& srcImageView);
         void Read(const TextureRegion& textureRegion, const MutableImageView& dstImageView);
 
+        /*
+        Copies the specified region from linear image data into this texture. The extent includes the array layers (see CommandBuffer::CopyTextureFromBuffer).
+        A row or layer stride of zero denotes tightly packed data. Returns false if the region is out of bounds.
+        */
+        bool CopyFromBufferData(
+            std::uint32_t       mipLevel,
+            std::uint32_t       arrayLayer,
+            const Offset3D&     offset,
+            const Extent3D&     extent,
+            const void*         data,
+            std::size_t         dataSize,
+            std::uint32_t       rowStride,
+            std::uint32_t       layerStride
+        );
+
+        // Copies the specified region of this texture into linear image data. This is the counterpart of CopyFromBufferData().
+        bool CopyToBufferData(
+            std::uint32_t       mipLevel,
+            std::uint32_t       arrayLayer,
+            const Offset3D&     offset,
+            const Extent3D&     extent,
+            void*               data,
+            std::size_t         dataSize,
+            std::uint32_t       rowStride,
+            std::uint32_t       layerStride
+        ) const;
+
+        // Copies the specified region from the source texture into this texture. Texels are converted if the formats differ.
+        bool CopyFromTexture(
+            std::uint32_t       mipLevel,
+            std::uint32_t       arrayLayer,
+            const Offset3D&     offset,
+            const NullTexture&  srcTexture,
+            std::uint32_t       srcMipLevel,
+            std::uint32_t       srcArrayLayer,
+            const Offset3D&     srcOffset,
+            const Extent3D&     extent
+        );
+
         // Generates the MIP-map images for either the entire resource or a rubresource.
         void GenerateMips(const TextureSubresource* subresource = nullptr);
 
+        // Returns the image of the specified MIP-map level. Array layers are laid out along the Y-axis for 1D array textures and along the Z-axis otherwise.
+        Image& GetMipImage(std::uint32_t mipLevel);
+
         std::uint32_t PackSubresourceIndex(std::uint32_t mipLevel, std::uint32_t arrayLayer) const;
         void UnpackSubresourceIndex(std::uint32_t subresource, std::uint32_t& outMipLevel, std::uint32_t& outArrayLayer) const;
 
@@ -54,6 +96,15 @@ class NullTexture final : public Texture
 
         void AllocImages();
 
+        // Returns the number of array layers that are laid out in each MIP-map image.
+        std::uint32_t GetNumArrayLayers() const;
+
+        // Returns the extent of a single array layer of the specified MIP-map level.
+        Extent3D GetMipLayerExtent(std::uint32_t mipLevel) const;
+
+        // Returns the stride (in bytes) between two rows of the linear buffer data for the specified region strides.
+        std::uint32_t GetBufferRowStride(std::uint32_t rowStride, std::uint32_t layerStride) const;
+
     private:
 
         std::string         label_;
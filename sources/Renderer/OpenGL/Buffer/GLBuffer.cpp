@@ -6,6 +6,7 @@
  */
 
 #include "GLBuffer.h"
+#include "GLStreamingBufferPool.h"
 #include "../Profile/GLProfile.h"
 #include "../GLObjectUtils.h"
 #include "../Ext/GLExtensions.h"
@@ -13,7 +14,9 @@
 #include "../Ext/GLExtensionRegistry.h"
 #include "../../../Core/CoreUtils.h"
 #include <LLGL/Backend/OpenGL/NativeHandle.h>
+#include <algorithm>
 #include <memory>
+#include <string.h>
 
 
 namespace LLGL
@@ -61,6 +64,9 @@ GLBuffer::GLBuffer(long bindFlags, const char* debugName) :
 
 GLBuffer::~GLBuffer()
 {
+    if (IsStreaming())
+        GLStreamingBufferPool::Get().UnregisterBuffer(*this);
+
     glDeleteBuffers(1, &id_);
     GLStateManager::Get().NotifyBufferRelease(*this);
 
@@ -97,6 +103,17 @@ void GLBuffer::SetDebugName(const char* name)
 
 BufferDescriptor GLBuffer::GetDesc() const
 {
+    if (IsStreaming())
+    {
+        /* Streaming buffers have no storage of their own, since their content lives in the ring of the streaming buffer pool */
+        BufferDescriptor bufferDesc;
+        bufferDesc.size             = static_cast<std::uint64_t>(GetStreamingSize());
+        bufferDesc.bindFlags        = GetBindFlags();
+        bufferDesc.cpuAccessFlags   = CPUAccessFlags::Write;
+        bufferDesc.miscFlags        = MiscFlags::Streaming;
+        return bufferDesc;
+    }
+
     /* Get buffer parameters */
     GLint size = 0, usage = 0, storageFlags = 0;
     GetBufferParams(&size, &usage, &storageFlags);
@@ -154,8 +171,34 @@ void GLBuffer::BufferStorage(GLsizeiptr size, const void* data, GLbitfield flags
     }
 }
 
+bool GLBuffer::BufferStorageStreaming(GLsizeiptr size, const void* data)
+{
+    if (size <= 0 || !GLStreamingBufferPool::Get().RegisterBuffer(*this, size))
+        return false;
+
+    /* Bind buffer once, so the GL object is created even though its content lives in the streaming ring */
+    GLStateManager::Get().BindGLBuffer(*this);
+
+    /* Initialize CPU copy and write it into the first range of the streaming ring */
+    streamingSize_ = size;
+    streamingShadow_.resize(static_cast<std::size_t>(size));
+    if (data != nullptr)
+        ::memcpy(streamingShadow_.data(), data, streamingShadow_.size());
+
+    CommitStreamingRange();
+
+    return true;
+}
+
 void GLBuffer::BufferSubData(GLintptr offset, GLsizeiptr size, const void* data)
 {
+    if (IsStreaming())
+    {
+        /* Update CPU copy first, so partial updates preserve the remaining content when the buffer is renamed */
+        ::memcpy(streamingShadow_.data() + offset, data, static_cast<std::size_t>(size));
+        WriteStreamingRange(offset, size);
+    }
+    else
     #if LLGL_GLEXT_DIRECT_STATE_ACCESS
     if (HasExtension(GLExt::ARB_direct_state_access))
     {
@@ -171,6 +214,12 @@ void GLBuffer::BufferSubData(GLintptr offset, GLsizeiptr size, const void* data)
 
 void GLBuffer::GetBufferSubData(GLintptr offset, GLsizeiptr size, void* data)
 {
+    if (IsStreaming())
+    {
+        /* Read from CPU copy, since the streaming ring is only mapped for write access */
+        ::memcpy(data, streamingShadow_.data() + offset, static_cast<std::size_t>(size));
+    }
+    else
     #if LLGL_GLEXT_DIRECT_STATE_ACCESS
     if (HasExtension(GLExt::ARB_direct_state_access))
     {
@@ -186,6 +235,11 @@ void GLBuffer::GetBufferSubData(GLintptr offset, GLsizeiptr size, void* data)
 
 void GLBuffer::ClearBufferData(std::uint32_t data)
 {
+    if (IsStreaming())
+    {
+        ClearBufferSubData(0, GetStreamingSize(), data);
+    }
+    else
     #if LLGL_GLEXT_DIRECT_STATE_ACCESS
     if (HasExtension(GLExt::ARB_direct_state_access))
     {
@@ -221,6 +275,16 @@ void GLBuffer::ClearBufferData(std::uint32_t data)
 
 void GLBuffer::ClearBufferSubData(GLintptr offset, GLsizeiptr size, std::uint32_t data)
 {
+    if (IsStreaming())
+    {
+        /* Fill CPU copy with 32-bit pattern and write it into the streaming ring */
+        char* dst = streamingShadow_.data() + offset;
+        for (GLsizeiptr i = 0; i < size; i += sizeof(data))
+            ::memcpy(dst + i, &data, std::min<std::size_t>(sizeof(data), static_cast<std::size_t>(size - i)));
+        WriteStreamingRange(offset, size);
+        return;
+    }
+
     #if 0 // TODO: does not work properly here with DSA version???
     #if LLGL_GLEXT_DIRECT_STATE_ACCESS
     if (HasExtension(GLExt::ARB_direct_state_access))
@@ -252,6 +316,24 @@ void GLBuffer::ClearBufferSubData(GLintptr offset, GLsizeiptr size, std::uint32_
 
 void GLBuffer::CopyBufferSubData(const GLBuffer& readBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
 {
+    if (IsStreaming())
+    {
+        /* Read source into CPU copy and write it into the streaming ring */
+        if (readBuffer.IsStreaming())
+            ::memcpy(streamingShadow_.data() + writeOffset, readBuffer.streamingShadow_.data() + readOffset, static_cast<std::size_t>(size));
+        else
+            const_cast<GLBuffer&>(readBuffer).GetBufferSubData(readOffset, size, streamingShadow_.data() + writeOffset);
+        WriteStreamingRange(writeOffset, size);
+        return;
+    }
+
+    if (readBuffer.IsStreaming())
+    {
+        /* Upload from the CPU copy of the source, since it always holds the latest content of a streaming buffer */
+        BufferSubData(writeOffset, size, readBuffer.streamingShadow_.data() + readOffset);
+        return;
+    }
+
     #if LLGL_GLEXT_DIRECT_STATE_ACCESS
     if (HasExtension(GLExt::ARB_direct_state_access))
     {
@@ -286,6 +368,13 @@ void GLBuffer::CopyBufferSubData(const GLBuffer& readBuffer, GLintptr readOffset
 
 void* GLBuffer::MapBuffer(GLenum access)
 {
+    if (IsStreaming())
+    {
+        /* Map CPU copy; it is written into the streaming ring when the buffer is unmapped */
+        streamingMapWrite_ = (access != GL_READ_ONLY);
+        return streamingShadow_.data();
+    }
+
     #if LLGL_GLEXT_DIRECT_STATE_ACCESS
     if (HasExtension(GLExt::ARB_direct_state_access))
     {
@@ -301,6 +390,13 @@ void* GLBuffer::MapBuffer(GLenum access)
 
 void* GLBuffer::MapBufferRange(GLintptr offset, GLsizeiptr length, GLbitfield access)
 {
+    if (IsStreaming())
+    {
+        /* Map CPU copy; it is written into the streaming ring when the buffer is unmapped */
+        streamingMapWrite_ = ((access & GL_MAP_WRITE_BIT) != 0);
+        return streamingShadow_.data() + offset;
+    }
+
     #if LLGL_GLEXT_DIRECT_STATE_ACCESS
     if (HasExtension(GLExt::ARB_direct_state_access))
     {
@@ -324,6 +420,16 @@ void* GLBuffer::MapBufferRange(GLintptr offset, GLsizeiptr length, GLbitfield ac
 
 void GLBuffer::UnmapBuffer()
 {
+    if (IsStreaming())
+    {
+        if (streamingMapWrite_)
+        {
+            WriteStreamingRange(0, GetStreamingSize());
+            streamingMapWrite_ = false;
+        }
+        return;
+    }
+
     #if LLGL_GLEXT_DIRECT_STATE_ACCESS
     if (HasExtension(GLExt::ARB_direct_state_access))
     {
@@ -446,6 +552,40 @@ void GLBuffer::SetIndexType(const Format format)
     indexType16Bits_ = (format == Format::R16UInt);
 }
 
+void GLBuffer::CommitStreamingRange()
+{
+    /* Allocate a new range, since the GPU might still read from the previous one */
+    GLStreamingBufferPool& pool = GLStreamingBufferPool::Get();
+    streamingOffset_ = pool.AllocRange(GetStreamingSize());
+    streamingRangeInUse_ = false;
+
+    /* Write entire content into the new range; no flush is required since the ring is mapped coherently */
+    ::memcpy(pool.GetMappedRange(streamingOffset_), streamingShadow_.data(), streamingShadow_.size());
+
+    /* Re-bind all uniform buffer slots this buffer is bound to with the offset of the new range */
+    GLStateManager::Get().NotifyStreamingBufferUpdate(*this);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLBuffer::WriteStreamingRange(GLintptr offset, GLsizeiptr size)
+{
+    if (streamingRangeInUse_)
+    {
+        /* Rename buffer, i.e. write its entire content into a new range */
+        CommitStreamingRange();
+    }
+    else
+    {
+        /* Current range has not been bound since it was written, so the GPU cannot read from it yet; update it in place */
+        char* dst = GLStreamingBufferPool::Get().GetMappedRange(streamingOffset_ + offset);
+        ::memcpy(dst, streamingShadow_.data() + offset, static_cast<std::size_t>(size));
+    }
+}
+
 
 } // /namespace LLGL
 
@@ -14,6 +14,7 @@
 #include "../OpenGL.h"
 #include "../RenderState/GLStateManager.h"
 #include <cstdint>
+#include <vector>
 
 
 namespace LLGL
@@ -37,6 +38,11 @@ class GLBuffer : public Buffer
         ~GLBuffer();
 
         void BufferStorage(GLsizeiptr size, const void* data, GLbitfield flags, GLenum usage);
+
+        // Registers this buffer as streaming buffer whose content lives in the shared persistently mapped ring of GLStreamingBufferPool (see MiscFlags::Streaming).
+        // Returns false if persistent buffer mapping is not supported or the pool is exhausted, in which case the caller must fall back to BufferStorage.
+        bool BufferStorageStreaming(GLsizeiptr size, const void* data);
+
         void BufferSubData(GLintptr offset, GLsizeiptr size, const void* data);
 
         void GetBufferSubData(GLintptr offset, GLsizeiptr size, void* data);
@@ -102,6 +108,38 @@ class GLBuffer : public Buffer
             return texInternalFormat_;
         }
 
+        // Returns true if the content of this buffer lives in the ring of GLStreamingBufferPool.
+        inline bool IsStreaming() const
+        {
+            return (streamingSize_ > 0);
+        }
+
+        // Returns the byte offset of the current range within the ring of GLStreamingBufferPool.
+        inline GLintptr GetStreamingOffset() const
+        {
+            return streamingOffset_;
+        }
+
+        // Returns the logical size of a streaming buffer.
+        inline GLsizeiptr GetStreamingSize() const
+        {
+            return streamingSize_;
+        }
+
+        // Marks the current range of this streaming buffer as bound to the pipeline, so the next update must not overwrite it.
+        inline void MarkStreamingRangeInUse() const
+        {
+            streamingRangeInUse_ = true;
+        }
+
+        // Writes the entire logical buffer content into a new range of the streaming ring.
+        void CommitStreamingRange();
+
+    private:
+
+        // Writes the specified part of the CPU copy into the streaming ring. This renames the buffer if its current range has been bound since it was written.
+        void WriteStreamingRange(GLintptr offset, GLsizeiptr size);
+
     private:
 
         GLuint          id_                 = 0;
@@ -110,6 +148,13 @@ class GLBuffer : public Buffer
         GLuint          texID_              = 0; // Used for sampler and image buffers
         GLenum          texInternalFormat_  = 0; // Used for sampler and image buffers
 
+        // Streaming buffer state (see MiscFlags::Streaming)
+        GLsizeiptr          streamingSize_          = 0;        // Logical buffer size
+        GLintptr            streamingOffset_        = 0;        // Offset of the current range within the ring of GLStreamingBufferPool
+        std::vector<char>   streamingShadow_;                   // CPU copy of the logical buffer content for partial updates and read access
+        mutable bool        streamingRangeInUse_    = true;     // Specifies whether the current range has been bound since it was written
+        bool                streamingMapWrite_      = false;    // Specifies whether the mapped CPU copy must be committed on unmap
+
 };
 
 
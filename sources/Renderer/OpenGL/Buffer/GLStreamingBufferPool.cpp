@@ -0,0 +1,220 @@
+/*
+ * GLStreamingBufferPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLStreamingBufferPool.h"
+#include "GLBuffer.h"
+#include "../RenderState/GLStateManager.h"
+#include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionRegistry.h"
+#include "../../../Core/CoreUtils.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+// Capacity of each segment, i.e. the maximal amount of streaming buffer updates per frame before the frame ends prematurely
+static constexpr GLsizeiptr  g_segmentCapacity   = 4 * 1024 * 1024;
+
+// Maximal sum of all registered buffer sizes; the remaining capacity of each segment is left for buffer updates
+static constexpr GLsizeiptr  g_maxRegisteredSize = g_segmentCapacity / 2;
+
+// Timeout (in nanoseconds) for each attempt to wait for a segment
+static constexpr GLuint64    g_fenceWaitTimeout  = 1000000000ull;
+
+GLStreamingBufferPool::~GLStreamingBufferPool()
+{
+    Clear();
+}
+
+GLStreamingBufferPool& GLStreamingBufferPool::Get()
+{
+    static GLStreamingBufferPool instance;
+    return instance;
+}
+
+void GLStreamingBufferPool::Clear()
+{
+    DeleteRingBuffer();
+    buffers_.clear();
+    registeredSize_ = 0;
+}
+
+bool GLStreamingBufferPool::RegisterBuffer(GLBuffer& buffer, GLsizeiptr size)
+{
+    #if defined GL_ARB_buffer_storage && GL_ARB_sync
+
+    if (!HasExtension(GLExt::ARB_buffer_storage) || !HasExtension(GLExt::ARB_sync))
+        return false;
+
+    /* Create ring buffer with the first streaming buffer */
+    if (bufferID_ == 0 && !CreateRingBuffer())
+        return false;
+
+    /* Reject buffer if all registered buffers could no longer be written into a single segment */
+    const GLsizeiptr alignedSize = GetAlignedSize<GLsizeiptr>(size, alignment_);
+    if (registeredSize_ + alignedSize > g_maxRegisteredSize)
+        return false;
+
+    registeredSize_ += alignedSize;
+    buffers_.push_back(&buffer);
+
+    return true;
+
+    #else // GL_ARB_buffer_storage && GL_ARB_sync
+
+    return false;
+
+    #endif // /GL_ARB_buffer_storage && GL_ARB_sync
+}
+
+void GLStreamingBufferPool::UnregisterBuffer(GLBuffer& buffer)
+{
+    auto it = std::find(buffers_.begin(), buffers_.end(), &buffer);
+    if (it != buffers_.end())
+    {
+        registeredSize_ -= GetAlignedSize<GLsizeiptr>(buffer.GetStreamingSize(), alignment_);
+        buffers_.erase(it);
+    }
+}
+
+GLintptr GLStreamingBufferPool::AllocRange(GLsizeiptr size)
+{
+    /* End the current frame prematurely if the range does not fit into the remaining capacity of the current segment */
+    GLintptr offset = GetAlignedSize<GLintptr>(head_, alignment_);
+    if (offset + size > static_cast<GLintptr>(segment_ + 1) * g_segmentCapacity)
+    {
+        AdvanceSegment();
+        offset = head_;
+    }
+
+    head_ = offset + size;
+
+    return offset;
+}
+
+void GLStreamingBufferPool::NextFrame()
+{
+    if (bufferID_ != 0)
+        AdvanceSegment();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool GLStreamingBufferPool::CreateRingBuffer()
+{
+    #ifdef GL_ARB_buffer_storage
+
+    /* Align ranges to the minimum offset alignment for glBindBufferRange */
+    GLint alignment = 0;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+    alignment_ = std::max<GLintptr>(static_cast<GLintptr>(alignment), 1);
+
+    /* Allocate immutable storage for all segments and keep it persistently and coherently mapped (GL 4.4+) */
+    const GLsizeiptr    capacity    = g_segmentCapacity * numSegments;
+    const GLbitfield    flags       = (GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+
+    glGenBuffers(1, &bufferID_);
+    GLStateManager::Get().BindBuffer(GLBufferTarget::CopyWriteBuffer, bufferID_);
+    {
+        glBufferStorage(GL_COPY_WRITE_BUFFER, capacity, nullptr, flags);
+        persistentPtr_ = static_cast<char*>(glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, capacity, flags));
+    }
+    GLStateManager::Get().BindBuffer(GLBufferTarget::CopyWriteBuffer, 0);
+
+    if (persistentPtr_ == nullptr)
+    {
+        DeleteRingBuffer();
+        return false;
+    }
+
+    segment_    = 0;
+    head_       = 0;
+
+    return true;
+
+    #else // GL_ARB_buffer_storage
+
+    return false;
+
+    #endif // /GL_ARB_buffer_storage
+}
+
+void GLStreamingBufferPool::DeleteRingBuffer()
+{
+    #if GL_ARB_sync
+    for (GLsync& fence : fences_)
+    {
+        if (fence != nullptr)
+        {
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    }
+    #endif // /GL_ARB_sync
+
+    if (bufferID_ != 0)
+    {
+        /* Deleting the buffer is safe even if the GPU still reads from it, since the GL defers its destruction */
+        glDeleteBuffers(1, &bufferID_);
+        GLStateManager::Get().NotifyBufferRelease(bufferID_, GLBufferTarget::CopyWriteBuffer);
+        bufferID_ = 0;
+    }
+
+    persistentPtr_  = nullptr;
+    segment_        = 0;
+    head_           = 0;
+}
+
+void GLStreamingBufferPool::AdvanceSegment()
+{
+    #if GL_ARB_sync
+
+    /* Guard current segment until the GPU has finished all commands that have been submitted so far */
+    fences_[segment_] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    /* Move on to the next segment and wait until the GPU no longer reads from it */
+    segment_    = (segment_ + 1) % numSegments;
+    head_       = static_cast<GLintptr>(segment_) * g_segmentCapacity;
+
+    if (GLsync fence = fences_[segment_])
+    {
+        /* Only flush the command queue with the first attempt */
+        GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+        while (glClientWaitSync(fence, flags, g_fenceWaitTimeout) == GL_TIMEOUT_EXPIRED)
+            flags = 0;
+
+        glDeleteSync(fence);
+        fences_[segment_] = nullptr;
+    }
+
+    /* Write all buffers whose latest content still lives in this segment into a new range, since it is about to be overwritten */
+    const std::uint32_t reusedSegment = segment_;
+    for (GLBuffer* buffer : buffers_)
+    {
+        if (GetSegmentIndex(buffer->GetStreamingOffset()) == reusedSegment)
+            buffer->CommitStreamingRange();
+    }
+
+    #endif // /GL_ARB_sync
+}
+
+std::uint32_t GLStreamingBufferPool::GetSegmentIndex(GLintptr offset) const
+{
+    return static_cast<std::uint32_t>(offset / g_segmentCapacity);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,114 @@
+/*
+ * GLStreamingBufferPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_STREAMING_BUFFER_POOL_H
+#define LLGL_GL_STREAMING_BUFFER_POOL_H
+
+
+#include "../OpenGL.h"
+#include <cstdint>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class GLBuffer;
+
+/*
+Class to manage a persistently mapped ring buffer that backs all streaming buffers (see MiscFlags::Streaming); used by <GLBuffer>.
+The ring is divided into one segment per frame in flight. Each buffer update sub-allocates a new range in the current segment,
+and only a single fence is inserted per segment when the frame ends, i.e. when a swap-chain is presented or the segment runs full.
+Before a segment is reused, all buffers whose latest content still lives in that segment are written into it again.
+*/
+class GLStreamingBufferPool
+{
+
+    public:
+
+        // Returns the instance of this singleton.
+        static GLStreamingBufferPool& Get();
+
+    public:
+
+        GLStreamingBufferPool(const GLStreamingBufferPool&) = delete;
+        GLStreamingBufferPool& operator = (const GLStreamingBufferPool&) = delete;
+
+        GLStreamingBufferPool(GLStreamingBufferPool&&) = delete;
+        GLStreamingBufferPool& operator = (GLStreamingBufferPool&&) = delete;
+
+        ~GLStreamingBufferPool();
+
+        // Releases all resources for this singleton class.
+        void Clear();
+
+        // Registers the specified buffer with its logical size. Returns false if persistent mapping is not supported or the pool has no capacity left.
+        bool RegisterBuffer(GLBuffer& buffer, GLsizeiptr size);
+
+        // Unregisters the specified buffer. Its last range remains in the ring until the segment is reused.
+        void UnregisterBuffer(GLBuffer& buffer);
+
+        // Allocates a range of the specified size within the current segment and returns its offset. This may end the current frame if the segment is full.
+        GLintptr AllocRange(GLsizeiptr size);
+
+        // Guards the current segment with a fence and moves on to the next one. Called once per frame when a swap-chain is presented.
+        void NextFrame();
+
+        // Returns the GL buffer ID of the ring buffer or 0 if no streaming buffer has been registered yet.
+        inline GLuint GetBufferID() const
+        {
+            return bufferID_;
+        }
+
+        // Returns a pointer to the persistently mapped memory of the ring buffer at the specified offset.
+        inline char* GetMappedRange(GLintptr offset) const
+        {
+            return (persistentPtr_ + offset);
+        }
+
+    private:
+
+        GLStreamingBufferPool() = default;
+
+        // Creates the ring buffer and keeps it persistently mapped.
+        bool CreateRingBuffer();
+
+        // Releases the ring buffer and all segment fences.
+        void DeleteRingBuffer();
+
+        // Guards the current segment with a fence, waits until the GPU no longer reads from the next segment, and writes all buffers it still holds again.
+        void AdvanceSegment();
+
+        // Returns the index of the segment the specified offset belongs to.
+        std::uint32_t GetSegmentIndex(GLintptr offset) const;
+
+    private:
+
+        // Number of segments in the ring buffer, i.e. number of frames in flight.
+        static constexpr std::uint32_t numSegments = 3;
+
+        GLuint                  bufferID_               = 0;
+        char*                   persistentPtr_          = nullptr;
+        GLintptr                alignment_              = 1;        // Minimum offset alignment for glBindBufferRange (GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT)
+        GLsizeiptr              registeredSize_         = 0;        // Sum of aligned logical sizes of all registered buffers
+        std::uint32_t           segment_                = 0;        // Index of the current segment
+        GLintptr                head_                   = 0;        // Offset of the next free byte in the current segment
+        GLsync                  fences_[numSegments]    = {};       // Fences guarding each segment until the GPU has finished the frame that used it
+        std::vector<GLBuffer*>  buffers_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
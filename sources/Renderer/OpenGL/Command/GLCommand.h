@@ -202,6 +202,12 @@ struct GLCmdBindBufferBase
     GLuint          id;
 };
 
+struct GLCmdBindStreamingUniformBuffer
+{
+    GLuint          index;
+    const GLBuffer* buffer;
+};
+
 struct GLCmdBindBuffersBase
 {
     GLBufferTarget  target;
@@ -396,6 +402,25 @@ struct GLCmdMultiDrawElementsIndirect
     GLsizei         stride;
 };
 
+struct GLCmdMultiDrawArrays
+{
+    GLenum          mode;
+    GLsizei         drawcount;
+//  GLint           first[drawcount];
+//  GLsizei         count[drawcount];
+};
+
+// Aligned to pointer size, so the array of index offsets can follow immediately.
+struct alignas(sizeof(const GLvoid*)) GLCmdMultiDrawElementsBaseVertex
+{
+    GLenum          mode;
+    GLenum          type;
+    GLsizei         drawcount;
+//  const GLvoid*   indices[drawcount];
+//  GLsizei         count[drawcount];
+//  GLint           basevertex[drawcount];
+};
+
 struct GLCmdDrawTransformFeedback
 {
     GLenum  mode;
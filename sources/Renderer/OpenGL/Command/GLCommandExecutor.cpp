@@ -219,6 +219,12 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
             stateMngr->BindBuffersBase(cmd->target, cmd->first, cmd->count, reinterpret_cast<const GLuint*>(cmd + 1));
             return (sizeof(*cmd) + sizeof(GLuint)*cmd->count);
         }
+        case GLOpcodeBindStreamingUniformBuffer:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBindStreamingUniformBuffer*>(pc);
+            stateMngr->BindStreamingUniformBuffer(cmd->index, *(cmd->buffer));
+            return sizeof(*cmd);
+        }
         case GLOpcodeBeginBufferXfb:
         {
             auto cmd = reinterpret_cast<const GLCmdBeginBufferXfb*>(pc);
@@ -435,6 +441,36 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
             #endif
             return sizeof(*cmd);
         }
+        case GLOpcodeMultiDrawArrays:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMultiDrawArrays*>(pc);
+            auto cmdData = reinterpret_cast<const std::int8_t*>(cmd + 1);
+            #if LLGL_GLEXT_MULTI_DRAW
+            glMultiDrawArrays(
+                cmd->mode,
+                reinterpret_cast<const GLint*>(cmdData),
+                reinterpret_cast<const GLsizei*>(cmdData + sizeof(GLint)*cmd->drawcount),
+                cmd->drawcount
+            );
+            #endif
+            return (sizeof(*cmd) + (sizeof(GLint) + sizeof(GLsizei))*cmd->drawcount);
+        }
+        case GLOpcodeMultiDrawElementsBaseVertex:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMultiDrawElementsBaseVertex*>(pc);
+            auto cmdData = reinterpret_cast<const std::int8_t*>(cmd + 1);
+            #if LLGL_GLEXT_MULTI_DRAW && LLGL_GLEXT_DRAW_ELEMENTS_BASE_VERTEX
+            glMultiDrawElementsBaseVertex(
+                cmd->mode,
+                reinterpret_cast<const GLsizei*>(cmdData + sizeof(const GLvoid*)*cmd->drawcount),
+                cmd->type,
+                reinterpret_cast<const GLvoid* const*>(cmdData),
+                cmd->drawcount,
+                reinterpret_cast<const GLint*>(cmdData + (sizeof(const GLvoid*) + sizeof(GLsizei))*cmd->drawcount)
+            );
+            #endif
+            return (sizeof(*cmd) + (sizeof(const GLvoid*) + sizeof(GLsizei) + sizeof(GLint))*cmd->drawcount);
+        }
         case GLOpcodeDrawTransformFeedback:
         {
             auto cmd = reinterpret_cast<const GLCmdDrawTransformFeedback*>(pc);
@@ -496,14 +532,14 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
             stateMngr->BindEmulatedSampler(cmd->layer, *(cmd->sampler));
             return sizeof(*cmd);
         }
-        #if LLGL_GLEXT_MEMORY_BARRIERS
         case GLOpcodeMemoryBarrier:
         {
             auto cmd = reinterpret_cast<const GLCmdMemoryBarrier*>(pc);
+            #if LLGL_GLEXT_MEMORY_BARRIERS
             glMemoryBarrier(cmd->barriers);
+            #endif
             return sizeof(*cmd);
         }
-        #endif
         case GLOpcodePushDebugGroup:
         {
             auto cmd = reinterpret_cast<const GLCmdPushDebugGroup*>(pc);
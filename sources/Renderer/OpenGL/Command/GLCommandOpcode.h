@@ -44,6 +44,7 @@ enum GLOpcode : std::uint8_t
     GLOpcodeBindElementArrayBufferToVAO,
     GLOpcodeBindBufferBase,
     GLOpcodeBindBuffersBase,
+    GLOpcodeBindStreamingUniformBuffer,
     GLOpcodeBeginBufferXfb,
     GLOpcodeEndBufferXfb,
     GLOpcodeBeginTransformFeedback,
@@ -74,6 +75,8 @@ enum GLOpcode : std::uint8_t
     GLOpcodeDrawEmulatedTransformFeedback,
     GLOpcodeMultiDrawArraysIndirect,
     GLOpcodeMultiDrawElementsIndirect,
+    GLOpcodeMultiDrawArrays,
+    GLOpcodeMultiDrawElementsBaseVertex,
     GLOpcodeDispatchCompute,
     GLOpcodeDispatchComputeIndirect,
     GLOpcodeBindTexture,
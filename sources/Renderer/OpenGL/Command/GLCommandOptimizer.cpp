@@ -0,0 +1,846 @@
+/*
+ * GLCommandOptimizer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLCommandOptimizer.h"
+#include "GLCommand.h"
+#include "../RenderState/GLGraphicsPSO.h"
+#include "../RenderState/GLPipelineLayout.h"
+#include "../Ext/GLExtensionRegistry.h"
+#include "../OpenGL.h"
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal functions
+ */
+
+// Bitmasks for the render states that are tracked by the optimizer.
+enum GLTrackedState : std::uint32_t
+{
+    GLTrackedStatePipelineState = (1u << 0),
+    GLTrackedStateVertexArray   = (1u << 1),
+    GLTrackedStateResources     = (1u << 2), // Resource heaps and individual resource bindings
+    GLTrackedStateViewport      = (1u << 3),
+    GLTrackedStateScissor       = (1u << 4),
+    GLTrackedStateBlendColor    = (1u << 5),
+    GLTrackedStateStencilRef    = (1u << 6),
+    GLTrackedStateAll           = ~0u,
+};
+
+// Returns the size (in bytes) of the specified command without its opcode. This must match the sizes the command executor returns.
+static std::size_t GetGLCommandSize(const GLOpcode opcode, const void* pc)
+{
+    switch (opcode)
+    {
+        case GLOpcodeBufferSubData:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBufferSubData*>(pc);
+            return (sizeof(*cmd) + cmd->size);
+        }
+        case GLOpcodeCopyBufferSubData:                         return sizeof(GLCmdCopyBufferSubData);
+        case GLOpcodeClearBufferData:                           return sizeof(GLCmdClearBufferData);
+        case GLOpcodeClearBufferSubData:                        return sizeof(GLCmdClearBufferSubData);
+        case GLOpcodeCopyImageSubData:                          return sizeof(GLCmdCopyImageSubData);
+        case GLOpcodeCopyImageToBuffer:                         return sizeof(GLCmdCopyImageBuffer);
+        case GLOpcodeCopyImageFromBuffer:                       return sizeof(GLCmdCopyImageBuffer);
+        case GLOpcodeCopyFramebufferSubData:                    return sizeof(GLCmdCopyFramebufferSubData);
+        case GLOpcodeGenerateMipmap:                            return sizeof(GLCmdGenerateMipmap);
+        case GLOpcodeGenerateMipmapSubresource:                 return sizeof(GLCmdGenerateMipmapSubresource);
+        case GLOpcodeExecute:                                   return sizeof(GLCmdExecute);
+        case GLOpcodeViewport:                                  return sizeof(GLCmdViewport);
+        case GLOpcodeViewportArray:
+        {
+            auto cmd = reinterpret_cast<const GLCmdViewportArray*>(pc);
+            return (sizeof(*cmd) + sizeof(GLViewport)*cmd->count + sizeof(GLDepthRange)*cmd->count);
+        }
+        case GLOpcodeScissor:                                   return sizeof(GLCmdScissor);
+        case GLOpcodeScissorArray:
+        {
+            auto cmd = reinterpret_cast<const GLCmdScissorArray*>(pc);
+            return (sizeof(*cmd) + sizeof(GLScissor)*cmd->count);
+        }
+        case GLOpcodeClearColor:                                return sizeof(GLCmdClearColor);
+        case GLOpcodeClearDepth:                                return sizeof(GLCmdClearDepth);
+        case GLOpcodeClearStencil:                              return sizeof(GLCmdClearStencil);
+        case GLOpcodeClear:                                     return sizeof(GLCmdClear);
+        case GLOpcodeClearAttachmentsWithRenderPass:
+        {
+            auto cmd = reinterpret_cast<const GLCmdClearAttachmentsWithRenderPass*>(pc);
+            return (sizeof(*cmd) + sizeof(ClearValue)*cmd->numClearValues);
+        }
+        case GLOpcodeClearBuffers:
+        {
+            auto cmd = reinterpret_cast<const GLCmdClearBuffers*>(pc);
+            return (sizeof(*cmd) + sizeof(AttachmentClear)*cmd->numAttachments);
+        }
+        case GLOpcodeResolveRenderTarget:                       return sizeof(GLCmdResolveRenderTarget);
+        case GLOpcodeBindVertexArray:                           return sizeof(GLCmdBindVertexArray);
+        case GLOpcodeBindElementArrayBufferToVAO:               return sizeof(GLCmdBindElementArrayBufferToVAO);
+        case GLOpcodeBindBufferBase:                            return sizeof(GLCmdBindBufferBase);
+        case GLOpcodeBindBuffersBase:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBindBuffersBase*>(pc);
+            return (sizeof(*cmd) + sizeof(GLuint)*cmd->count);
+        }
+        case GLOpcodeBindStreamingUniformBuffer:                return sizeof(GLCmdBindStreamingUniformBuffer);
+        case GLOpcodeBeginBufferXfb:                            return sizeof(GLCmdBeginBufferXfb);
+        case GLOpcodeEndBufferXfb:                              return 0;
+        case GLOpcodeBeginTransformFeedback:                    return sizeof(GLCmdBeginTransformFeedback);
+        case GLOpcodeBeginTransformFeedbackNV:                  return sizeof(GLCmdBeginTransformFeedbackNV);
+        case GLOpcodeEndTransformFeedback:                      return 0;
+        case GLOpcodeEndTransformFeedbackNV:                    return 0;
+        case GLOpcodeBindResourceHeap:                          return sizeof(GLCmdBindResourceHeap);
+        case GLOpcodeBindRenderTarget:                          return sizeof(GLCmdBindRenderTarget);
+        case GLOpcodeBindPipelineState:                         return sizeof(GLCmdBindPipelineState);
+        case GLOpcodeSetBlendColor:                             return sizeof(GLCmdSetBlendColor);
+        case GLOpcodeSetStencilRef:                             return sizeof(GLCmdSetStencilRef);
+        case GLOpcodeSetUniform:
+        {
+            auto cmd = reinterpret_cast<const GLCmdSetUniform*>(pc);
+            return (sizeof(*cmd) + cmd->size);
+        }
+        case GLOpcodeBeginQuery:                                return sizeof(GLCmdBeginQuery);
+        case GLOpcodeEndQuery:                                  return sizeof(GLCmdEndQuery);
+        case GLOpcodeBeginConditionalRender:                    return sizeof(GLCmdBeginConditionalRender);
+        case GLOpcodeEndConditionalRender:                      return 0;
+        case GLOpcodeDrawArrays:                                return sizeof(GLCmdDrawArrays);
+        case GLOpcodeDrawArraysInstanced:                       return sizeof(GLCmdDrawArraysInstanced);
+        case GLOpcodeDrawArraysInstancedBaseInstance:           return sizeof(GLCmdDrawArraysInstancedBaseInstance);
+        case GLOpcodeDrawArraysIndirect:                        return sizeof(GLCmdDrawArraysIndirect);
+        case GLOpcodeDrawElements:                              return sizeof(GLCmdDrawElements);
+        case GLOpcodeDrawElementsBaseVertex:                    return sizeof(GLCmdDrawElementsBaseVertex);
+        case GLOpcodeDrawElementsInstanced:                     return sizeof(GLCmdDrawElementsInstanced);
+        case GLOpcodeDrawElementsInstancedBaseVertex:           return sizeof(GLCmdDrawElementsInstancedBaseVertex);
+        case GLOpcodeDrawElementsInstancedBaseVertexBaseInstance: return sizeof(GLCmdDrawElementsInstancedBaseVertexBaseInstance);
+        case GLOpcodeDrawElementsIndirect:                      return sizeof(GLCmdDrawElementsIndirect);
+        case GLOpcodeDrawTransformFeedback:                     return sizeof(GLCmdDrawTransformFeedback);
+        case GLOpcodeDrawEmulatedTransformFeedback:             return sizeof(GLCmdDrawEmulatedTransformFeedback);
+        case GLOpcodeMultiDrawArraysIndirect:                   return sizeof(GLCmdMultiDrawArraysIndirect);
+        case GLOpcodeMultiDrawElementsIndirect:                 return sizeof(GLCmdMultiDrawElementsIndirect);
+        case GLOpcodeMultiDrawArrays:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMultiDrawArrays*>(pc);
+            return (sizeof(*cmd) + (sizeof(GLint) + sizeof(GLsizei))*cmd->drawcount);
+        }
+        case GLOpcodeMultiDrawElementsBaseVertex:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMultiDrawElementsBaseVertex*>(pc);
+            return (sizeof(*cmd) + (sizeof(const GLvoid*) + sizeof(GLsizei) + sizeof(GLint))*cmd->drawcount);
+        }
+        case GLOpcodeDispatchCompute:                           return sizeof(GLCmdDispatchCompute);
+        case GLOpcodeDispatchComputeIndirect:                   return sizeof(GLCmdDispatchComputeIndirect);
+        case GLOpcodeBindTexture:                               return sizeof(GLCmdBindTexture);
+        case GLOpcodeBindTextureNative:                         return sizeof(GLCmdBindTextureNative);
+        case GLOpcodeBindImageTexture:                          return sizeof(GLCmdBindImageTexture);
+        case GLOpcodeBindSampler:                               return sizeof(GLCmdBindSampler);
+        case GLOpcodeBindEmulatedSampler:                       return sizeof(GLCmdBindEmulatedSampler);
+        case GLOpcodeMemoryBarrier:                             return sizeof(GLCmdMemoryBarrier);
+        case GLOpcodePushDebugGroup:
+        {
+            auto cmd = reinterpret_cast<const GLCmdPushDebugGroup*>(pc);
+            return (sizeof(*cmd) + cmd->length + 1);
+        }
+        case GLOpcodePopDebugGroup:                             return 0;
+        default:                                                return 0;
+    }
+}
+
+// Returns the bitmask of tracked states the specified command modifies or otherwise makes unpredictable. Commands with their own tracking are not included.
+static std::uint32_t GetInvalidatedStates(const GLOpcode opcode)
+{
+    switch (opcode)
+    {
+        case GLOpcodeClearColor:
+        case GLOpcodeClearDepth:
+        case GLOpcodeClearStencil:
+        case GLOpcodeSetUniform:
+        case GLOpcodeBeginQuery:
+        case GLOpcodeEndQuery:
+        case GLOpcodeBeginConditionalRender:
+        case GLOpcodeEndConditionalRender:
+        case GLOpcodeDrawArrays:
+        case GLOpcodeDrawArraysInstanced:
+        case GLOpcodeDrawArraysInstancedBaseInstance:
+        case GLOpcodeDrawArraysIndirect:
+        case GLOpcodeDrawElements:
+        case GLOpcodeDrawElementsBaseVertex:
+        case GLOpcodeDrawElementsInstanced:
+        case GLOpcodeDrawElementsInstancedBaseVertex:
+        case GLOpcodeDrawElementsInstancedBaseVertexBaseInstance:
+        case GLOpcodeDrawElementsIndirect:
+        case GLOpcodeMultiDrawArraysIndirect:
+        case GLOpcodeMultiDrawElementsIndirect:
+        case GLOpcodeMultiDrawArrays:
+        case GLOpcodeMultiDrawElementsBaseVertex:
+        case GLOpcodeDispatchCompute:
+        case GLOpcodeDispatchComputeIndirect:
+        case GLOpcodeMemoryBarrier:
+        case GLOpcodePushDebugGroup:
+        case GLOpcodePopDebugGroup:
+            return 0;
+
+        case GLOpcodeViewportArray:
+            return GLTrackedStateViewport;
+
+        case GLOpcodeScissorArray:
+            return GLTrackedStateScissor;
+
+        /* Buffer updates may bind the buffer to its target, which affects the index buffer of the bound VAO */
+        case GLOpcodeBufferSubData:
+        case GLOpcodeCopyBufferSubData:
+        case GLOpcodeClearBufferData:
+        case GLOpcodeClearBufferSubData:
+        case GLOpcodeBindElementArrayBufferToVAO:
+            return GLTrackedStateVertexArray;
+
+        case GLOpcodeBindTexture:
+        case GLOpcodeBindTextureNative:
+        case GLOpcodeBindImageTexture:
+        case GLOpcodeBindSampler:
+        case GLOpcodeBindEmulatedSampler:
+        case GLOpcodeBindBufferBase:
+        case GLOpcodeBindBuffersBase:
+        case GLOpcodeBindStreamingUniformBuffer:
+            return GLTrackedStateResources;
+
+        /* Render target changes may switch the GL context, secondary command buffers are opaque, and all other commands might go through helper objects */
+        default:
+            return GLTrackedStateAll;
+    }
+}
+
+// Returns true if the specified command neither reads nor writes viewports and scissors, i.e. a pending viewport or scissor command can be moved across it.
+static bool IsIndependentOfViewportAndScissor(const GLOpcode opcode)
+{
+    switch (opcode)
+    {
+        case GLOpcodeBufferSubData:
+        case GLOpcodeClearColor:
+        case GLOpcodeClearDepth:
+        case GLOpcodeClearStencil:
+        case GLOpcodeBindVertexArray:
+        case GLOpcodeBindElementArrayBufferToVAO:
+        case GLOpcodeBindBufferBase:
+        case GLOpcodeBindBuffersBase:
+        case GLOpcodeBindStreamingUniformBuffer:
+        case GLOpcodeBindResourceHeap:
+        case GLOpcodeSetBlendColor:
+        case GLOpcodeSetStencilRef:
+        case GLOpcodeSetUniform:
+        case GLOpcodeBindTexture:
+        case GLOpcodeBindTextureNative:
+        case GLOpcodeBindImageTexture:
+        case GLOpcodeBindSampler:
+        case GLOpcodeBindEmulatedSampler:
+        case GLOpcodeMemoryBarrier:
+        case GLOpcodePushDebugGroup:
+        case GLOpcodePopDebugGroup:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Returns the bitmask of tracked states the specified PSO sets when it is bound.
+static std::uint32_t GetPipelineStateWrites(const GLPipelineState* pipelineState)
+{
+    std::uint32_t states = 0;
+
+    if (pipelineState->IsGraphicsPSO())
+    {
+        /* Blend color and stencil reference might be static states of the blend and depth-stencil state objects */
+        states |= (GLTrackedStateBlendColor | GLTrackedStateStencilRef);
+
+        auto* graphicsPSO = static_cast<const GLGraphicsPSO*>(pipelineState);
+        if (graphicsPSO->HasStaticViewports())
+            states |= GLTrackedStateViewport;
+        if (graphicsPSO->HasStaticScissors())
+            states |= GLTrackedStateScissor;
+    }
+
+    /* Static samplers are bound to the same slots as the resource bindings */
+    if (const GLPipelineLayout* pipelineLayout = pipelineState->GetPipelineLayout())
+    {
+        if (!pipelineLayout->GetStaticSamplerSlots().empty())
+            states |= GLTrackedStateResources;
+    }
+
+    return states;
+}
+
+// Returns true if runs of DrawArrays commands can be folded into a single glMultiDrawArrays call.
+static bool IsMultiDrawArraysSupported()
+{
+    #if LLGL_GLEXT_MULTI_DRAW
+    return HasExtension(GLExt::EXT_multi_draw_arrays);
+    #else
+    return false;
+    #endif
+}
+
+// Returns true if runs of DrawElements commands can be folded into a single glMultiDrawElementsBaseVertex call.
+static bool IsMultiDrawElementsSupported()
+{
+    #if LLGL_GLEXT_MULTI_DRAW && LLGL_GLEXT_DRAW_ELEMENTS_BASE_VERTEX
+    return (HasExtension(GLExt::EXT_multi_draw_arrays) && HasExtension(GLExt::ARB_draw_elements_base_vertex));
+    #else
+    return false;
+    #endif
+}
+
+static bool IsEqualViewport(const GLCmdViewport& lhs, const GLCmdViewport& rhs)
+{
+    return
+    (
+        lhs.viewport.x              == rhs.viewport.x               &&
+        lhs.viewport.y              == rhs.viewport.y               &&
+        lhs.viewport.width          == rhs.viewport.width           &&
+        lhs.viewport.height         == rhs.viewport.height          &&
+        lhs.depthRange.minDepth     == rhs.depthRange.minDepth      &&
+        lhs.depthRange.maxDepth     == rhs.depthRange.maxDepth
+    );
+}
+
+static bool IsEqualScissor(const GLCmdScissor& lhs, const GLCmdScissor& rhs)
+{
+    return
+    (
+        lhs.scissor.x       == rhs.scissor.x        &&
+        lhs.scissor.y       == rhs.scissor.y        &&
+        lhs.scissor.width   == rhs.scissor.width    &&
+        lhs.scissor.height  == rhs.scissor.height
+    );
+}
+
+static bool IsEqualResourceHeap(const GLCmdBindResourceHeap& lhs, const GLCmdBindResourceHeap& rhs)
+{
+    return
+    (
+        lhs.resourceHeap        == rhs.resourceHeap     &&
+        lhs.descriptorSet       == rhs.descriptorSet    &&
+        lhs.bufferInterfaceMap  == rhs.bufferInterfaceMap
+    );
+}
+
+static bool IsEqualBlendColor(const GLCmdSetBlendColor& lhs, const GLCmdSetBlendColor& rhs)
+{
+    return std::equal(std::begin(lhs.color), std::end(lhs.color), std::begin(rhs.color));
+}
+
+static bool IsEqualStencilRef(const GLCmdSetStencilRef& lhs, const GLCmdSetStencilRef& rhs)
+{
+    return (lhs.ref == rhs.ref && lhs.face == rhs.face);
+}
+
+
+/*
+ * GLCommandOptimizer class
+ */
+
+// Helper class to re-encode a virtual command buffer while tracking the bound states.
+class GLCommandOptimizer
+{
+
+    public:
+
+        GLCommandOptimizer(GLVirtualCommandBuffer& output) :
+            output_             { output                         },
+            multiDrawArrays_    { IsMultiDrawArraysSupported()   },
+            multiDrawElements_  { IsMultiDrawElementsSupported() }
+        {
+        }
+
+        // Processes the specified command and returns its size (in bytes). Compatible with VirtualCommandBuffer::Run().
+        std::size_t operator () (const GLOpcode opcode, const void* pc)
+        {
+            const std::size_t size = GetGLCommandSize(opcode, pc);
+
+            if (opcode != GLOpcodeBufferSubData)
+                FlushBufferUpdate();
+
+            /* Consecutive draw commands are only separated by commands that have been removed, so they share the same state */
+            if (AppendDrawToBatch(opcode, pc))
+                return size;
+
+            /* Redundant state changes are dropped without breaking the current draw batch; all other commands flush it before they are encoded */
+            switch (opcode)
+            {
+                case GLOpcodeBufferSubData:
+                    FlushDrawBatch();
+                    AppendBufferUpdate(*reinterpret_cast<const GLCmdBufferSubData*>(pc));
+                    break;
+                case GLOpcodeBindPipelineState:
+                    BindPipelineState(*reinterpret_cast<const GLCmdBindPipelineState*>(pc));
+                    break;
+                case GLOpcodeBindVertexArray:
+                    BindVertexArray(*reinterpret_cast<const GLCmdBindVertexArray*>(pc));
+                    break;
+                case GLOpcodeBindResourceHeap:
+                    BindResourceHeap(*reinterpret_cast<const GLCmdBindResourceHeap*>(pc));
+                    break;
+                case GLOpcodeViewport:
+                    SetViewport(*reinterpret_cast<const GLCmdViewport*>(pc));
+                    break;
+                case GLOpcodeScissor:
+                    SetScissor(*reinterpret_cast<const GLCmdScissor*>(pc));
+                    break;
+                case GLOpcodeSetBlendColor:
+                    SetBlendColor(*reinterpret_cast<const GLCmdSetBlendColor*>(pc));
+                    break;
+                case GLOpcodeSetStencilRef:
+                    SetStencilRef(*reinterpret_cast<const GLCmdSetStencilRef*>(pc));
+                    break;
+                default:
+                    FlushDrawBatch();
+                    CopyCommand(opcode, pc, size);
+                    break;
+            }
+
+            return size;
+        }
+
+        // Flushes the remaining buffer update and draw batch.
+        void Finish()
+        {
+            FlushBufferUpdate();
+            FlushDrawBatch();
+        }
+
+        // Returns the number of commands that have been removed.
+        std::size_t GetNumRemovedCommands() const
+        {
+            return numRemovedCommands_;
+        }
+
+    private:
+
+        // Returns true if the specified states are currently known.
+        bool IsValid(std::uint32_t states) const
+        {
+            return ((validStates_ & states) == states);
+        }
+
+        // Marks the specified states as unknown. This also invalidates the PSO if it sets any of these states on its own.
+        void InvalidateStates(std::uint32_t states)
+        {
+            if ((states & pipelineStateWrites_) != 0)
+                states |= GLTrackedStatePipelineState;
+            validStates_ &= ~states;
+        }
+
+        // Marks the specified state as known after it has been encoded.
+        void ValidateState(std::uint32_t state)
+        {
+            InvalidateStates(state);
+            validStates_ |= state;
+        }
+
+        template <typename TCommand>
+        TCommand* AllocCommand(const GLOpcode opcode, std::size_t payloadSize = 0)
+        {
+            return output_.AllocCommand<TCommand>(opcode, payloadSize);
+        }
+
+        void CopyCommand(const GLOpcode opcode, const void* pc, std::size_t size)
+        {
+            /* Copy command with maximum alignment since the actual command type is unknown */
+            if (size > 0)
+                ::memcpy(output_.AllocCommandData(opcode, size, alignof(std::max_align_t)), pc, size);
+            else
+                output_.AllocOpcode(opcode);
+
+            InvalidateStates(GetInvalidatedStates(opcode));
+
+            if (!IsIndependentOfViewportAndScissor(opcode))
+            {
+                pendingViewport_ = nullptr;
+                pendingScissor_ = nullptr;
+            }
+        }
+
+        void BindPipelineState(const GLCmdBindPipelineState& cmd)
+        {
+            if (IsValid(GLTrackedStatePipelineState) && pipelineState_.pipelineState == cmd.pipelineState)
+            {
+                ++numRemovedCommands_;
+                return;
+            }
+            FlushDrawBatch();
+
+            *AllocCommand<GLCmdBindPipelineState>(GLOpcodeBindPipelineState) = cmd;
+            pipelineState_ = cmd;
+
+            /* States that are set by the PSO are no longer known, but the PSO itself is */
+            pipelineStateWrites_ = GetPipelineStateWrites(cmd.pipelineState);
+            validStates_ &= ~pipelineStateWrites_;
+            validStates_ |= GLTrackedStatePipelineState;
+
+            if ((pipelineStateWrites_ & GLTrackedStateViewport) != 0)
+                pendingViewport_ = nullptr;
+            if ((pipelineStateWrites_ & GLTrackedStateScissor) != 0)
+                pendingScissor_ = nullptr;
+        }
+
+        void BindVertexArray(const GLCmdBindVertexArray& cmd)
+        {
+            if (IsValid(GLTrackedStateVertexArray) && vertexArray_.vertexArray == cmd.vertexArray)
+            {
+                ++numRemovedCommands_;
+                return;
+            }
+            FlushDrawBatch();
+            *AllocCommand<GLCmdBindVertexArray>(GLOpcodeBindVertexArray) = cmd;
+            vertexArray_ = cmd;
+            ValidateState(GLTrackedStateVertexArray);
+        }
+
+        void BindResourceHeap(const GLCmdBindResourceHeap& cmd)
+        {
+            if (IsValid(GLTrackedStateResources) && IsEqualResourceHeap(resourceHeap_, cmd))
+            {
+                ++numRemovedCommands_;
+                return;
+            }
+            FlushDrawBatch();
+            *AllocCommand<GLCmdBindResourceHeap>(GLOpcodeBindResourceHeap) = cmd;
+            resourceHeap_ = cmd;
+            ValidateState(GLTrackedStateResources);
+        }
+
+        void SetViewport(const GLCmdViewport& cmd)
+        {
+            if (IsValid(GLTrackedStateViewport) && IsEqualViewport(viewport_, cmd))
+            {
+                ++numRemovedCommands_;
+                return;
+            }
+            FlushDrawBatch();
+            if (pendingViewport_ != nullptr)
+            {
+                /* Overwrite previous viewport since no command has observed it yet */
+                *pendingViewport_ = cmd;
+                ++numRemovedCommands_;
+            }
+            else
+            {
+                pendingViewport_ = AllocCommand<GLCmdViewport>(GLOpcodeViewport);
+                *pendingViewport_ = cmd;
+            }
+            viewport_ = cmd;
+            ValidateState(GLTrackedStateViewport);
+        }
+
+        void SetScissor(const GLCmdScissor& cmd)
+        {
+            if (IsValid(GLTrackedStateScissor) && IsEqualScissor(scissor_, cmd))
+            {
+                ++numRemovedCommands_;
+                return;
+            }
+            FlushDrawBatch();
+            if (pendingScissor_ != nullptr)
+            {
+                /* Overwrite previous scissor since no command has observed it yet */
+                *pendingScissor_ = cmd;
+                ++numRemovedCommands_;
+            }
+            else
+            {
+                pendingScissor_ = AllocCommand<GLCmdScissor>(GLOpcodeScissor);
+                *pendingScissor_ = cmd;
+            }
+            scissor_ = cmd;
+            ValidateState(GLTrackedStateScissor);
+        }
+
+        void SetBlendColor(const GLCmdSetBlendColor& cmd)
+        {
+            if (IsValid(GLTrackedStateBlendColor) && IsEqualBlendColor(blendColor_, cmd))
+            {
+                ++numRemovedCommands_;
+                return;
+            }
+            FlushDrawBatch();
+            *AllocCommand<GLCmdSetBlendColor>(GLOpcodeSetBlendColor) = cmd;
+            blendColor_ = cmd;
+            ValidateState(GLTrackedStateBlendColor);
+        }
+
+        void SetStencilRef(const GLCmdSetStencilRef& cmd)
+        {
+            if (IsValid(GLTrackedStateStencilRef) && IsEqualStencilRef(stencilRef_, cmd))
+            {
+                ++numRemovedCommands_;
+                return;
+            }
+            FlushDrawBatch();
+            *AllocCommand<GLCmdSetStencilRef>(GLOpcodeSetStencilRef) = cmd;
+            stencilRef_ = cmd;
+            ValidateState(GLTrackedStateStencilRef);
+        }
+
+        void AppendBufferUpdate(const GLCmdBufferSubData& cmd)
+        {
+            const char* data = reinterpret_cast<const char*>(&cmd + 1);
+            const GLintptr pendingEnd = bufferUpdateOffset_ + static_cast<GLintptr>(bufferUpdateData_.size());
+
+            if (bufferUpdate_ != nullptr && bufferUpdate_ == cmd.buffer && cmd.offset >= bufferUpdateOffset_ && cmd.offset <= pendingEnd)
+            {
+                /* Merge contiguous or overlapping range into pending update; later writes take precedence */
+                const std::size_t relativeOffset = static_cast<std::size_t>(cmd.offset - bufferUpdateOffset_);
+                const std::size_t requiredSize = relativeOffset + static_cast<std::size_t>(cmd.size);
+                if (requiredSize > bufferUpdateData_.size())
+                    bufferUpdateData_.resize(requiredSize);
+                ::memcpy(bufferUpdateData_.data() + relativeOffset, data, static_cast<std::size_t>(cmd.size));
+                ++numRemovedCommands_;
+            }
+            else
+            {
+                /* Start new pending update */
+                FlushBufferUpdate();
+                bufferUpdate_       = cmd.buffer;
+                bufferUpdateOffset_ = cmd.offset;
+                bufferUpdateData_.assign(data, data + cmd.size);
+            }
+
+            InvalidateStates(GetInvalidatedStates(GLOpcodeBufferSubData));
+        }
+
+        void FlushBufferUpdate()
+        {
+            if (bufferUpdate_ != nullptr)
+            {
+                auto cmd = AllocCommand<GLCmdBufferSubData>(GLOpcodeBufferSubData, bufferUpdateData_.size());
+                {
+                    cmd->buffer = bufferUpdate_;
+                    cmd->offset = bufferUpdateOffset_;
+                    cmd->size   = static_cast<GLsizeiptr>(bufferUpdateData_.size());
+                    ::memcpy(cmd + 1, bufferUpdateData_.data(), bufferUpdateData_.size());
+                }
+                bufferUpdate_ = nullptr;
+                bufferUpdateData_.clear();
+            }
+        }
+
+        // Appends the specified command to the current draw batch if it is a non-instanced draw command.
+        bool AppendDrawToBatch(const GLOpcode opcode, const void* pc)
+        {
+            switch (opcode)
+            {
+                case GLOpcodeDrawArrays:
+                {
+                    auto cmd = reinterpret_cast<const GLCmdDrawArrays*>(pc);
+                    return AppendDrawArrays(cmd->mode, cmd->first, cmd->count);
+                }
+                case GLOpcodeDrawArraysInstanced:
+                {
+                    auto cmd = reinterpret_cast<const GLCmdDrawArraysInstanced*>(pc);
+                    return (cmd->instancecount == 1 && AppendDrawArrays(cmd->mode, cmd->first, cmd->count));
+                }
+                case GLOpcodeDrawElements:
+                {
+                    auto cmd = reinterpret_cast<const GLCmdDrawElements*>(pc);
+                    return AppendDrawElements(cmd->mode, cmd->type, cmd->indices, cmd->count, 0);
+                }
+                case GLOpcodeDrawElementsBaseVertex:
+                {
+                    auto cmd = reinterpret_cast<const GLCmdDrawElementsBaseVertex*>(pc);
+                    return AppendDrawElements(cmd->mode, cmd->type, cmd->indices, cmd->count, cmd->basevertex);
+                }
+                case GLOpcodeDrawElementsInstanced:
+                {
+                    auto cmd = reinterpret_cast<const GLCmdDrawElementsInstanced*>(pc);
+                    return (cmd->instancecount == 1 && AppendDrawElements(cmd->mode, cmd->type, cmd->indices, cmd->count, 0));
+                }
+                case GLOpcodeDrawElementsInstancedBaseVertex:
+                {
+                    auto cmd = reinterpret_cast<const GLCmdDrawElementsInstancedBaseVertex*>(pc);
+                    return (cmd->instancecount == 1 && AppendDrawElements(cmd->mode, cmd->type, cmd->indices, cmd->count, cmd->basevertex));
+                }
+                default:
+                    return false;
+            }
+        }
+
+        bool AppendDrawArrays(GLenum mode, GLint first, GLsizei count)
+        {
+            if (!multiDrawArrays_)
+                return false;
+
+            if (drawBatchOpcode_ != GLOpcodeMultiDrawArrays || drawBatchMode_ != mode)
+            {
+                FlushDrawBatch();
+                drawBatchOpcode_    = GLOpcodeMultiDrawArrays;
+                drawBatchMode_      = mode;
+            }
+
+            drawBatchFirsts_.push_back(first);
+            drawBatchCounts_.push_back(count);
+            return true;
+        }
+
+        bool AppendDrawElements(GLenum mode, GLenum type, const GLvoid* indices, GLsizei count, GLint basevertex)
+        {
+            if (!multiDrawElements_)
+                return false;
+
+            if (drawBatchOpcode_ != GLOpcodeMultiDrawElementsBaseVertex || drawBatchMode_ != mode || drawBatchType_ != type)
+            {
+                FlushDrawBatch();
+                drawBatchOpcode_    = GLOpcodeMultiDrawElementsBaseVertex;
+                drawBatchMode_      = mode;
+                drawBatchType_      = type;
+            }
+
+            drawBatchIndices_.push_back(indices);
+            drawBatchCounts_.push_back(count);
+            drawBatchFirsts_.push_back(basevertex);
+            return true;
+        }
+
+        void FlushDrawBatch()
+        {
+            const std::size_t numDraws = drawBatchCounts_.size();
+            if (numDraws == 0)
+                return;
+
+            if (drawBatchOpcode_ == GLOpcodeMultiDrawArrays)
+            {
+                if (numDraws == 1)
+                {
+                    auto cmd = AllocCommand<GLCmdDrawArrays>(GLOpcodeDrawArrays);
+                    {
+                        cmd->mode   = drawBatchMode_;
+                        cmd->first  = drawBatchFirsts_[0];
+                        cmd->count  = drawBatchCounts_[0];
+                    }
+                }
+                else
+                {
+                    auto cmd = AllocCommand<GLCmdMultiDrawArrays>(GLOpcodeMultiDrawArrays, (sizeof(GLint) + sizeof(GLsizei))*numDraws);
+                    {
+                        cmd->mode       = drawBatchMode_;
+                        cmd->drawcount  = static_cast<GLsizei>(numDraws);
+                        auto cmdData = reinterpret_cast<char*>(cmd + 1);
+                        ::memcpy(cmdData, drawBatchFirsts_.data(), sizeof(GLint)*numDraws);
+                        ::memcpy(cmdData + sizeof(GLint)*numDraws, drawBatchCounts_.data(), sizeof(GLsizei)*numDraws);
+                    }
+                }
+            }
+            else
+            {
+                if (numDraws == 1 && drawBatchFirsts_[0] == 0)
+                {
+                    auto cmd = AllocCommand<GLCmdDrawElements>(GLOpcodeDrawElements);
+                    {
+                        cmd->mode       = drawBatchMode_;
+                        cmd->count      = drawBatchCounts_[0];
+                        cmd->type       = drawBatchType_;
+                        cmd->indices    = drawBatchIndices_[0];
+                    }
+                }
+                else if (numDraws == 1)
+                {
+                    auto cmd = AllocCommand<GLCmdDrawElementsBaseVertex>(GLOpcodeDrawElementsBaseVertex);
+                    {
+                        cmd->mode       = drawBatchMode_;
+                        cmd->count      = drawBatchCounts_[0];
+                        cmd->type       = drawBatchType_;
+                        cmd->indices    = drawBatchIndices_[0];
+                        cmd->basevertex = drawBatchFirsts_[0];
+                    }
+                }
+                else
+                {
+                    auto cmd = AllocCommand<GLCmdMultiDrawElementsBaseVertex>(
+                        GLOpcodeMultiDrawElementsBaseVertex,
+                        (sizeof(const GLvoid*) + sizeof(GLsizei) + sizeof(GLint))*numDraws
+                    );
+                    {
+                        cmd->mode       = drawBatchMode_;
+                        cmd->type       = drawBatchType_;
+                        cmd->drawcount  = static_cast<GLsizei>(numDraws);
+                        auto cmdData = reinterpret_cast<char*>(cmd + 1);
+                        ::memcpy(cmdData, drawBatchIndices_.data(), sizeof(const GLvoid*)*numDraws);
+                        cmdData += sizeof(const GLvoid*)*numDraws;
+                        ::memcpy(cmdData, drawBatchCounts_.data(), sizeof(GLsizei)*numDraws);
+                        cmdData += sizeof(GLsizei)*numDraws;
+                        ::memcpy(cmdData, drawBatchFirsts_.data(), sizeof(GLint)*numDraws);
+                    }
+                }
+            }
+
+            /* Draw commands observe the current viewports and scissors */
+            pendingViewport_    = nullptr;
+            pendingScissor_     = nullptr;
+
+            numRemovedCommands_ += numDraws - 1;
+            drawBatchIndices_.clear();
+            drawBatchCounts_.clear();
+            drawBatchFirsts_.clear();
+        }
+
+    private:
+
+        GLVirtualCommandBuffer&     output_;
+        std::size_t                 numRemovedCommands_     = 0;
+
+        std::uint32_t               validStates_            = 0;
+        std::uint32_t               pipelineStateWrites_    = 0;
+
+        GLCmdBindPipelineState      pipelineState_;
+        GLCmdBindVertexArray        vertexArray_;
+        GLCmdBindResourceHeap       resourceHeap_;
+        GLCmdViewport               viewport_;
+        GLCmdScissor                scissor_;
+        GLCmdSetBlendColor          blendColor_;
+        GLCmdSetStencilRef          stencilRef_;
+
+        GLCmdViewport*              pendingViewport_        = nullptr; // Last encoded viewport that has not been observed by any command yet
+        GLCmdScissor*               pendingScissor_         = nullptr; // Last encoded scissor that has not been observed by any command yet
+
+        GLBuffer*                   bufferUpdate_           = nullptr;
+        GLintptr                    bufferUpdateOffset_     = 0;
+        std::vector<char>           bufferUpdateData_;
+
+        bool                        multiDrawArrays_        = false;
+        bool                        multiDrawElements_      = false;
+        GLOpcode                    drawBatchOpcode_        = GLOpcodeMultiDrawArrays;
+        GLenum                      drawBatchMode_          = 0;
+        GLenum                      drawBatchType_          = 0;
+        std::vector<const GLvoid*>  drawBatchIndices_;
+        std::vector<GLsizei>        drawBatchCounts_;
+        std::vector<GLint>          drawBatchFirsts_;                  // First vertices for DrawArrays or base vertices for DrawElements
+
+};
+
+
+/*
+ * Global functions
+ */
+
+std::size_t OptimizeGLVirtualCommandBuffer(const GLVirtualCommandBuffer& input, GLVirtualCommandBuffer& output)
+{
+    GLCommandOptimizer optimizer{ output };
+    input.Run(std::ref(optimizer));
+    optimizer.Finish();
+    return optimizer.GetNumRemovedCommands();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,38 @@
+/*
+ * GLCommandOptimizer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_COMMAND_OPTIMIZER_H
+#define LLGL_GL_COMMAND_OPTIMIZER_H
+
+
+#include "GLDeferredCommandBuffer.h"
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/*
+Optimizes the specified virtual command buffer and writes the result into the output buffer.
+Redundant bindings (pipeline states, vertex arrays, resource heaps, viewports, scissors, blend colors, and stencil references) are dropped,
+viewport and scissor commands that are overwritten before any command can observe them are merged,
+consecutive buffer updates of contiguous or overlapping ranges within the same buffer are coalesced into a single update,
+and runs of non-instanced draw commands are folded into a single multi-draw command if supported.
+Returns the number of commands that have been removed.
+*/
+std::size_t OptimizeGLVirtualCommandBuffer(const GLVirtualCommandBuffer& input, GLVirtualCommandBuffer& output);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -12,6 +12,7 @@
 #include "../RenderState/GLFence.h"
 #include "../RenderState/GLQueryHeap.h"
 #include "../RenderState/GLStateManager.h"
+#include "../Texture/GLPixelBufferPool.h"
 #include "../../CheckedCast.h"
 #include "../Ext/GLExtensionRegistry.h"
 #include <algorithm>
@@ -31,10 +32,11 @@ void GLCommandQueue::Submit(CommandBuffer& commandBuffer)
     Only deferred command buffers can be submitted multiple times (via GLDeferredCommandBuffer),
     otherwise the commands must be submitted immediately (via GLImmediateCommandBuffer).
     */
-    auto& cmdBufferGL = LLGL_CAST(const GLCommandBuffer&, commandBuffer);
+    auto& cmdBufferGL = LLGL_CAST(GLCommandBuffer&, commandBuffer);
     if (!cmdBufferGL.IsImmediateCmdBuffer())
     {
-        auto& deferredCmdBufferGL = LLGL_CAST(const GLDeferredCommandBuffer&, cmdBufferGL);
+        auto& deferredCmdBufferGL = LLGL_CAST(GLDeferredCommandBuffer&, cmdBufferGL);
+        deferredCmdBufferGL.SubmitEncodingProfile();
         ExecuteGLDeferredCommandBuffer(deferredCmdBufferGL, GLStateManager::Get());
     }
 }
@@ -179,7 +181,12 @@ void GLCommandQueue::Submit(Fence& fence)
 bool GLCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
 {
     auto& fenceGL = LLGL_CAST(GLFence&, fence);
-    return fenceGL.Wait(timeout);
+    if (!fenceGL.Wait(timeout))
+        return false;
+
+    /* Copy image data of all asynchronous texture readbacks that were guarded by this fence into client memory */
+    GLPixelBufferPool::Get().ResolveReadbacks(fenceGL);
+    return true;
 }
 
 void GLCommandQueue::WaitIdle()
@@ -7,8 +7,10 @@
 
 #include "GLDeferredCommandBuffer.h"
 #include "GLCommand.h"
+#include "GLCommandOptimizer.h"
 #include <LLGL/Constants.h>
 #include <LLGL/TypeInfo.h>
+#include <LLGL/RenderingDebugger.h>
 
 #include "../../TextureUtils.h"
 #include "../GLSwapChain.h"
@@ -45,9 +47,17 @@ namespace LLGL
 {
 
 
-GLDeferredCommandBuffer::GLDeferredCommandBuffer(long flags, std::size_t initialBufferSize) :
-    flags_  { flags             },
-    buffer_ { initialBufferSize }
+GLDeferredCommandBuffer::GLDeferredCommandBuffer(
+    long                        flags,
+    VirtualCommandBufferPool&   commandBufferPool,
+    bool                        optimize,
+    RenderingDebugger*          debugger,
+    std::size_t                 initialBufferSize)
+:
+    flags_    { flags                                 },
+    buffer_   { initialBufferSize, &commandBufferPool },
+    optimize_ { optimize                              },
+    debugger_ { debugger                              }
 {
 }
 
@@ -62,11 +72,35 @@ void GLDeferredCommandBuffer::Begin()
 
 void GLDeferredCommandBuffer::End()
 {
+    /* Remove redundant commands once, so re-submitted command buffers don't pay for them on every execution */
+    if (optimize_ && !buffer_.Empty())
+    {
+        GLVirtualCommandBuffer optimizedBuffer{ buffer_.Size(), buffer_.GetPool() };
+        numEliminatedCommands_ = OptimizeGLVirtualCommandBuffer(buffer_, optimizedBuffer);
+        buffer_ = std::move(optimizedBuffer);
+    }
+    else
+        numEliminatedCommands_ = 0;
+
+    hasEncodingProfile_ = (debugger_ != nullptr && numEliminatedCommands_ > 0);
+
     /* Pack virtual command buffer if it has to be traversed multiple times */
     if ((GetFlags() & CommandBufferFlags::MultiSubmit) != 0)
         buffer_.Pack();
 }
 
+void GLDeferredCommandBuffer::SubmitEncodingProfile()
+{
+    /* Merge profile only once per encoding, even if the command buffer is submitted multiple times */
+    if (hasEncodingProfile_)
+    {
+        FrameProfile profile;
+        profile.commandBufferRecord.eliminatedCommands = static_cast<std::uint32_t>(numEliminatedCommands_);
+        debugger_->RecordProfile(profile);
+        hasEncodingProfile_ = false;
+    }
+}
+
 void GLDeferredCommandBuffer::Execute(CommandBuffer& secondaryCommandBuffer)
 {
     if (IsPrimary())
@@ -418,7 +452,17 @@ void GLDeferredCommandBuffer::BindResource(GLResourceType type, GLuint slot, std
         case GLResourceType_UBO:
         {
             auto& bufferGL = LLGL_CAST(GLBuffer&, resource);
-            BindBufferBase(GLBufferTarget::UniformBuffer, bufferGL, slot);
+            if (bufferGL.IsStreaming())
+            {
+                /* Streaming buffers are bound by reference, since their current range is only known at execution time */
+                auto cmd = AllocCommand<GLCmdBindStreamingUniformBuffer>(GLOpcodeBindStreamingUniformBuffer);
+                {
+                    cmd->index  = slot;
+                    cmd->buffer = &bufferGL;
+                }
+            }
+            else
+                BindBufferBase(GLBufferTarget::UniformBuffer, bufferGL, slot);
         }
         break;
 
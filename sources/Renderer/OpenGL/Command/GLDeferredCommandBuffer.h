@@ -30,6 +30,7 @@ class GLStateManager;
 class GLRenderPass;
 class GLShaderPipeline;
 class GLEmulatedSampler;
+class RenderingDebugger;
 
 using GLVirtualCommandBuffer = VirtualCommandBuffer<GLOpcode>;
 
@@ -42,7 +43,13 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
 
     public:
 
-        GLDeferredCommandBuffer(long flags, std::size_t initialBufferSize = 1024);
+        GLDeferredCommandBuffer(
+            long                        flags,
+            VirtualCommandBufferPool&   commandBufferPool,
+            bool                        optimize            = false,
+            RenderingDebugger*          debugger            = nullptr,
+            std::size_t                 initialBufferSize   = 1024
+        );
 
     public:
 
@@ -64,6 +71,15 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
             return flags_;
         }
 
+        // Returns the number of commands that have been removed by the optimization pass at the end of the last encoding.
+        inline std::size_t GetNumEliminatedCommands() const
+        {
+            return numEliminatedCommands_;
+        }
+
+        // Records the statistics of the last encoding into the debugger. This only happens once per encoding, even if this command buffer is submitted multiple times.
+        void SubmitEncodingProfile();
+
     private:
 
         void BindResource(GLResourceType type, GLuint slot, std::uint32_t descriptor, Resource& resource);
@@ -91,6 +107,10 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
         long                    flags_                  = 0;
         GLVirtualCommandBuffer  buffer_;
         GLRenderTarget*         renderTargetToResolve_  = nullptr;
+        bool                    optimize_               = false;
+        std::size_t             numEliminatedCommands_  = 0;
+        RenderingDebugger*      debugger_               = nullptr; // Receives the number of eliminated commands
+        bool                    hasEncodingProfile_     = false;
 
 };
 
@@ -379,7 +379,10 @@ void GLImmediateCommandBuffer::BindResource(GLResourceType type, GLuint slot, st
         case GLResourceType_UBO:
         {
             auto& bufferGL = LLGL_CAST(GLBuffer&, resource);
-            stateMngr_->BindBufferBase(GLBufferTarget::UniformBuffer, slot, bufferGL.GetID());
+            if (bufferGL.IsStreaming())
+                stateMngr_->BindStreamingUniformBuffer(slot, bufferGL);
+            else
+                stateMngr_->BindBufferBase(GLBufferTarget::UniformBuffer, slot, bufferGL.GetID());
         }
         break;
 
@@ -9,6 +9,7 @@
 #include "Profile/GLProfile.h"
 #include "Texture/GLMipGenerator.h"
 #include "Texture/GLTextureViewPool.h"
+#include "Texture/GLPixelBufferPool.h"
 #include "Texture/GLFramebufferCapture.h"
 #include "Ext/GLExtensions.h"
 #include "Ext/GLExtensionRegistry.h"
@@ -19,6 +20,7 @@
 #include "Shader/GLLegacyShader.h"
 #include "Buffer/GLBufferWithVAO.h"
 #include "Buffer/GLBufferWithXFB.h"
+#include "Buffer/GLStreamingBufferPool.h"
 #include "Buffer/GLBufferArrayWithVAO.h"
 #include "../CheckedCast.h"
 #include "../BufferUtils.h"
@@ -65,6 +67,14 @@ GLRenderSystem::GLRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
     debugContext_
     {
         ((renderSystemDesc.flags & RenderSystemFlags::DebugDevice) != 0)
+    },
+    optimizeCmdBuffers_
+    {
+        GetGLProfileFromDesc(renderSystemDesc).optimizeCommandBuffers
+    },
+    debugger_
+    {
+        renderSystemDesc.debugger
     }
 {
 }
@@ -75,7 +85,9 @@ GLRenderSystem::~GLRenderSystem()
     GLFramebufferCapture::Get().Clear();
     GLTextureViewPool::Get().Clear();
     GLMipGenerator::Get().Clear();
+    GLPixelBufferPool::Get().Clear();
     GLStatePool::Get().Clear();
+    GLStreamingBufferPool::Get().Clear();
 }
 
 /* ----- Swap-chain ----- */
@@ -106,7 +118,7 @@ CommandBuffer* GLRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor
     if ((commandBufferDesc.flags & CommandBufferFlags::ImmediateSubmit) != 0)
         return commandBuffers_.emplace<GLImmediateCommandBuffer>();
     else
-        return commandBuffers_.emplace<GLDeferredCommandBuffer>(commandBufferDesc.flags);
+        return commandBuffers_.emplace<GLDeferredCommandBuffer>(commandBufferDesc.flags, commandBufferPool_, optimizeCmdBuffers_, debugger_);
 }
 
 void GLRenderSystem::Release(CommandBuffer& commandBuffer)
@@ -144,8 +156,27 @@ static GLenum GetGLBufferUsage(long miscFlags)
     return ((miscFlags & MiscFlags::DynamicUsage) != 0 ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
 }
 
+// Returns true if the specified buffer can be sub-allocated from the persistently mapped ring of GLStreamingBufferPool (see MiscFlags::Streaming).
+static bool IsStreamingBufferDesc(const BufferDescriptor& bufferDesc)
+{
+    const long streamingBindFlags = (BindFlags::ConstantBuffer | BindFlags::CopySrc | BindFlags::CopyDst);
+    return
+    (
+        (bufferDesc.miscFlags & MiscFlags::Streaming) != 0 &&
+        (bufferDesc.bindFlags & BindFlags::ConstantBuffer) != 0 &&
+        (bufferDesc.bindFlags & ~streamingBindFlags) == 0
+    );
+}
+
 static void GLBufferStorage(GLBuffer& bufferGL, const BufferDescriptor& bufferDesc, const void* initialData)
 {
+    /* Try to allocate streaming ring first and fall back to regular buffer storage if persistent mapping is not supported */
+    if (IsStreamingBufferDesc(bufferDesc))
+    {
+        if (bufferGL.BufferStorageStreaming(static_cast<GLsizeiptr>(bufferDesc.size), initialData))
+            return;
+    }
+
     bufferGL.BufferStorage(
         static_cast<GLsizeiptr>(bufferDesc.size),
         initialData,
@@ -360,27 +391,53 @@ void GLRenderSystem::Release(Texture& texture)
 
 void GLRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageView)
 {
-    /* Bind texture and write texture sub data */
     auto& textureGL = LLGL_CAST(GLTexture&, texture);
+
+    /* Stage large image data in a pixel unpack buffer, so we don't stall until the GL has consumed the client memory */
+    if (GLPixelBufferPool::Get().WriteTexture(textureGL, textureRegion, srcImageView))
+        return;
+
+    /* Bind texture and write texture sub data */
     textureGL.TextureSubImage(textureRegion, srcImageView, false);
 }
 
-void GLRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView)
+// Ensures all shader writes to the specified texture have completed before its image data is read
+static void GLTextureReadBarrier(const GLTexture& textureGL)
 {
-    /* Bind texture and write texture sub data */
-    LLGL_ASSERT_PTR(dstImageView.data);
-    auto& textureGL = LLGL_CAST(GLTexture&, texture);
-
     #if LLGL_GLEXT_MEMORY_BARRIERS
     if ((textureGL.GetBindFlags() & BindFlags::Storage) != 0)
     {
-        /* Ensure all shader writes to the texture completed */
         if (HasExtension(GLExt::ARB_shader_image_load_store))
             glMemoryBarrier(GL_TEXTURE_UPDATE_BARRIER_BIT);
     }
     #endif // /LLGL_GLEXT_MEMORY_BARRIERS
+}
 
+void GLRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView)
+{
+    /* Bind texture and write texture sub data */
+    LLGL_ASSERT_PTR(dstImageView.data);
+    auto& textureGL = LLGL_CAST(GLTexture&, texture);
+
+    GLTextureReadBarrier(textureGL);
+    textureGL.GetTextureSubImage(textureRegion, dstImageView, false);
+}
+
+void GLRenderSystem::ReadTextureAsync(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView, Fence& fence)
+{
+    LLGL_ASSERT_PTR(dstImageView.data);
+    auto& textureGL = LLGL_CAST(GLTexture&, texture);
+    auto& fenceGL = LLGL_CAST(GLFence&, fence);
+
+    GLTextureReadBarrier(textureGL);
+
+    /* Read image data into a pixel pack buffer, so we don't stall until the GL has finished all commands that write to the texture */
+    if (GLPixelBufferPool::Get().ReadTexture(textureGL, textureRegion, dstImageView, fenceGL))
+        return;
+
+    /* Read texture sub data synchronously and signal fence right away */
     textureGL.GetTextureSubImage(textureRegion, dstImageView, false);
+    fenceGL.Submit();
 }
 
 /* ----- Sampler States ---- */
@@ -556,6 +613,43 @@ void GLRenderSystem::Release(PipelineState& pipelineState)
     pipelineStates_.erase(&pipelineState);
 }
 
+void GLRenderSystem::CreatePipelineStates(std::uint32_t numPipelineStates, const GraphicsPipelineDescriptor* pipelineStateDescs, PipelineState** outPipelineStates)
+{
+    /*
+    Link the shader programs of all PSOs first without querying their status, so the GL can link them concurrently.
+    The PSOs then share these shader programs via the state pool and only wait for the link status when they query the info logs.
+    */
+    std::vector<GLShaderPipelineSPtr> shaderPipelines;
+    for_range(i, numPipelineStates)
+        GLPipelineState::LinkShaderPipelines(GLGraphicsPSO::GetShaderArrayFromDesc(pipelineStateDescs[i]), shaderPipelines);
+
+    for_range(i, numPipelineStates)
+        outPipelineStates[i] = CreatePipelineState(pipelineStateDescs[i]);
+
+    /* Release temporary references to shader pipelines */
+    for (GLShaderPipelineSPtr& shaderPipeline : shaderPipelines)
+        GLStatePool::Get().ReleaseShaderPipeline(std::move(shaderPipeline));
+}
+
+void GLRenderSystem::CreatePipelineStates(std::uint32_t numPipelineStates, const ComputePipelineDescriptor* pipelineStateDescs, PipelineState** outPipelineStates)
+{
+    /* Link the shader programs of all PSOs first (see graphics PSOs) */
+    std::vector<GLShaderPipelineSPtr> shaderPipelines;
+    for_range(i, numPipelineStates)
+    {
+        Shader* computeShader = pipelineStateDescs[i].computeShader;
+        if (computeShader != nullptr)
+            GLPipelineState::LinkShaderPipelines({ computeShader }, shaderPipelines);
+    }
+
+    for_range(i, numPipelineStates)
+        outPipelineStates[i] = CreatePipelineState(pipelineStateDescs[i]);
+
+    /* Release temporary references to shader pipelines */
+    for (GLShaderPipelineSPtr& shaderPipeline : shaderPipelines)
+        GLStatePool::Get().ReleaseShaderPipeline(std::move(shaderPipeline));
+}
+
 /* ----- Queries ----- */
 
 QueryHeap* GLRenderSystem::CreateQueryHeap(const QueryHeapDescriptor& quertHeapDesc)
@@ -577,6 +671,8 @@ Fence* GLRenderSystem::CreateFence()
 
 void GLRenderSystem::Release(Fence& fence)
 {
+    auto& fenceGL = LLGL_CAST(GLFence&, fence);
+    GLPixelBufferPool::Get().DiscardReadbacks(fenceGL);
     fences_.erase(&fence);
 }
 
@@ -605,6 +701,12 @@ void GLRenderSystem::RegisterNewGLContext(GLContext& /*context*/, const GLPixelF
     /* Enable debug callback function */
     if (debugContext_)
         EnableDebugCallback();
+
+    #if LLGL_GLEXT_PARALLEL_SHADER_COMPILE
+    /* Let the driver choose the number of threads to compile shaders and link programs concurrently */
+    if (HasExtension(GLExt::KHR_parallel_shader_compile))
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+    #endif // /LLGL_GLEXT_PARALLEL_SHADER_COMPILE
 }
 
 #if LLGL_GLEXT_DEBUG
@@ -38,6 +38,7 @@
 #include "RenderState/GLResourceHeap.h"
 
 #include "../ProxyPipelineCache.h"
+#include "../VirtualCommandBufferPool.h"
 
 #include <string>
 #include <memory>
@@ -59,11 +60,25 @@ class GLRenderSystem final : public RenderSystem
 
         #include <LLGL/Backend/RenderSystem.inl>
 
+        void ReadTextureAsync(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView, Fence& fence) override;
+
     public:
 
         GLRenderSystem(const RenderSystemDescriptor& renderSystemDesc);
         ~GLRenderSystem();
 
+        void CreatePipelineStates(
+            std::uint32_t                       numPipelineStates,
+            const GraphicsPipelineDescriptor*   pipelineStateDescs,
+            PipelineState**                     outPipelineStates
+        ) override;
+
+        void CreatePipelineStates(
+            std::uint32_t                       numPipelineStates,
+            const ComputePipelineDescriptor*    pipelineStateDescs,
+            PipelineState**                     outPipelineStates
+        ) override;
+
     private:
 
         #include <LLGL/Backend/RenderSystem.Internal.inl>
@@ -88,7 +103,10 @@ class GLRenderSystem final : public RenderSystem
 
         GLContextManager                        contextMngr_;
         GLCommandQueue                          commandQueue_;
-        bool                                    debugContext_   = false;
+        bool                                    debugContext_       = false;
+        bool                                    optimizeCmdBuffers_ = false;
+        RenderingDebugger*                      debugger_           = nullptr;
+        VirtualCommandBufferPool                commandBufferPool_;
 
         HWObjectContainer<GLSwapChain>          swapChains_;
         HWObjectContainer<GLCommandBuffer>      commandBuffers_;
@@ -7,6 +7,7 @@
 
 #include "GLSwapChain.h"
 #include "GLRenderSystem.h"
+#include "Buffer/GLStreamingBufferPool.h"
 #include "../TextureUtils.h"
 #include "Platform/GLContextManager.h"
 #include <LLGL/TypeInfo.h>
@@ -101,6 +102,9 @@ bool GLSwapChain::IsPresentable() const
 void GLSwapChain::Present()
 {
     swapChainContext_->SwapBuffers();
+
+    /* End frame for streaming buffers, which inserts a single fence for all buffer updates of this frame */
+    GLStreamingBufferPool::Get().NextFrame();
 }
 
 std::uint32_t GLSwapChain::GetCurrentSwapIndex() const
@@ -106,6 +106,10 @@
 #   define LLGL_GLEXT_MULTI_DRAW_INDIRECT 1
 #endif
 
+#if LLGL_OPENGL && GL_VERSION_1_4
+#   define LLGL_GLEXT_MULTI_DRAW 1
+#endif
+
 #if GL_ARB_compute_shader || GL_ES_VERSION_3_1
 #   define LLGL_GLEXT_COMPUTE_SHADER 1
 #endif
@@ -114,6 +118,10 @@
 #   define LLGL_GLEXT_DEBUG 1
 #endif
 
+#if defined LLGL_OPENGL && GL_KHR_parallel_shader_compile
+#   define LLGL_GLEXT_PARALLEL_SHADER_COMPILE 1
+#endif
+
 //TODO: which extension?
 #if defined LLGL_OPENGL && !LLGL_GL_ENABLE_OPENGL2X
 #   define LLGL_GLEXT_CONDITIONAL_RENDER 1
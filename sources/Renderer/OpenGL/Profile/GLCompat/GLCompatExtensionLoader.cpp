@@ -332,6 +332,13 @@ static bool DECL_LOADGLEXT_PROC(ARB_draw_buffers_blend)
     return true;
 }
 
+static bool DECL_LOADGLEXT_PROC(EXT_multi_draw_arrays)
+{
+    LOAD_GLPROC( glMultiDrawArrays   );
+    LOAD_GLPROC( glMultiDrawElements );
+    return true;
+}
+
 static bool DECL_LOADGLEXT_PROC(EXT_stencil_two_side)
 {
     //correct extension ??? maybe "GL_ATI_separate_stencil"
@@ -491,6 +498,7 @@ static void IncludeDefaultCompatProfileExtensions(GLExtensionMap& extensions)
         "GL_EXT_blend_func_separate",   // GL 2.0
         "GL_EXT_copy_texture",
         "GL_EXT_gpu_shader4",           // GL 2.0
+        "GL_EXT_multi_draw_arrays",     // GL 1.4
         "GL_EXT_stencil_two_side",      // GL 2.0
         "GL_EXT_texture3D",
     };
@@ -574,6 +582,7 @@ bool LoadSupportedOpenGLExtensions(bool /*isCoreProfile*/, bool abortOnFailure)
     ENABLE_GLEXT( ARB_polygon_offset_clamp         );
     ENABLE_GLEXT( ARB_copy_buffer                  );
     ENABLE_GLEXT( ARB_draw_indirect                );
+    ENABLE_GLEXT( EXT_multi_draw_arrays            );
     ENABLE_GLEXT( ARB_multi_draw_indirect          );
 
     /* Enable extensions without procedures */
@@ -657,6 +666,7 @@ bool LoadSupportedOpenGLExtensions(bool /*isCoreProfile*/, bool abortOnFailure)
     LOAD_GLEXT( NV_conditional_render            );
     LOAD_GLEXT( ARB_timer_query                  );
     LOAD_GLEXT( EXT_stencil_two_side             );
+    LOAD_GLEXT( EXT_multi_draw_arrays            );
     LOAD_GLEXT( ARB_draw_buffers                 );
     LOAD_GLEXT( EXT_draw_buffers2                );
     LOAD_GLEXT( EXT_transform_feedback           );
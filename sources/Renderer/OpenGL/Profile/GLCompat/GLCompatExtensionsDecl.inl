@@ -43,6 +43,11 @@ DECL_GLPROC(PFNGLPRIMITIVERESTARTINDEXPROC,                         glPrimitiveR
 
 DECL_GLPROC(PFNGLBLENDFUNCSEPARATEPROC,                             glBlendFuncSeparate,                            void,           (GLenum, GLenum, GLenum, GLenum));
 
+/* GL_EXT_multi_draw_arrays */
+
+DECL_GLPROC(PFNGLMULTIDRAWARRAYSPROC,                               glMultiDrawArrays,                              void,           (GLenum, const GLint*, const GLsizei*, GLsizei));
+DECL_GLPROC(PFNGLMULTIDRAWELEMENTSPROC,                             glMultiDrawElements,                            void,           (GLenum, const GLsizei*, GLenum, const void* const*, GLsizei));
+
 /* GL_EXT_blend_minmax */
 
 DECL_GLPROC(PFNGLBLENDEQUATIONPROC,                                 glBlendEquation,                                void,           (GLenum));
@@ -242,6 +242,7 @@ static bool DECL_LOADGLEXT_PROC(ARB_draw_elements_base_vertex)
 {
     LOAD_GLPROC( glDrawElementsBaseVertex          );
     LOAD_GLPROC( glDrawElementsInstancedBaseVertex );
+    LOAD_GLPROC( glMultiDrawElementsBaseVertex     );
     return true;
 }
 
@@ -618,6 +619,12 @@ static bool DECL_LOADGLEXT_PROC(KHR_debug)
     return true;
 }
 
+static bool DECL_LOADGLEXT_PROC(KHR_parallel_shader_compile)
+{
+    LOAD_GLPROC( glMaxShaderCompilerThreadsKHR );
+    return true;
+}
+
 static bool DECL_LOADGLEXT_PROC(ARB_clip_control)
 {
     LOAD_GLPROC( glClipControl );
@@ -781,6 +788,13 @@ static bool DECL_LOADGLEXT_PROC(ARB_draw_indirect)
     return true;
 }
 
+static bool DECL_LOADGLEXT_PROC(EXT_multi_draw_arrays)
+{
+    LOAD_GLPROC( glMultiDrawArrays   );
+    LOAD_GLPROC( glMultiDrawElements );
+    return true;
+}
+
 static bool DECL_LOADGLEXT_PROC(ARB_multi_draw_indirect)
 {
     LOAD_GLPROC( glMultiDrawArraysIndirect   );
@@ -983,6 +997,7 @@ static void IncludeDefaultCoreProfileExtensions(GLExtensionMap& extensions)
         "GL_EXT_blend_func_separate",   // GL 2.0
         "GL_EXT_copy_texture",
         "GL_EXT_gpu_shader4",           // GL 2.0
+        "GL_EXT_multi_draw_arrays",     // GL 1.4
         "GL_EXT_stencil_two_side",      // GL 2.0
         "GL_EXT_texture3D",
     };
@@ -1082,6 +1097,7 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
     ENABLE_GLEXT( ARB_polygon_offset_clamp         );
     ENABLE_GLEXT( ARB_copy_buffer                  );
     ENABLE_GLEXT( ARB_draw_indirect                );
+    ENABLE_GLEXT( EXT_multi_draw_arrays            );
     ENABLE_GLEXT( ARB_multi_draw_indirect          );
 
     /* Enable extensions without procedures */
@@ -1196,6 +1212,7 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
     LOAD_GLEXT( ARB_multi_bind                   );
     LOAD_GLEXT( EXT_stencil_two_side             );
     LOAD_GLEXT( KHR_debug                        );
+    LOAD_GLEXT( KHR_parallel_shader_compile      );
     LOAD_GLEXT( ARB_clip_control                 );
     LOAD_GLEXT( ARB_draw_buffers                 );
     LOAD_GLEXT( EXT_draw_buffers2                );
@@ -1217,6 +1234,7 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
     LOAD_GLEXT( ARB_framebuffer_no_attachments   );
     LOAD_GLEXT( ARB_clear_buffer_object          );
     LOAD_GLEXT( ARB_draw_indirect                );
+    LOAD_GLEXT( EXT_multi_draw_arrays            );
     LOAD_GLEXT( ARB_multi_draw_indirect          );
     LOAD_GLEXT( ARB_get_texture_sub_image        );
     #ifdef LLGL_GL_ENABLE_DSA_EXT
@@ -228,6 +228,7 @@ DECL_GLPROC(PFNGLDRAWELEMENTSINSTANCEDPROC,                         glDrawElemen
 
 DECL_GLPROC(PFNGLDRAWELEMENTSBASEVERTEXPROC,                        glDrawElementsBaseVertex,                       void,           (GLenum, GLsizei, GLenum, const void*, GLint));
 DECL_GLPROC(PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC,               glDrawElementsInstancedBaseVertex,              void,           (GLenum, GLsizei, GLenum, const void*, GLsizei, GLint));
+DECL_GLPROC(PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC,                   glMultiDrawElementsBaseVertex,                  void,           (GLenum, const GLsizei*, GLenum, const void* const*, GLsizei, const GLint*));
 
 /* GL_ARB_base_instance */
 
@@ -460,6 +461,10 @@ DECL_GLPROC(PFNGLGETOBJECTLABELPROC,                                glGetObjectL
 DECL_GLPROC(PFNGLOBJECTPTRLABELPROC,                                glObjectPtrLabel,                               void,           (const void*, GLsizei, const GLchar*));
 DECL_GLPROC(PFNGLGETOBJECTPTRLABELPROC,                             glGetObjectPtrLabel,                            void,           (const void*, GLsizei, GLsizei*, GLchar*));
 
+/* GL_KHR_parallel_shader_compile */
+
+DECL_GLPROC(PFNGLMAXSHADERCOMPILERTHREADSKHRPROC,                   glMaxShaderCompilerThreadsKHR,                  void,           (GLuint));
+
 /* GL_ARB_clip_control */
 
 DECL_GLPROC(PFNGLCLIPCONTROLPROC,                                   glClipControl,                                  void,           (GLenum, GLenum));
@@ -568,6 +573,11 @@ DECL_GLPROC(PFNGLCLEARBUFFERSUBDATAPROC,                            glClearBuffe
 DECL_GLPROC(PFNGLDRAWARRAYSINDIRECTPROC,                            glDrawArraysIndirect,                           void,           (GLenum, const void*));
 DECL_GLPROC(PFNGLDRAWELEMENTSINDIRECTPROC,                          glDrawElementsIndirect,                         void,           (GLenum, GLenum, const void*));
 
+/* GL_EXT_multi_draw_arrays */
+
+DECL_GLPROC(PFNGLMULTIDRAWARRAYSPROC,                               glMultiDrawArrays,                              void,           (GLenum, const GLint*, const GLsizei*, GLsizei));
+DECL_GLPROC(PFNGLMULTIDRAWELEMENTSPROC,                             glMultiDrawElements,                            void,           (GLenum, const GLsizei*, GLenum, const void* const*, GLsizei));
+
 /* GL_ARB_multi_draw_indirect */
 
 DECL_GLPROC(PFNGLMULTIDRAWARRAYSINDIRECTPROC,                       glMultiDrawArraysIndirect,                      void,           (GLenum, const void*, GLsizei, GLsizei));
@@ -13,6 +13,7 @@
 #include "../Profile/GLProfile.h"
 #include "../../PipelineStateUtils.h"
 #include "../../../Core/MacroUtils.h"
+#include "../../../Core/CoreUtils.h"
 #include "../Texture/GLRenderTarget.h"
 #include "GLStateManager.h"
 #include <LLGL/PipelineStateFlags.h>
@@ -125,6 +126,27 @@ int GLBlendState::CompareSWO(const GLBlendState& lhs, const GLBlendState& rhs)
     return 0;
 }
 
+std::uint64_t GLBlendState::GetHash(const GLBlendState& state)
+{
+    std::uint64_t seed = 0;
+
+    HashCombine(seed, state.blendColor_[0]         );
+    HashCombine(seed, state.blendColor_[1]         );
+    HashCombine(seed, state.blendColor_[2]         );
+    HashCombine(seed, state.blendColor_[3]         );
+    HashCombine(seed, state.sampleAlphaToCoverage_ );
+    #ifdef LLGL_OPENGL
+    HashCombine(seed, state.logicOpEnabled_        );
+    HashCombine(seed, state.logicOp_               );
+    #endif
+    HashCombine(seed, state.numDrawBuffers_        );
+
+    for_range(i, state.numDrawBuffers_)
+        GLDrawBufferState::Hash(seed, state.drawBuffers_[i]);
+
+    return seed;
+}
+
 
 /*
  * ======= Private: =======
@@ -278,6 +300,21 @@ int GLBlendState::GLDrawBufferState::CompareSWO(const GLDrawBufferState& lhs, co
     return 0;
 }
 
+void GLBlendState::GLDrawBufferState::Hash(std::uint64_t& seed, const GLDrawBufferState& state)
+{
+    HashCombine(seed, (state.blendEnabled != GL_FALSE));
+    HashCombine(seed, state.srcColor    );
+    HashCombine(seed, state.dstColor    );
+    HashCombine(seed, state.funcColor   );
+    HashCombine(seed, state.srcAlpha    );
+    HashCombine(seed, state.dstAlpha    );
+    HashCombine(seed, state.funcAlpha   );
+    HashCombine(seed, state.colorMask[0]);
+    HashCombine(seed, state.colorMask[1]);
+    HashCombine(seed, state.colorMask[2]);
+    HashCombine(seed, state.colorMask[3]);
+}
+
 
 } // /namespace LLGL
 
@@ -47,12 +47,16 @@ class GLBlendState
         // Returns a signed integer of the strict-weak-order (SWO) comparison, and 0 on equality.
         static int CompareSWO(const GLBlendState& lhs, const GLBlendState& rhs);
 
+        // Returns a 64-bit hash of the specified state. States that are equal by CompareSWO always have the same hash.
+        static std::uint64_t GetHash(const GLBlendState& state);
+
     private:
 
         struct GLDrawBufferState
         {
             static void Convert(GLDrawBufferState& dst, const BlendTargetDescriptor& src);
             static int CompareSWO(const GLDrawBufferState& lhs, const GLDrawBufferState& rhs);
+            static void Hash(std::uint64_t& seed, const GLDrawBufferState& state);
 
             GLboolean   blendEnabled    = GL_FALSE;
             GLenum      srcColor        = GL_ONE;
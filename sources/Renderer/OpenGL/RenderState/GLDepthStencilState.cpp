@@ -11,6 +11,7 @@
 #include "../GLCore.h"
 #include "../GLTypes.h"
 #include "../../../Core/MacroUtils.h"
+#include "../../../Core/CoreUtils.h"
 #include "GLStateManager.h"
 #include <LLGL/PipelineStateFlags.h>
 
@@ -161,6 +162,36 @@ int GLDepthStencilState::CompareSWO(const GLDepthStencilState& lhs, const GLDept
     return 0;
 }
 
+std::uint64_t GLDepthStencilState::GetHash(const GLDepthStencilState& state)
+{
+    /* Only hash the members that are considered by CompareSWO */
+    std::uint64_t seed = 0;
+
+    HashCombine(seed, state.depthTestEnabled_);
+    if (state.depthTestEnabled_)
+    {
+        HashCombine(seed, state.depthMask_);
+        HashCombine(seed, state.depthFunc_);
+    }
+
+    HashCombine(seed, state.stencilTestEnabled_);
+    if (state.stencilTestEnabled_)
+    {
+        #if LLGL_SUPPORTS_INDEPENDENT_STENCIL_FACES
+        HashCombine(seed, state.independentStencilFaces_);
+        #endif // /LLGL_SUPPORTS_INDEPENDENT_STENCIL_FACES
+
+        GLStencilFaceState::Hash(seed, state.stencilFront_);
+
+        #if LLGL_SUPPORTS_INDEPENDENT_STENCIL_FACES
+        if (!state.independentStencilFaces_)
+            GLStencilFaceState::Hash(seed, state.stencilBack_);
+        #endif // /LLGL_SUPPORTS_INDEPENDENT_STENCIL_FACES
+    }
+
+    return seed;
+}
+
 
 /*
  * ======= Private: =======
@@ -210,6 +241,17 @@ int GLDepthStencilState::GLStencilFaceState::CompareSWO(const GLStencilFaceState
     return 0;
 }
 
+void GLDepthStencilState::GLStencilFaceState::Hash(std::uint64_t& seed, const GLStencilFaceState& state)
+{
+    HashCombine(seed, state.sfail    );
+    HashCombine(seed, state.dpfail   );
+    HashCombine(seed, state.dppass   );
+    HashCombine(seed, state.func     );
+    HashCombine(seed, state.ref      );
+    HashCombine(seed, state.mask     );
+    HashCombine(seed, state.writeMask);
+}
+
 
 } // /namespace LLGL
 
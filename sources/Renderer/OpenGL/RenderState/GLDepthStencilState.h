@@ -12,6 +12,7 @@
 #include <LLGL/ForwardDecls.h>
 #include "../OpenGL.h"
 #include <memory>
+#include <cstdint>
 #include <limits.h>
 
 
@@ -49,12 +50,16 @@ class GLDepthStencilState
         // Returns a signed integer of the strict-weak-order (SWO) comparison, and 0 on equality.
         static int CompareSWO(const GLDepthStencilState& lhs, const GLDepthStencilState& rhs);
 
+        // Returns a 64-bit hash of the specified state. States that are equal by CompareSWO always have the same hash.
+        static std::uint64_t GetHash(const GLDepthStencilState& state);
+
     private:
 
         struct GLStencilFaceState
         {
             static void Convert(GLStencilFaceState& dst, const StencilFaceDescriptor& src, bool referenceDynamic);
             static int CompareSWO(const GLStencilFaceState& lhs, const GLStencilFaceState& rhs);
+            static void Hash(std::uint64_t& seed, const GLStencilFaceState& state);
 
             GLenum  sfail       = GL_KEEP;
             GLenum  dpfail      = GL_KEEP;
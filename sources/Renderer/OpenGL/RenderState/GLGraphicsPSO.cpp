@@ -31,7 +31,7 @@ static void AddToShaderArray(Shader* shader, std::vector<Shader*>& shaders)
         shaders.push_back(shader);
 }
 
-static std::vector<Shader*> GetShaderArrayFromDesc(const GraphicsPipelineDescriptor& desc)
+std::vector<Shader*> GLGraphicsPSO::GetShaderArrayFromDesc(const GraphicsPipelineDescriptor& desc)
 {
     std::vector<Shader*> shaders;
     shaders.reserve(5);
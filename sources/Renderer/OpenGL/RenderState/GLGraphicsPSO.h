@@ -16,6 +16,7 @@
 #include "GLBlendState.h"
 #include <LLGL/RenderSystemFlags.h>
 #include <LLGL/Container/DynamicArray.h>
+#include <vector>
 
 
 namespace LLGL
@@ -37,6 +38,9 @@ class GLGraphicsPSO final : public GLPipelineState
         // Binds this graphics pipeline state with the specified GL state manager.
         void Bind(GLStateManager& stateMngr) override;
 
+        // Returns the array of all shaders that are specified in the graphics PSO descriptor.
+        static std::vector<Shader*> GetShaderArrayFromDesc(const GraphicsPipelineDescriptor& desc);
+
         // Returns the GL mode for drawing commands (GL_TRIANGLES, GL_TRIANGLE_STRIP, etc.).
         inline GLenum GetDrawMode() const
         {
@@ -49,6 +53,18 @@ class GLGraphicsPSO final : public GLPipelineState
             return primitiveMode_;
         }
 
+        // Returns true if this PSO sets static viewports when it is bound.
+        inline bool HasStaticViewports() const
+        {
+            return (numStaticViewports_ > 0);
+        }
+
+        // Returns true if this PSO sets static scissor rectangles when it is bound.
+        inline bool HasStaticScissors() const
+        {
+            return (numStaticScissors_ > 0);
+        }
+
     private:
 
         void BuildStaticStateBuffer(const GraphicsPipelineDescriptor& desc);
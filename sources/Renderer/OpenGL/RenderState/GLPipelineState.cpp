@@ -97,6 +97,16 @@ const Report* GLPipelineState::GetReport() const
     return (report_ ? &report_ : nullptr);
 }
 
+void GLPipelineState::LinkShaderPipelines(const ArrayView<Shader*>& shaders, std::vector<GLShaderPipelineSPtr>& outShaderPipelines)
+{
+    for_range(permutationIndex, GLShader::PermutationCount)
+    {
+        const GLShader::Permutation permutation = static_cast<GLShader::Permutation>(permutationIndex);
+        if (GLShader::HasAnyShaderPermutation(permutation, shaders))
+            outShaderPipelines.push_back(GLStatePool::Get().CreateShaderPipeline(shaders.size(), shaders.data(), permutation));
+    }
+}
+
 void GLPipelineState::Bind(GLStateManager& stateMngr)
 {
     /* Select shader pipeline permutation depending on what is needed for the current framebuffer */
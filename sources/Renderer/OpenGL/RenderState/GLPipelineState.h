@@ -19,6 +19,7 @@
 #include <LLGL/RenderSystemFlags.h>
 #include <LLGL/Container/ArrayView.h>
 #include <memory>
+#include <vector>
 #include <unordered_map>
 
 
@@ -56,6 +57,13 @@ class GLPipelineState : public PipelineState
 
         const Report* GetReport() const override;
 
+        /*
+        Creates the shader pipelines of all permutations for the specified shaders and appends them to the output container.
+        This does not query the link status, so the GL can link multiple shader programs concurrently (see GL_KHR_parallel_shader_compile).
+        PSOs that are created with the same shaders afterwards share these shader pipelines via the state pool.
+        */
+        static void LinkShaderPipelines(const ArrayView<Shader*>& shaders, std::vector<GLShaderPipelineSPtr>& outShaderPipelines);
+
         // Binds this pipeline state with the specified GL state manager.
         virtual void Bind(GLStateManager& stateMngr);
 
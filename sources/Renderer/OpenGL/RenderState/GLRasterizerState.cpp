@@ -11,6 +11,7 @@
 #include "../GLCore.h"
 #include "../GLTypes.h"
 #include "../../../Core/MacroUtils.h"
+#include "../../../Core/CoreUtils.h"
 #include "../../../Core/Exception.h"
 #include "GLStateManager.h"
 #include <LLGL/PipelineStateFlags.h>
@@ -134,6 +135,34 @@ int GLRasterizerState::CompareSWO(const GLRasterizerState& lhs, const GLRasteriz
     return 0;
 }
 
+std::uint64_t GLRasterizerState::GetHash(const GLRasterizerState& state)
+{
+    std::uint64_t seed = 0;
+
+    #ifdef LLGL_OPENGL
+    HashCombine(seed, state.polygonMode_         );
+    HashCombine(seed, state.depthClampEnabled_   );
+    #endif
+
+    HashCombine(seed, state.cullFace_            );
+    HashCombine(seed, state.frontFace_           );
+    HashCombine(seed, state.scissorTestEnabled_  );
+    HashCombine(seed, state.multiSampleEnabled_  );
+    HashCombine(seed, state.lineSmoothEnabled_   );
+    HashCombine(seed, state.lineWidth_           );
+    HashCombine(seed, state.polygonOffsetEnabled_);
+    HashCombine(seed, state.polygonOffsetMode_   );
+    HashCombine(seed, state.polygonOffsetFactor_ );
+    HashCombine(seed, state.polygonOffsetUnits_  );
+    HashCombine(seed, state.polygonOffsetClamp_  );
+
+    #ifdef LLGL_GL_ENABLE_VENDOR_EXT
+    HashCombine(seed, state.conservativeRaster_  );
+    #endif
+
+    return seed;
+}
+
 
 } // /namespace LLGL
 
@@ -14,6 +14,7 @@
 #include "GLState.h"
 #include <memory>
 #include <limits>
+#include <cstdint>
 
 
 namespace LLGL
@@ -47,6 +48,9 @@ class GLRasterizerState
         // Returns a signed integer of the strict-weak-order (SWO) comparison, and 0 on equality.
         static int CompareSWO(const GLRasterizerState& lhs, const GLRasterizerState& rhs);
 
+        // Returns a 64-bit hash of the specified state. States that are equal by CompareSWO always have the same hash.
+        static std::uint64_t GetHash(const GLRasterizerState& state);
+
     private:
 
         #ifdef LLGL_OPENGL
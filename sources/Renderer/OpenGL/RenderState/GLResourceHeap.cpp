@@ -66,12 +66,14 @@ Offset      Attribute                              Value   Description
 // Resource segment flags. Bits can be shared as they are only used for certain segment types.
 enum GLResourceFlags : std::uint32_t
 {
-    GLResourceFlags_HasBufferRange  = (1 << 0),
-    GLResourceFlags_HasTextureViews = (1 << 0), // Same as GLResourceFlags_HasBufferRange since they are mutually exclusive
+    GLResourceFlags_HasBufferRange      = (1 << 0),
+    GLResourceFlags_HasTextureViews     = (1 << 0), // Same as GLResourceFlags_HasBufferRange since they are mutually exclusive
+    GLResourceFlags_HasStreamingBuffers = (1 << 1), // Only used for UBO segments
 };
 
-static constexpr int k_heapSegmentSizeBits = 28;
-static constexpr int k_heapSegmentTypeBits = (32 - 1 - k_heapSegmentSizeBits);
+static constexpr int k_heapSegmentFlagsBits = 2;
+static constexpr int k_heapSegmentSizeBits  = 27;
+static constexpr int k_heapSegmentTypeBits  = (32 - k_heapSegmentFlagsBits - k_heapSegmentSizeBits);
 
 static_assert(
     (GLResourceType_End - 1) < (1 << k_heapSegmentTypeBits),
@@ -82,7 +84,7 @@ static_assert(
 struct alignas(sizeof(std::uintptr_t)) GLResourceHeapSegment
 {
     std::uint32_t   size        : k_heapSegmentSizeBits; // Byte size of this segment
-    std::uint32_t   flags       :  1; // GLResourceFlags
+    std::uint32_t   flags       : k_heapSegmentFlagsBits; // GLResourceFlags
     GLResourceType  type        :  3;
     GLuint          first       : 16;
     GLsizei         count       : 16;
@@ -265,6 +267,38 @@ static std::size_t BindBuffersSegment(GLStateManager& stateMngr, const char* hea
     return segment->size;
 }
 
+static std::size_t BindUniformBuffersSegment(GLStateManager& stateMngr, const char* heapPtr)
+{
+    auto* segment = GLRESOURCEHEAP_CONST_SEGMENT(heapPtr);
+    if ((segment->flags & GLResourceFlags_HasStreamingBuffers) != 0)
+    {
+        /* Bind each UBO individually, since streaming buffers must be bound at their current range */
+        auto* buffers           = reinterpret_cast<const GLuint*>(heapPtr + sizeof(GLResourceHeapSegment));
+        auto* offsets           = reinterpret_cast<const GLintptr*>(heapPtr + segment->data1Offset);
+        auto* sizes             = reinterpret_cast<const GLsizeiptr*>(heapPtr + segment->data2Offset);
+        auto* streamingBuffers  = reinterpret_cast<const GLBuffer* const*>(heapPtr + segment->data3Offset);
+        const bool hasBufferRangeData = ((segment->flags & GLResourceFlags_HasBufferRange) != 0);
+
+        for_range(i, segment->count)
+        {
+            const GLuint index = segment->first + i;
+            if (streamingBuffers[i] != nullptr)
+            {
+                if (hasBufferRangeData)
+                    stateMngr.BindStreamingUniformBuffer(index, *streamingBuffers[i], offsets[i], sizes[i]);
+                else
+                    stateMngr.BindStreamingUniformBuffer(index, *streamingBuffers[i]);
+            }
+            else if (hasBufferRangeData)
+                stateMngr.BindBufferRange(GLBufferTarget::UniformBuffer, index, buffers[i], offsets[i], sizes[i]);
+            else
+                stateMngr.BindBufferBase(GLBufferTarget::UniformBuffer, index, buffers[i]);
+        }
+        return segment->size;
+    }
+    return BindBuffersSegment(stateMngr, heapPtr, GLBufferTarget::UniformBuffer);
+}
+
 static std::size_t BindStorageBuffersSegment(
     GLStateManager&                     stateMngr,
     const char*                         heapPtr,
@@ -386,7 +420,7 @@ void GLResourceHeap::Bind(GLStateManager& stateMngr, std::uint32_t descriptorSet
 
     /* Bind all constant buffers */
     for_range(i, segmentation_.numUniformBufferSegments)
-        heapPtr += BindBuffersSegment(stateMngr, heapPtr, GLBufferTarget::UniformBuffer);
+        heapPtr += BindUniformBuffersSegment(stateMngr, heapPtr);
 
     /* Bind all shader storage buffers */
     if (bufferInterfaceMap != nullptr && !bufferInterfaceMap->HasHeapSSBOEntriesOnly())
@@ -514,10 +548,10 @@ void GLResourceHeap::AllocSegmentsUBO(GLHeapBindingIterator& bindingIter)
     /* Collect all uniform buffers */
     auto bindingSlots = FilterAndSortGLBindingSlots(bindingIter, ResourceType::Buffer, BindFlags::ConstantBuffer);
 
-    /* Build all resource segments for type <GLResourceHeap3PartSegment> */
+    /* Build all resource segments for type <GLResourceHeap4PartSegment> */
     segmentation_.numUniformBufferSegments = GLResourceHeap::ConsolidateSegments(
         bindingSlots,
-        BIND_SEGMENT_ALLOCATOR(GLResourceHeap::Alloc3PartSegment, GLResourceType_UBO, sizeof(GLuint), sizeof(GLintptr), sizeof(GLsizeiptr))
+        BIND_SEGMENT_ALLOCATOR(GLResourceHeap::Alloc4PartSegment, GLResourceType_UBO, sizeof(GLuint), sizeof(GLintptr), sizeof(GLsizeiptr), sizeof(const GLBuffer*))
     );
 }
 
@@ -801,17 +835,39 @@ void GLResourceHeap::WriteResourceView(const ResourceViewDescriptor& desc, const
     }
 }
 
+// Updates the segment flags for the specified heap position whether any streaming buffers are referenced in this UBO segment.
+static void UpdateUniformBufferSegmentFlags(char* heapPtr)
+{
+    GLResourceHeapSegment* segment = GLRESOURCEHEAP_SEGMENT(heapPtr);
+    segment->flags &= (~GLResourceFlags_HasStreamingBuffers);
+    for_range(i, segment->count)
+    {
+        if (GLRESOURCEHEAP_DATA3(heapPtr, const GLBuffer*)[i] != nullptr)
+        {
+            segment->flags |= GLResourceFlags_HasStreamingBuffers;
+            break;
+        }
+    }
+}
+
 void GLResourceHeap::WriteResourceViewUBO(const ResourceViewDescriptor& desc, char* heapPtr, std::uint32_t index)
 {
     /* Get buffer resource and its size parameter */
     auto* bufferGL = LLGL_CAST(GLBuffer*, GetAsExpectedBuffer(desc.resource, BindFlags::ConstantBuffer));
 
     GLint bufferSize = 0;
-    bufferGL->GetBufferParams(&bufferSize, nullptr, nullptr);
+    if (bufferGL->IsStreaming())
+        bufferSize = static_cast<GLint>(bufferGL->GetStreamingSize());
+    else
+        bufferGL->GetBufferParams(&bufferSize, nullptr, nullptr);
 
     /* Write buffer ID to segment (GLuint) */
     GLRESOURCEHEAP_DATA0(heapPtr, GLuint)[index] = bufferGL->GetID();
 
+    /* Write streaming buffer reference to segment (const GLBuffer*) and update segment flags */
+    GLRESOURCEHEAP_DATA3(heapPtr, const GLBuffer*)[index] = (bufferGL->IsStreaming() ? bufferGL : nullptr);
+    UpdateUniformBufferSegmentFlags(heapPtr);
+
     /* Write buffer offset and length to segment (GLintptr, GLsizeiptr) */
     if (IsGLBufferViewEnabled(desc.bufferView))
     {
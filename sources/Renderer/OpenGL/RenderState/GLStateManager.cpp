@@ -14,6 +14,7 @@
 #include "../GLSwapChain.h"
 #include "../Buffer/GLBuffer.h"
 #include "../Buffer/GLBufferWithXFB.h"
+#include "../Buffer/GLStreamingBufferPool.h"
 #include "../Texture/GLTexture.h"
 #include "../Texture/GLRenderTarget.h"
 #include "../Texture/GLEmulatedSampler.h"
@@ -896,6 +897,10 @@ void GLStateManager::BindBuffer(GLBufferTarget target, GLuint buffer)
 void GLStateManager::BindBufferBase(GLBufferTarget target, GLuint index, GLuint buffer)
 {
     #if LLGL_GLEXT_UNIFORM_BUFFER_OBJECT
+    /* Uniform buffer slots that are overwritten no longer follow a streaming buffer */
+    if (target == GLBufferTarget::UniformBuffer && !streamingBufferBindings_.empty())
+        DropStreamingBufferBindings(index, 1);
+
     /* Always bind buffer with a base index */
     auto targetIdx = static_cast<std::size_t>(target);
     glBindBufferBase(g_bufferTargetsEnum[targetIdx], index, buffer);
@@ -907,6 +912,12 @@ void GLStateManager::BindBufferBase(GLBufferTarget target, GLuint index, GLuint
 
 void GLStateManager::BindBuffersBase(GLBufferTarget target, GLuint first, GLsizei count, const GLuint* buffers)
 {
+    #if LLGL_GLEXT_UNIFORM_BUFFER_OBJECT
+    /* Uniform buffer slots that are overwritten no longer follow a streaming buffer */
+    if (target == GLBufferTarget::UniformBuffer && !streamingBufferBindings_.empty())
+        DropStreamingBufferBindings(first, count);
+    #endif // /LLGL_GLEXT_UNIFORM_BUFFER_OBJECT
+
     /* Always bind buffers with a base index */
     auto targetIdx = static_cast<std::size_t>(target);
     auto targetGL = g_bufferTargetsEnum[targetIdx];
@@ -939,6 +950,12 @@ void GLStateManager::BindBuffersBase(GLBufferTarget target, GLuint first, GLsize
 void GLStateManager::BindBufferRange(GLBufferTarget target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
 {
     #if GL_EXT_transform_feedback && !LLGL_GL_ENABLE_OPENGL2X
+    #if LLGL_GLEXT_UNIFORM_BUFFER_OBJECT
+    /* Uniform buffer slots that are overwritten no longer follow a streaming buffer */
+    if (target == GLBufferTarget::UniformBuffer && !streamingBufferBindings_.empty())
+        DropStreamingBufferBindings(index, 1);
+    #endif // /LLGL_GLEXT_UNIFORM_BUFFER_OBJECT
+
     /* Always bind buffer with a base index */
     auto targetIdx = static_cast<std::size_t>(target);
     glBindBufferRange(g_bufferTargetsEnum[targetIdx], index, buffer, offset, size);
@@ -950,6 +967,12 @@ void GLStateManager::BindBufferRange(GLBufferTarget target, GLuint index, GLuint
 
 void GLStateManager::BindBuffersRange(GLBufferTarget target, GLuint first, GLsizei count, const GLuint* buffers, const GLintptr* offsets, const GLsizeiptr* sizes)
 {
+    #if LLGL_GLEXT_UNIFORM_BUFFER_OBJECT
+    /* Uniform buffer slots that are overwritten no longer follow a streaming buffer */
+    if (target == GLBufferTarget::UniformBuffer && !streamingBufferBindings_.empty())
+        DropStreamingBufferBindings(first, count);
+    #endif // /LLGL_GLEXT_UNIFORM_BUFFER_OBJECT
+
     /* Always bind buffers with a base index */
     auto targetIdx = static_cast<std::size_t>(target);
     auto targetGL = g_bufferTargetsEnum[targetIdx];
@@ -989,6 +1012,40 @@ void GLStateManager::BindBuffersRange(GLBufferTarget target, GLuint first, GLsiz
     }
 }
 
+void GLStateManager::BindStreamingUniformBuffer(GLuint index, const GLBuffer& buffer, GLintptr offset, GLsizeiptr size)
+{
+    #if LLGL_GLEXT_UNIFORM_BUFFER_OBJECT
+
+    /* Bind current range of streaming buffer within the streaming ring; GPU may read from it from now on */
+    const GLuint id     = buffer.GetID();
+    const GLuint ringID = GLStreamingBufferPool::Get().GetBufferID();
+    if (size == 0)
+        size = buffer.GetStreamingSize();
+
+    glBindBufferRange(GL_UNIFORM_BUFFER, index, ringID, buffer.GetStreamingOffset() + offset, size);
+    contextState_.boundBuffers[static_cast<std::size_t>(GLBufferTarget::UniformBuffer)] = ringID;
+    buffer.MarkStreamingRangeInUse();
+
+    /* Keep track of this slot to re-bind it when the buffer moves on to its next range */
+    auto it = std::find_if(
+        streamingBufferBindings_.begin(),
+        streamingBufferBindings_.end(),
+        [index](const StreamingBufferBinding& binding) -> bool
+        {
+            return (binding.index == index);
+        }
+    );
+
+    if (it != streamingBufferBindings_.end())
+        *it = StreamingBufferBinding{ index, id, offset, size };
+    else
+        streamingBufferBindings_.push_back(StreamingBufferBinding{ index, id, offset, size });
+
+    #else // LLGL_GLEXT_UNIFORM_BUFFER_OBJECT
+    LLGL_TRAP_FEATURE_NOT_SUPPORTED("GL_ARB_uniform_buffer_object");
+    #endif // /LLGL_GLEXT_UNIFORM_BUFFER_OBJECT
+}
+
 // Returns the maximum index value for the specified index data type.
 static GLuint GetPrimitiveRestartIndex(bool indexType16Bits)
 {
@@ -1151,6 +1208,35 @@ void GLStateManager::NotifyBufferRelease(const GLBuffer& buffer)
     NotifyBufferRelease(id, GLBufferTarget::CopyReadBuffer);
     NotifyBufferRelease(id, GLBufferTarget::CopyWriteBuffer);
     NotifyBufferRelease(id, buffer.GetTarget());
+
+    /* Drop all uniform buffer slots that are bound to this streaming buffer */
+    if (buffer.IsStreaming())
+    {
+        RemoveFromListIf(
+            streamingBufferBindings_,
+            [id](const StreamingBufferBinding& binding) -> bool
+            {
+                return (binding.buffer == id);
+            }
+        );
+    }
+}
+
+void GLStateManager::NotifyStreamingBufferUpdate(const GLBuffer& buffer)
+{
+    #if LLGL_GLEXT_UNIFORM_BUFFER_OBJECT
+    const GLuint id     = buffer.GetID();
+    const GLuint ringID = GLStreamingBufferPool::Get().GetBufferID();
+    for (const StreamingBufferBinding& binding : streamingBufferBindings_)
+    {
+        if (binding.buffer == id)
+        {
+            glBindBufferRange(GL_UNIFORM_BUFFER, binding.index, ringID, buffer.GetStreamingOffset() + binding.offset, binding.size);
+            contextState_.boundBuffers[static_cast<std::size_t>(GLBufferTarget::UniformBuffer)] = ringID;
+            buffer.MarkStreamingRangeInUse();
+        }
+    }
+    #endif // /LLGL_GLEXT_UNIFORM_BUFFER_OBJECT
 }
 
 void GLStateManager::DisableVertexAttribArrays(GLuint firstIndex)
@@ -1914,6 +2000,18 @@ void GLStateManager::FlipFrontFacing(bool isFlipped)
     frontFacingDirtyBit_ = true;
 }
 
+void GLStateManager::DropStreamingBufferBindings(GLuint first, GLsizei count)
+{
+    const GLuint last = first + static_cast<GLuint>(count);
+    RemoveFromListIf(
+        streamingBufferBindings_,
+        [first, last](const StreamingBufferBinding& binding) -> bool
+        {
+            return (binding.index >= first && binding.index < last);
+        }
+    );
+}
+
 static void AccumCommonGLLimits(GLStateManager::GLLimits& dst, const GLStateManager::GLLimits& src)
 {
     if (dst.maxViewports == 0)
@@ -16,6 +16,7 @@
 #include "../OpenGL.h"
 #include "../../../Core/Assertion.h"
 #include <stack>
+#include <vector>
 #include <cstdint>
 
 
@@ -174,6 +175,9 @@ class GLStateManager
         void BindBufferRange(GLBufferTarget target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
         void BindBuffersRange(GLBufferTarget target, GLuint first, GLsizei count, const GLuint* buffers, const GLintptr* offsets, const GLsizeiptr* sizes);
 
+        // Binds the current range of the specified streaming buffer to a uniform buffer slot and keeps track of it (see MiscFlags::Streaming). A size of zero binds the entire logical buffer.
+        void BindStreamingUniformBuffer(GLuint index, const GLBuffer& buffer, GLintptr offset = 0, GLsizeiptr size = 0);
+
         void BindVertexArray(GLuint vertexArray);
 
         void BindGLBuffer(const GLBuffer& buffer);
@@ -192,6 +196,9 @@ class GLStateManager
         void NotifyBufferRelease(GLuint buffer, GLBufferTarget target);
         void NotifyBufferRelease(const GLBuffer& buffer);
 
+        // Re-binds all uniform buffer slots the specified streaming buffer is bound to with the offset of its current range (see MiscFlags::Streaming).
+        void NotifyStreamingBufferUpdate(const GLBuffer& buffer);
+
         // Disables all previous enabled vertex attrib arrays, and sets the specified index as the new highest enabled index.
         void DisableVertexAttribArrays(GLuint firstIndex);
 
@@ -340,6 +347,11 @@ class GLStateManager
         void DetermineVendorSpecificExtensions();
         #endif
 
+        /* ----- Buffer ----- */
+
+        // Stops tracking the uniform buffer slots in the range [first, first + count) that were bound to a streaming buffer.
+        void DropStreamingBufferBindings(GLuint first, GLsizei count);
+
         /* ----- Stacks ----- */
 
         void PrepareRasterizerStateForClear(GLFramebufferClearState& clearState);
@@ -395,6 +407,15 @@ class GLStateManager
             GLuint program;
         };
 
+        // Uniform buffer slot that is bound to a streaming buffer and must follow its current range.
+        struct StreamingBufferBinding
+        {
+            GLuint      index;
+            GLuint      buffer;
+            GLintptr    offset;
+            GLsizeiptr  size;
+        };
+
     private:
 
         static GLStateManager*  current_;
@@ -435,6 +456,8 @@ class GLStateManager
         std::stack<RenderbufferStackEntry>  renderbufferStack_;
         std::stack<ShaderProgramStackEntry> shaderProgramStack_;
 
+        std::vector<StreamingBufferBinding> streamingBufferBindings_;   // Only bindings of this GL context are tracked, i.e. streaming buffers must be updated on the context they are bound in
+
 };
 
 
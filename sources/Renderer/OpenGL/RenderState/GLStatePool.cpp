@@ -29,64 +29,74 @@ namespace LLGL
  * Internal templates
  */
 
-// Searches a compatible state object with complexity O(log n)
+template <typename T>
+using GLHashedStateContainer = std::unordered_multimap<std::uint64_t, std::shared_ptr<T>>;
+
+// Searches a compatible state object within the bucket of the specified hash with average complexity O(1)
 template <typename T, typename TCompare = T, typename TBase = T>
 std::shared_ptr<T> FindCompatibleStateObject(
-    std::vector<std::shared_ptr<TBase>>&    container,
-    const TCompare&                         compareObject,
-    std::size_t&                            index)
-{
-    std::shared_ptr<TBase>* entry = FindInSortedArray<std::shared_ptr<TBase>>(
-        container.data(),
-        container.size(),
-        [&compareObject](const std::shared_ptr<TBase>& entry) -> int
-        {
-            return T::CompareSWO(*entry.get(), compareObject);
-        },
-        &index
-    );
-    return std::static_pointer_cast<T>(entry != nullptr ? *entry : nullptr);
+    GLHashedStateContainer<TBase>&  container,
+    const TCompare&                 compareObject,
+    std::uint64_t                   hash)
+{
+    auto range = container.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (T::CompareSWO(*(it->second.get()), compareObject) == 0)
+            return std::static_pointer_cast<T>(it->second);
+    }
+    return nullptr;
 }
 
+// Creates a render state object whose construction is expensive, e.g. linking a shader program. The mutex is only locked for lookup and insertion.
 template <typename T, typename TCompare, typename TBase, typename... Args>
-std::shared_ptr<T> CreateRenderStateObjectExt(std::vector<std::shared_ptr<TBase>>& container, Args&&... args)
+std::shared_ptr<T> CreateRenderStateObjectExt(std::mutex& mutex, GLHashedStateContainer<TBase>& container, Args&&... args)
 {
     /* Try to find render state object with same parameter */
-    const TCompare stateToCompare{ std::forward<Args>(args)... };
+    const TCompare stateToCompare{ args... };
+    const std::uint64_t hash = TCompare::GetHash(stateToCompare);
+    {
+        std::lock_guard<std::mutex> guard{ mutex };
+        if (std::shared_ptr<T> sharedState = FindCompatibleStateObject<T, TCompare, TBase>(container, stateToCompare, hash))
+            return sharedState;
+    }
 
-    std::size_t insertionIndex = 0;
-    if (std::shared_ptr<T> sharedState = FindCompatibleStateObject<T, TCompare, TBase>(container, stateToCompare, insertionIndex))
+    /* Allocate new render state object without holding the lock */
+    std::shared_ptr<T> newState = std::make_shared<T>(std::forward<Args>(args)...);
+
+    /* Insert new object into the bucket of its hash unless another thread has inserted a compatible one in the meantime */
+    std::lock_guard<std::mutex> guard{ mutex };
+    if (std::shared_ptr<T> sharedState = FindCompatibleStateObject<T, TCompare, TBase>(container, stateToCompare, hash))
         return sharedState;
 
-    /* Allocate new render state object with insertion sort */
-    std::shared_ptr<T> newState = std::make_shared<T>(std::forward<Args>(args)...);
-    container.insert(container.begin() + insertionIndex, newState);
+    container.insert({ hash, newState });
 
     return newState;
 }
 
 template <typename T, typename... Args>
-std::shared_ptr<T> CreateRenderStateObject(std::vector<std::shared_ptr<T>>& container, Args&&... args)
+std::shared_ptr<T> CreateRenderStateObject(std::mutex& mutex, GLHashedStateContainer<T>& container, Args&&... args)
 {
     /* Try to find render state object with same parameter */
     T stateToCompare{ std::forward<Args>(args)... };
+    const std::uint64_t hash = T::GetHash(stateToCompare);
 
-    std::size_t insertionIndex = 0;
-    if (std::shared_ptr<T> sharedState = FindCompatibleStateObject<T, T, T>(container, stateToCompare, insertionIndex))
+    std::lock_guard<std::mutex> guard{ mutex };
+    if (std::shared_ptr<T> sharedState = FindCompatibleStateObject<T, T, T>(container, stateToCompare, hash))
         return sharedState;
 
-    /* Allocate new render state object with insertion sort */
+    /* Allocate new render state object and insert it into the bucket of its hash */
     std::shared_ptr<T> newState = std::make_shared<T>(stateToCompare);
-    container.insert(container.begin() + insertionIndex, newState);
+    container.insert({ hash, newState });
 
     return newState;
 }
 
 template <typename T>
 void ReleaseRenderStateObject(
-    std::vector<std::shared_ptr<T>>&    container,
-    const std::function<void(T*)>&      callback,
-    std::shared_ptr<T>&&                renderState)
+    GLHashedStateContainer<T>&      container,
+    const std::function<void(T*)>&  callback,
+    std::shared_ptr<T>&&            renderState)
 {
     if (renderState && renderState.use_count() == 2)
     {
@@ -94,14 +104,18 @@ void ReleaseRenderStateObject(
         T* objectRef = renderState.get();
         renderState.reset();
 
-        /* Retrieve entry index in container to remove entry */
-        std::size_t entryIndex = 0;
-        if (FindCompatibleStateObject<T, T, T>(container, *objectRef, entryIndex) != nullptr)
+        /* Find entry of this exact object within the bucket of its hash to remove entry */
+        auto range = container.equal_range(T::GetHash(*objectRef));
+        for (auto it = range.first; it != range.second; ++it)
         {
-            /* Notify via callback and erase from container */
-            if (callback)
-                callback(objectRef);
-            container.erase(container.begin() + entryIndex);
+            if (it->second.get() == objectRef)
+            {
+                /* Notify via callback and erase from container */
+                if (callback)
+                    callback(objectRef);
+                container.erase(it);
+                break;
+            }
         }
     }
 }
@@ -119,6 +133,7 @@ GLStatePool& GLStatePool::Get()
 
 void GLStatePool::Clear()
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
     depthStencilStates_.clear();
     rasterizerStates_.clear();
     blendStates_.clear();
@@ -130,11 +145,12 @@ void GLStatePool::Clear()
 
 GLDepthStencilStateSPtr GLStatePool::CreateDepthStencilState(const DepthDescriptor& depthDesc, const StencilDescriptor& stencilDesc)
 {
-    return CreateRenderStateObject(depthStencilStates_, depthDesc, stencilDesc);
+    return CreateRenderStateObject(mutex_, depthStencilStates_, depthDesc, stencilDesc);
 }
 
 void GLStatePool::ReleaseDepthStencilState(GLDepthStencilStateSPtr&& depthStencilState)
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
     ReleaseRenderStateObject<GLDepthStencilState>(
         depthStencilStates_,
         std::bind(&GLStateManager::NotifyDepthStencilStateRelease, &(GLStateManager::Get()), std::placeholders::_1),
@@ -146,11 +162,12 @@ void GLStatePool::ReleaseDepthStencilState(GLDepthStencilStateSPtr&& depthStenci
 
 GLRasterizerStateSPtr GLStatePool::CreateRasterizerState(const RasterizerDescriptor& rasterizerDesc)
 {
-    return CreateRenderStateObject(rasterizerStates_, rasterizerDesc);
+    return CreateRenderStateObject(mutex_, rasterizerStates_, rasterizerDesc);
 }
 
 void GLStatePool::ReleaseRasterizerState(GLRasterizerStateSPtr&& rasterizerState)
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
     ReleaseRenderStateObject<GLRasterizerState>(
         rasterizerStates_,
         std::bind(&GLStateManager::NotifyRasterizerStateRelease, &(GLStateManager::Get()), std::placeholders::_1),
@@ -162,11 +179,12 @@ void GLStatePool::ReleaseRasterizerState(GLRasterizerStateSPtr&& rasterizerState
 
 GLBlendStateSPtr GLStatePool::CreateBlendState(const BlendDescriptor& blendDesc, std::uint32_t numColorAttachments)
 {
-    return CreateRenderStateObject(blendStates_, blendDesc, numColorAttachments);
+    return CreateRenderStateObject(mutex_, blendStates_, blendDesc, numColorAttachments);
 }
 
 void GLStatePool::ReleaseBlendState(GLBlendStateSPtr&& blendState)
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
     ReleaseRenderStateObject<GLBlendState>(
         blendStates_,
         std::bind(&GLStateManager::NotifyBlendStateRelease, &(GLStateManager::Get()), std::placeholders::_1),
@@ -178,11 +196,12 @@ void GLStatePool::ReleaseBlendState(GLBlendStateSPtr&& blendState)
 
 GLShaderBindingLayoutSPtr GLStatePool::CreateShaderBindingLayout(const GLPipelineLayout& pipelineLayout)
 {
-    return CreateRenderStateObject(shaderBindingLayouts_, pipelineLayout);
+    return CreateRenderStateObject(mutex_, shaderBindingLayouts_, pipelineLayout);
 }
 
 void GLStatePool::ReleaseShaderBindingLayout(GLShaderBindingLayoutSPtr&& shaderBindingLayout)
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
     ReleaseRenderStateObject<GLShaderBindingLayout>(
         shaderBindingLayouts_,
         nullptr,
@@ -219,20 +238,21 @@ GLShaderPipelineSPtr GLStatePool::CreateShaderPipeline(
     if (HasExtension(GLExt::ARB_separate_shader_objects) && HasGLSeparableShaders(numShaders, shaders))
     {
         return std::static_pointer_cast<GLShaderPipeline>(
-            CreateRenderStateObjectExt<GLProgramPipeline, GLPipelineSignature>(shaderPipelines_, numShaders, shaders, permutation)
+            CreateRenderStateObjectExt<GLProgramPipeline, GLPipelineSignature>(mutex_, shaderPipelines_, numShaders, shaders, permutation)
         );
     }
     else
     #endif
     {
         return std::static_pointer_cast<GLShaderPipeline>(
-            CreateRenderStateObjectExt<GLShaderProgram, GLPipelineSignature>(shaderPipelines_, numShaders, shaders, permutation, pipelineCache)
+            CreateRenderStateObjectExt<GLShaderProgram, GLPipelineSignature>(mutex_, shaderPipelines_, numShaders, shaders, permutation, pipelineCache)
         );
     }
 }
 
 void GLStatePool::ReleaseShaderPipeline(GLShaderPipelineSPtr&& shaderPipeline)
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
     ReleaseRenderStateObject<GLShaderPipeline>(
         shaderPipelines_,
         nullptr,
@@ -17,7 +17,9 @@
 #include "../Shader/GLShaderBindingLayout.h"
 #include "../Shader/GLShaderPipeline.h"
 #include "../Shader/GLShader.h"
-#include <vector>
+#include <unordered_map>
+#include <mutex>
+#include <cstdint>
 
 
 namespace LLGL
@@ -31,6 +33,7 @@ class GLPipelineCache;
 /*
 Singleton pool for OpenGL depth-stencil-, rasterizer-, and blend states.
 These states are separated from the GLStateManager, because they don't need to exist for every GL context.
+All states are interned by their 64-bit hash and all functions of this pool are thread-safe.
 */
 class GLStatePool
 {
@@ -82,11 +85,19 @@ class GLStatePool
 
     private:
 
-        std::vector<GLDepthStencilStateSPtr>    depthStencilStates_;
-        std::vector<GLRasterizerStateSPtr>      rasterizerStates_;
-        std::vector<GLBlendStateSPtr>           blendStates_;
-        std::vector<GLShaderBindingLayoutSPtr>  shaderBindingLayouts_;
-        std::vector<GLShaderPipelineSPtr>       shaderPipelines_;
+        // Container of state objects mapped by their hash. Different states with the same hash share a bucket.
+        template <typename T>
+        using HashedContainer = std::unordered_multimap<std::uint64_t, std::shared_ptr<T>>;
+
+    private:
+
+        std::mutex                                  mutex_;
+
+        HashedContainer<GLDepthStencilState>        depthStencilStates_;
+        HashedContainer<GLRasterizerState>          rasterizerStates_;
+        HashedContainer<GLBlendState>               blendStates_;
+        HashedContainer<GLShaderBindingLayout>      shaderBindingLayouts_;
+        HashedContainer<GLShaderPipeline>           shaderPipelines_;
 
 };
 
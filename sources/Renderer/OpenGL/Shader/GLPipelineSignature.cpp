@@ -9,6 +9,7 @@
 #include "GLShader.h"
 #include "../../CheckedCast.h"
 #include "../../../Core/MacroUtils.h"
+#include "../../../Core/CoreUtils.h"
 #include "../../../Core/Assertion.h"
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Utils/TypeNames.h>
@@ -83,6 +84,18 @@ int GLPipelineSignature::CompareSWO(const GLPipelineSignature& lhs, const GLPipe
     return std::memcmp(&(lhs.data_), &(rhs.data_), sizeof(GLuint)*(1 + lhs.GetNumShaders()));
 }
 
+std::uint64_t GLPipelineSignature::GetHash(const GLPipelineSignature& signature)
+{
+    /* Hash the same words that are compared by CompareSWO, i.e. the header word followed by the shader IDs */
+    const GLuint* words = reinterpret_cast<const GLuint*>(&(signature.data_));
+
+    std::uint64_t seed = 0;
+    for_range(i, 1 + signature.GetNumShaders())
+        HashCombine(seed, words[i]);
+
+    return seed;
+}
+
 static int GetShaderPipelineOrder(const Shader* shader)
 {
     /* Convert shader type to order number */
@@ -12,6 +12,7 @@
 #include "../OpenGL.h"
 #include "GLShader.h"
 #include <cstddef>
+#include <cstdint>
 #include <type_traits>
 
 
@@ -49,6 +50,9 @@ class GLPipelineSignature
         // Returns a signed integer of the strict-weak-order (SWO) comparison, and 0 on equality.
         static int CompareSWO(const GLPipelineSignature& lhs, const GLPipelineSignature& rhs);
 
+        // Returns a 64-bit hash of the specified signature. Signatures that are equal by CompareSWO always have the same hash.
+        static std::uint64_t GetHash(const GLPipelineSignature& signature);
+
         // Returns the last shader in the pipeline that modifies gl_Position.
         static const GLShader* FindFinalGLPositionShader(std::size_t numShaders, const Shader* const* shaders);
 
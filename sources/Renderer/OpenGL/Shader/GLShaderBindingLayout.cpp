@@ -12,6 +12,7 @@
 #include "../RenderState/GLPipelineLayout.h"
 #include "../RenderState/GLStateManager.h"
 #include "../../../Core/MacroUtils.h"
+#include "../../../Core/CoreUtils.h"
 #include <LLGL/Utils/ForRange.h>
 #include <algorithm>
 
@@ -151,6 +152,20 @@ int GLShaderBindingLayout::CompareSWO(const GLShaderBindingLayout& lhs, const GL
     return 0;
 }
 
+std::uint64_t GLShaderBindingLayout::GetHash(const GLShaderBindingLayout& bindingLayout)
+{
+    std::uint64_t seed = 0;
+
+    HashCombine(seed, bindingLayout.bindings_.size());
+    for (const NamedResourceBinding& binding : bindingLayout.bindings_)
+    {
+        HashCombine(seed, binding.slot);
+        HashCombine(seed, binding.name);
+    }
+
+    return seed;
+}
+
 
 /*
  * ======= Private: =======
@@ -53,6 +53,9 @@ class GLShaderBindingLayout
         // Returns a signed integer of the strict-weak-order (SWO) comparison, and 0 on equality.
         static int CompareSWO(const GLShaderBindingLayout& lhs, const GLShaderBindingLayout& rhs);
 
+        // Returns a 64-bit hash of the specified binding layout. Layouts that are equal by CompareSWO always have the same hash.
+        static std::uint64_t GetHash(const GLShaderBindingLayout& bindingLayout);
+
     private:
 
         struct NamedResourceBinding
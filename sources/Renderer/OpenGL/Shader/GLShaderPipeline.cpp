@@ -35,6 +35,11 @@ int GLShaderPipeline::CompareSWO(const GLShaderPipeline& lhs, const GLPipelineSi
     return GLPipelineSignature::CompareSWO(lhs.signature_, rhs);
 }
 
+std::uint64_t GLShaderPipeline::GetHash(const GLShaderPipeline& shaderPipeline)
+{
+    return GLPipelineSignature::GetHash(shaderPipeline.signature_);
+}
+
 
 } // /namespace LLGL
 
@@ -60,6 +60,9 @@ class GLShaderPipeline
         static int CompareSWO(const GLShaderPipeline& lhs, const GLShaderPipeline& rhs);
         static int CompareSWO(const GLShaderPipeline& lhs, const GLPipelineSignature& rhs);
 
+        // Returns the hash of the pipeline signature (see GLPipelineSignature::GetHash).
+        static std::uint64_t GetHash(const GLShaderPipeline& shaderPipeline);
+
     protected:
 
         GLShaderPipeline() = default;
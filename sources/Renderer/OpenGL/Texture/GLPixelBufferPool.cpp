@@ -0,0 +1,343 @@
+/*
+ * GLPixelBufferPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLPixelBufferPool.h"
+#include "GLTexture.h"
+#include "../RenderState/GLStateManager.h"
+#include "../RenderState/GLFence.h"
+#include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionRegistry.h"
+#include "../../../Core/CoreUtils.h"
+#include <LLGL/ImageFlags.h>
+#include <algorithm>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+// Smaller uploads are not staged, since the GL copies small amounts of client memory immediately anyway
+static constexpr GLsizeiptr  g_minStagingSize    = 16 * 1024;
+
+static constexpr GLsizeiptr  g_minRingCapacity   = 4 * 1024 * 1024;
+static constexpr GLsizeiptr  g_maxRingCapacity   = 64 * 1024 * 1024;
+
+// Byte alignment of each range within the ring buffer; satisfies the offset requirements of all pixel data types
+static constexpr GLintptr    g_rangeAlignment    = 16;
+
+// Timeout (in nanoseconds) for each attempt to wait for an in-flight range
+static constexpr GLuint64    g_fenceWaitTimeout  = 1000000000ull;
+
+// Maximal number of pixel pack buffers that are kept for later readbacks
+static constexpr std::size_t g_maxFreePackBuffers = 4;
+
+GLPixelBufferPool::~GLPixelBufferPool()
+{
+    Clear();
+}
+
+GLPixelBufferPool& GLPixelBufferPool::Get()
+{
+    static GLPixelBufferPool instance;
+    return instance;
+}
+
+void GLPixelBufferPool::Clear()
+{
+    DeleteRingBuffer();
+    DeletePackBuffers();
+}
+
+bool GLPixelBufferPool::WriteTexture(GLTexture& texture, const TextureRegion& region, const ImageView& srcImageView)
+{
+    #if GL_ARB_sync && defined GL_ARB_map_buffer_range
+
+    const GLsizeiptr size = static_cast<GLsizeiptr>(srcImageView.dataSize);
+
+    if (texture.IsRenderbuffer() || size < g_minStagingSize || size > g_maxRingCapacity)
+        return false;
+    if (!HasExtension(GLExt::ARB_sync) || !HasExtension(GLExt::ARB_map_buffer_range))
+        return false;
+
+    /* Allocate range within ring buffer that is no longer in use by the GPU */
+    const GLintptr offset = AllocRange(size);
+
+    /* Copy image data into staging buffer */
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PixelUnpackBuffer, bufferID_);
+
+    if (persistentPtr_ != nullptr)
+    {
+        /* Write directly into persistently mapped memory; no flush is required since it is mapped coherently */
+        ::memcpy(persistentPtr_ + offset, srcImageView.data, srcImageView.dataSize);
+    }
+    else
+    {
+        /* Map range without implicit synchronization, since it is already guarded by the fences of previous uploads */
+        void* dst = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, offset, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+        if (dst == nullptr)
+        {
+            GLStateManager::Get().BindBuffer(GLBufferTarget::PixelUnpackBuffer, 0);
+            return false;
+        }
+        ::memcpy(dst, srcImageView.data, srcImageView.dataSize);
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    }
+
+    /* Upload image from staging buffer; the image data pointer is interpreted as byte offset into the bound pixel unpack buffer */
+    ImageView stagedImageView = srcImageView;
+    stagedImageView.data = reinterpret_cast<const void*>(offset);
+    texture.TextureSubImage(region, stagedImageView, false);
+
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PixelUnpackBuffer, 0);
+
+    /* Guard range until the GPU has finished the upload */
+    inFlightRanges_.push_back(GLInFlightRange{ offset, offset + size, glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0) });
+
+    return true;
+
+    #else // GL_ARB_sync && GL_ARB_map_buffer_range
+
+    return false;
+
+    #endif // /GL_ARB_sync && GL_ARB_map_buffer_range
+}
+
+bool GLPixelBufferPool::ReadTexture(GLTexture& texture, const TextureRegion& region, const MutableImageView& dstImageView, GLFence& fence)
+{
+    #if GL_ARB_sync && defined GL_ARB_map_buffer_range
+
+    /* Stencil values might be separated on the CPU from an intermediate buffer, which cannot be read into a pixel pack buffer */
+    if (texture.IsRenderbuffer() || dstImageView.format == ImageFormat::Stencil || dstImageView.dataSize == 0)
+        return false;
+    if (!HasExtension(GLExt::ARB_sync) || !HasExtension(GLExt::ARB_map_buffer_range))
+        return false;
+
+    /* Read image into pixel pack buffer; the image data pointer is interpreted as byte offset into the bound pixel pack buffer */
+    GLPackBuffer packBuffer;
+    packBuffer.id = AcquirePackBuffer(static_cast<GLsizeiptr>(dstImageView.dataSize), packBuffer.capacity);
+
+    MutableImageView packedImageView = dstImageView;
+    packedImageView.data = nullptr;
+
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PixelPackBuffer, packBuffer.id);
+    {
+        texture.GetTextureSubImage(region, packedImageView, false);
+    }
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PixelPackBuffer, 0);
+
+    /* Guard pixel pack buffer with the fence; it is copied into client memory once the fence has been signaled */
+    fence.Submit();
+    pendingReadbacks_.push_back(GLPendingReadback{ &fence, packBuffer, dstImageView.data, dstImageView.dataSize });
+
+    return true;
+
+    #else // GL_ARB_sync && GL_ARB_map_buffer_range
+
+    return false;
+
+    #endif // /GL_ARB_sync && GL_ARB_map_buffer_range
+}
+
+void GLPixelBufferPool::ResolveReadbacks(const GLFence& fence)
+{
+    #ifdef GL_ARB_map_buffer_range
+    for (auto it = pendingReadbacks_.begin(); it != pendingReadbacks_.end();)
+    {
+        if (it->fence == &fence)
+        {
+            /* Copy image data from pixel pack buffer into client memory; the fence guarantees that the GL has finished writing it */
+            GLStateManager::Get().BindBuffer(GLBufferTarget::PixelPackBuffer, it->buffer.id);
+            if (const void* src = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(it->size), GL_MAP_READ_BIT))
+            {
+                ::memcpy(it->dst, src, it->size);
+                glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            }
+            GLStateManager::Get().BindBuffer(GLBufferTarget::PixelPackBuffer, 0);
+
+            RecyclePackBuffer(it->buffer.id, it->buffer.capacity);
+            it = pendingReadbacks_.erase(it);
+        }
+        else
+            ++it;
+    }
+    #endif // /GL_ARB_map_buffer_range
+}
+
+void GLPixelBufferPool::DiscardReadbacks(const GLFence& fence)
+{
+    for (auto it = pendingReadbacks_.begin(); it != pendingReadbacks_.end();)
+    {
+        if (it->fence == &fence)
+        {
+            RecyclePackBuffer(it->buffer.id, it->buffer.capacity);
+            it = pendingReadbacks_.erase(it);
+        }
+        else
+            ++it;
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+GLintptr GLPixelBufferPool::AllocRange(GLsizeiptr size)
+{
+    /* Replace ring buffer if the requested size exceeds its capacity */
+    if (size > capacity_)
+        CreateRingBuffer(size);
+
+    /* Wrap around to the beginning if the range does not fit into the remaining capacity */
+    GLintptr offset = GetAlignedSize(head_, g_rangeAlignment);
+    if (offset + size > capacity_)
+        offset = 0;
+
+    WaitForRange(offset, offset + size);
+    head_ = offset + size;
+
+    return offset;
+}
+
+void GLPixelBufferPool::CreateRingBuffer(GLsizeiptr minCapacity)
+{
+    DeleteRingBuffer();
+
+    /* Grow capacity in powers of two */
+    capacity_ = g_minRingCapacity;
+    while (capacity_ < minCapacity)
+        capacity_ *= 2;
+    capacity_ = std::min(capacity_, g_maxRingCapacity);
+
+    glGenBuffers(1, &bufferID_);
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PixelUnpackBuffer, bufferID_);
+
+    #ifdef GL_ARB_buffer_storage
+    if (HasExtension(GLExt::ARB_buffer_storage))
+    {
+        /* Allocate immutable storage and keep it persistently and coherently mapped (GL 4.4+) */
+        const GLbitfield flags = (GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+        glBufferStorage(GL_PIXEL_UNPACK_BUFFER, capacity_, nullptr, flags);
+        persistentPtr_ = static_cast<char*>(glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, capacity_, flags));
+    }
+    else
+    #endif // /GL_ARB_buffer_storage
+    {
+        /* Allocate mutable storage that is mapped for each upload individually */
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, capacity_, nullptr, GL_STREAM_DRAW);
+    }
+
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PixelUnpackBuffer, 0);
+}
+
+void GLPixelBufferPool::DeleteRingBuffer()
+{
+    #if GL_ARB_sync
+    for (const GLInFlightRange& range : inFlightRanges_)
+        glDeleteSync(range.sync);
+    #endif // /GL_ARB_sync
+    inFlightRanges_.clear();
+
+    if (bufferID_ != 0)
+    {
+        /* Deleting the buffer is safe even if the GPU still reads from it, since the GL defers its destruction */
+        glDeleteBuffers(1, &bufferID_);
+        GLStateManager::Get().NotifyBufferRelease(bufferID_, GLBufferTarget::PixelUnpackBuffer);
+        bufferID_ = 0;
+    }
+
+    capacity_       = 0;
+    head_           = 0;
+    persistentPtr_  = nullptr;
+}
+
+void GLPixelBufferPool::WaitForRange(GLintptr begin, GLintptr end)
+{
+    #if GL_ARB_sync
+    for (auto it = inFlightRanges_.begin(); it != inFlightRanges_.end();)
+    {
+        if (it->begin < end && begin < it->end)
+        {
+            /* Only flush the command queue with the first attempt */
+            GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+            while (glClientWaitSync(it->sync, flags, g_fenceWaitTimeout) == GL_TIMEOUT_EXPIRED)
+                flags = 0;
+
+            glDeleteSync(it->sync);
+            it = inFlightRanges_.erase(it);
+        }
+        else
+            ++it;
+    }
+    #endif // /GL_ARB_sync
+}
+
+
+GLuint GLPixelBufferPool::AcquirePackBuffer(GLsizeiptr size, GLsizeiptr& outCapacity)
+{
+    /* Find smallest free pixel pack buffer that is large enough */
+    auto bestFit = freePackBuffers_.end();
+    for (auto it = freePackBuffers_.begin(); it != freePackBuffers_.end(); ++it)
+    {
+        if (it->capacity >= size && (bestFit == freePackBuffers_.end() || it->capacity < bestFit->capacity))
+            bestFit = it;
+    }
+
+    if (bestFit != freePackBuffers_.end())
+    {
+        const GLPackBuffer packBuffer = *bestFit;
+        freePackBuffers_.erase(bestFit);
+        outCapacity = packBuffer.capacity;
+        return packBuffer.id;
+    }
+
+    /* Create new pixel pack buffer that is only read by the CPU */
+    GLuint bufferID = 0;
+    glGenBuffers(1, &bufferID);
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PixelPackBuffer, bufferID);
+    glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PixelPackBuffer, 0);
+
+    outCapacity = size;
+    return bufferID;
+}
+
+void GLPixelBufferPool::RecyclePackBuffer(GLuint bufferID, GLsizeiptr capacity)
+{
+    freePackBuffers_.push_back(GLPackBuffer{ bufferID, capacity });
+
+    /* Release oldest free pixel pack buffer if the limit is exceeded */
+    if (freePackBuffers_.size() > g_maxFreePackBuffers)
+    {
+        GLuint oldestBufferID = freePackBuffers_.front().id;
+        glDeleteBuffers(1, &oldestBufferID);
+        GLStateManager::Get().NotifyBufferRelease(oldestBufferID, GLBufferTarget::PixelPackBuffer);
+        freePackBuffers_.erase(freePackBuffers_.begin());
+    }
+}
+
+void GLPixelBufferPool::DeletePackBuffers()
+{
+    for (const GLPendingReadback& readback : pendingReadbacks_)
+        freePackBuffers_.push_back(readback.buffer);
+    pendingReadbacks_.clear();
+
+    for (GLPackBuffer& packBuffer : freePackBuffers_)
+    {
+        glDeleteBuffers(1, &packBuffer.id);
+        GLStateManager::Get().NotifyBufferRelease(packBuffer.id, GLBufferTarget::PixelPackBuffer);
+    }
+    freePackBuffers_.clear();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,141 @@
+/*
+ * GLPixelBufferPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_PIXEL_BUFFER_POOL_H
+#define LLGL_GL_PIXEL_BUFFER_POOL_H
+
+
+#include "../OpenGL.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+struct TextureRegion;
+struct ImageView;
+struct MutableImageView;
+class GLTexture;
+class GLFence;
+
+// Class to manage a ring of GL pixel unpack buffer (PBO) memory to stage texture uploads without stalling the render thread; used by <GLRenderSystem>.
+// It also manages a pool of pixel pack buffers for asynchronous texture readbacks that are resolved once their fence has been signaled.
+class GLPixelBufferPool
+{
+
+    public:
+
+        // Returns the instance of this singleton.
+        static GLPixelBufferPool& Get();
+
+    public:
+
+        GLPixelBufferPool(const GLPixelBufferPool&) = delete;
+        GLPixelBufferPool& operator = (const GLPixelBufferPool&) = delete;
+
+        GLPixelBufferPool(GLPixelBufferPool&&) = delete;
+        GLPixelBufferPool& operator = (GLPixelBufferPool&&) = delete;
+
+        ~GLPixelBufferPool();
+
+        // Releases all resources for this singleton class.
+        void Clear();
+
+        /*
+        Writes the specified image data to a subregion of the texture by staging it in a pixel unpack buffer.
+        This returns as soon as the image data has been copied into the staging buffer, i.e. the GL performs the actual upload asynchronously.
+        Returns false if the image data cannot be staged, in which case the caller must upload it directly from client memory.
+        */
+        bool WriteTexture(GLTexture& texture, const TextureRegion& region, const ImageView& srcImageView);
+
+        /*
+        Reads a subregion of the texture into a pixel pack buffer and submits the specified fence afterwards.
+        The image data is copied into the destination image view when the fence has been signaled (see ResolveReadbacks).
+        Returns false if the image data cannot be read into a pixel pack buffer, in which case the caller must read it synchronously.
+        */
+        bool ReadTexture(GLTexture& texture, const TextureRegion& region, const MutableImageView& dstImageView, GLFence& fence);
+
+        // Copies the image data of all readbacks that are guarded by the specified fence into their destination. The fence must have been signaled.
+        void ResolveReadbacks(const GLFence& fence);
+
+        // Discards all readbacks that are guarded by the specified fence, e.g. when the fence is released before it has been waited on.
+        void DiscardReadbacks(const GLFence& fence);
+
+    private:
+
+        GLPixelBufferPool() = default;
+
+        // Allocates a range of the specified size within the ring buffer and waits until the GPU no longer reads from it.
+        GLintptr AllocRange(GLsizeiptr size);
+
+        // Creates a new ring buffer with at least the specified capacity and releases the previous one.
+        void CreateRingBuffer(GLsizeiptr minCapacity);
+
+        // Releases the ring buffer and all fences of in-flight ranges.
+        void DeleteRingBuffer();
+
+        // Waits until all in-flight ranges that overlap the specified range are no longer in use and removes them.
+        void WaitForRange(GLintptr begin, GLintptr end);
+
+        // Returns the smallest free pixel pack buffer with at least the specified capacity or creates a new one.
+        GLuint AcquirePackBuffer(GLsizeiptr size, GLsizeiptr& outCapacity);
+
+        // Returns the specified pixel pack buffer to the free list.
+        void RecyclePackBuffer(GLuint bufferID, GLsizeiptr capacity);
+
+        // Releases all pixel pack buffers and discards all pending readbacks.
+        void DeletePackBuffers();
+
+    private:
+
+        // Range within the ring buffer that is guarded by a fence until the GPU has finished the texture upload.
+        struct GLInFlightRange
+        {
+            GLintptr    begin;
+            GLintptr    end;
+            GLsync      sync;
+        };
+
+        // Pixel pack buffer that is not in use by any readback.
+        struct GLPackBuffer
+        {
+            GLuint      id;
+            GLsizeiptr  capacity;
+        };
+
+        // Texture readback into a pixel pack buffer that is copied into client memory once its fence has been signaled.
+        struct GLPendingReadback
+        {
+            const GLFence*  fence;
+            GLPackBuffer    buffer;
+            void*           dst;
+            std::size_t     size;
+        };
+
+    private:
+
+        GLuint                          bufferID_       = 0;
+        GLsizeiptr                      capacity_       = 0;
+        GLintptr                        head_           = 0;
+        char*                           persistentPtr_  = nullptr; // Non-null if the ring buffer is persistently mapped
+        std::vector<GLInFlightRange>    inFlightRanges_;
+
+        std::vector<GLPackBuffer>       freePackBuffers_;
+        std::vector<GLPendingReadback>  pendingReadbacks_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -216,6 +216,25 @@ const Report* RenderSystem::GetReport() const
     return (pimpl_->report ? &(pimpl_->report) : nullptr);
 }
 
+void RenderSystem::ReadTextureAsync(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView, Fence& fence)
+{
+    /* Read texture synchronously and signal fence right away, since this backend provides no asynchronous texture readback */
+    ReadTexture(texture, textureRegion, dstImageView);
+    GetCommandQueue()->Submit(fence);
+}
+
+void RenderSystem::CreatePipelineStates(std::uint32_t numPipelineStates, const GraphicsPipelineDescriptor* pipelineStateDescs, PipelineState** outPipelineStates)
+{
+    for_range(i, numPipelineStates)
+        outPipelineStates[i] = CreatePipelineState(pipelineStateDescs[i]);
+}
+
+void RenderSystem::CreatePipelineStates(std::uint32_t numPipelineStates, const ComputePipelineDescriptor* pipelineStateDescs, PipelineState** outPipelineStates)
+{
+    for_range(i, numPipelineStates)
+        outPipelineStates[i] = CreatePipelineState(pipelineStateDescs[i]);
+}
+
 
 /*
  * ======= Protected: =======
@@ -44,6 +44,7 @@ struct RenderingDebugger::Pimpl
     const char*             source          = "";
     const char*             groupName       = "";
     bool                    isTimeRecording = false;
+    bool                    isValidating    = true;
 };
 
 
@@ -77,6 +78,16 @@ bool RenderingDebugger::GetTimeRecording() const
     return pimpl_->isTimeRecording;
 }
 
+void RenderingDebugger::SetValidation(bool enabled)
+{
+    pimpl_->isValidating = enabled;
+}
+
+bool RenderingDebugger::GetValidation() const
+{
+    return pimpl_->isValidating;
+}
+
 void RenderingDebugger::Errorf(const ErrorType type, const char* format, ...)
 {
     /* Print formatted string */
@@ -159,7 +170,7 @@ void RenderingDebugger::PostWarning(const WarningType type, const StringView& me
 
 static void MergeProfileCommandQueueRecords(ProfileCommandQueueRecord& dst, const ProfileCommandQueueRecord& src)
 {
-    LLGL_ASSERT_STRUCT_FIELDS(ProfileCommandQueueRecord, 7);
+    LLGL_ASSERT_STRUCT_FIELDS(ProfileCommandQueueRecord, 8);
     dst.bufferWrites                += src.bufferWrites             ;
     dst.bufferReads                 += src.bufferReads              ;
     dst.bufferMappings              += src.bufferMappings           ;
@@ -167,11 +178,12 @@ static void MergeProfileCommandQueueRecords(ProfileCommandQueueRecord& dst, cons
     dst.textureReads                += src.textureReads             ;
     dst.commandBufferSubmittions    += src.commandBufferSubmittions ;
     dst.fenceSubmissions            += src.fenceSubmissions         ;
+    dst.transferSubmissions         += src.transferSubmissions      ;
 }
 
 static void MergeProfileCommandBufferRecords(ProfileCommandBufferRecord& dst, const ProfileCommandBufferRecord& src)
 {
-    LLGL_ASSERT_STRUCT_FIELDS(ProfileCommandBufferRecord, 24);
+    LLGL_ASSERT_STRUCT_FIELDS(ProfileCommandBufferRecord, 28);
     dst.encodings                   += src.encodings                ;
     dst.mipMapsGenerations          += src.mipMapsGenerations       ;
     dst.vertexBufferBindings        += src.vertexBufferBindings     ;
@@ -196,6 +208,10 @@ static void MergeProfileCommandBufferRecords(ProfileCommandBufferRecord& dst, co
     dst.renderConditionSections     += src.renderConditionSections  ;
     dst.drawCommands                += src.drawCommands             ;
     dst.dispatchCommands            += src.dispatchCommands         ;
+    dst.descriptorSetCacheHits      += src.descriptorSetCacheHits   ;
+    dst.descriptorSetCacheMisses    += src.descriptorSetCacheMisses ;
+    dst.encodingStalls              += src.encodingStalls           ;
+    dst.eliminatedCommands          += src.eliminatedCommands       ;
 }
 
 void RenderingDebugger::MergeProfiles(FrameProfile& dst, const FrameProfile& src)
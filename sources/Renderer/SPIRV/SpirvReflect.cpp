@@ -32,6 +32,15 @@ SpirvResult SpirvReflect::Reflect(const SpirvModuleView& module)
     idBound_ = header.idBound;
     names_.Reset(header.idBound);
 
+    /* Reset all flat tables to the ID bound of this module, so each ID can be looked up without searching */
+    types_.Reset(header.idBound);
+    constants_.Reset(header.idBound);
+    uniforms_.Reset(header.idBound);
+    varyings_.Reset(header.idBound);
+    members_.Reset(header.idBound);
+    pushConstantTypeId_ = 0;
+    executionMode_      = SpvExecutionMode{};
+
     /* Parse each SPIR-V instruction in the module */
     for (const SpirvInstruction& instr : module)
     {
@@ -54,13 +63,31 @@ const SpirvReflect::SpvType* SpirvReflect::GetPushConstantStructType() const
     if (pushConstantTypeId_ != 0)
     {
         /* Find push constant pointer type and deference to its struct type */
-        auto it = types_.find(pushConstantTypeId_);
-        if (it != types_.end())
-            return it->second.Deref();
+        if (const SpvType* type = types_.Find(pushConstantTypeId_))
+            return type->Deref();
     }
     return nullptr;
 }
 
+bool SpirvReflect::GetPushConstantBlock(SpvBlock& outBlock) const
+{
+    const SpvType* structType = GetPushConstantStructType();
+    if (structType == nullptr || structType->opcode != spv::Op::OpTypeStruct)
+        return false;
+
+    /* Return block name and its field names and offsets; names might be missing if the module was stripped */
+    outBlock.name = structType->name;
+    outBlock.fields.resize(structType->fieldOffsets.size());
+
+    for_range(i, outBlock.fields.size())
+    {
+        outBlock.fields[i].name     = (i < structType->fieldNames.size() ? structType->fieldNames[i] : nullptr);
+        outBlock.fields[i].offset   = structType->fieldOffsets[i];
+    }
+
+    return true;
+}
+
 static void ParseSpvExecutionMode(const SpirvInstruction& instr, SpirvReflect::SpvExecutionMode& outExecutionMode)
 {
     auto mode = static_cast<spv::ExecutionMode>(instr.GetUInt32(1));
@@ -93,154 +120,6 @@ static void ParseSpvExecutionMode(const SpirvInstruction& instr, SpirvReflect::S
     }
 }
 
-SpirvResult SpirvReflectExecutionMode(const SpirvModuleView& module, SpirvReflect::SpvExecutionMode& outExecutionMode)
-{
-    /* Parse SPIR-V header */
-    SpirvHeader header;
-    SpirvResult result = module.ReadHeader(header);
-    if (result != SpirvResult::NoError)
-        return result;
-
-    /* Parse each SPIR-V instruction in the module */
-    bool firstModeParsed = false;
-
-    for (const SpirvInstruction& instr : module)
-    {
-        if (instr.opcode == spv::Op::OpExecutionMode)
-        {
-            ParseSpvExecutionMode(instr, outExecutionMode);
-            firstModeParsed = true;
-        }
-        else if (firstModeParsed)
-        {
-            /* Stop parsing after we found all execution modes */
-            break;
-        }
-    }
-
-    return SpirvResult::NoError;
-}
-
-static spv::Id FindGlobalPushConstantVariableType(const SpirvModuleView& module)
-{
-    for (const SpirvInstruction& instr : module)
-    {
-        if (instr.opcode == spv::Op::OpVariable)
-        {
-            /* OpVariable ResultType ResultId StorageClass[0] (Initializer[1]) */
-            auto storage = static_cast<spv::StorageClass>(instr.GetUInt32(0));
-            if (storage == spv::StorageClassPushConstant)
-            {
-                /* Return variable type; Must be OpTypePointer for push constants */
-                return instr.type;
-            }
-        }
-        else if (instr.opcode == spv::Op::OpFunction)
-        {
-            /* No more declarations and decorations after first OpFunction instruction */
-            break;
-        }
-    }
-    return 0;
-}
-
-static spv::Id FindPointerTypeSubtype(const SpirvModuleView& module, spv::Id pointerTypeId)
-{
-    for (const SpirvInstruction& instr : module)
-    {
-        if (instr.opcode == spv::Op::OpTypePointer)
-        {
-            if (instr.result == pointerTypeId)
-            {
-                /* OpTypePointer ResultId StorageClass[0] SubTypeId[1] */
-                return instr.GetUInt32(1);
-            }
-        }
-        else if (instr.opcode == spv::Op::OpFunction)
-        {
-            /* No more declarations and decorations after first OpFunction instruction */
-            break;
-        }
-    }
-    return 0;
-}
-
-SpirvResult SpirvReflectPushConstants(const SpirvModuleView& module, SpirvReflect::SpvBlock& outBlock)
-{
-    /* Parse SPIR-V header */
-    SpirvHeader header;
-    SpirvResult result = module.ReadHeader(header);
-    if (result != SpirvResult::NoError)
-        return result;
-
-    /* Find global variable declaration with PushConstant storage class */
-    const spv::Id pushConstantVarId = FindGlobalPushConstantVariableType(module);
-    if (pushConstantVarId == 0)
-        return SpirvResult::NoError;
-
-    /* Find pointer subtype for push constant variable */
-    const spv::Id pushConstantTypeId = FindPointerTypeSubtype(module, pushConstantVarId);
-    if (pushConstantTypeId == 0)
-        return SpirvResult::IdTypeMismatch;
-
-    auto GetOrMakeBlockField = [&outBlock](std::uint32_t index) -> SpirvReflect::SpvBlockField&
-    {
-        if (index >= outBlock.fields.size())
-            outBlock.fields.resize(index + 1);
-        return outBlock.fields[index];
-    };
-
-    /* Now parse SPIR-V module for block name, its member names, and member offsets */
-    for (const SpirvInstruction& instr : module)
-    {
-        if (instr.opcode == spv::Op::OpFunction)
-        {
-            /* No more declarations and decorations after first OpFunction instruction */
-            break;
-        }
-
-        switch (instr.opcode)
-        {
-            case spv::Op::OpName:
-                /* OpName Target[0] Name[1] */
-                if (instr.numOperands < 2)
-                    return SpirvResult::OperandOutOfBounds;
-                if (instr.GetUInt32(0) == pushConstantTypeId)
-                    outBlock.name = instr.GetString(1);
-                break;
-
-            case spv::Op::OpMemberName:
-                /* OpMemberName TypeId Member[0] Name[1] */
-                if (instr.numOperands < 2)
-                    return SpirvResult::OperandOutOfBounds;
-                if (instr.type == pushConstantTypeId)
-                    GetOrMakeBlockField(instr.GetUInt32(0)).name = instr.GetString(1);
-                break;
-
-            case spv::Op::OpMemberDecorate:
-                /* OpMemberDecorate Target[0] Member[1] Decoration[2] (Values[3+]) */
-                if (instr.numOperands < 3)
-                    return SpirvResult::OperandOutOfBounds;
-                if (instr.GetUInt32(0) == pushConstantTypeId)
-                {
-                    const auto decoration = static_cast<spv::Decoration>(instr.GetUInt32(2));
-                    if (decoration == spv::DecorationOffset)
-                    {
-                        if (instr.numOperands < 4)
-                            return SpirvResult::OperandOutOfBounds;
-                        GetOrMakeBlockField(instr.GetUInt32(1)).offset = instr.GetUInt32(3);
-                    }
-                }
-                break;
-
-            default:
-                break;
-        }
-    }
-
-    return SpirvResult::NoError;
-}
-
 static SpirvReflect::SpvBindingPoint* FindOrInsertBindingPoint(std::vector<SpirvReflect::SpvBindingPoint>& bindingPoints, spv::Id varId)
 {
     /* Try to find binding point for specified variable ID */
@@ -331,10 +210,14 @@ SpirvResult SpirvReflect::ParseInstruction(const SpirvInstruction& instr)
     {
         case spv::Op::OpName:
             return OpName(instr);
+        case spv::Op::OpExecutionMode:
+            return OpExecutionMode(instr);
         case spv::Op::OpMemberName:
             return OpMemberName(instr);
         case spv::Op::OpDecorate:
             return OpDecorate(instr);
+        case spv::Op::OpMemberDecorate:
+            return OpMemberDecorate(instr);
         case spv::Op::OpTypeVoid:
         case spv::Op::OpTypeBool:
         case spv::Op::OpTypeInt:
@@ -372,12 +255,49 @@ SpirvResult SpirvReflect::OpName(const Instr& instr)
 
 SpirvResult SpirvReflect::OpMemberName(const Instr& instr)
 {
-    SpvMemberNames& memberNames = memberNames_[instr.type];
+    /* OpMemberName TypeId Member[0] Name[1] */
+    if (!(instr.type < idBound_))
+        return SpirvResult::IdOutOfBounds;
+
+    SpvMembers& members = members_.FindOrInsert(instr.type);
     const std::uint32_t memberIndex = instr.GetUInt32(0);
-    if (memberNames.names.size() <= memberIndex)
-        memberNames.names.resize(memberIndex + 1);
+    if (members.names.size() <= memberIndex)
+        members.names.resize(memberIndex + 1);
+
+    members.names[memberIndex] = instr.GetString(1);
+    return SpirvResult::NoError;
+}
+
+SpirvResult SpirvReflect::OpMemberDecorate(const Instr& instr)
+{
+    /* OpMemberDecorate Target[0] Member[1] Decoration[2] (Values[3+]) */
+    if (instr.numOperands < 3)
+        return SpirvResult::OperandOutOfBounds;
+
+    const spv::Id id = instr.GetUInt32(0);
+    if (!(id < idBound_))
+        return SpirvResult::IdOutOfBounds;
+
+    const auto decoration = static_cast<spv::Decoration>(instr.GetUInt32(2));
+    if (decoration == spv::DecorationOffset)
+    {
+        if (instr.numOperands < 4)
+            return SpirvResult::OperandOutOfBounds;
+
+        SpvMembers& members = members_.FindOrInsert(id);
+        const std::uint32_t memberIndex = instr.GetUInt32(1);
+        if (members.offsets.size() <= memberIndex)
+            members.offsets.resize(memberIndex + 1);
+
+        members.offsets[memberIndex] = instr.GetUInt32(3);
+    }
 
-    memberNames.names[memberIndex] = instr.GetString(1);
+    return SpirvResult::NoError;
+}
+
+SpirvResult SpirvReflect::OpExecutionMode(const Instr& instr)
+{
+    ParseSpvExecutionMode(instr, executionMode_);
     return SpirvResult::NoError;
 }
 
@@ -407,7 +327,7 @@ SpirvResult SpirvReflect::OpDecorate(const Instr& instr)
 
 void SpirvReflect::OpDecorateBinding(const Instr& instr, spv::Id id)
 {
-    auto& variable = uniforms_[id];
+    auto& variable = uniforms_.FindOrInsert(id);
     {
         variable.name       = names_[id];
         variable.binding    = instr.GetUInt32(2);
@@ -416,7 +336,7 @@ void SpirvReflect::OpDecorateBinding(const Instr& instr, spv::Id id)
 
 void SpirvReflect::OpDecorateLocation(const Instr& instr, spv::Id id)
 {
-    auto& variable = varyings_[id];
+    auto& variable = varyings_.FindOrInsert(id);
     {
         variable.name       = names_[id];
         variable.location   = instr.GetUInt32(2);
@@ -425,7 +345,7 @@ void SpirvReflect::OpDecorateLocation(const Instr& instr, spv::Id id)
 
 void SpirvReflect::OpDecorateBuiltin(const Instr& instr, spv::Id id)
 {
-    auto& variable = varyings_[id];
+    auto& variable = varyings_.FindOrInsert(id);
     {
         variable.name       = names_[id];
         variable.builtin    = static_cast<spv::BuiltIn>(instr.GetUInt32(2));
@@ -443,6 +363,9 @@ Example:
 */
 SpirvResult SpirvReflect::OpVariable(const Instr& instr)
 {
+    if (!(instr.result < idBound_))
+        return SpirvResult::IdOutOfBounds;
+
     auto storage = static_cast<spv::StorageClass>(instr.GetUInt32(0));
 
     switch (storage)
@@ -450,7 +373,7 @@ SpirvResult SpirvReflect::OpVariable(const Instr& instr)
         case spv::StorageClassUniform:
         case spv::StorageClassUniformConstant:
         {
-            auto& var = uniforms_[instr.result];
+            auto& var = uniforms_.FindOrInsert(instr.result);
             {
                 var.type = FindType(instr.type);
                 if (auto structType = var.type->Deref(spv::Op::OpTypeStruct))
@@ -473,7 +396,7 @@ SpirvResult SpirvReflect::OpVariable(const Instr& instr)
 
         case spv::StorageClassInput:
         {
-            auto& var = varyings_[instr.result];
+            auto& var = varyings_.FindOrInsert(instr.result);
             {
                 var.type    = FindType(instr.type);
                 var.input   = true;
@@ -483,7 +406,7 @@ SpirvResult SpirvReflect::OpVariable(const Instr& instr)
 
         case spv::StorageClassOutput:
         {
-            auto& var = varyings_[instr.result];
+            auto& var = varyings_.FindOrInsert(instr.result);
             {
                 var.type    = FindType(instr.type);
                 var.input   = false;
@@ -500,7 +423,10 @@ SpirvResult SpirvReflect::OpVariable(const Instr& instr)
 
 SpirvResult SpirvReflect::OpConstant(const Instr& instr)
 {
-    auto& val = constants_[instr.result];
+    if (!(instr.result < idBound_))
+        return SpirvResult::IdOutOfBounds;
+
+    auto& val = constants_.FindOrInsert(instr.result);
     {
         val.type = FindType(instr.type);
 
@@ -530,7 +456,7 @@ SpirvResult SpirvReflect::OpType(const Instr& instr)
         return SpirvResult::IdOutOfBounds;
 
     /* Register type and store it as current type to operate on */
-    auto& type = types_[instr.result];
+    auto& type = types_.FindOrInsert(instr.result);
     {
         type.opcode = instr.opcode;
         type.result = instr.result;
@@ -651,17 +577,17 @@ void SpirvReflect::OpTypeStruct(const Instr& instr, SpvType& type)
         AccumulateSizeInVectorBoundary(type.size, 16, fieldType->size);
     }
 
-    /* Also append field names */
-    auto memberNamesIt = memberNames_.find(type.result);
-    if (memberNamesIt != memberNames_.end())
+    /* Also append field names and offsets */
+    if (const SpvMembers* members = members_.Find(type.result))
     {
-        if (instr.numOperands == memberNamesIt->second.names.size())
-        {
-            type.fieldNames.resize(instr.numOperands);
-            for_range(i, instr.numOperands)
-                type.fieldNames[i] = memberNamesIt->second.names[i];
-        }
+        if (instr.numOperands == members->names.size())
+            type.fieldNames = members->names;
+
+        type.fieldOffsets = members->offsets;
+        type.fieldOffsets.resize(instr.numOperands, 0);
     }
+    else
+        type.fieldOffsets.resize(instr.numOperands, 0);
 
     type.size = GetAlignedSize(type.size, 16u);
 }
@@ -684,16 +610,16 @@ void SpirvReflect::OpTypeFunction(const Instr& instr, SpvType& type)
 
 const SpirvReflect::SpvType* SpirvReflect::FindType(spv::Id id) const
 {
-    auto it = types_.find(id);
-    LLGL_ASSERT(it != types_.end(), "cannot find SPIR-V OpType* instruction with result ID %%%u", id);
-    return &(it->second);
+    const SpvType* type = types_.Find(id);
+    LLGL_ASSERT(type != nullptr, "cannot find SPIR-V OpType* instruction with result ID %%%u", id);
+    return type;
 }
 
 const SpirvReflect::SpvConstant* SpirvReflect::FindConstant(spv::Id id) const
 {
-    auto it = constants_.find(id);
-    LLGL_ASSERT(it != constants_.end(), "cannot find SPIR-V OpConstant instruction with with result ID %%%u", id);
-    return &(it->second);
+    const SpvConstant* constant = constants_.Find(id);
+    LLGL_ASSERT(constant != nullptr, "cannot find SPIR-V OpConstant instruction with with result ID %%%u", id);
+    return constant;
 }
 
 
@@ -12,7 +12,7 @@
 #include "SpirvIterator.h"
 #include "SpirvModule.h"
 #include <vector>
-#include <map>
+#include <deque>
 
 
 namespace LLGL
@@ -62,6 +62,61 @@ class SpirvNameDecorations
 
 };
 
+// Helper class to map SPIR-V IDs to entries with a flat table that is sized by the module's ID bound.
+template <typename T>
+class SpirvIdTable
+{
+
+    public:
+
+        SpirvIdTable() = default;
+        SpirvIdTable(const SpirvIdTable&) = delete;
+        SpirvIdTable& operator = (const SpirvIdTable&) = delete;
+
+        inline void Reset(std::uint32_t idBound)
+        {
+            entries_.clear();
+            table_.clear();
+            table_.resize(idBound, nullptr);
+        }
+
+        // Returns the entry for the specified ID or null if there is no such entry.
+        inline const T* Find(spv::Id id) const
+        {
+            return (id < table_.size() ? table_[id] : nullptr);
+        }
+
+        // Returns the entry for the specified ID and inserts a new one if there is no such entry. The ID must be less than the ID bound.
+        inline T& FindOrInsert(spv::Id id)
+        {
+            T*& entry = table_[id];
+            if (entry == nullptr)
+            {
+                entries_.emplace_back();
+                entry = &(entries_.back());
+            }
+            return *entry;
+        }
+
+        // Returns the upper bound of all IDs in this table. Use this to iterate over all entries in the order of their IDs.
+        inline std::uint32_t GetIdBound() const
+        {
+            return static_cast<std::uint32_t>(table_.size());
+        }
+
+        // Returns the number of entries in this table.
+        inline std::size_t Size() const
+        {
+            return entries_.size();
+        }
+
+    private:
+
+        std::vector<T*> table_;     // Flat table indexed by SPIR-V ID.
+        std::deque<T>   entries_;   // Entries are stored in a deque to keep their addresses stable while the module is parsed.
+
+};
+
 // SPIR-V shader module parser.
 class SpirvReflect
 {
@@ -97,6 +152,7 @@ class SpirvReflect
             bool                        sign        = false;                // Specifies whether or not this is a signed type (only for OpTypeInt).
             std::vector<const SpvType*> fieldTypes;                         // List of types of each record field.
             std::vector<const char*>    fieldNames;                         // List of names for each record field.
+            std::vector<std::uint32_t>  fieldOffsets;                       // List of byte offsets for each record field (from OpMemberDecorate Offset).
         };
 
         // SPIRV-V scalar constants.
@@ -160,43 +216,54 @@ class SpirvReflect
 
     public:
 
-        // Parse all instructions in the specified SPIR-V module.
+        // Parse all instructions in the specified SPIR-V module with a single pass.
         SpirvResult Reflect(const SpirvModuleView& module);
 
         // Returns the SPIR-V structure type for push constants or null if there is no push_constant block.
         const SpvType* GetPushConstantStructType() const;
 
+        // Returns the push constant block with the names and offsets of its fields. Returns false if there is no push_constant block.
+        bool GetPushConstantBlock(SpvBlock& outBlock) const;
+
     public:
 
         // Returns the container that maps a SPIR-V ID to its type definition.
-        inline const std::map<spv::Id, SpvType>& GetTypes() const
+        inline const SpirvIdTable<SpvType>& GetTypes() const
         {
             return types_;
         }
 
         // Returns the container that maps a SPIR-V ID to its constant definition.
-        inline const std::map<spv::Id, SpvConstant>& GetConstants() const
+        inline const SpirvIdTable<SpvConstant>& GetConstants() const
         {
             return constants_;
         }
 
         // Returns the container that maps a SPIR-V ID to its uniform definition.
-        inline const std::map<spv::Id, SpvUniform>& GetUniforms() const
+        inline const SpirvIdTable<SpvUniform>& GetUniforms() const
         {
             return uniforms_;
         }
 
         // Returns the container that maps a SPIR-V ID to its varying definition.
-        inline const std::map<spv::Id, SpvVarying>& GetVaryings() const
+        inline const SpirvIdTable<SpvVarying>& GetVaryings() const
         {
             return varyings_;
         }
 
+        // Returns the execution modes of the module.
+        inline const SpvExecutionMode& GetExecutionMode() const
+        {
+            return executionMode_;
+        }
+
     private:
 
-        struct SpvMemberNames
+        // Member names and offsets of a structure type, which are declared before the type itself.
+        struct SpvMembers
         {
-            std::vector<const char*> names;
+            std::vector<const char*>    names;
+            std::vector<std::uint32_t>  offsets;
         };
 
     private:
@@ -208,6 +275,9 @@ class SpirvReflect
         SpirvResult OpName(const Instr& instr);
 
         SpirvResult OpMemberName(const Instr& instr);
+        SpirvResult OpMemberDecorate(const Instr& instr);
+
+        SpirvResult OpExecutionMode(const Instr& instr);
 
         SpirvResult OpDecorate(const Instr& instr);
         void OpDecorateBinding(const Instr& instr, spv::Id id);
@@ -242,22 +312,17 @@ class SpirvReflect
         std::uint32_t                       idBound_            = 0;
         SpirvNameDecorations                names_;
 
-        std::map<spv::Id, SpvType>          types_;
-        std::map<spv::Id, SpvConstant>      constants_;
-        std::map<spv::Id, SpvUniform>       uniforms_;
-        std::map<spv::Id, SpvVarying>       varyings_;
-        std::map<spv::Id, SpvMemberNames>   memberNames_;
+        SpirvIdTable<SpvType>               types_;
+        SpirvIdTable<SpvConstant>           constants_;
+        SpirvIdTable<SpvUniform>            uniforms_;
+        SpirvIdTable<SpvVarying>            varyings_;
+        SpirvIdTable<SpvMembers>            members_;
         spv::Id                             pushConstantTypeId_ = 0;
+        SpvExecutionMode                    executionMode_;
 
 };
 
 
-// Reflect the specified SPIR-V module only for the execution mode.
-SpirvResult SpirvReflectExecutionMode(const SpirvModuleView& module, SpirvReflect::SpvExecutionMode& outExecutionMode);
-
-// Reflect the specified SPIR-V module only for push constants.
-SpirvResult SpirvReflectPushConstants(const SpirvModuleView& module, SpirvReflect::SpvBlock& outBlock);
-
 // Reflect the specified SPIR-V module only for binding points (including their descriptor sets).
 SpirvResult SpirvReflectBindingPoints(const SpirvModuleView& module, std::vector<SpirvReflect::SpvBindingPoint>& outBindingPoints);
 
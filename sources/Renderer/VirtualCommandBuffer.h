@@ -11,6 +11,7 @@
 
 #include "../Core/Assertion.h"
 #include "../Core/CoreUtils.h"
+#include "VirtualCommandBufferPool.h"
 #include <cstddef>
 #include <algorithm>
 #include <iterator>
@@ -36,6 +37,7 @@ struct DefaultBufferGrowPolicy
 };
 
 // Container class to manage the memory for virtual command buffers.
+// If a pool is specified, the memory chunks are allocated from and returned to that pool instead of the global heap.
 template <typename TOpcode, typename TGrowPolicy = DefaultBufferGrowPolicy>
 class VirtualCommandBuffer
 {
@@ -139,7 +141,10 @@ class VirtualCommandBuffer
         {
             std::swap(first_, rhs.first_);
             std::swap(current_, rhs.current_);
+            std::swap(biggest_, rhs.biggest_);
+            std::swap(capacity_, rhs.capacity_);
             std::swap(size_, rhs.size_);
+            std::swap(pool_, rhs.pool_);
         }
 
         // Takes the ownership of the specified virtual command buffer memory.
@@ -147,13 +152,17 @@ class VirtualCommandBuffer
         {
             std::swap(first_, rhs.first_);
             std::swap(current_, rhs.current_);
+            std::swap(biggest_, rhs.biggest_);
+            std::swap(capacity_, rhs.capacity_);
             std::swap(size_, rhs.size_);
+            std::swap(pool_, rhs.pool_);
             return *this;
         }
 
-        // Initializes the virtual command buffer with the specified size (in bytes).
-        VirtualCommandBuffer(std::size_t initialCapacity) :
-            initialCapacity_ { std::max(TGrowPolicy::MinChunkCapacity(), initialCapacity) }
+        // Initializes the virtual command buffer with the specified size (in bytes) and optional chunk pool.
+        VirtualCommandBuffer(std::size_t initialCapacity, VirtualCommandBufferPool* pool = nullptr) :
+            initialCapacity_ { std::max(TGrowPolicy::MinChunkCapacity(), initialCapacity) },
+            pool_            { pool                                                       }
         {
         }
 
@@ -181,6 +190,12 @@ class VirtualCommandBuffer
             return (Size() == 0);
         }
 
+        // Returns the pool this virtual command buffer allocates its memory chunks from or null if there is none.
+        VirtualCommandBufferPool* GetPool() const
+        {
+            return pool_;
+        }
+
         // Clears the container but keeps the allocated capacity.
         void Clear()
         {
@@ -193,13 +208,13 @@ class VirtualCommandBuffer
             }
         }
 
-        // Deletes all memory chunks.
+        // Deletes all memory chunks or returns them to the pool.
         void Release()
         {
             for (Chunk* c = first_, *next = nullptr; c != nullptr; c = next)
             {
                 next = c->next;
-                VirtualCommandBuffer::FreeChunk(c);
+                FreeChunk(c);
             }
             first_      = nullptr;
             current_    = nullptr;
@@ -238,6 +253,12 @@ class VirtualCommandBuffer
             return reinterpret_cast<TCommand*>(AllocAlignedDataWithOpcode(opcode, sizeof(TCommand) + payloadSize, alignof(TCommand)));
         }
 
+        // Allocates a new command with the specified opcode, size (in bytes), and alignment. This is used to copy commands of unknown type.
+        void* AllocCommandData(const TOpcode opcode, std::size_t size, std::size_t alignment)
+        {
+            return AllocAlignedDataWithOpcode(opcode, size, alignment);
+        }
+
         // Runs the input function over every command in this virtual command buffer.
         // The function callback must return the size (in bytes) of the command being processed.
         template <typename Functor, typename... TArgs>
@@ -267,9 +288,18 @@ class VirtualCommandBuffer
     private:
 
         // Allocates a new memory chunk of the specified capacity plus sizeof(Chunk).
-        static Chunk* AllocChunk(std::size_t capacity, Chunk* next = nullptr)
+        // If the chunk is allocated from the pool, its capacity might be greater than requested.
+        Chunk* AllocChunk(std::size_t capacity, Chunk* next = nullptr)
         {
-            Chunk* chunk = reinterpret_cast<Chunk*>(::new char[sizeof(Chunk) + capacity]);
+            Chunk* chunk = nullptr;
+            if (pool_ != nullptr)
+            {
+                std::size_t size = sizeof(Chunk) + capacity;
+                chunk = reinterpret_cast<Chunk*>(pool_->AllocChunk(size));
+                capacity = size - sizeof(Chunk);
+            }
+            else
+                chunk = reinterpret_cast<Chunk*>(::new char[sizeof(Chunk) + capacity]);
             {
                 chunk->capacity = capacity;
                 chunk->size     = 0;
@@ -278,13 +308,18 @@ class VirtualCommandBuffer
             return chunk;
         }
 
-        // Deletes the specified memory chunk.
-        static void FreeChunk(Chunk* chunk)
+        // Deletes the specified memory chunk or returns it to the pool.
+        void FreeChunk(Chunk* chunk)
         {
             if (chunk != nullptr)
             {
-                char* buf = reinterpret_cast<char*>(chunk);
-                delete [] buf;
+                if (pool_ != nullptr)
+                    pool_->FreeChunk(chunk, sizeof(Chunk) + chunk->capacity);
+                else
+                {
+                    char* buf = reinterpret_cast<char*>(chunk);
+                    delete [] buf;
+                }
             }
         }
 
@@ -337,10 +372,10 @@ class VirtualCommandBuffer
         // Allocates a new chunk and makes it the current one.
         void AllocNextChunkAndMakeCurrent(std::size_t capacity, Chunk* next = nullptr)
         {
-            current_->next = VirtualCommandBuffer::AllocChunk(capacity, next);
+            current_->next = AllocChunk(capacity, next);
             current_ = current_->next;
-            capacity_ += capacity;
-            if (biggest_ == nullptr || capacity > biggest_->capacity)
+            capacity_ += current_->capacity;
+            if (biggest_ == nullptr || current_->capacity > biggest_->capacity)
                 biggest_ = current_;
         }
 
@@ -364,7 +399,8 @@ class VirtualCommandBuffer
                         Chunk* secondNext = current_->next->next;
                         if (biggest_ == current_->next)
                             biggest_ = secondNext;
-                        VirtualCommandBuffer::FreeChunk(current_->next);
+                        capacity_ -= current_->next->capacity;
+                        FreeChunk(current_->next);
                         AllocNextChunkAndMakeCurrent(capacity, secondNext);
                     }
                 }
@@ -377,10 +413,10 @@ class VirtualCommandBuffer
             else
             {
                 /* Allocate first chunk */
-                first_      = VirtualCommandBuffer::AllocChunk(capacity);
+                first_      = AllocChunk(capacity);
                 current_    = first_;
                 biggest_    = first_;
-                capacity_   = capacity;
+                capacity_   = first_->capacity;
             }
         }
 
@@ -485,7 +521,7 @@ class VirtualCommandBuffer
                     ::memcpy(VirtualCommandBuffer::GetChunkData(chunk) + offset, VirtualCommandBuffer::GetChunkData(c), c->size);
                     offset += c->size;
                     next = c->next;
-                    VirtualCommandBuffer::FreeChunk(c);
+                    FreeChunk(c);
                 }
                 else
                 {
@@ -506,7 +542,7 @@ class VirtualCommandBuffer
         void PackNew()
         {
             /* Allocate new chunk */
-            Chunk* chunk = VirtualCommandBuffer::AllocChunk(size_);
+            Chunk* chunk = AllocChunk(size_);
 
             /* Copy all chunks into new chunk and free old chunks */
             for (Chunk* c = first_, *next = nullptr; c != nullptr; c = next)
@@ -517,7 +553,7 @@ class VirtualCommandBuffer
 
                 /* Delete old chunk and move to next one */
                 next = c->next;
-                VirtualCommandBuffer::FreeChunk(c);
+                FreeChunk(c);
             }
 
             /* Clean up references */
@@ -529,12 +565,13 @@ class VirtualCommandBuffer
 
     private:
 
-        Chunk*      first_              = nullptr;
-        Chunk*      current_            = nullptr;
-        Chunk*      biggest_            = nullptr; // Keep track of biggest chunk for packing
-        std::size_t capacity_           = 0;
-        std::size_t size_               = 0;
-        std::size_t initialCapacity_    = TGrowPolicy::MinChunkCapacity();
+        Chunk*                      first_              = nullptr;
+        Chunk*                      current_            = nullptr;
+        Chunk*                      biggest_            = nullptr; // Keep track of biggest chunk for packing
+        std::size_t                 capacity_           = 0;
+        std::size_t                 size_               = 0;
+        std::size_t                 initialCapacity_    = TGrowPolicy::MinChunkCapacity();
+        VirtualCommandBufferPool*   pool_               = nullptr; // Optional pool to recycle memory chunks
 
 };
 
@@ -0,0 +1,162 @@
+/*
+ * VirtualCommandBufferPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VirtualCommandBufferPool.h"
+#include <LLGL/Utils/ForRange.h>
+#include <new>
+
+
+namespace LLGL
+{
+
+
+VirtualCommandBufferPool::VirtualCommandBufferPool() :
+    allocatedSize_ { 0 },
+    pooledSize_    { 0 }
+{
+    for (std::atomic<TaggedHead>& freeList : freeLists_)
+        freeList.store(0, std::memory_order_relaxed);
+}
+
+VirtualCommandBufferPool::~VirtualCommandBufferPool()
+{
+    Trim();
+}
+
+static std::size_t GetSizeClassCapacity(std::size_t sizeClass)
+{
+    return (static_cast<std::size_t>(1) << (VirtualCommandBufferPool::minChunkSizeLog2 + sizeClass));
+}
+
+/*
+Number of bits for the chunk pointer in a tagged freelist head. On 64-bit platforms, user-space addresses occupy at most 48 bits,
+which leaves 16 bits for the version tag. On 32-bit platforms, the entire upper half is available for the version tag.
+*/
+static constexpr unsigned g_taggedHeadPointerBits = (sizeof(void*) == 4 ? 32u : 48u);
+static constexpr std::uint64_t g_taggedHeadPointerMask = ((std::uint64_t(1) << g_taggedHeadPointerBits) - 1);
+
+void* VirtualCommandBufferPool::AllocChunk(std::size_t& size)
+{
+    const std::size_t sizeClass = VirtualCommandBufferPool::GetSizeClass(size);
+    if (sizeClass < numSizeClasses)
+    {
+        size = GetSizeClassCapacity(sizeClass);
+
+        /* Try to recycle a chunk from the freelist first */
+        if (FreeChunkHeader* chunk = PopFreeList(sizeClass))
+        {
+            pooledSize_.fetch_sub(size, std::memory_order_relaxed);
+            return chunk;
+        }
+    }
+
+    /* Allocate new chunk from the global heap */
+    void* chunk = ::operator new(size);
+    allocatedSize_.fetch_add(size, std::memory_order_relaxed);
+    return chunk;
+}
+
+void VirtualCommandBufferPool::FreeChunk(void* chunk, std::size_t size)
+{
+    if (chunk == nullptr)
+        return;
+
+    const std::size_t sizeClass = VirtualCommandBufferPool::GetSizeClass(size);
+    if (sizeClass < numSizeClasses && size == GetSizeClassCapacity(sizeClass) && VirtualCommandBufferPool::IsTaggableChunk(chunk))
+    {
+        /* Return chunk to the freelist */
+        FreeChunkHeader* header = reinterpret_cast<FreeChunkHeader*>(chunk);
+        PushFreeList(sizeClass, header, header);
+        pooledSize_.fetch_add(size, std::memory_order_relaxed);
+    }
+    else
+    {
+        /* Free oversized chunk or chunk that cannot be linked into a freelist immediately */
+        ::operator delete(chunk);
+        allocatedSize_.fetch_sub(size, std::memory_order_relaxed);
+    }
+}
+
+void VirtualCommandBufferPool::Trim()
+{
+    for_range(sizeClass, numSizeClasses)
+    {
+        const std::size_t size = GetSizeClassCapacity(sizeClass);
+        for (FreeChunkHeader* chunk = GetHeadChunk(freeLists_[sizeClass].exchange(0, std::memory_order_acquire)), *next = nullptr; chunk != nullptr; chunk = next)
+        {
+            next = chunk->next;
+            ::operator delete(chunk);
+            pooledSize_.fetch_sub(size, std::memory_order_relaxed);
+            allocatedSize_.fetch_sub(size, std::memory_order_relaxed);
+        }
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+std::size_t VirtualCommandBufferPool::GetSizeClass(std::size_t size)
+{
+    std::size_t sizeClass = 0;
+    while (sizeClass < numSizeClasses && GetSizeClassCapacity(sizeClass) < size)
+        ++sizeClass;
+    return sizeClass;
+}
+
+bool VirtualCommandBufferPool::IsTaggableChunk(const void* chunk)
+{
+    return ((static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(chunk)) & ~g_taggedHeadPointerMask) == 0);
+}
+
+VirtualCommandBufferPool::FreeChunkHeader* VirtualCommandBufferPool::GetHeadChunk(TaggedHead head)
+{
+    return reinterpret_cast<FreeChunkHeader*>(static_cast<std::uintptr_t>(head & g_taggedHeadPointerMask));
+}
+
+VirtualCommandBufferPool::TaggedHead VirtualCommandBufferPool::MakeTaggedHead(FreeChunkHeader* chunk, TaggedHead prevHead)
+{
+    const TaggedHead tag = ((prevHead >> g_taggedHeadPointerBits) + 1) << g_taggedHeadPointerBits;
+    return (tag | static_cast<TaggedHead>(reinterpret_cast<std::uintptr_t>(chunk)));
+}
+
+void VirtualCommandBufferPool::PushFreeList(std::size_t sizeClass, FreeChunkHeader* first, FreeChunkHeader* last)
+{
+    std::atomic<TaggedHead>& freeList = freeLists_[sizeClass];
+    TaggedHead head = freeList.load(std::memory_order_relaxed);
+    do
+    {
+        last->next = GetHeadChunk(head);
+    }
+    while (!freeList.compare_exchange_weak(head, MakeTaggedHead(first, head), std::memory_order_release, std::memory_order_relaxed));
+}
+
+VirtualCommandBufferPool::FreeChunkHeader* VirtualCommandBufferPool::PopFreeList(std::size_t sizeClass)
+{
+    std::atomic<TaggedHead>& freeList = freeLists_[sizeClass];
+    TaggedHead head = freeList.load(std::memory_order_acquire);
+    while (FreeChunkHeader* first = GetHeadChunk(head))
+    {
+        /*
+        If another thread pops this chunk in the meantime, its 'next' field can be stale or overwritten,
+        but the version tag of the head has changed as well, so the CAS fails and we retry with the new head.
+        The chunk memory itself remains valid, since pooled chunks are only freed by Trim().
+        */
+        FreeChunkHeader* next = first->next;
+        if (freeList.compare_exchange_weak(head, MakeTaggedHead(next, head), std::memory_order_acquire, std::memory_order_acquire))
+            return first;
+    }
+    return nullptr;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
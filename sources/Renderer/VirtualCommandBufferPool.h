@@ -0,0 +1,122 @@
+/*
+ * VirtualCommandBufferPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VIRTUAL_COMMAND_BUFFER_POOL_H
+#define LLGL_VIRTUAL_COMMAND_BUFFER_POOL_H
+
+
+#include <LLGL/Export.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Thread-safe memory pool for the chunks of virtual command buffers.
+Released chunks are kept in lock-free freelists (one per power-of-two size class) and recycled by subsequent allocations,
+so transient command buffers don't have to go through the global heap allocator every time they grow or get destroyed.
+Chunks that are bigger than the largest size class are allocated and freed directly.
+Each freelist head is a pointer packed with a version tag that is incremented with every push and pop,
+so a single chunk can be popped with one CAS without running into the ABA problem.
+*/
+class LLGL_EXPORT VirtualCommandBufferPool
+{
+
+    public:
+
+        VirtualCommandBufferPool();
+
+        VirtualCommandBufferPool(const VirtualCommandBufferPool&) = delete;
+        VirtualCommandBufferPool& operator = (const VirtualCommandBufferPool&) = delete;
+
+        // Frees all pooled chunks. All chunks allocated by this pool must have been returned at this point.
+        ~VirtualCommandBufferPool();
+
+        /*
+        Allocates a memory chunk of at least the specified size (in bytes).
+        The size is rounded up to the respective size class and the actual capacity of the chunk is returned in 'size'.
+        */
+        void* AllocChunk(std::size_t& size);
+
+        // Returns the specified memory chunk to this pool. The size must be the one that was returned by AllocChunk.
+        void FreeChunk(void* chunk, std::size_t size);
+
+        // Frees all chunks that are currently in the freelists. This must not be called concurrently with AllocChunk.
+        void Trim();
+
+        // Returns the number of bytes that are currently allocated by this pool, including the pooled chunks.
+        std::size_t GetAllocatedSize() const
+        {
+            return allocatedSize_.load(std::memory_order_relaxed);
+        }
+
+        // Returns the number of bytes that are currently held in the freelists and ready to be recycled.
+        std::size_t GetPooledSize() const
+        {
+            return pooledSize_.load(std::memory_order_relaxed);
+        }
+
+    public:
+
+        // Capacity of the smallest size class (8 KB).
+        static constexpr std::size_t minChunkSizeLog2   = 13;
+
+        // Number of size classes, i.e. the biggest pooled chunk has a capacity of 8 KB * 2^11 = 16 MB.
+        static constexpr std::size_t numSizeClasses     = 12;
+
+    private:
+
+        // Freelist head: chunk pointer in the lower bits and version tag in the upper bits.
+        using TaggedHead = std::uint64_t;
+
+        // Header of pooled chunks. This is placed at the beginning of a free chunk to link it into the freelist.
+        struct FreeChunkHeader
+        {
+            FreeChunkHeader* next;
+        };
+
+    private:
+
+        // Returns the size class index for the specified size or numSizeClasses if the size is too big to be pooled.
+        static std::size_t GetSizeClass(std::size_t size);
+
+        // Returns true if the specified chunk address can be packed into a tagged freelist head.
+        static bool IsTaggableChunk(const void* chunk);
+
+        // Returns the chunk pointer of the specified tagged freelist head.
+        static FreeChunkHeader* GetHeadChunk(TaggedHead head);
+
+        // Returns a new tagged freelist head for the specified chunk with the version tag of the previous head incremented by one.
+        static TaggedHead MakeTaggedHead(FreeChunkHeader* chunk, TaggedHead prevHead);
+
+        // Pushes the specified list of free chunks onto a freelist.
+        void PushFreeList(std::size_t sizeClass, FreeChunkHeader* first, FreeChunkHeader* last);
+
+        // Pops a single chunk from the specified freelist or returns null if the freelist is empty.
+        FreeChunkHeader* PopFreeList(std::size_t sizeClass);
+
+    private:
+
+        std::atomic<TaggedHead>         freeLists_[numSizeClasses];
+        std::atomic<std::size_t>        allocatedSize_;
+        std::atomic<std::size_t>        pooledSize_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
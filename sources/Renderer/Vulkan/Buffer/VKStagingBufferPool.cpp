@@ -0,0 +1,419 @@
+/*
+ * VKStagingBufferPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKStagingBufferPool.h"
+#include "../VKDevice.h"
+#include "../VKCore.h"
+#include "../VKInitializers.h"
+#include "../Memory/VKDeviceMemoryRegion.h"
+#include "../Memory/VKDeviceMemoryManager.h"
+#include "../Texture/VKTexture.h"
+#include "../../../Core/CoreUtils.h"
+#include "../../../Core/Assertion.h"
+#include <LLGL/TextureFlags.h>
+#include <LLGL/RenderingDebugger.h>
+#include <LLGL/Utils/ForRange.h>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+VKStagingBufferPool::VKStagingBufferPool(
+    VKDevice&                               device,
+    VKDeviceMemoryManager&                  deviceMemoryMngr,
+    const VkPhysicalDeviceMemoryProperties& memoryProperties,
+    VkDeviceSize                            ringSize,
+    RenderingDebugger*                      debugger)
+:
+    device_             { device                                 },
+    deviceMemoryMngr_   { deviceMemoryMngr                       },
+    debugger_           { debugger                               },
+    ringBuffer_         { device                                 },
+    commandPool_        { device.CreateCommandPool()             },
+    frameFences_        { VKPtr<VkFence>{ device, vkDestroyFence },
+                          VKPtr<VkFence>{ device, vkDestroyFence },
+                          VKPtr<VkFence>{ device, vkDestroyFence } }
+{
+    CreateRingBuffer(memoryProperties, ringSize);
+    CreateTransferFrames();
+}
+
+VKStagingBufferPool::~VKStagingBufferPool()
+{
+    /* Wait for all transfer frames that are still in flight */
+    while (numFramesInFlight_ > 0)
+        WaitForOldestFrame();
+
+    /* Resources that were released after the last submission can be destroyed right away, since the render system waits for the device to be idle first */
+    DestroyReleasedResources(frames_[currentFrame_]);
+
+    /* Unmap ring buffer memory; command buffers are released together with their command pool */
+    if (ringMappedData_ != nullptr)
+        ringMemory_->Unmap(device_);
+}
+
+bool VKStagingBufferPool::WriteBuffer(
+    VkBuffer        dstBuffer,
+    VkDeviceSize    dstOffset,
+    const void*     data,
+    VkDeviceSize    dataSize)
+{
+    /* Copy data into staging ring */
+    VkDeviceSize srcOffset = 0;
+    if (!AllocRingRegion(dataSize, 4, srcOffset))
+        return false;
+
+    ::memcpy(ringMappedData_ + srcOffset, data, static_cast<std::size_t>(dataSize));
+
+    /* Record copy command into current transfer frame */
+    BeginTransferFrame();
+    {
+        VkBufferCopy region;
+        {
+            region.srcOffset    = srcOffset;
+            region.dstOffset    = dstOffset;
+            region.size         = dataSize;
+        }
+        vkCmdCopyBuffer(frames_[currentFrame_].commandBuffer, ringBuffer_.GetVkBuffer(), dstBuffer, 1, &region);
+    }
+
+    return true;
+}
+
+bool VKStagingBufferPool::WriteTexture(
+    VKTexture&              dstTexture,
+    const TextureRegion&    textureRegion,
+    const void*             data,
+    VkDeviceSize            dataSize,
+    VkDeviceSize            alignment)
+{
+    /* Copy image data into staging ring */
+    VkDeviceSize srcOffset = 0;
+    if (!AllocRingRegion(dataSize, alignment, srcOffset))
+        return false;
+
+    ::memcpy(ringMappedData_ + srcOffset, data, static_cast<std::size_t>(dataSize));
+
+    /* Record copy command into current transfer frame and restore previous image layout afterwards */
+    BeginTransferFrame();
+    {
+        const Offset3D&             offset      = textureRegion.offset;
+        const Extent3D&             extent      = textureRegion.extent;
+        const TextureSubresource&   subresource = textureRegion.subresource;
+
+        VkImageLayout oldLayout = dstTexture.TransitionImageLayout(context_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, subresource, true);
+
+        context_.CopyBufferToImage(
+            ringBuffer_.GetVkBuffer(),
+            dstTexture.GetVkImage(),
+            dstTexture.GetVkFormat(),
+            VkOffset3D{ offset.x, offset.y, offset.z },
+            VkExtent3D{ extent.width, extent.height, extent.depth },
+            subresource,
+            srcOffset
+        );
+
+        dstTexture.TransitionImageLayout(context_, oldLayout, subresource, true);
+    }
+
+    return true;
+}
+
+void VKStagingBufferPool::ReleaseDeviceBuffer(VKDeviceBuffer&& deviceBuffer)
+{
+    frames_[currentFrame_].releasedBuffers.push_back(std::move(deviceBuffer));
+}
+
+void VKStagingBufferPool::ReleaseDeviceImage(VKDeviceImage&& deviceImage, VKPtr<VkImageView>&& imageView)
+{
+    TransferFrame& frame = frames_[currentFrame_];
+    frame.releasedImages.push_back(std::move(deviceImage));
+    if (imageView.Get() != VK_NULL_HANDLE)
+        frame.releasedImageViews.push_back(std::move(imageView));
+}
+
+void VKStagingBufferPool::Flush()
+{
+    /* Reclaim completed frames first, so released resources are not held longer than necessary */
+    RecycleCompletedFrames();
+
+    TransferFrame& frame = frames_[currentFrame_];
+    if (frame.isRecording)
+    {
+        /* Make transfer writes visible to all commands that are submitted after this batch */
+        VkMemoryBarrier barrier;
+        {
+            barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            barrier.pNext           = nullptr;
+            barrier.srcAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask   = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+        }
+        vkCmdPipelineBarrier(
+            frame.commandBuffer,
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+            0,
+            1, &barrier,
+            0, nullptr,
+            0, nullptr
+        );
+
+        VkResult result = vkEndCommandBuffer(frame.commandBuffer);
+        VKThrowIfFailed(result, "failed to end recording Vulkan transfer command buffer");
+    }
+    else if (!frame.HasReleasedResources())
+    {
+        /* Nothing to submit */
+        return;
+    }
+
+    /*
+    Submit transfer batch with the fence of this frame.
+    Without pending transfers, submit the fence alone, which is signaled once all previously submitted commands have completed.
+    */
+    VkSubmitInfo submitInfo = {};
+    {
+        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount   = 1;
+        submitInfo.pCommandBuffers      = &(frame.commandBuffer);
+    }
+    const std::uint32_t numSubmits = (frame.isRecording ? 1 : 0);
+    VkResult result = vkQueueSubmit(device_.GetVkQueue(), numSubmits, &submitInfo, frameFences_[currentFrame_].Get());
+    VKThrowIfFailed(result, "failed to submit Vulkan transfer command buffer");
+
+    frame.isRecording   = false;
+    frame.isInFlight    = true;
+    ++numFramesInFlight_;
+    ++numSubmissions_;
+
+    if (debugger_ != nullptr)
+    {
+        FrameProfile profile;
+        profile.commandQueueRecord.transferSubmissions = 1;
+        debugger_->RecordProfile(profile);
+    }
+
+    /* Move to next frame and wait until it's available again */
+    currentFrame_ = (currentFrame_ + 1) % maxNumFrames;
+    if (frames_[currentFrame_].isInFlight)
+        WaitForOldestFrame();
+}
+
+void VKStagingBufferPool::FlushAndWait()
+{
+    Flush();
+    while (numFramesInFlight_ > 0)
+        WaitForOldestFrame();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void VKStagingBufferPool::CreateRingBuffer(const VkPhysicalDeviceMemoryProperties& memoryProperties, VkDeviceSize ringSize)
+{
+    /* Create ring buffer object */
+    VkBufferCreateInfo createInfo;
+    BuildVkBufferCreateInfo(createInfo, ringSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    ringBuffer_.CreateVkBuffer(device_, createInfo);
+
+    /*
+    Allocate dedicated host memory for the ring buffer, so it can stay mapped
+    without interfering with other staging buffers that share device memory chunks
+    */
+    const VkMemoryRequirements& requirements = ringBuffer_.GetRequirements();
+    const std::uint32_t memoryTypeIndex = VKFindMemoryType(
+        memoryProperties,
+        requirements.memoryTypeBits,
+        (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
+    );
+    ringMemory_ = MakeUnique<VKDeviceMemory>(device_, requirements.size, memoryTypeIndex);
+
+    VKDeviceMemoryRegion* region = ringMemory_->Allocate(requirements.size, requirements.alignment);
+    LLGL_ASSERT_PTR(region);
+    ringBuffer_.BindMemoryRegion(device_, region);
+
+    /* Map entire ring buffer persistently */
+    ringMappedData_ = static_cast<char*>(ringMemory_->Map(device_, region->GetOffset(), ringSize));
+    ringSize_       = ringSize;
+}
+
+void VKStagingBufferPool::CreateTransferFrames()
+{
+    /* Allocate one primary command buffer per transfer frame */
+    VkCommandBuffer commandBuffers[maxNumFrames];
+
+    VkCommandBufferAllocateInfo allocInfo;
+    {
+        allocInfo.sType                 = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.pNext                 = nullptr;
+        allocInfo.commandPool           = commandPool_;
+        allocInfo.level                 = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount    = maxNumFrames;
+    }
+    VkResult result = vkAllocateCommandBuffers(device_, &allocInfo, commandBuffers);
+    VKThrowIfFailed(result, "failed to allocate Vulkan transfer command buffers");
+
+    /* Create fences in unsignaled state; they are only waited on for frames in flight */
+    VkFenceCreateInfo createInfo;
+    {
+        createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        createInfo.pNext = nullptr;
+        createInfo.flags = 0;
+    }
+
+    for_range(i, maxNumFrames)
+    {
+        frames_[i].commandBuffer = commandBuffers[i];
+        result = vkCreateFence(device_, &createInfo, nullptr, frameFences_[i].ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan fence");
+    }
+}
+
+bool VKStagingBufferPool::AllocRingRegion(VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize& outOffset)
+{
+    if (size == 0 || size > ringSize_)
+        return false;
+
+    for (;;)
+    {
+        /* Place region at the aligned head or wrap around to the beginning if it does not fit at the end */
+        VkDeviceSize offset = GetAlignedSize(ringHead_, alignment);
+        VkDeviceSize padding = offset - ringHead_;
+
+        if (offset + size > ringSize_)
+        {
+            offset  = 0;
+            padding = ringSize_ - ringHead_;
+        }
+
+        if (ringUsage_ + padding + size <= ringSize_)
+        {
+            ringHead_   = offset + size;
+            ringUsage_ += padding + size;
+            frames_[currentFrame_].ringUsage += padding + size;
+            outOffset = offset;
+            return true;
+        }
+
+        /* Ring is full: submit pending transfers and reclaim memory of the oldest frame */
+        if (numFramesInFlight_ == 0)
+            Flush();
+        if (numFramesInFlight_ > 0)
+            WaitForOldestFrame();
+    }
+}
+
+void VKStagingBufferPool::BeginTransferFrame()
+{
+    TransferFrame& frame = frames_[currentFrame_];
+    if (frame.isRecording)
+        return;
+
+    /* Begin recording; this implicitly resets the command buffer since the pool was created with VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT */
+    VkCommandBufferBeginInfo beginInfo;
+    {
+        beginInfo.sType             = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.pNext             = nullptr;
+        beginInfo.flags             = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        beginInfo.pInheritanceInfo  = nullptr;
+    }
+    VkResult result = vkBeginCommandBuffer(frame.commandBuffer, &beginInfo);
+    VKThrowIfFailed(result, "failed to begin recording Vulkan transfer command buffer");
+
+    context_.Reset(frame.commandBuffer);
+
+    /* Don't overwrite resources before all previously submitted commands are done with them */
+    VkMemoryBarrier barrier;
+    {
+        barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.pNext           = nullptr;
+        barrier.srcAccessMask   = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+        barrier.dstAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+    }
+    vkCmdPipelineBarrier(
+        frame.commandBuffer,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        0,
+        1, &barrier,
+        0, nullptr,
+        0, nullptr
+    );
+
+    frame.isRecording = true;
+}
+
+void VKStagingBufferPool::WaitForOldestFrame()
+{
+    LLGL_ASSERT(numFramesInFlight_ > 0);
+
+    const std::uint32_t oldestFrame = (currentFrame_ + maxNumFrames - numFramesInFlight_) % maxNumFrames;
+
+    VkFence fence = frameFences_[oldestFrame].Get();
+    vkWaitForFences(device_, 1, &fence, VK_TRUE, UINT64_MAX);
+
+    ReclaimOldestFrame();
+}
+
+void VKStagingBufferPool::RecycleCompletedFrames()
+{
+    /* Frames complete in submission order, so stop at the first fence that has not been signaled yet */
+    while (numFramesInFlight_ > 0)
+    {
+        const std::uint32_t oldestFrame = (currentFrame_ + maxNumFrames - numFramesInFlight_) % maxNumFrames;
+        if (vkGetFenceStatus(device_, frameFences_[oldestFrame].Get()) != VK_SUCCESS)
+            break;
+        ReclaimOldestFrame();
+    }
+}
+
+void VKStagingBufferPool::ReclaimOldestFrame()
+{
+    const std::uint32_t oldestFrame = (currentFrame_ + maxNumFrames - numFramesInFlight_) % maxNumFrames;
+    TransferFrame& frame = frames_[oldestFrame];
+
+    /* Reset fence for the next submission of this frame */
+    VkFence fence = frameFences_[oldestFrame].Get();
+    vkResetFences(device_, 1, &fence);
+
+    /* Reclaim ring memory of this frame and destroy all resources that were released with it */
+    ringUsage_     -= frame.ringUsage;
+    frame.ringUsage = 0;
+    frame.isInFlight = false;
+    --numFramesInFlight_;
+
+    DestroyReleasedResources(frame);
+
+    if (ringUsage_ == 0)
+        ringHead_ = 0;
+}
+
+void VKStagingBufferPool::DestroyReleasedResources(TransferFrame& frame)
+{
+    /* Destroy image views before their images */
+    frame.releasedImageViews.clear();
+
+    /* Release device memory regions, then destroy native objects */
+    for (VKDeviceImage& deviceImage : frame.releasedImages)
+        deviceImage.ReleaseMemoryRegion(deviceMemoryMngr_);
+    frame.releasedImages.clear();
+
+    for (VKDeviceBuffer& deviceBuffer : frame.releasedBuffers)
+        deviceBuffer.ReleaseMemoryRegion(deviceMemoryMngr_);
+    frame.releasedBuffers.clear();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
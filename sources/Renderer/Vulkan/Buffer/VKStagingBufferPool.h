@@ -0,0 +1,175 @@
+/*
+ * VKStagingBufferPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_STAGING_BUFFER_POOL_H
+#define LLGL_VK_STAGING_BUFFER_POOL_H
+
+
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include "../Command/VKCommandContext.h"
+#include "../Memory/VKDeviceMemory.h"
+#include "../Texture/VKDeviceImage.h"
+#include "VKDeviceBuffer.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class VKDevice;
+class VKDeviceMemoryManager;
+class VKTexture;
+class RenderingDebugger;
+struct TextureRegion;
+
+/*
+Staging ring buffer with a batch of transfer commands.
+All writes are copied into a persistently mapped ring buffer and the respective copy commands are recorded into a single command buffer.
+That command buffer is submitted once per call to Flush() with its own fence, so writes don't block on the GPU.
+Ring memory of a transfer batch is reclaimed once the fence of that batch has been signaled.
+Released resources are attached to the next transfer batch and destroyed once its fence has been signaled,
+since that fence also covers all command buffers that were submitted before.
+*/
+class VKStagingBufferPool
+{
+
+    public:
+
+        VKStagingBufferPool(
+            VKDevice&                               device,
+            VKDeviceMemoryManager&                  deviceMemoryMngr,
+            const VkPhysicalDeviceMemoryProperties& memoryProperties,
+            VkDeviceSize                            ringSize,
+            RenderingDebugger*                      debugger            = nullptr
+        );
+        ~VKStagingBufferPool();
+
+        VKStagingBufferPool(const VKStagingBufferPool&) = delete;
+        VKStagingBufferPool& operator = (const VKStagingBufferPool&) = delete;
+
+        // Writes the specified data into the staging ring and records a copy command into the destination buffer. Returns false if the data exceeds the ring size.
+        bool WriteBuffer(
+            VkBuffer        dstBuffer,
+            VkDeviceSize    dstOffset,
+            const void*     data,
+            VkDeviceSize    dataSize
+        );
+
+        // Writes the specified image data into the staging ring and records a copy command into the destination texture region. Returns false if the data exceeds the ring size.
+        bool WriteTexture(
+            VKTexture&              dstTexture,
+            const TextureRegion&    textureRegion,
+            const void*             data,
+            VkDeviceSize            dataSize,
+            VkDeviceSize            alignment
+        );
+
+        // Defers the release of the specified buffer and its device memory until all previously submitted commands have completed.
+        void ReleaseDeviceBuffer(VKDeviceBuffer&& deviceBuffer);
+
+        // Defers the release of the specified image, its primary view, and its device memory until all previously submitted commands have completed.
+        void ReleaseDeviceImage(VKDeviceImage&& deviceImage, VKPtr<VkImageView>&& imageView);
+
+        // Submits all pending transfer commands and released resources with a single queue submission. This does not wait for the GPU.
+        void Flush();
+
+        // Submits all pending transfer commands and waits until all transfer frames have completed.
+        void FlushAndWait();
+
+        // Returns true if there are transfer commands that have not been submitted yet.
+        inline bool HasPendingTransfers() const
+        {
+            return frames_[currentFrame_].isRecording;
+        }
+
+        // Returns the number of queue submissions this pool has issued so far.
+        inline std::uint64_t GetNumSubmissions() const
+        {
+            return numSubmissions_;
+        }
+
+    private:
+
+        static constexpr std::uint32_t maxNumFrames = 3;
+
+        struct TransferFrame
+        {
+            inline bool HasReleasedResources() const
+            {
+                return !(releasedBuffers.empty() && releasedImages.empty());
+            }
+
+            VkCommandBuffer                 commandBuffer   = VK_NULL_HANDLE;
+            bool                            isRecording     = false;
+            bool                            isInFlight      = false;
+            VkDeviceSize                    ringUsage       = 0;
+            std::vector<VKDeviceBuffer>     releasedBuffers;
+            std::vector<VKDeviceImage>      releasedImages;
+            std::vector<VKPtr<VkImageView>> releasedImageViews;
+        };
+
+    private:
+
+        void CreateRingBuffer(const VkPhysicalDeviceMemoryProperties& memoryProperties, VkDeviceSize ringSize);
+        void CreateTransferFrames();
+
+        // Allocates a region within the staging ring and returns false if the size exceeds the ring.
+        bool AllocRingRegion(VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize& outOffset);
+
+        // Begins recording the current transfer frame if it has not been started yet.
+        void BeginTransferFrame();
+
+        // Waits for the oldest frame in flight and reclaims its ring memory.
+        void WaitForOldestFrame();
+
+        // Reclaims all frames in flight whose fences have already been signaled without waiting for the GPU.
+        void RecycleCompletedFrames();
+
+        // Reclaims ring memory and destroys released resources of the oldest frame in flight. Its fence must have been signaled.
+        void ReclaimOldestFrame();
+
+        // Destroys all resources that have been released with the specified frame.
+        void DestroyReleasedResources(TransferFrame& frame);
+
+    private:
+
+        VKDevice&                       device_;
+        VKDeviceMemoryManager&          deviceMemoryMngr_;
+        RenderingDebugger*              debugger_                       = nullptr;
+
+        std::unique_ptr<VKDeviceMemory> ringMemory_;
+        VKDeviceBuffer                  ringBuffer_;
+        char*                           ringMappedData_                 = nullptr;
+        VkDeviceSize                    ringSize_                       = 0;
+        VkDeviceSize                    ringHead_                       = 0;
+        VkDeviceSize                    ringUsage_                      = 0;
+
+        VKPtr<VkCommandPool>            commandPool_;
+        VKCommandContext                context_;
+
+        VKPtr<VkFence>                  frameFences_[maxNumFrames];
+        TransferFrame                   frames_[maxNumFrames];
+        std::uint32_t                   currentFrame_                   = 0;
+        std::uint32_t                   numFramesInFlight_              = 0;
+
+        std::uint64_t                   numSubmissions_                 = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -7,6 +7,7 @@
 
 #include "VKCommandBuffer.h"
 #include "VKCommandQueue.h"
+#include "../VKDevice.h"
 #include "../VKPhysicalDevice.h"
 #include "../VKSwapChain.h"
 #include "../VKTypes.h"
@@ -29,6 +30,8 @@
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Constants.h>
 #include <LLGL/TypeInfo.h>
+#include <LLGL/RenderingDebugger.h>
+#include <LLGL/Timer.h>
 #include <cstddef>
 
 #include <LLGL/Backend/Vulkan/NativeHandle.h>
@@ -38,8 +41,6 @@ namespace LLGL
 {
 
 
-constexpr std::uint32_t VKCommandBuffer::maxNumCommandBuffers;
-
 // Returns the maximum for a indirect multi draw command
 static std::uint32_t GetMaxDrawIndirectCount(const VKPhysicalDevice& physicalDevice)
 {
@@ -52,24 +53,20 @@ static std::uint32_t GetMaxDrawIndirectCount(const VKPhysicalDevice& physicalDev
 VKCommandBuffer::VKCommandBuffer(
     const VKPhysicalDevice&         physicalDevice,
     VkDevice                        device,
-    VkQueue                         commandQueue,
+    VKCommandQueue&                 commandQueue,
     const VKQueueFamilyIndices&     queueFamilyIndices,
-    const CommandBufferDescriptor&  desc)
+    const CommandBufferDescriptor&  desc,
+    RenderingDebugger*              debugger)
 :
     device_                 { device                                        },
+    debugger_               { debugger                                      },
     commandQueue_           { commandQueue                                  },
-    commandPool_            { device, vkDestroyCommandPool                  },
-    numCommandBuffers_      { VKCommandBuffer::GetNumVkCommandBuffers(desc) },
     queuePresentFamily_     { queueFamilyIndices.presentFamily              },
-    maxDrawIndirectCount_   { GetMaxDrawIndirectCount(physicalDevice)       },
-    recordingFenceArray_    { VKPtr<VkFence>{ device, vkDestroyFence },
-                              VKPtr<VkFence>{ device, vkDestroyFence },
-                              VKPtr<VkFence>{ device, vkDestroyFence }      },
-    descriptorSetPoolArray_ { device,
-                              device,
-                              device                                        }
+    maxDrawIndirectCount_   { GetMaxDrawIndirectCount(physicalDevice)       }
 {
     /* Translate creation flags */
+    VkCommandPoolCreateFlags poolFlags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+
     if ((desc.flags & CommandBufferFlags::ImmediateSubmit) != 0)
     {
         immediateSubmit_    = true;
@@ -89,17 +86,12 @@ VKCommandBuffer::VKCommandBuffer(
         }
         if ((desc.flags & CommandBufferFlags::MultiSubmit) == 0)
             usageFlags_ |= VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        else
+            poolFlags = 0; // Multi-submit command buffers are long-lived
     }
 
-    /* Create native command buffer objects */
-    CreateVkCommandPool(queueFamilyIndices.graphicsFamily);
-    CreateVkCommandBuffers();
-    CreateVkRecordingFences();
-}
-
-VKCommandBuffer::~VKCommandBuffer()
-{
-    vkFreeCommandBuffers(device_, commandPool_, numCommandBuffers_, commandBufferArray_);
+    /* Create native command buffer objects for each frame in flight */
+    CreateCommandFrames(VKCommandBuffer::GetNumVkCommandBuffers(desc), queueFamilyIndices.graphicsFamily, poolFlags);
 }
 
 VkFence VKCommandBuffer::GetQueueSubmitFenceAndFlush()
@@ -110,10 +102,39 @@ VkFence VKCommandBuffer::GetQueueSubmitFenceAndFlush()
     */
     VkFence fence = recordingFence_;
     recordingFence_ = VK_NULL_HANDLE;
-    recordingFenceDirty_[commandBufferIndex_] = true;
+    frames_[frameIndex_].recordingFenceDirty = true;
     return fence;
 }
 
+void VKCommandBuffer::FlushQueueSubmitFence(const std::shared_ptr<VKFence>& batchFence)
+{
+    /* Only the first submission after encoding must be tracked, same as with the recording fence */
+    if (recordingFence_ != VK_NULL_HANDLE)
+    {
+        recordingFence_ = VK_NULL_HANDLE;
+        frames_[frameIndex_].batchFence = batchFence;
+    }
+}
+
+void VKCommandBuffer::FlushQueueSubmitTimelineValue(std::uint64_t value)
+{
+    if (recordingFence_ != VK_NULL_HANDLE)
+    {
+        recordingFence_ = VK_NULL_HANDLE;
+        frames_[frameIndex_].timelineValue = value;
+    }
+}
+
+void VKCommandBuffer::SubmitEncodingProfile()
+{
+    /* Merge profile only once per encoding, even if the command buffer is submitted multiple times */
+    if (hasEncodingProfile_)
+    {
+        debugger_->RecordProfile(encodingProfile_);
+        hasEncodingProfile_ = false;
+    }
+}
+
 /* ----- Encoding ----- */
 
 void VKCommandBuffer::Begin()
@@ -172,10 +193,17 @@ void VKCommandBuffer::End()
     /* Execute command buffer right after encoding for immediate command buffers */
     if (IsImmediateCmdBuffer())
     {
-        VkResult result = VKSubmitCommandBuffer(commandQueue_, commandBuffer_, GetQueueSubmitFenceAndFlush());
+        VkResult result = commandQueue_.SubmitCommandBuffer(commandBuffer_, GetQueueSubmitFenceAndFlush());
         VKThrowIfFailed(result, "failed to submit command buffer to Vulkan graphics queue");
     }
 
+    if (debugger_ != nullptr)
+    {
+        RecordEncodingProfile();
+        if (IsImmediateCmdBuffer())
+            SubmitEncodingProfile();
+    }
+
     ResetBindingStates();
 }
 
@@ -576,7 +604,7 @@ void VKCommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource)
     if (boundPipelineLayout_ != nullptr && descriptor < boundPipelineLayout_->GetLayoutDynamicBindings().size())
     {
         const VKLayoutBinding& binding = boundPipelineLayout_->GetLayoutDynamicBindings()[descriptor];
-        descriptorCache_->EmplaceDescriptor(resource, binding, descriptorSetWriter_);
+        descriptorCache_->EmplaceDescriptor(descriptor, resource, binding, descriptorSetWriter_);
     }
 }
 
@@ -1153,49 +1181,57 @@ bool VKCommandBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHand
  * ======= Private: =======
  */
 
-void VKCommandBuffer::CreateVkCommandPool(std::uint32_t queueFamilyIndex)
+VKCommandBuffer::CommandFrame::CommandFrame(VkDevice device) :
+    commandPool         { device, vkDestroyCommandPool  },
+    recordingFence      { device, vkDestroyFence        },
+    descriptorSetPool   { device                        }
 {
-    /* Create command pool */
-    VkCommandPoolCreateInfo createInfo;
-    {
-        createInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-        createInfo.pNext            = nullptr;
-        createInfo.flags            = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
-        createInfo.queueFamilyIndex = queueFamilyIndex;
-    }
-    VkResult result = vkCreateCommandPool(device_, &createInfo, nullptr, commandPool_.ReleaseAndGetAddressOf());
-    VKThrowIfFailed(result, "failed to create Vulkan command pool");
 }
 
-void VKCommandBuffer::CreateVkCommandBuffers()
+void VKCommandBuffer::CreateCommandFrames(std::uint32_t numFrames, std::uint32_t queueFamilyIndex, VkCommandPoolCreateFlags poolFlags)
 {
-    /* Allocate command buffers */
-    VkCommandBufferAllocateInfo allocInfo;
+    /*
+    Create one command pool per frame, so the native command buffer of a frame can be recycled with a single call to vkResetCommandPool.
+    Recording fences are initially signaled, i.e. the first encoding of each frame does not wait.
+    */
+    VkCommandPoolCreateInfo poolCreateInfo;
     {
-        allocInfo.sType                 = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-        allocInfo.pNext                 = nullptr;
-        allocInfo.commandPool           = commandPool_;
-        allocInfo.level                 = bufferLevel_;
-        allocInfo.commandBufferCount    = numCommandBuffers_;
+        poolCreateInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolCreateInfo.pNext            = nullptr;
+        poolCreateInfo.flags            = poolFlags;
+        poolCreateInfo.queueFamilyIndex = queueFamilyIndex;
     }
-    VkResult result = vkAllocateCommandBuffers(device_, &allocInfo, commandBufferArray_);
-    VKThrowIfFailed(result, "failed to allocate Vulkan command buffers");
-}
-
-void VKCommandBuffer::CreateVkRecordingFences()
-{
-    /* Create all recording fences with their initial state being signaled */
-    VkFenceCreateInfo createInfo;
+    VkFenceCreateInfo fenceCreateInfo;
     {
-        createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-        createInfo.pNext = nullptr;
-        createInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+        fenceCreateInfo.sType           = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        fenceCreateInfo.pNext           = nullptr;
+        fenceCreateInfo.flags           = VK_FENCE_CREATE_SIGNALED_BIT;
     }
 
-    for_range(i, numCommandBuffers_)
+    frames_.reserve(numFrames);
+    for_range(i, numFrames)
     {
+        frames_.emplace_back(device_);
+        CommandFrame& frame = frames_.back();
+
+        /* Create command pool for this frame */
+        VkResult result = vkCreateCommandPool(device_, &poolCreateInfo, nullptr, frame.commandPool.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan command pool");
+
+        /* Allocate the only command buffer of this pool; it is freed together with the pool */
+        VkCommandBufferAllocateInfo allocInfo;
+        {
+            allocInfo.sType                 = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocInfo.pNext                 = nullptr;
+            allocInfo.commandPool           = frame.commandPool;
+            allocInfo.level                 = bufferLevel_;
+            allocInfo.commandBufferCount    = 1;
+        }
+        result = vkAllocateCommandBuffers(device_, &allocInfo, &(frame.commandBuffer));
+        VKThrowIfFailed(result, "failed to allocate Vulkan command buffers");
+
         /* Create fence for command buffer recording */
-        VkResult result = vkCreateFence(device_, &createInfo, nullptr, recordingFenceArray_[i].ReleaseAndGetAddressOf());
+        result = vkCreateFence(device_, &fenceCreateInfo, nullptr, frame.recordingFence.ReleaseAndGetAddressOf());
         VKThrowIfFailed(result, "failed to create Vulkan fence");
     }
 }
@@ -1333,25 +1369,70 @@ void VKCommandBuffer::FlushDescriptorCache()
 
 void VKCommandBuffer::AcquireNextBuffer()
 {
-    /* Move to next command buffer index */
-    commandBufferIndex_ = (commandBufferIndex_ + 1) % numCommandBuffers_;
+    /* Move to next frame in flight */
+    frameIndex_ = (frameIndex_ + 1) % static_cast<std::uint32_t>(frames_.size());
+    CommandFrame& frame = frames_[frameIndex_];
 
     /* Wait for fence before using next command buffer */
-    recordingFence_ = recordingFenceArray_[commandBufferIndex_].Get();
-    if (recordingFenceDirty_[commandBufferIndex_])
-        vkWaitForFences(device_, 1, &recordingFence_, VK_TRUE, UINT64_MAX);
+    recordingFence_ = frame.recordingFence.Get();
+    WaitForCurrentFrame();
 
     /* Reset fence state after it has been signaled by the command queue */
     vkResetFences(device_, 1, &recordingFence_);
-    recordingFenceDirty_[commandBufferIndex_] = false;
+    frame.recordingFenceDirty = false;
+
+    /* Recycle all command buffer memory of this frame at once, which is cheaper than resetting the command buffer individually */
+    VkResult result = vkResetCommandPool(device_, frame.commandPool, 0);
+    VKThrowIfFailed(result, "failed to reset Vulkan command pool");
 
     /* Make next command buffer current and reset pools and context */
-    commandBuffer_      = commandBufferArray_[commandBufferIndex_];
-    descriptorSetPool_  = &(descriptorSetPoolArray_[commandBufferIndex_]);
+    commandBuffer_      = frame.commandBuffer;
+    descriptorSetPool_  = &(frame.descriptorSetPool);
     descriptorSetPool_->Reset();
     context_.Reset(commandBuffer_);
 }
 
+void VKCommandBuffer::WaitForCurrentFrame()
+{
+    encodingStall_ = EncodingStall{};
+
+    CommandFrame& frame = frames_[frameIndex_];
+
+    if (frame.timelineValue != 0)
+    {
+        /* Only block if the timeline semaphore has not reached the value of the last submission of this frame yet */
+        const VKDevice& device = commandQueue_.GetDevice();
+        if (!device.IsTimelineValueReached(frame.timelineValue))
+        {
+            encodingStall_.tickStart = Timer::Tick();
+            device.WaitTimelineValue(frame.timelineValue, UINT64_MAX);
+            encodingStall_.tickEnd = Timer::Tick();
+        }
+        frame.timelineValue = 0;
+        return;
+    }
+
+    /* Determine which fence the last submission of this frame has signaled */
+    VkFence fence = VK_NULL_HANDLE;
+    if (frame.batchFence)
+        fence = frame.batchFence->GetVkFence();
+    else if (frame.recordingFenceDirty)
+        fence = recordingFence_;
+    else
+        return;
+
+    /* Only block if the GPU is still executing the command buffer; polling the fence status does not block */
+    if (vkGetFenceStatus(device_, fence) == VK_NOT_READY)
+    {
+        encodingStall_.tickStart = Timer::Tick();
+        vkWaitForFences(device_, 1, &fence, VK_TRUE, UINT64_MAX);
+        encodingStall_.tickEnd = Timer::Tick();
+    }
+
+    /* Release batch fence, so the command queue can recycle it */
+    frame.batchFence.reset();
+}
+
 void VKCommandBuffer::ResetBindingStates()
 {
     boundSwapChain_         = nullptr;
@@ -1360,6 +1441,40 @@ void VKCommandBuffer::ResetBindingStates()
     descriptorCache_        = nullptr;
 }
 
+void VKCommandBuffer::RecordEncodingProfile()
+{
+    /* The descriptor set pool is reset with each encoding, so its counters only refer to the current encoding */
+    FrameProfile& profile = encodingProfile_;
+    profile = FrameProfile{};
+    {
+        profile.commandBufferRecord.descriptorSetCacheHits      = descriptorSetPool_->GetNumCacheHits();
+        profile.commandBufferRecord.descriptorSetCacheMisses    = descriptorSetPool_->GetNumCacheMisses();
+    }
+
+    /* Record the time the CPU was blocked by the GPU at the beginning of this encoding */
+    if (encodingStall_.tickEnd != 0)
+    {
+        profile.commandBufferRecord.encodingStalls = 1;
+        if (debugger_->GetTimeRecording())
+        {
+            ProfileTimeRecord record;
+            {
+                record.annotation       = "vkWaitForFences";
+                record.cpuTicksStart    = encodingStall_.tickStart;
+                record.cpuTicksEnd      = encodingStall_.tickEnd;
+            }
+            profile.timeRecords.push_back(record);
+        }
+    }
+
+    hasEncodingProfile_ =
+    (
+        profile.commandBufferRecord.descriptorSetCacheHits      > 0 ||
+        profile.commandBufferRecord.descriptorSetCacheMisses    > 0 ||
+        profile.commandBufferRecord.encodingStalls              > 0
+    );
+}
+
 #if 0
 void VKCommandBuffer::ResetQueryPoolsInFlight()
 {
@@ -1392,7 +1507,7 @@ std::uint32_t VKCommandBuffer::GetNumVkCommandBuffers(const CommandBufferDescrip
     if (desc.numNativeBuffers == 0)
         return numNativeBuffersDefault;
     else
-        return Clamp<std::uint32_t>(desc.numNativeBuffers, 1u, VKCommandBuffer::maxNumCommandBuffers);
+        return desc.numNativeBuffers;
 }
 
 
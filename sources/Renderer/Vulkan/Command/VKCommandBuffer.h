@@ -10,12 +10,14 @@
 
 
 #include <LLGL/CommandBuffer.h>
+#include <LLGL/RenderingDebuggerFlags.h>
 #include "../Vulkan.h"
 #include "../VKPtr.h"
 #include "../VKCore.h"
 #include "VKCommandContext.h"
 #include "../RenderState/VKStagingDescriptorSetPool.h"
 #include "../RenderState/VKDescriptorCache.h"
+#include <memory>
 #include <vector>
 
 
@@ -24,11 +26,14 @@ namespace LLGL
 
 
 class VKPhysicalDevice;
+class VKCommandQueue;
 class VKResourceHeap;
 class VKRenderPass;
 class VKQueryHeap;
 class VKSwapChain;
 class VKPipelineState;
+class VKFence;
+class RenderingDebugger;
 
 class VKCommandBuffer final : public CommandBuffer
 {
@@ -42,19 +47,27 @@ class VKCommandBuffer final : public CommandBuffer
         VKCommandBuffer(
             const VKPhysicalDevice&         physicalDevice,
             VkDevice                        device,
-            VkQueue                         commandQueue,
+            VKCommandQueue&                 commandQueue,
             const VKQueueFamilyIndices&     queueFamilyIndices,
-            const CommandBufferDescriptor&  desc
+            const CommandBufferDescriptor&  desc,
+            RenderingDebugger*              debugger    = nullptr
         );
 
-        ~VKCommandBuffer();
-
     public:
 
         // Returns the fence used to submit the command buffer and resets it if this is a multi-submit command buffer,
         // i.e. it won't need another signal for the next submission.
         VkFence GetQueueSubmitFenceAndFlush();
 
+        // Flushes the recording fence like GetQueueSubmitFenceAndFlush(), but the command buffer is tracked by the specified fence of a batch submission instead.
+        void FlushQueueSubmitFence(const std::shared_ptr<VKFence>& batchFence);
+
+        // Flushes the recording fence like GetQueueSubmitFenceAndFlush(), but the command buffer is tracked by the specified value of the device's timeline semaphore instead.
+        void FlushQueueSubmitTimelineValue(std::uint64_t value);
+
+        // Merges the profile of the last encoding into the rendering debugger. This must be called on submission, since the debugger is not synchronized with encoding threads.
+        void SubmitEncodingProfile();
+
         // Returns the native VkCommandBuffer object.
         inline VkCommandBuffer GetVkCommandBuffer() const
         {
@@ -85,9 +98,7 @@ class VKCommandBuffer final : public CommandBuffer
 
     private:
 
-        void CreateVkCommandPool(std::uint32_t queueFamilyIndex);
-        void CreateVkCommandBuffers();
-        void CreateVkRecordingFences();
+        void CreateCommandFrames(std::uint32_t numFrames, std::uint32_t queueFamilyIndex, VkCommandPoolCreateFlags poolFlags);
 
         void ClearFramebufferAttachments(std::uint32_t numAttachments, const VkClearAttachment* attachments);
 
@@ -116,11 +127,17 @@ class VKCommandBuffer final : public CommandBuffer
 
         void FlushDescriptorCache();
 
-        // Acquires the next native VkCommandBuffer object.
+        // Acquires the next native VkCommandBuffer object and resets the command pool of its frame.
         void AcquireNextBuffer();
 
+        // Waits until the GPU has finished the native command buffer of the current frame and records the stall if it had to block.
+        void WaitForCurrentFrame();
+
         void ResetBindingStates();
 
+        // Records the descriptor set cache hit rate and the stall of the current encoding into the pending encoding profile.
+        void RecordEncodingProfile();
+
         #if 1//TODO: optimize
         void ResetQueryPoolsInFlight();
         void AppendQueryPoolInFlight(VKQueryHeap* queryHeap);
@@ -133,6 +150,27 @@ class VKCommandBuffer final : public CommandBuffer
 
     private:
 
+        // Native objects of one frame in flight. The command pool only contains the command buffer of this frame, so it can be reset in its entirety.
+        struct CommandFrame
+        {
+            CommandFrame(VkDevice device);
+
+            VKPtr<VkCommandPool>        commandPool;
+            VkCommandBuffer             commandBuffer       = VK_NULL_HANDLE;
+            VKPtr<VkFence>              recordingFence;
+            bool                        recordingFenceDirty = false;
+            std::shared_ptr<VKFence>    batchFence;                     // Replaces the recording fence if this frame was submitted in a batch
+            std::uint64_t               timelineValue       = 0;        // Replaces the recording fence if this frame was submitted with a timeline semaphore
+            VKStagingDescriptorSetPool  descriptorSetPool;
+        };
+
+        // CPU ticks of the last wait for the GPU in WaitForCurrentFrame(); both are zero if it did not block.
+        struct EncodingStall
+        {
+            std::uint64_t   tickStart   = 0;
+            std::uint64_t   tickEnd     = 0;
+        };
+
         struct InputAssemblyState
         {
             // Input-assembly state for slot 0 only (IA0)
@@ -150,21 +188,18 @@ class VKCommandBuffer final : public CommandBuffer
 
     private:
 
-        static constexpr std::uint32_t maxNumCommandBuffers = 3;
-
         VkDevice                        device_                                         = VK_NULL_HANDLE;
+        RenderingDebugger*              debugger_                                       = nullptr; // Receives the descriptor set cache and encoding stall statistics
 
-        VkQueue                         commandQueue_                                   = VK_NULL_HANDLE;
-
-        VKPtr<VkCommandPool>            commandPool_;
+        VKCommandQueue&                 commandQueue_;
 
-        VKPtr<VkFence>                  recordingFenceArray_[maxNumCommandBuffers];
+        std::vector<CommandFrame>       frames_;
+        std::uint32_t                   frameIndex_                                     = 0;
         VkFence                         recordingFence_                                 = VK_NULL_HANDLE;
-        bool                            recordingFenceDirty_[maxNumCommandBuffers]      = {};
-        VkCommandBuffer                 commandBufferArray_[maxNumCommandBuffers];
         VkCommandBuffer                 commandBuffer_                                  = VK_NULL_HANDLE;
-        std::uint32_t                   commandBufferIndex_                             = 0;
-        std::uint32_t                   numCommandBuffers_                              = 2;
+        EncodingStall                   encodingStall_;
+        FrameProfile                    encodingProfile_;                                               // Profile of the last encoding; merged into the debugger on submission
+        bool                            hasEncodingProfile_                             = false;
 
         VKCommandContext                context_;
 
@@ -195,7 +230,6 @@ class VKCommandBuffer final : public CommandBuffer
 
         std::uint32_t                   maxDrawIndirectCount_                           = 0;
 
-        VKStagingDescriptorSetPool      descriptorSetPoolArray_[maxNumCommandBuffers];
         VKStagingDescriptorSetPool*     descriptorSetPool_                              = nullptr;
         VKDescriptorCache*              descriptorCache_                                = nullptr;
         VKDescriptorSetWriter           descriptorSetWriter_;
@@ -98,7 +98,8 @@ class VKCommandContext
             VkFormat                    format,
             const VkOffset3D&           offset,
             const VkExtent3D&           extent,
-            const TextureSubresource&   subresource
+            const TextureSubresource&   subresource,
+            VkDeviceSize                srcOffset   = 0
         );
 
         void CopyBufferToImage(
@@ -9,6 +9,8 @@
 #include "VKCommandBuffer.h"
 #include "../RenderState/VKFence.h"
 #include "../RenderState/VKQueryHeap.h"
+#include "../Buffer/VKStagingBufferPool.h"
+#include "../VKDevice.h"
 #include "../VKCore.h"
 #include "../../CheckedCast.h"
 
@@ -34,21 +36,39 @@ VkResult VKSubmitCommandBuffer(VkQueue commandQueue, VkCommandBuffer commandBuff
     return vkQueueSubmit(commandQueue, 1, &submitInfo, fence);
 }
 
-VKCommandQueue::VKCommandQueue(VkDevice device, VkQueue queue) :
-    device_ { device },
-    native_ { queue  }
+VKCommandQueue::VKCommandQueue(VKDevice& device, VKStagingBufferPool* stagingBufferPool) :
+    device_            { device                },
+    native_            { device.GetVkQueue()   },
+    stagingBufferPool_ { stagingBufferPool     }
 {
 }
 
+VkResult VKCommandQueue::SubmitCommandBuffer(VkCommandBuffer commandBuffer, VkFence fence)
+{
+    FlushStagingTransfers();
+    return VKSubmitCommandBuffer(native_, commandBuffer, fence);
+}
+
 /* ----- Command Buffers ----- */
 
 void VKCommandQueue::Submit(CommandBuffer& commandBuffer)
 {
     auto& commandBufferVK = LLGL_CAST(VKCommandBuffer&, commandBuffer);
-    if (!commandBufferVK.IsImmediateCmdBuffer())
+    if (commandBufferVK.IsImmediateCmdBuffer())
+        return;
+
+    commandBufferVK.SubmitEncodingProfile();
+
+    if (device_.HasTimelineSemaphore())
+    {
+        /* Track submission with the next timeline value instead of the recording fence */
+        VkCommandBuffer cmdBuffer = commandBufferVK.GetVkCommandBuffer();
+        const std::uint64_t value = SubmitAndSignalTimeline(1, &cmdBuffer);
+        commandBufferVK.FlushQueueSubmitTimelineValue(value);
+    }
+    else
     {
-        VkResult result = VKSubmitCommandBuffer(
-            native_,
+        VkResult result = SubmitCommandBuffer(
             commandBufferVK.GetVkCommandBuffer(),
             commandBufferVK.GetQueueSubmitFenceAndFlush()
         );
@@ -56,6 +76,81 @@ void VKCommandQueue::Submit(CommandBuffer& commandBuffer)
     }
 }
 
+void VKCommandQueue::Submit(const ArrayView<CommandBuffer*>& commandBuffers)
+{
+    /* Gather all native command buffers; immediate command buffers have already been submitted */
+    batchCmdBuffers_.clear();
+    batchCmdBuffers_.reserve(commandBuffers.size());
+
+    VKCommandBuffer* lastCmdBufferVK = nullptr;
+
+    for (CommandBuffer* commandBuffer : commandBuffers)
+    {
+        auto* commandBufferVK = LLGL_CAST(VKCommandBuffer*, commandBuffer);
+        if (!commandBufferVK->IsImmediateCmdBuffer())
+        {
+            batchCmdBuffers_.push_back(commandBufferVK->GetVkCommandBuffer());
+            commandBufferVK->SubmitEncodingProfile();
+            lastCmdBufferVK = commandBufferVK;
+        }
+    }
+
+    if (batchCmdBuffers_.empty())
+        return;
+
+    if (device_.HasTimelineSemaphore())
+    {
+        /* All command buffers of this batch are tracked by the same timeline value */
+        const std::uint64_t value = SubmitAndSignalTimeline(static_cast<std::uint32_t>(batchCmdBuffers_.size()), batchCmdBuffers_.data());
+
+        for (CommandBuffer* commandBuffer : commandBuffers)
+        {
+            auto* commandBufferVK = LLGL_CAST(VKCommandBuffer*, commandBuffer);
+            if (!commandBufferVK->IsImmediateCmdBuffer())
+                commandBufferVK->FlushQueueSubmitTimelineValue(value);
+        }
+        return;
+    }
+
+    /* Avoid the shared fence if there is only a single command buffer */
+    if (batchCmdBuffers_.size() == 1)
+    {
+        Submit(*lastCmdBufferVK);
+        return;
+    }
+
+    /*
+    Only a single fence can be signaled per submission, so all command buffers of this batch share the same fence.
+    Each command buffer keeps a reference to it until it waits for this fence before it is recorded again.
+    */
+    std::shared_ptr<VKFence> batchFence = AcquireBatchFence();
+
+    for (CommandBuffer* commandBuffer : commandBuffers)
+    {
+        auto* commandBufferVK = LLGL_CAST(VKCommandBuffer*, commandBuffer);
+        if (!commandBufferVK->IsImmediateCmdBuffer())
+            commandBufferVK->FlushQueueSubmitFence(batchFence);
+    }
+
+    /* Submit all command buffers with a single queue submission */
+    FlushStagingTransfers();
+
+    VkSubmitInfo submitInfo;
+    {
+        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.pNext                = nullptr;
+        submitInfo.waitSemaphoreCount   = 0;
+        submitInfo.pWaitSemaphores      = nullptr;
+        submitInfo.pWaitDstStageMask    = 0;
+        submitInfo.commandBufferCount   = static_cast<std::uint32_t>(batchCmdBuffers_.size());
+        submitInfo.pCommandBuffers      = batchCmdBuffers_.data();
+        submitInfo.signalSemaphoreCount = 0;
+        submitInfo.pSignalSemaphores    = nullptr;
+    }
+    VkResult result = vkQueueSubmit(native_, 1, &submitInfo, batchFence->GetVkFence());
+    VKThrowIfFailed(result, "failed to submit command buffers to Vulkan graphics queue");
+}
+
 /* ----- Queries ----- */
 
 bool VKCommandQueue::QueryResult(
@@ -103,8 +198,17 @@ bool VKCommandBuffer::QueryPipelineStatisticsResult(QueryHeap& queryHeap, QueryP
 void VKCommandQueue::Submit(Fence& fence)
 {
     auto& fenceVK = LLGL_CAST(VKFence&, fence);
-    fenceVK.Reset(device_);
-    vkQueueSubmit(native_, 0, nullptr, fenceVK.GetVkFence());
+    if (fenceVK.IsTimeline())
+    {
+        /* Signal the next timeline value without any command buffers; no VkFence is required */
+        fenceVK.SetTimelineValue(SubmitAndSignalTimeline(0, nullptr));
+    }
+    else
+    {
+        FlushStagingTransfers();
+        fenceVK.Reset(device_);
+        vkQueueSubmit(native_, 0, nullptr, fenceVK.GetVkFence());
+    }
 }
 
 bool VKCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
@@ -115,6 +219,7 @@ bool VKCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
 
 void VKCommandQueue::WaitIdle()
 {
+    FlushStagingTransfers();
     vkQueueWaitIdle(native_);
 }
 
@@ -123,6 +228,41 @@ void VKCommandQueue::WaitIdle()
  * ======= Private: =======
  */
 
+void VKCommandQueue::FlushStagingTransfers()
+{
+    if (stagingBufferPool_ != nullptr)
+        stagingBufferPool_->Flush();
+}
+
+std::shared_ptr<VKFence> VKCommandQueue::AcquireBatchFence()
+{
+    /*
+    Recycle a fence that is only referenced by this queue. It must also have been signaled,
+    since a command buffer might have been released without waiting for its batch fence.
+    */
+    for (const std::shared_ptr<VKFence>& fence : batchFences_)
+    {
+        if (fence.use_count() == 1 && vkGetFenceStatus(device_, fence->GetVkFence()) == VK_SUCCESS)
+        {
+            fence->Reset(device_);
+            return fence;
+        }
+    }
+
+    /* Create a new fence in unsignaled state */
+    batchFences_.push_back(std::make_shared<VKFence>(device_));
+    return batchFences_.back();
+}
+
+std::uint64_t VKCommandQueue::SubmitAndSignalTimeline(std::uint32_t numCommandBuffers, const VkCommandBuffer* commandBuffers)
+{
+    FlushStagingTransfers();
+    std::uint64_t value = 0;
+    VkResult result = device_.SubmitAndSignalTimeline(numCommandBuffers, commandBuffers, VK_NULL_HANDLE, value);
+    VKThrowIfFailed(result, "failed to submit command buffers to Vulkan graphics queue");
+    return value;
+}
+
 VkResult VKCommandQueue::GetQueryResults(
     VKQueryHeap&    queryHeapVK,
     std::uint32_t   firstQuery,
@@ -14,13 +14,18 @@
 #include "../VKPtr.h"
 #include "../VKCore.h"
 #include "../RenderState/VKFence.h"
+#include <memory>
+#include <vector>
 
 
 namespace LLGL
 {
 
 
+class VKDevice;
 class VKQueryHeap;
+class VKStagingBufferPool;
+class VKCommandBuffer;
 
 // Helper function to submit the specified Vulkan command buffer to a command queue.
 VkResult VKSubmitCommandBuffer(VkQueue commandQueue, VkCommandBuffer commandBuffer, VkFence fence);
@@ -32,12 +37,32 @@ class VKCommandQueue final : public CommandQueue
 
         #include <LLGL/Backend/CommandQueue.inl>
 
+        void Submit(const ArrayView<CommandBuffer*>& commandBuffers) override;
+
     public:
 
-        VKCommandQueue(VkDevice device, VkQueue queue);
+        VKCommandQueue(VKDevice& device, VKStagingBufferPool* stagingBufferPool = nullptr);
+
+        // Submits the specified native command buffer after all pending staging transfers.
+        VkResult SubmitCommandBuffer(VkCommandBuffer commandBuffer, VkFence fence);
+
+        // Returns the device this queue belongs to.
+        inline const VKDevice& GetDevice() const
+        {
+            return device_;
+        }
 
     private:
 
+        // Submits all pending staging transfers, so they are executed before any subsequent submission.
+        void FlushStagingTransfers();
+
+        // Returns a fence for a batch submission that is no longer in use by any command buffer.
+        std::shared_ptr<VKFence> AcquireBatchFence();
+
+        // Submits the specified native command buffers after all pending staging transfers and returns the timeline value that is signaled on completion.
+        std::uint64_t SubmitAndSignalTimeline(std::uint32_t numCommandBuffers, const VkCommandBuffer* commandBuffers);
+
         VkResult GetQueryResults(
             VKQueryHeap&    queryHeapVK,
             std::uint32_t   firstQuery,
@@ -66,8 +91,12 @@ class VKCommandQueue final : public CommandQueue
 
     private:
 
-        VkDevice    device_ = VK_NULL_HANDLE;
-        VkQueue     native_ = VK_NULL_HANDLE;
+        VKDevice&               device_;
+        VkQueue                 native_             = VK_NULL_HANDLE;
+        VKStagingBufferPool*    stagingBufferPool_  = nullptr;
+
+        std::vector<std::shared_ptr<VKFence>>   batchFences_;   // Fences that are shared between all command buffers of a batch submission
+        std::vector<VkCommandBuffer>            batchCmdBuffers_;
 
 };
 
@@ -123,6 +123,14 @@ static bool DECL_LOADVKEXT_PROC(KHR_get_physical_device_properties2)
     return true;
 }
 
+static bool DECL_LOADVKEXT_PROC(KHR_timeline_semaphore)
+{
+    LOAD_VKPROC( vkGetSemaphoreCounterValueKHR );
+    LOAD_VKPROC( vkWaitSemaphoresKHR           );
+    LOAD_VKPROC( vkSignalSemaphoreKHR          );
+    return true;
+}
+
 #undef DECL_LOADVKEXT_PROC_BASE
 #undef DECL_LOADVKEXT_PROC_INSTANCE
 #undef DECL_LOADVKEXT_PROC
@@ -197,6 +205,7 @@ bool VKLoadDeviceExtensions(VkDevice device, const std::vector<const char*>& sup
 
     /* Multi-vendor extensions */
     LOAD_VKEXT( KHR_get_physical_device_properties2 );
+    LOAD_VKEXT( KHR_timeline_semaphore              );
     LOAD_VKEXT( EXT_debug_marker                    );
     LOAD_VKEXT( EXT_conditional_rendering           );
     LOAD_VKEXT( EXT_transform_feedback              );
@@ -25,6 +25,9 @@ static const char* g_VKOptionalExtensions[] =
     #ifdef VK_KHR_get_physical_device_properties2
     VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME,
     #endif
+    #ifdef VK_KHR_timeline_semaphore
+    VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME,
+    #endif
     #ifdef VK_EXT_debug_marker
     VK_EXT_DEBUG_MARKER_EXTENSION_NAME,
     #endif
@@ -61,6 +61,12 @@ DECL_VKPROC( vkGetPhysicalDeviceQueueFamilyProperties2KHR       );
 DECL_VKPROC( vkGetPhysicalDeviceMemoryProperties2KHR            );
 DECL_VKPROC( vkGetPhysicalDeviceSparseImageFormatProperties2KHR );
 
+/* VK_KHR_timeline_semaphore */
+
+DECL_VKPROC( vkGetSemaphoreCounterValueKHR );
+DECL_VKPROC( vkWaitSemaphoresKHR           );
+DECL_VKPROC( vkSignalSemaphoreKHR          );
+
 
 
 // ================================================================================
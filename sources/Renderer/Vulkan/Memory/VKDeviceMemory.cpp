@@ -20,7 +20,7 @@ VKDeviceMemory::VKDeviceMemory(VkDevice device, VkDeviceSize size, std::uint32_t
     deviceMemory_    { device, vkFreeMemory },
     size_            { size                 },
     memoryTypeIndex_ { memoryTypeIndex      },
-    maxNewBlockSize_ { size                 }
+    allocator_       { size                 }
 {
     /* Allocate device memory */
     VkMemoryAllocateInfo allocInfo;
@@ -54,33 +54,22 @@ void VKDeviceMemory::Unmap(VkDevice device)
     vkUnmapMemory(device, deviceMemory_);
 }
 
-VKDeviceMemoryRegion* VKDeviceMemory::Allocate(VkDeviceSize size, VkDeviceSize alignment, bool reduceFragmentation)
+VKDeviceMemoryRegion* VKDeviceMemory::Allocate(VkDeviceSize size, VkDeviceSize alignment)
 {
     if (size > 0 && alignment > 0)
     {
-        /* Adjust size and offset by alignment */
-        VkDeviceSize alignedSize    = GetAlignedSize(size, alignment);
-        VkDeviceSize alignedOffset  = GetAlignedSize(GetNextOffset(), alignment);
+        /* Allocate block with aligned size from the TLSF allocator */
+        const VkDeviceSize alignedSize = GetAlignedSize(size, alignment);
+        const VKTLSFAllocator::BlockID block = allocator_.Allocate(alignedSize, alignment);
 
-        if (reduceFragmentation)
+        if (block != VKTLSFAllocator::invalidBlockID)
         {
-            /* Reuse fragmented block */
-            if (alignedSize <= maxFragmentedBlockSize_)
-                return FindReusableBlock(alignedSize, alignment);
+            /* Store region at the index of its block ID, so it can be released in constant time */
+            if (block >= regions_.size())
+                regions_.resize(allocator_.GetBlockIDBound());
 
-            /* Allocate block with aligned size and offset */
-            if (alignedSize + alignedOffset <= GetSize())
-                return AllocAndAppendBlock(alignedSize, alignedOffset);
-        }
-        else
-        {
-            /* Allocate block with aligned size and offset */
-            if (alignedSize + alignedOffset <= GetSize())
-                return AllocAndAppendBlock(alignedSize, alignedOffset);
-
-            /* Reuse fragmented block */
-            if (alignedSize <= maxFragmentedBlockSize_)
-                return FindReusableBlock(alignedSize, alignment);
+            regions_[block] = MakeUnique<VKDeviceMemoryRegion>(this, alignedSize, allocator_.GetBlockOffset(block), alignment, memoryTypeIndex_, block);
+            return regions_[block].get();
         }
     }
     return nullptr;
@@ -90,75 +79,67 @@ void VKDeviceMemory::Release(VKDeviceMemoryRegion* region)
 {
     if (region)
     {
-        /* Increase maximal size of fragmented blocks */
-        IncMaxFragmentedBlockSize(region->GetSize());
-
-        auto it = std::find_if(
-            blocks_.begin(), blocks_.end(),
-            [region](const std::unique_ptr<VKDeviceMemoryRegion>& entry)
-            {
-                return (entry.get() == region);
-            }
-        );
-
-        if (it != blocks_.end())
-        {
-            InsertBlockToFragmentsSorted(std::move(*it));
-            blocks_.erase(it);
-        }
+        const VKTLSFAllocator::BlockID block = region->GetBlockID();
+        LLGL_ASSERT(block < regions_.size() && regions_[block].get() == region, "device memory region does not belong to this chunk");
+        allocator_.Free(block);
+        regions_[block].reset();
     }
 }
 
 bool VKDeviceMemory::IsEmpty() const
 {
-    return blocks_.empty();
+    return (allocator_.GetNumAllocatedBlocks() == 0);
 }
 
 VkDeviceSize VKDeviceMemory::GetMaxAllocationSize() const
 {
-    return std::max(maxNewBlockSize_, maxFragmentedBlockSize_);
+    return allocator_.GetMaxFreeBlockSize();
+}
+
+VkDeviceSize VKDeviceMemory::GetAllocatedSize() const
+{
+    return allocator_.GetAllocatedSize();
+}
+
+void VKDeviceMemory::GetAllocatedRegions(std::vector<VKDeviceMemoryRegion*>& outRegions) const
+{
+    for (auto block = allocator_.GetFirstBlock(); block != VKTLSFAllocator::invalidBlockID; block = allocator_.GetNextBlock(block))
+    {
+        if (!allocator_.IsBlockFree(block))
+            outRegions.push_back(regions_[block].get());
+    }
 }
 
 void VKDeviceMemory::AccumDetails(VKDeviceMemoryDetails& details) const
 {
     details.numChunks               += 1;
-    details.numBlocks               += blocks_.size();
-    details.numFragments            += fragmentedBlocks_.size();
-    details.maxNewBlockSize         = std::max(details.maxNewBlockSize, maxNewBlockSize_);
-    details.maxFragmentedBlockSize  = std::max(details.maxFragmentedBlockSize, maxFragmentedBlockSize_);
+    details.numBlocks               += allocator_.GetNumAllocatedBlocks();
+    details.numFragments            += allocator_.GetNumFreeBlocks();
+    details.totalSize               += GetSize();
+    details.allocatedSize           += allocator_.GetAllocatedSize();
+    details.maxFragmentedBlockSize  = std::max(details.maxFragmentedBlockSize, allocator_.GetMaxFreeBlockSize());
 }
 
 #ifdef LLGL_DEBUG
 
 /*
-Prints a single memory region to the output stream.
+Prints a single memory block to the output stream.
 Example of 3 consecutive blocks: [0+++++][8++][13++++++]
 Example of 3 fragmented blocks: [0+++++]...[11+].[17++++++]
 */
-static void PrintDeviceMemoryRegion(std::ostream& s, VKDeviceMemoryRegion& region, VKDeviceMemoryRegion* prevRegion)
+static void PrintDeviceMemoryBlock(std::ostream& s, VkDeviceSize offset, VkDeviceSize size, VkDeviceSize prevOffsetEnd)
 {
-    /* Print space between previous and current region */
-    if (prevRegion)
-    {
-        auto startOffset    = prevRegion->GetOffsetWithSize();
-        auto endOffset      = region.GetOffset();
-        if (startOffset < endOffset)
-            s << std::string(static_cast<std::size_t>(endOffset - startOffset), '.');
-    }
-    else
-    {
-        auto endOffset = region.GetOffset();
-        if (endOffset > 0)
-            s << std::string(static_cast<std::size_t>(endOffset), '.');
-    }
+    /* Print space between previous and current block */
+    if (prevOffsetEnd < offset)
+        s << std::string(static_cast<std::size_t>(offset - prevOffsetEnd), '.');
 
-    /* Print new region */
-    auto n = static_cast<std::size_t>(region.GetSize());
+    /* Print new block */
+    auto n = static_cast<std::size_t>(size);
     if (n > 2)
     {
         s << '[';
 
-        auto numStr = std::to_string(region.GetSize());
+        auto numStr = std::to_string(size);
 
         n -= 2;
         if (numStr.size() <= n)
@@ -178,288 +159,33 @@ static void PrintDeviceMemoryRegion(std::ostream& s, VKDeviceMemoryRegion& regio
         s << '|';
 }
 
-void VKDeviceMemory::PrintBlocks(std::ostream& s) const
-{
-    VKDeviceMemoryRegion* prevBlock = nullptr;
-    for (const auto& block : blocks_)
-    {
-        PrintDeviceMemoryRegion(s, *block, prevBlock);
-        prevBlock = block.get();
-    }
-}
-
-void VKDeviceMemory::PrintFragmentedBlocks(std::ostream& s) const
-{
-    VKDeviceMemoryRegion* prevBlock = nullptr;
-    for (const auto& block : fragmentedBlocks_)
-    {
-        PrintDeviceMemoryRegion(s, *block, prevBlock);
-        prevBlock = block.get();
-    }
-}
-
-#endif
-
-
-/*
- * ======= Private: =======
- */
-
-VkDeviceSize VKDeviceMemory::GetNextOffset() const
-{
-    if (blocks_.empty())
-        return 0;
-    else
-        return blocks_.back()->GetOffsetWithSize();
-}
-
-std::unique_ptr<VKDeviceMemoryRegion> VKDeviceMemory::MakeUniqueBlock(VkDeviceSize alignedSize, VkDeviceSize alignedOffset)
-{
-    return MakeUnique<VKDeviceMemoryRegion>(this, alignedSize, alignedOffset, memoryTypeIndex_);
-}
-
-VKDeviceMemoryRegion* VKDeviceMemory::AllocAndAppendBlock(VkDeviceSize alignedSize, VkDeviceSize alignedOffset)
-{
-    /* Update maximal free block size */
-    maxNewBlockSize_ = GetSize() - (alignedSize + alignedOffset);
-
-    /* Check if the aligned offset results in a new fragment */
-    const VkDeviceSize nextOffset = GetNextOffset();
-
-    if (nextOffset < alignedOffset)
-    {
-        /*
-        Check if new fragment can be immediately merged with previous fragment:
-        Before: blocks:    [++]........[++++]
-                fragments: ....[++++]
-        After:  blocks:    [++]........[++++]
-                fragments: ....[++++++]
-        */
-        if (!fragmentedBlocks_.empty() && fragmentedBlocks_.back()->GetOffset() == nextOffset)
-        {
-            /* Resize last fragmented block (can also get smaller) */
-            const VkDeviceSize size = fragmentedBlocks_.back()->GetSize();
-            fragmentedBlocks_.back()->MoveAt(alignedOffset - nextOffset, nextOffset);
-            DecMaxFragmentedBlockSize(size);
-        }
-        else
-        {
-            /* Append new fragmented block at the end */
-            fragmentedBlocks_.push_back(MakeUniqueBlock(alignedOffset - nextOffset, nextOffset));
-        }
-
-        /* Track largest fragmented block size */
-        IncMaxFragmentedBlockSize(fragmentedBlocks_.back()->GetSize());
-    }
-    else
-    {
-        /* Check if last fragmented block can be replaced by new block */
-        if (!fragmentedBlocks_.empty() && fragmentedBlocks_.back()->GetOffset() == nextOffset)
-        {
-            /* Move fragmented block into main blocks and resize it */
-            VKDeviceMemoryRegion* block = TakeOwnership(blocks_, PopBackFragmentedBlock());
-            block->MoveAt(alignedSize, alignedOffset);
-            return block;
-        }
-    }
-
-    /* Allocate new block */
-    return TakeOwnership(blocks_, MakeUniqueBlock(alignedSize, alignedOffset));
-}
-
-VKDeviceMemoryRegion* VKDeviceMemory::InsertBlock(std::unique_ptr<VKDeviceMemoryRegion>&& region)
+// Prints either all allocated or all free blocks of the specified allocator.
+static void PrintTLSFBlocks(std::ostream& s, const VKTLSFAllocator& allocator, bool freeBlocks)
 {
-    VKDeviceMemoryRegion* regionRef = region.get();
-
-    /* Add block by insertion sort */
-    if (!blocks_.empty())
+    VkDeviceSize prevOffsetEnd = 0;
+    for (auto block = allocator.GetFirstBlock(); block != VKTLSFAllocator::invalidBlockID; block = allocator.GetNextBlock(block))
     {
-        for (auto it = blocks_.rbegin(); it != blocks_.rend(); ++it)
+        if (allocator.IsBlockFree(block) == freeBlocks)
         {
-            if ((*it)->GetOffset() < region->GetOffset())
-            {
-                blocks_.insert(it.base(), std::move(region));
-                break;
-            }
+            const VkDeviceSize offset   = allocator.GetBlockOffset(block);
+            const VkDeviceSize size     = allocator.GetBlockSize(block);
+            PrintDeviceMemoryBlock(s, offset, size, prevOffsetEnd);
+            prevOffsetEnd = offset + size;
         }
     }
-    else
-        blocks_.emplace_back(std::move(region));
-
-    return regionRef;
-}
-
-VKDeviceMemoryRegion* VKDeviceMemory::FindReusableBlock(VkDeviceSize alignedSize, VkDeviceSize alignment)
-{
-    VKDeviceMemoryRegion* prevBlock = nullptr;
-    VKDeviceMemoryRegion* nextBlock = nullptr;
-
-    /* Search for fragmented block that fits the requirement */
-    for (auto it = fragmentedBlocks_.begin(); it != fragmentedBlocks_.end(); ++it)
-    {
-        VKDeviceMemoryRegion* block = it->get();
-
-        /* Check if required size plus the additional aligned offset fits into the current block */
-        const VkDeviceSize alignedOffset = GetAlignedSize(block->GetOffset(), alignment);
-        if (alignedSize + alignedOffset - block->GetOffset() <= block->GetSize())
-        {
-            /* If this block has the maximum fragmented block size, this value must be updated */
-            const bool isLargestFragmentedBlock = (block->GetSize() == maxFragmentedBlockSize_);
-
-            /* If block can be reused with its entire size, it can be removed from the fragmented blocks */
-            InsertBlock(std::move(*it));
-
-            it = fragmentedBlocks_.erase(it);
-            if (it != fragmentedBlocks_.end())
-                nextBlock = it->get();
-
-            /* Check if block must be split up at the lower part */
-            if (block->GetOffset() < alignedOffset)
-            {
-                /* Allocate fragmented lower block (left to the current block) */
-                std::unique_ptr<VKDeviceMemoryRegion> blockLower = MakeUniqueBlock(alignedOffset - block->GetOffset(), block->GetOffset());
-
-                if (!prevBlock || !MergeFragmentedBlockWith(*prevBlock, *blockLower))
-                {
-                    it = fragmentedBlocks_.insert(it, std::move(blockLower));
-                    ++it;
-                }
-            }
-
-            /* Check if block must be split up at the upper part */
-            const VkDeviceSize alignedSizeWithOffset = alignedSize + alignedOffset - block->GetOffset();
-            if (alignedSizeWithOffset < block->GetSize())
-            {
-                /* Allocate fragmented upper block (right to the current block) */
-                const VkDeviceSize blockUpperSize = block->GetSize() - alignedSizeWithOffset;
-                std::unique_ptr<VKDeviceMemoryRegion> blockUpper = MakeUniqueBlock(blockUpperSize, block->GetOffsetWithSize() - blockUpperSize);
-
-                if (!nextBlock || !MergeFragmentedBlockWith(*blockUpper, *nextBlock))
-                    fragmentedBlocks_.insert(it, std::move(blockUpper));
-            }
-
-            /* Move reused block to new offset and size */
-            block->MoveAt(alignedSize, alignedOffset);
-
-            if (isLargestFragmentedBlock)
-                UpdateMaxFragmentedBlockSize();
-
-            /* Reuse current block */
-            return block;
-        }
-
-        prevBlock = block;
-    }
-
-    /* No reusable block found */
-    return nullptr;
 }
 
-void VKDeviceMemory::UpdateMaxFragmentedBlockSize()
-{
-    maxFragmentedBlockSize_ = 0;
-    for (const auto& block : fragmentedBlocks_)
-        IncMaxFragmentedBlockSize(block->GetSize());
-}
-
-void VKDeviceMemory::InsertBlockToFragmentsSorted(std::unique_ptr<VKDeviceMemoryRegion>&& region)
-{
-    VkDeviceSize offset = region->GetOffset();
-    std::size_t count = fragmentedBlocks_.size();
-
-    /* Start serach in half-open range [begin, end) */
-    std::size_t begin = 0, end = count;
-
-    while (begin + 2 < end)
-    {
-        /* Check if region's offset is before or after the middle's element */
-        std::size_t center = (begin + end) / 2;
-
-        if (offset < fragmentedBlocks_[center]->GetOffset())
-        {
-            /* Restrict search to lower half */
-            end = center + 1;
-        }
-        else
-        {
-            /* Restrict search to upper half */
-            begin = center;
-        }
-    }
-
-    /* Insert region by insertion-sort of the remaining half-open range [begin, begin + 2) */
-    if (begin < count && offset < fragmentedBlocks_[begin]->GetOffset())
-        InsertBlockToFragmentsAt(std::move(region), begin);
-    else if (begin + 1 < count)
-    {
-        if (offset < fragmentedBlocks_[begin + 1]->GetOffset())
-            InsertBlockToFragmentsAt(std::move(region), begin + 1);
-        else
-            InsertBlockToFragmentsAt(std::move(region), begin + 2);
-    }
-    else
-        InsertBlockToFragmentsAt(std::move(region), count);
-}
-
-void VKDeviceMemory::InsertBlockToFragmentsAt(std::unique_ptr<VKDeviceMemoryRegion>&& region, std::size_t position)
-{
-    std::size_t count = fragmentedBlocks_.size();
-
-    /* Try to merge region into lower part: [LOWER][BLOCK] --> [+++LOWER++++] */
-    if (position > 0 && MergeFragmentedBlockWith(*fragmentedBlocks_[position - 1], *region))
-    {
-        /* Try to merge upper part into lower part: [+++LOWER++++][UPPER] --> [+++++++LOWER+++++++] */
-        if (position < count && MergeFragmentedBlockWith(*fragmentedBlocks_[position - 1], *fragmentedBlocks_[position]))
-        {
-            /* Remove previous upper part after two-phase-merge */
-            const VkDeviceSize size = fragmentedBlocks_[position]->GetSize();
-            fragmentedBlocks_.erase(fragmentedBlocks_.begin() + position);
-            DecMaxFragmentedBlockSize(size);
-        }
-    }
-    /* Try to merge region into upper part: [BLOCK][UPPER] --> [+++UPPER++++] */
-    else if (position >= count || !MergeFragmentedBlockWith(*fragmentedBlocks_[position], *region))
-    {
-        /* Insert new fragmented block: [LOWER]..[BLOCK]..[UPPER] */
-        IncMaxFragmentedBlockSize(region->GetSize());
-        fragmentedBlocks_.insert(fragmentedBlocks_.begin() + position, std::move(region));
-    }
-}
-
-std::unique_ptr<VKDeviceMemoryRegion> VKDeviceMemory::PopBackFragmentedBlock()
-{
-    std::unique_ptr<VKDeviceMemoryRegion> block = std::move(fragmentedBlocks_.back());
-    fragmentedBlocks_.pop_back();
-    DecMaxFragmentedBlockSize(block->GetSize());
-    return block;
-}
-
-bool VKDeviceMemory::MergeFragmentedBlockWith(VKDeviceMemoryRegion& region, VKDeviceMemoryRegion& appendixRegion)
-{
-    if (region.MergeWith(appendixRegion))
-    {
-        IncMaxFragmentedBlockSize(region.GetSize());
-        return true;
-    }
-    return false;
-}
-
-VkDeviceSize VKDeviceMemory::GetFragmentBlockOffsetEnd(std::size_t position) const
-{
-    return fragmentedBlocks_[position]->GetOffsetWithSize();
-}
-
-void VKDeviceMemory::IncMaxFragmentedBlockSize(VkDeviceSize size)
+void VKDeviceMemory::PrintBlocks(std::ostream& s) const
 {
-    maxFragmentedBlockSize_ = std::max(maxFragmentedBlockSize_, size);
+    PrintTLSFBlocks(s, allocator_, false);
 }
 
-void VKDeviceMemory::DecMaxFragmentedBlockSize(VkDeviceSize size)
+void VKDeviceMemory::PrintFragmentedBlocks(std::ostream& s) const
 {
-    if (size == maxFragmentedBlockSize_)
-        UpdateMaxFragmentedBlockSize();
+    PrintTLSFBlocks(s, allocator_, true);
 }
 
+#endif
 
 } // /namespace LLGL
 
@@ -10,6 +10,7 @@
 
 
 #include "VKDeviceMemoryRegion.h"
+#include "VKTLSFAllocator.h"
 #include "../VKPtr.h"
 #include <vulkan/vulkan.h>
 #include <cstdint>
@@ -29,10 +30,14 @@ namespace LLGL
 struct VKDeviceMemoryDetails
 {
     std::size_t     numChunks               = 0;
+    std::size_t     numDedicatedChunks      = 0;    // Number of chunks that were allocated for a single large resource.
     std::size_t     numBlocks               = 0;
-    std::size_t     numFragments            = 0;
-    VkDeviceSize    maxNewBlockSize         = 0;
-    VkDeviceSize    maxFragmentedBlockSize  = 0;
+    std::size_t     numFragments            = 0;    // Number of free blocks.
+    VkDeviceSize    totalSize               = 0;    // Sum of the sizes of all chunks.
+    VkDeviceSize    allocatedSize           = 0;    // Sum of the sizes of all allocated blocks.
+    VkDeviceSize    maxFragmentedBlockSize  = 0;    // Size of the largest free block across all chunks.
+    std::size_t     numDefragMoves          = 0;    // Number of blocks moved by all defragmentation passes.
+    VkDeviceSize    numDefragBytesMoved     = 0;    // Number of bytes moved by all defragmentation passes.
 };
 
 // An instance of this class holds a single VkDeviceMemory allocation chunk.
@@ -53,7 +58,7 @@ class VKDeviceMemory
         void Unmap(VkDevice device);
 
         // Tries to allocate a new block within this device memory chunk, and returns null of failure.
-        VKDeviceMemoryRegion* Allocate(VkDeviceSize size, VkDeviceSize alignment, bool reduceFragmentation = false);
+        VKDeviceMemoryRegion* Allocate(VkDeviceSize size, VkDeviceSize alignment);
 
         // Releases the specified block within this device memory chunk.
         void Release(VKDeviceMemoryRegion* region);
@@ -64,6 +69,12 @@ class VKDeviceMemory
         // Returns the maximal size that can be allocated for a device memory region within this device memory chunk.
         VkDeviceSize GetMaxAllocationSize() const;
 
+        // Returns the sum of the sizes of all allocated blocks within this device memory chunk.
+        VkDeviceSize GetAllocatedSize() const;
+
+        // Appends all allocated regions of this device memory chunk to the output container in order of their offsets.
+        void GetAllocatedRegions(std::vector<VKDeviceMemoryRegion*>& outRegions) const;
+
         // Accumulates the memory details of this device memory into the output structure.
         void AccumDetails(VKDeviceMemoryDetails& details) const;
 
@@ -92,58 +103,14 @@ class VKDeviceMemory
             return memoryTypeIndex_;
         }
 
-    private:
-
-        // Returns the next offset after the last block.
-        VkDeviceSize GetNextOffset() const;
-
-        // Makes a new device memory block.
-        std::unique_ptr<VKDeviceMemoryRegion> MakeUniqueBlock(VkDeviceSize alignedSize, VkDeviceSize alignedOffset);
-
-        // Allocates a new block.
-        VKDeviceMemoryRegion* AllocAndAppendBlock(VkDeviceSize alignedSize, VkDeviceSize alignedOffset);
-
-        // Inserts the specified region into the main block list by insertion-sort.
-        VKDeviceMemoryRegion* InsertBlock(std::unique_ptr<VKDeviceMemoryRegion>&& region);
-
-        // Tries to find a fragmented block that can be reused.
-        VKDeviceMemoryRegion* FindReusableBlock(VkDeviceSize alignedSize, VkDeviceSize alignment);
-
-        // Updates the maximal size of fragmanted blocks.
-        void UpdateMaxFragmentedBlockSize();
-
-        // Inserts the specified region into the fragmented block list by insertion-sort.
-        void InsertBlockToFragmentsSorted(std::unique_ptr<VKDeviceMemoryRegion>&& region);
-
-        // Inserts the specified region into the fragmented block list at the specified position and merges it with surrounding blocks if possible.
-        void InsertBlockToFragmentsAt(std::unique_ptr<VKDeviceMemoryRegion>&& region, std::size_t position);
-
-        // Pops the last block off the fragments blocks and returns it.
-        std::unique_ptr<VKDeviceMemoryRegion> PopBackFragmentedBlock();
-
-        // Merges the two fragmented blocks and records the maximal fragmented block size.
-        bool MergeFragmentedBlockWith(VKDeviceMemoryRegion& region, VKDeviceMemoryRegion& appendixRegion);
-
-        // Returns the offset after the specified fragmented block.
-        VkDeviceSize GetFragmentBlockOffsetEnd(std::size_t position) const;
-
-        // Increases the maximal fragmented block size.
-        void IncMaxFragmentedBlockSize(VkDeviceSize size);
-
-        // Updates the maximal fragmented block size if the input size equals the current maximum size.
-        void DecMaxFragmentedBlockSize(VkDeviceSize size);
-
     private:
 
         VKPtr<VkDeviceMemory>                               deviceMemory_;
         VkDeviceSize                                        size_                   = 0;
         std::uint32_t                                       memoryTypeIndex_        = 0;
 
-        VkDeviceSize                                        maxNewBlockSize_        = 0;
-        std::vector<std::unique_ptr<VKDeviceMemoryRegion>>  blocks_;
-
-        VkDeviceSize                                        maxFragmentedBlockSize_ = 0;
-        std::vector<std::unique_ptr<VKDeviceMemoryRegion>>  fragmentedBlocks_;
+        VKTLSFAllocator                                     allocator_;
+        std::vector<std::unique_ptr<VKDeviceMemoryRegion>>  regions_;               // Allocated regions indexed by their allocator block IDs.
 
 };
 
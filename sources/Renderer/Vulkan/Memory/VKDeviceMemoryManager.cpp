@@ -8,6 +8,7 @@
 #include "VKDeviceMemoryManager.h"
 #include "../VKCore.h"
 #include "../../ContainerTypes.h"
+#include "../../../Core/CoreUtils.h"
 
 
 namespace LLGL
@@ -31,27 +32,35 @@ VKDeviceMemoryRegion* VKDeviceMemoryManager::Allocate(
     VkDeviceSize            size,
     VkDeviceSize            alignment,
     std::uint32_t           memoryTypeBits,
-    VkMemoryPropertyFlags   properties)
+    VkMemoryPropertyFlags   properties,
+    bool                    optimalTiling)
 {
     const VkDeviceSize  alignedSize     = GetAlignedSize(size, alignment);
-    const VkDeviceSize  allocationSize  = std::max(minAllocationSize_, alignedSize);
     const std::uint32_t memoryTypeIndex = FindMemoryType(memoryTypeBits, properties);
 
-    if (VKDeviceMemory* chunk = FindOrAllocChunk(allocationSize, memoryTypeIndex, alignedSize))
+    /* Allocate dedicated chunk for large resources, so they don't waste the remainder of a shared chunk */
+    if (alignedSize > minAllocationSize_ / 2)
+    {
+        VKDeviceMemory* chunk = AllocChunk(alignedSize, memoryTypeIndex);
+        ++numDedicatedChunks_;
         return chunk->Allocate(size, alignment);
-    else
-        return nullptr;
+    }
+
+    /* Allocate block within the pool of the respective memory type and tiling */
+    return AllocateInPool(GetOrCreatePool(memoryTypeIndex, optimalTiling), size, alignment, memoryTypeIndex);
 }
 
 VKDeviceMemoryRegion* VKDeviceMemoryManager::Allocate(
     const VkMemoryRequirements& requirements,
-    VkMemoryPropertyFlags       properties)
+    VkMemoryPropertyFlags       properties,
+    bool                        optimalTiling)
 {
     return Allocate(
         requirements.size,
         requirements.alignment,
         requirements.memoryTypeBits,
-        properties
+        properties,
+        optimalTiling
     );
 }
 
@@ -64,19 +73,42 @@ void VKDeviceMemoryManager::Release(VKDeviceMemoryRegion* region)
             /* Release block in chunk */
             chunk->Release(region);
 
-            /* Release chunk if it's empty */
+            /* Release chunk if it's empty, otherwise move it into the bin of its new largest free block */
             if (chunk->IsEmpty())
-                chunks_.erase(chunk);
+                ReleaseChunk(chunk);
+            else if (VKDeviceMemoryPool* pool = FindPoolOfChunk(chunk))
+                pool->Update(chunk);
         }
     }
 }
 
+std::size_t VKDeviceMemoryManager::Defragment(std::size_t maxMoves, const MoveRegionCallback& moveCallback)
+{
+    std::size_t numMoves = 0;
+
+    for (auto& poolsPerType : pools_)
+    {
+        for (auto& pool : poolsPerType)
+        {
+            if (numMoves >= maxMoves)
+                return numMoves;
+            if (pool)
+                numMoves += DefragmentPool(*pool, maxMoves - numMoves, moveCallback);
+        }
+    }
+
+    return numMoves;
+}
+
 VKDeviceMemoryDetails VKDeviceMemoryManager::QueryDetails() const
 {
     VKDeviceMemoryDetails details;
     {
         for (const auto& chunk : chunks_)
             chunk->AccumDetails(details);
+        details.numDedicatedChunks  = numDedicatedChunks_;
+        details.numDefragMoves      = numDefragMoves_;
+        details.numDefragBytesMoved = numDefragBytesMoved_;
     }
     return details;
 }
@@ -124,17 +156,134 @@ VKDeviceMemory* VKDeviceMemoryManager::AllocChunk(VkDeviceSize size, std::uint32
     return chunks_.emplace<VKDeviceMemory>(device_, size, memoryTypeIndex);
 }
 
-VKDeviceMemory* VKDeviceMemoryManager::FindOrAllocChunk(VkDeviceSize allocationSize, std::uint32_t memoryTypeIndex, VkDeviceSize minFreeBlockSize)
+VKDeviceMemoryPool& VKDeviceMemoryManager::GetOrCreatePool(std::uint32_t memoryTypeIndex, bool optimalTiling)
 {
-    /* Search for a suitable chunk */
-    for (const auto& chunk : chunks_)
+    std::unique_ptr<VKDeviceMemoryPool>& pool = pools_[memoryTypeIndex][optimalTiling ? 1 : 0];
+    if (!pool)
+        pool = MakeUnique<VKDeviceMemoryPool>();
+    return *pool;
+}
+
+VKDeviceMemoryRegion* VKDeviceMemoryManager::AllocateInPool(VKDeviceMemoryPool& pool, VkDeviceSize size, VkDeviceSize alignment, std::uint32_t memoryTypeIndex)
+{
+    /* Try to allocate block within an existing chunk */
+    if (VKDeviceMemoryRegion* region = AllocateInExistingChunks(pool, size, alignment))
+        return region;
+
+    /* Allocate new chunk and add it to the pool */
+    VKDeviceMemory* chunk = AllocChunk(minAllocationSize_, memoryTypeIndex);
+    VKDeviceMemoryRegion* region = chunk->Allocate(size, alignment);
+    pool.Insert(chunk);
+    return region;
+}
+
+VKDeviceMemoryRegion* VKDeviceMemoryManager::AllocateInExistingChunks(VKDeviceMemoryPool& pool, VkDeviceSize size, VkDeviceSize alignment)
+{
+    const VkDeviceSize alignedSize = GetAlignedSize(size, alignment);
+
+    /*
+    Select chunk from the size class bins of the pool in constant time.
+    With reduced fragmentation, the chunk with the smallest sufficient free block is filled up first (best fit).
+    */
+    if (VKDeviceMemory* chunk = pool.FindChunk(alignedSize, alignment, reduceFragmentation_))
+    {
+        if (VKDeviceMemoryRegion* region = chunk->Allocate(size, alignment))
+        {
+            pool.Update(chunk);
+            return region;
+        }
+    }
+
+    /* Otherwise, try the chunks whose largest free block is in the exact size class, since it might still fit with its alignment */
+    for (VKDeviceMemory* chunk : pool.GetChunksInSizeClass(alignedSize))
+    {
+        if (chunk->GetMaxAllocationSize() >= alignedSize)
+        {
+            if (VKDeviceMemoryRegion* region = chunk->Allocate(size, alignment))
+            {
+                pool.Update(chunk);
+                return region;
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+VKDeviceMemoryPool* VKDeviceMemoryManager::FindPoolOfChunk(const VKDeviceMemory* chunk)
+{
+    for (auto& pool : pools_[chunk->GetMemoryTypeIndex()])
+    {
+        if (pool && pool->Contains(chunk))
+            return pool.get();
+    }
+    return nullptr;
+}
+
+void VKDeviceMemoryManager::ReleaseChunk(VKDeviceMemory* chunk)
+{
+    if (VKDeviceMemoryPool* pool = FindPoolOfChunk(chunk))
+        pool->Remove(chunk);
+    else
+        --numDedicatedChunks_;
+
+    chunks_.erase(chunk);
+}
+
+std::size_t VKDeviceMemoryManager::DefragmentPool(VKDeviceMemoryPool& pool, std::size_t maxMoves, const MoveRegionCallback& moveCallback)
+{
+    if (pool.GetNumChunks() < 2 || maxMoves == 0)
+        return 0;
+
+    /* Select least occupied chunk as source, since it requires the fewest moves to be released */
+    VKDeviceMemory* srcChunk = nullptr;
+    for (const auto& entry : pool.GetChunks())
     {
-        if (chunk->GetMaxAllocationSize() >= minFreeBlockSize && chunk->GetMemoryTypeIndex() == memoryTypeIndex)
-            return chunk.get();
+        if (srcChunk == nullptr || entry.first->GetAllocatedSize() < srcChunk->GetAllocatedSize())
+            srcChunk = entry.first;
     }
 
-    /* Allocate new chunk */
-    return AllocChunk(allocationSize, memoryTypeIndex);
+    std::vector<VKDeviceMemoryRegion*> srcRegions;
+    srcChunk->GetAllocatedRegions(srcRegions);
+
+    /* Take source chunk out of the pool during this pass, so no block is moved within the same chunk */
+    pool.Remove(srcChunk);
+
+    std::size_t numMoves = 0;
+
+    for (VKDeviceMemoryRegion* srcRegion : srcRegions)
+    {
+        if (numMoves >= maxMoves)
+            break;
+
+        /* Allocate destination block within any other chunk of the same pool; stop if the remaining chunks are full */
+        VKDeviceMemoryRegion* dstRegion = AllocateInExistingChunks(pool, srcRegion->GetSize(), srcRegion->GetAlignment());
+        if (dstRegion == nullptr)
+            break;
+
+        const VkDeviceSize size = srcRegion->GetSize();
+        if (moveCallback(*srcRegion, *dstRegion))
+        {
+            /* Release source block; the source chunk is released below once it is empty */
+            srcChunk->Release(srcRegion);
+            ++numMoves;
+            ++numDefragMoves_;
+            numDefragBytesMoved_ += size;
+        }
+        else
+        {
+            /* Owner of the source block rejected the move */
+            Release(dstRegion);
+        }
+    }
+
+    /* Release source chunk if all of its blocks have been moved, otherwise put it back into the pool */
+    if (srcChunk->IsEmpty())
+        chunks_.erase(srcChunk);
+    else
+        pool.Insert(srcChunk);
+
+    return numMoves;
 }
 
 
@@ -15,8 +15,10 @@
 #include "../../ContainerTypes.h"
 #include "VKDeviceMemory.h"
 #include "VKDeviceMemoryRegion.h"
+#include "VKDeviceMemoryPool.h"
 #include <vector>
 #include <memory>
+#include <functional>
 
 
 namespace LLGL
@@ -28,6 +30,8 @@ Vulkan device memory manager. Memory allocations are stored in a small hierarchy
  - Chunk: denotes a single Vulkan memory allocation of type VkDeviceMemory
  - Block: denotes one of multiple regions inside a chunk of type VkBuffer
  - Region: denotes a sub-range inside a block and holds a reference to the VkBuffer and its offset and size (both of type VkDeviceSize).
+Chunks are pooled per memory type and per tiling (linear for buffers, optimal for images), so linear and optimal resources never share a chunk
+and the device's bufferImageGranularity never applies. Resources that would occupy more than half a chunk get a dedicated chunk.
 */
 class VKDeviceMemoryManager
 {
@@ -44,23 +48,41 @@ class VKDeviceMemoryManager
         VKDeviceMemoryManager(const VKDeviceMemoryManager&) = delete;
         VKDeviceMemoryManager& operator = (const VKDeviceMemoryManager&) = delete;
 
+        /*
+        Callback to move the contents of a resource from the source region into the destination region during defragmentation.
+        The callback must copy the resource data, bind the resource to the destination region, and return true on success.
+        If the callback returns false, the destination region is released again and the resource remains in the source region.
+        */
+        using MoveRegionCallback = std::function<bool(VKDeviceMemoryRegion& srcRegion, VKDeviceMemoryRegion& dstRegion)>;
+
+    public:
+
         // Allocates a new device memory block of the specified size and with the specified attributes.
         VKDeviceMemoryRegion* Allocate(
             VkDeviceSize            size,
             VkDeviceSize            alignment,
             std::uint32_t           memoryTypeBits,
-            VkMemoryPropertyFlags   properties
+            VkMemoryPropertyFlags   properties,
+            bool                    optimalTiling   = false
         );
 
         // Allocates a new device memory block with the specified memory requirements.
         VKDeviceMemoryRegion* Allocate(
             const VkMemoryRequirements& requirements,
-            VkMemoryPropertyFlags       properties
+            VkMemoryPropertyFlags       properties,
+            bool                        optimalTiling   = false
         );
 
         // Releases the specified device memory block.
         void Release(VKDeviceMemoryRegion* region);
 
+        /*
+        Runs an incremental defragmentation pass and returns the number of blocks that have been moved.
+        For each pool with more than one chunk, the blocks of its least occupied chunk are moved into the other chunks of that pool,
+        so the source chunk is eventually released. At most 'maxMoves' blocks are moved per call.
+        */
+        std::size_t Defragment(std::size_t maxMoves, const MoveRegionCallback& moveCallback);
+
         // Queries the memory details of all chunks.
         VKDeviceMemoryDetails QueryDetails() const;
 
@@ -84,8 +106,23 @@ class VKDeviceMemoryManager
         // Allocates a new VkDeviceMemory chunk of the specified size and memory type.
         VKDeviceMemory* AllocChunk(VkDeviceSize allocationSize, std::uint32_t memoryTypeIndex);
 
-        // Finds a suitable device memory chunk or allocates a new one.
-        VKDeviceMemory* FindOrAllocChunk(VkDeviceSize allocationSize, std::uint32_t memoryTypeIndex, VkDeviceSize minFreeBlockSize);
+        // Returns the pool of the specified memory type and tiling and creates it on demand.
+        VKDeviceMemoryPool& GetOrCreatePool(std::uint32_t memoryTypeIndex, bool optimalTiling);
+
+        // Allocates a block within one of the chunks of the specified pool or within a new chunk.
+        VKDeviceMemoryRegion* AllocateInPool(VKDeviceMemoryPool& pool, VkDeviceSize size, VkDeviceSize alignment, std::uint32_t memoryTypeIndex);
+
+        // Allocates a block within one of the chunks of the specified pool, but never allocates a new chunk.
+        VKDeviceMemoryRegion* AllocateInExistingChunks(VKDeviceMemoryPool& pool, VkDeviceSize size, VkDeviceSize alignment);
+
+        // Returns the pool the specified chunk belongs to, or null if the chunk is dedicated to a single resource.
+        VKDeviceMemoryPool* FindPoolOfChunk(const VKDeviceMemory* chunk);
+
+        // Removes the specified chunk from its pool and releases it.
+        void ReleaseChunk(VKDeviceMemory* chunk);
+
+        // Moves up to 'maxMoves' blocks out of the least occupied chunk of the specified pool.
+        std::size_t DefragmentPool(VKDeviceMemoryPool& pool, std::size_t maxMoves, const MoveRegionCallback& moveCallback);
 
     private:
 
@@ -96,6 +133,11 @@ class VKDeviceMemoryManager
         bool                                        reduceFragmentation_    = false;
 
         UnorderedUniquePtrVector<VKDeviceMemory>    chunks_;
+        std::unique_ptr<VKDeviceMemoryPool>         pools_[VK_MAX_MEMORY_TYPES][2]; // Indexed by memory type and tiling (0 = linear, 1 = optimal).
+
+        std::size_t                                 numDedicatedChunks_     = 0;
+        std::size_t                                 numDefragMoves_         = 0;
+        VkDeviceSize                                numDefragBytesMoved_    = 0;
 
 };
 
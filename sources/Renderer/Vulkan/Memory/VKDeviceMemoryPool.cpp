@@ -0,0 +1,139 @@
+/*
+ * VKDeviceMemoryPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKDeviceMemoryPool.h"
+#include "VKDeviceMemory.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+constexpr std::uint32_t VKDeviceMemoryPool::slIndexCount;
+constexpr std::uint32_t VKDeviceMemoryPool::flIndexCount;
+constexpr std::uint32_t VKDeviceMemoryPool::invalidBinIndex;
+
+void VKDeviceMemoryPool::Insert(VKDeviceMemory* chunk)
+{
+    const std::uint32_t bin = GetBinIndex(chunk);
+    chunkBins_[chunk] = bin;
+    InsertIntoBin(chunk, bin);
+}
+
+bool VKDeviceMemoryPool::Remove(VKDeviceMemory* chunk)
+{
+    auto it = chunkBins_.find(chunk);
+    if (it == chunkBins_.end())
+        return false;
+
+    RemoveFromBin(chunk, it->second);
+    chunkBins_.erase(it);
+    return true;
+}
+
+void VKDeviceMemoryPool::Update(VKDeviceMemory* chunk)
+{
+    auto it = chunkBins_.find(chunk);
+    if (it != chunkBins_.end())
+    {
+        /* Only move chunk if its largest free block moved into another size class */
+        const std::uint32_t bin = GetBinIndex(chunk);
+        if (it->second != bin)
+        {
+            RemoveFromBin(chunk, it->second);
+            InsertIntoBin(chunk, bin);
+            it->second = bin;
+        }
+    }
+}
+
+bool VKDeviceMemoryPool::Contains(const VKDeviceMemory* chunk) const
+{
+    return (chunkBins_.find(const_cast<VKDeviceMemory*>(chunk)) != chunkBins_.end());
+}
+
+VKDeviceMemory* VKDeviceMemoryPool::FindChunk(VkDeviceSize size, VkDeviceSize alignment, bool bestFit) const
+{
+    /* Find size class that fits the worst case padding, just like the TLSF allocator of each chunk does */
+    std::uint32_t fl = 0, sl = 0;
+    if (!VKTLSFSizeClassBitmap::MapSizeRoundUp(size + alignment - 1, fl, sl))
+        return nullptr;
+
+    if (bestFit)
+    {
+        if (!binBitmap_.FindLowest(fl, sl))
+            return nullptr;
+    }
+    else
+    {
+        std::uint32_t flMax = 0, slMax = 0;
+        if (!binBitmap_.FindHighest(flMax, slMax) || flMax < fl || (flMax == fl && slMax < sl))
+            return nullptr;
+        fl = flMax;
+        sl = slMax;
+    }
+
+    return bins_[fl * slIndexCount + sl].back();
+}
+
+const std::vector<VKDeviceMemory*>& VKDeviceMemoryPool::GetChunksInSizeClass(VkDeviceSize size) const
+{
+    std::uint32_t fl = 0, sl = 0;
+    VKTLSFSizeClassBitmap::MapSize(size, fl, sl);
+    return bins_[fl * slIndexCount + sl];
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+std::uint32_t VKDeviceMemoryPool::GetBinIndex(const VKDeviceMemory* chunk)
+{
+    const VkDeviceSize maxSize = chunk->GetMaxAllocationSize();
+    if (maxSize == 0)
+        return invalidBinIndex;
+
+    std::uint32_t fl = 0, sl = 0;
+    VKTLSFSizeClassBitmap::MapSize(maxSize, fl, sl);
+    return (fl * slIndexCount + sl);
+}
+
+void VKDeviceMemoryPool::InsertIntoBin(VKDeviceMemory* chunk, std::uint32_t bin)
+{
+    if (bin == invalidBinIndex)
+        return;
+
+    bins_[bin].push_back(chunk);
+    binBitmap_.Set(bin / slIndexCount, bin % slIndexCount);
+}
+
+void VKDeviceMemoryPool::RemoveFromBin(VKDeviceMemory* chunk, std::uint32_t bin)
+{
+    if (bin == invalidBinIndex)
+        return;
+
+    /* Bins only hold chunks with similar free space, so this search is short */
+    std::vector<VKDeviceMemory*>& chunks = bins_[bin];
+    auto it = std::find(chunks.begin(), chunks.end(), chunk);
+    if (it != chunks.end())
+    {
+        *it = chunks.back();
+        chunks.pop_back();
+    }
+
+    if (chunks.empty())
+        binBitmap_.Clear(bin / slIndexCount, bin % slIndexCount);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
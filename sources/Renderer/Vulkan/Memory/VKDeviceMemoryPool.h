@@ -0,0 +1,101 @@
+/*
+ * VKDeviceMemoryPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_DEVICE_MEMORY_POOL_H
+#define LLGL_VK_DEVICE_MEMORY_POOL_H
+
+
+#include <vulkan/vulkan.h>
+#include "VKTLSFAllocator.h"
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class VKDeviceMemory;
+
+/*
+Pool of device memory chunks of one memory type and tiling; used by <VKDeviceMemoryManager>.
+Chunks are binned by the size of their largest free block with the same size classes as the TLSF allocator,
+so a chunk that fits an allocation is found in constant time instead of scanning all chunks of the pool.
+*/
+class VKDeviceMemoryPool
+{
+
+    public:
+
+        // Adds the specified chunk to this pool.
+        void Insert(VKDeviceMemory* chunk);
+
+        // Removes the specified chunk from this pool. Returns false if the chunk does not belong to this pool.
+        bool Remove(VKDeviceMemory* chunk);
+
+        // Moves the specified chunk into the bin of its largest free block. Must be called after a block has been allocated or released within the chunk.
+        void Update(VKDeviceMemory* chunk);
+
+        // Returns true if the specified chunk belongs to this pool.
+        bool Contains(const VKDeviceMemory* chunk) const;
+
+        /*
+        Returns a chunk whose largest free block is guaranteed to fit the specified size with alignment, or null if there is none.
+        With best fit, the chunk with the smallest sufficient block is selected, so the fullest chunks are filled up first.
+        Otherwise, the chunk with the largest free block is selected.
+        */
+        VKDeviceMemory* FindChunk(VkDeviceSize size, VkDeviceSize alignment, bool bestFit) const;
+
+        // Returns the chunks whose largest free block is in the size class of the specified size. These might still fit an allocation that FindChunk rejected.
+        const std::vector<VKDeviceMemory*>& GetChunksInSizeClass(VkDeviceSize size) const;
+
+        // Returns the number of chunks in this pool.
+        inline std::size_t GetNumChunks() const
+        {
+            return chunkBins_.size();
+        }
+
+        // Returns the container of all chunks in this pool, each mapped to the index of its bin.
+        inline const std::unordered_map<VKDeviceMemory*, std::uint32_t>& GetChunks() const
+        {
+            return chunkBins_;
+        }
+
+    private:
+
+        static constexpr std::uint32_t slIndexCount = VKTLSFSizeClassBitmap::slIndexCount;
+        static constexpr std::uint32_t flIndexCount = VKTLSFSizeClassBitmap::flIndexCount;
+
+        // Bin index of chunks without any free memory; these chunks are not stored in any bin.
+        static constexpr std::uint32_t invalidBinIndex = ~0u;
+
+    private:
+
+        // Returns the bin index for the largest free block of the specified chunk or invalidBinIndex if the chunk is full.
+        static std::uint32_t GetBinIndex(const VKDeviceMemory* chunk);
+
+        void InsertIntoBin(VKDeviceMemory* chunk, std::uint32_t bin);
+        void RemoveFromBin(VKDeviceMemory* chunk, std::uint32_t bin);
+
+    private:
+
+        VKTLSFSizeClassBitmap                               binBitmap_;
+        std::vector<VKDeviceMemory*>                        bins_[flIndexCount * slIndexCount];
+        std::unordered_map<VKDeviceMemory*, std::uint32_t>  chunkBins_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -25,7 +25,14 @@ class VKDeviceMemoryRegion
 
     public:
 
-        VKDeviceMemoryRegion(VKDeviceMemory* deviceMemory, VkDeviceSize alignedSize, VkDeviceSize alignedOffset, std::uint32_t memoryTypeIndex);
+        VKDeviceMemoryRegion(
+            VKDeviceMemory* deviceMemory,
+            VkDeviceSize    alignedSize,
+            VkDeviceSize    alignedOffset,
+            VkDeviceSize    alignment,
+            std::uint32_t   memoryTypeIndex,
+            std::uint32_t   blockID
+        );
 
         // Binds the specified buffer to this memory region.
         void BindBuffer(VkDevice device, VkBuffer buffer);
@@ -57,6 +64,12 @@ class VKDeviceMemoryRegion
             return offset_ + size_;
         }
 
+        // Returns the alignment this region was allocated with.
+        inline VkDeviceSize GetAlignment() const
+        {
+            return alignment_;
+        }
+
         // Returns the memory type index.
         inline std::uint32_t GetMemoryTypeIndex() const
         {
@@ -67,18 +80,20 @@ class VKDeviceMemoryRegion
 
         friend class VKDeviceMemory;
 
-        // Tries to merge the specified region into this region, and returns true on success.
-        bool MergeWith(VKDeviceMemoryRegion& other);
-
-        // Sets the new size and offset.
-        void MoveAt(VkDeviceSize alignedSize, VkDeviceSize alignedOffset);
+        // Returns the ID of the allocator block this region occupies within its parent chunk.
+        inline std::uint32_t GetBlockID() const
+        {
+            return blockID_;
+        }
 
     private:
 
         VKDeviceMemory* deviceMemory_       = nullptr;
         VkDeviceSize    size_               = 0;
         VkDeviceSize    offset_             = 0;
+        VkDeviceSize    alignment_          = 1;
         std::uint32_t   memoryTypeIndex_    = 0;
+        std::uint32_t   blockID_            = 0;
 
 };
 
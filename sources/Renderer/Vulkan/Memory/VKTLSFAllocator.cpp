@@ -0,0 +1,398 @@
+/*
+ * VKTLSFAllocator.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKTLSFAllocator.h"
+#include "../../../Core/CoreUtils.h"
+#include "../../../Core/Assertion.h"
+#include <algorithm>
+
+#ifdef _MSC_VER
+#   include <intrin.h>
+#endif
+
+
+namespace LLGL
+{
+
+
+// Returns the index of the most significant bit. The input must not be zero.
+static std::uint32_t BitScanReverse64(std::uint64_t value)
+{
+    #if defined _MSC_VER && defined _WIN64
+    unsigned long index = 0;
+    _BitScanReverse64(&index, value);
+    return static_cast<std::uint32_t>(index);
+    #elif defined __GNUC__ || defined __clang__
+    return static_cast<std::uint32_t>(63 - __builtin_clzll(value));
+    #else
+    std::uint32_t index = 0;
+    while (value >>= 1)
+        ++index;
+    return index;
+    #endif
+}
+
+// Returns the index of the least significant bit. The input must not be zero.
+static std::uint32_t BitScanForward64(std::uint64_t value)
+{
+    #if defined _MSC_VER && defined _WIN64
+    unsigned long index = 0;
+    _BitScanForward64(&index, value);
+    return static_cast<std::uint32_t>(index);
+    #elif defined __GNUC__ || defined __clang__
+    return static_cast<std::uint32_t>(__builtin_ctzll(value));
+    #else
+    std::uint32_t index = 0;
+    while ((value & 1) == 0)
+    {
+        value >>= 1;
+        ++index;
+    }
+    return index;
+    #endif
+}
+
+static bool FitsIntoBlock(std::uint64_t blockOffset, std::uint64_t blockSize, std::uint64_t size, std::uint64_t alignment)
+{
+    const std::uint64_t padding = GetAlignedSize(blockOffset, alignment) - blockOffset;
+    return (padding + size <= blockSize);
+}
+
+
+/*
+ * VKTLSFSizeClassBitmap class
+ */
+
+constexpr std::uint32_t VKTLSFSizeClassBitmap::slIndexBits;
+constexpr std::uint32_t VKTLSFSizeClassBitmap::slIndexCount;
+constexpr std::uint32_t VKTLSFSizeClassBitmap::flIndexCount;
+
+void VKTLSFSizeClassBitmap::MapSize(std::uint64_t size, std::uint32_t& fl, std::uint32_t& sl)
+{
+    if (size < slIndexCount)
+    {
+        /* Small sizes are mapped linearly into the first level */
+        fl = 0;
+        sl = static_cast<std::uint32_t>(size);
+    }
+    else
+    {
+        /* First level is the power of two, second level subdivides it linearly */
+        const std::uint32_t msb = BitScanReverse64(size);
+        fl = msb - slIndexBits + 1;
+        sl = static_cast<std::uint32_t>(size >> (msb - slIndexBits)) & (slIndexCount - 1);
+    }
+}
+
+bool VKTLSFSizeClassBitmap::MapSizeRoundUp(std::uint64_t size, std::uint32_t& fl, std::uint32_t& sl)
+{
+    /* Round up to the next size class, so every size in that class is large enough */
+    if (size >= slIndexCount)
+    {
+        const std::uint64_t round = (1ull << (BitScanReverse64(size) - slIndexBits)) - 1;
+        if (size + round < size)
+            return false;
+        size += round;
+    }
+
+    MapSize(size, fl, sl);
+    return (fl < flIndexCount);
+}
+
+void VKTLSFSizeClassBitmap::Set(std::uint32_t fl, std::uint32_t sl)
+{
+    flBitmap_       |= (1ull << fl);
+    slBitmaps_[fl]  |= (1u << sl);
+}
+
+void VKTLSFSizeClassBitmap::Clear(std::uint32_t fl, std::uint32_t sl)
+{
+    slBitmaps_[fl] &= ~(1u << sl);
+    if (slBitmaps_[fl] == 0)
+        flBitmap_ &= ~(1ull << fl);
+}
+
+bool VKTLSFSizeClassBitmap::FindLowest(std::uint32_t& fl, std::uint32_t& sl) const
+{
+    /* Search for a non-empty class in the same first level, otherwise in the next higher first level */
+    std::uint32_t slMap = slBitmaps_[fl] & (~0u << sl);
+    if (slMap == 0)
+    {
+        const std::uint64_t flMap = (fl + 1 < flIndexCount ? flBitmap_ & (~0ull << (fl + 1)) : 0);
+        if (flMap == 0)
+            return false;
+
+        fl      = BitScanForward64(flMap);
+        slMap   = slBitmaps_[fl];
+    }
+
+    sl = BitScanForward64(slMap);
+    return true;
+}
+
+bool VKTLSFSizeClassBitmap::FindHighest(std::uint32_t& fl, std::uint32_t& sl) const
+{
+    if (flBitmap_ == 0)
+        return false;
+
+    fl = BitScanReverse64(flBitmap_);
+    sl = BitScanReverse64(slBitmaps_[fl]);
+    return true;
+}
+
+
+/*
+ * VKTLSFAllocator class
+ */
+
+constexpr VKTLSFAllocator::BlockID VKTLSFAllocator::invalidBlockID;
+
+VKTLSFAllocator::VKTLSFAllocator(std::uint64_t size) :
+    size_ { size }
+{
+    for (auto& freeList : freeLists_)
+        std::fill(std::begin(freeList), std::end(freeList), invalidBlockID);
+
+    /* Start with a single free block that spans the entire range */
+    if (size > 0)
+    {
+        firstBlock_ = NewBlock(0, size);
+        InsertFreeBlock(firstBlock_);
+    }
+}
+
+VKTLSFAllocator::BlockID VKTLSFAllocator::Allocate(std::uint64_t size, std::uint64_t alignment)
+{
+    if (size == 0)
+        return invalidBlockID;
+
+    alignment = std::max<std::uint64_t>(1, alignment);
+
+    /*
+    Find a free block that fits the worst case padding in constant time.
+    If there is none, search the list of the exact size class since it might still contain a block that fits.
+    */
+    BlockID block = FindFreeBlock(size + alignment - 1);
+    if (block == invalidBlockID)
+    {
+        block = FindFreeBlockInList(size, alignment);
+        if (block == invalidBlockID)
+            return invalidBlockID;
+    }
+
+    RemoveFreeBlock(block);
+
+    /* Split off the padding at the lower end to satisfy the alignment; its lower neighbor cannot be free, since free blocks are always coalesced */
+    const std::uint64_t padding = GetAlignedSize(blocks_[block].offset, alignment) - blocks_[block].offset;
+    if (padding > 0)
+    {
+        const BlockID upperBlock = SplitBlock(block, padding);
+        InsertFreeBlock(block);
+        block = upperBlock;
+    }
+
+    /* Split off the remainder at the upper end */
+    if (blocks_[block].size > size)
+    {
+        const BlockID remainderBlock = SplitBlock(block, size);
+        InsertFreeBlock(remainderBlock);
+    }
+
+    blocks_[block].isFree = false;
+    allocatedSize_ += blocks_[block].size;
+    ++numAllocatedBlocks_;
+
+    return block;
+}
+
+void VKTLSFAllocator::Free(BlockID block)
+{
+    LLGL_ASSERT(block < blocks_.size() && !blocks_[block].isFree, "invalid TLSF block to free");
+
+    allocatedSize_ -= blocks_[block].size;
+    --numAllocatedBlocks_;
+
+    /* Merge with upper neighbor: [BLOCK][UPPER] --> [+++BLOCK++++] */
+    const BlockID nextBlock = blocks_[block].nextPhys;
+    if (nextBlock != invalidBlockID && blocks_[nextBlock].isFree)
+    {
+        RemoveFreeBlock(nextBlock);
+        MergeWithNextBlock(block);
+    }
+
+    /* Merge with lower neighbor: [LOWER][BLOCK] --> [+++LOWER++++] */
+    const BlockID prevBlock = blocks_[block].prevPhys;
+    if (prevBlock != invalidBlockID && blocks_[prevBlock].isFree)
+    {
+        RemoveFreeBlock(prevBlock);
+        MergeWithNextBlock(prevBlock);
+        block = prevBlock;
+    }
+
+    InsertFreeBlock(block);
+}
+
+std::uint64_t VKTLSFAllocator::GetMaxFreeBlockSize() const
+{
+    /* Only the list of the highest size class must be searched */
+    std::uint32_t fl = 0, sl = 0;
+    if (!freeListBitmap_.FindHighest(fl, sl))
+        return 0;
+
+    std::uint64_t maxSize = 0;
+    for (BlockID block = freeLists_[fl][sl]; block != invalidBlockID; block = blocks_[block].nextFree)
+        maxSize = std::max(maxSize, blocks_[block].size);
+
+    return maxSize;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+VKTLSFAllocator::BlockID VKTLSFAllocator::FindFreeBlock(std::uint64_t size) const
+{
+    /* Round up to the next size class, so every block in that class is large enough */
+    std::uint32_t fl = 0, sl = 0;
+    if (!VKTLSFSizeClassBitmap::MapSizeRoundUp(size, fl, sl))
+        return invalidBlockID;
+
+    if (!freeListBitmap_.FindLowest(fl, sl))
+        return invalidBlockID;
+
+    return freeLists_[fl][sl];
+}
+
+VKTLSFAllocator::BlockID VKTLSFAllocator::FindFreeBlockInList(std::uint64_t size, std::uint64_t alignment) const
+{
+    std::uint32_t fl = 0, sl = 0;
+    VKTLSFSizeClassBitmap::MapSize(size, fl, sl);
+
+    for (BlockID block = freeLists_[fl][sl]; block != invalidBlockID; block = blocks_[block].nextFree)
+    {
+        if (FitsIntoBlock(blocks_[block].offset, blocks_[block].size, size, alignment))
+            return block;
+    }
+
+    return invalidBlockID;
+}
+
+void VKTLSFAllocator::InsertFreeBlock(BlockID block)
+{
+    std::uint32_t fl = 0, sl = 0;
+    VKTLSFSizeClassBitmap::MapSize(blocks_[block].size, fl, sl);
+
+    /* Insert block at the front of its free list */
+    const BlockID head = freeLists_[fl][sl];
+    blocks_[block].isFree   = true;
+    blocks_[block].prevFree = invalidBlockID;
+    blocks_[block].nextFree = head;
+    if (head != invalidBlockID)
+        blocks_[head].prevFree = block;
+
+    freeLists_[fl][sl] = block;
+    freeListBitmap_.Set(fl, sl);
+
+    ++numFreeBlocks_;
+}
+
+void VKTLSFAllocator::RemoveFreeBlock(BlockID block)
+{
+    std::uint32_t fl = 0, sl = 0;
+    VKTLSFSizeClassBitmap::MapSize(blocks_[block].size, fl, sl);
+
+    const BlockID prevFree = blocks_[block].prevFree;
+    const BlockID nextFree = blocks_[block].nextFree;
+
+    if (prevFree != invalidBlockID)
+        blocks_[prevFree].nextFree = nextFree;
+    if (nextFree != invalidBlockID)
+        blocks_[nextFree].prevFree = prevFree;
+
+    /* Update head of list and clear bitmaps if the list is now empty */
+    if (freeLists_[fl][sl] == block)
+    {
+        freeLists_[fl][sl] = nextFree;
+        if (nextFree == invalidBlockID)
+            freeListBitmap_.Clear(fl, sl);
+    }
+
+    blocks_[block].isFree   = false;
+    blocks_[block].prevFree = invalidBlockID;
+    blocks_[block].nextFree = invalidBlockID;
+
+    --numFreeBlocks_;
+}
+
+VKTLSFAllocator::BlockID VKTLSFAllocator::NewBlock(std::uint64_t offset, std::uint64_t size)
+{
+    BlockID block = invalidBlockID;
+
+    /* Recycle block IDs of previously merged blocks */
+    if (!unusedBlockIDs_.empty())
+    {
+        block = unusedBlockIDs_.back();
+        unusedBlockIDs_.pop_back();
+        blocks_[block] = Block{};
+    }
+    else
+    {
+        block = static_cast<BlockID>(blocks_.size());
+        blocks_.push_back(Block{});
+    }
+
+    blocks_[block].offset   = offset;
+    blocks_[block].size     = size;
+
+    return block;
+}
+
+void VKTLSFAllocator::DeleteBlock(BlockID block)
+{
+    unusedBlockIDs_.push_back(block);
+}
+
+VKTLSFAllocator::BlockID VKTLSFAllocator::SplitBlock(BlockID block, std::uint64_t lowerSize)
+{
+    /* Create upper block first, since this might re-allocate the block container */
+    const BlockID upperBlock = NewBlock(blocks_[block].offset + lowerSize, blocks_[block].size - lowerSize);
+
+    Block& lower = blocks_[block];
+    Block& upper = blocks_[upperBlock];
+
+    upper.prevPhys = block;
+    upper.nextPhys = lower.nextPhys;
+    if (lower.nextPhys != invalidBlockID)
+        blocks_[lower.nextPhys].prevPhys = upperBlock;
+
+    lower.nextPhys  = upperBlock;
+    lower.size      = lowerSize;
+
+    return upperBlock;
+}
+
+void VKTLSFAllocator::MergeWithNextBlock(BlockID block)
+{
+    Block& lower = blocks_[block];
+    const BlockID upperBlock = lower.nextPhys;
+    const Block& upper = blocks_[upperBlock];
+
+    lower.size      += upper.size;
+    lower.nextPhys  = upper.nextPhys;
+    if (upper.nextPhys != invalidBlockID)
+        blocks_[upper.nextPhys].prevPhys = block;
+
+    DeleteBlock(upperBlock);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
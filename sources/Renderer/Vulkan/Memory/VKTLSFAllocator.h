@@ -0,0 +1,209 @@
+/*
+ * VKTLSFAllocator.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_TLSF_ALLOCATOR_H
+#define LLGL_VK_TLSF_ALLOCATOR_H
+
+
+#include <cstdint>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Two-level bitmap of the non-empty size classes of a TLSF allocator.
+The first level is the power of two of a size and the second level subdivides it linearly.
+This is shared by the TLSF allocator to find free blocks and by the device memory pools to find chunks with enough free memory.
+*/
+class VKTLSFSizeClassBitmap
+{
+
+    public:
+
+        static constexpr std::uint32_t slIndexBits  = 4;
+        static constexpr std::uint32_t slIndexCount = (1u << slIndexBits);
+        static constexpr std::uint32_t flIndexCount = 64;
+
+    public:
+
+        // Maps the specified size to its first- and second-level indices.
+        static void MapSize(std::uint64_t size, std::uint32_t& fl, std::uint32_t& sl);
+
+        // Maps the specified size to the lowest size class whose sizes are all at least as large. Returns false if there is no such class.
+        static bool MapSizeRoundUp(std::uint64_t size, std::uint32_t& fl, std::uint32_t& sl);
+
+        // Marks the specified size class as non-empty.
+        void Set(std::uint32_t fl, std::uint32_t sl);
+
+        // Marks the specified size class as empty.
+        void Clear(std::uint32_t fl, std::uint32_t sl);
+
+        // Finds the lowest non-empty size class that is equal to or greater than the input class. Returns false if there is none.
+        bool FindLowest(std::uint32_t& fl, std::uint32_t& sl) const;
+
+        // Finds the highest non-empty size class. Returns false if all size classes are empty.
+        bool FindHighest(std::uint32_t& fl, std::uint32_t& sl) const;
+
+    private:
+
+        std::uint64_t flBitmap_                 = 0;
+        std::uint32_t slBitmaps_[flIndexCount]  = {};
+
+};
+
+/*
+Two-level segregated fit (TLSF) allocator for ranges within a single memory chunk.
+This class only manages offsets and sizes, i.e. it does not depend on any Vulkan object.
+Allocating and freeing a block has constant time complexity and free blocks are always coalesced with their physical neighbors.
+*/
+class VKTLSFAllocator
+{
+
+    public:
+
+        // Identifies a block within this allocator. IDs of allocated blocks remain valid until they are freed.
+        using BlockID = std::uint32_t;
+
+        static constexpr BlockID invalidBlockID = ~0u;
+
+    public:
+
+        VKTLSFAllocator(std::uint64_t size);
+
+        // Allocates a block of the specified size and alignment. Returns invalidBlockID if there is no free block large enough.
+        BlockID Allocate(std::uint64_t size, std::uint64_t alignment);
+
+        // Frees the specified block and merges it with its free neighbors.
+        void Free(BlockID block);
+
+        // Returns the size of the largest free block.
+        std::uint64_t GetMaxFreeBlockSize() const;
+
+        // Returns the offset of the specified block.
+        inline std::uint64_t GetBlockOffset(BlockID block) const
+        {
+            return blocks_[block].offset;
+        }
+
+        // Returns the size of the specified block.
+        inline std::uint64_t GetBlockSize(BlockID block) const
+        {
+            return blocks_[block].size;
+        }
+
+        // Returns true if the specified block is free.
+        inline bool IsBlockFree(BlockID block) const
+        {
+            return blocks_[block].isFree;
+        }
+
+        // Returns the block at offset zero. Together with GetNextBlock, all blocks can be iterated in memory order.
+        inline BlockID GetFirstBlock() const
+        {
+            return firstBlock_;
+        }
+
+        // Returns the block that physically follows the specified block, or invalidBlockID if it is the last one.
+        inline BlockID GetNextBlock(BlockID block) const
+        {
+            return blocks_[block].nextPhys;
+        }
+
+        // Returns the upper bound of all block IDs, i.e. the size an array must have to be indexed by block IDs.
+        inline std::size_t GetBlockIDBound() const
+        {
+            return blocks_.size();
+        }
+
+        // Returns the total size this allocator manages.
+        inline std::uint64_t GetSize() const
+        {
+            return size_;
+        }
+
+        // Returns the sum of the sizes of all allocated blocks.
+        inline std::uint64_t GetAllocatedSize() const
+        {
+            return allocatedSize_;
+        }
+
+        // Returns the number of allocated blocks.
+        inline std::size_t GetNumAllocatedBlocks() const
+        {
+            return numAllocatedBlocks_;
+        }
+
+        // Returns the number of free blocks.
+        inline std::size_t GetNumFreeBlocks() const
+        {
+            return numFreeBlocks_;
+        }
+
+    private:
+
+        static constexpr std::uint32_t slIndexCount = VKTLSFSizeClassBitmap::slIndexCount;
+        static constexpr std::uint32_t flIndexCount = VKTLSFSizeClassBitmap::flIndexCount;
+
+        struct Block
+        {
+            std::uint64_t   offset      = 0;
+            std::uint64_t   size        = 0;
+            BlockID         prevPhys    = invalidBlockID;
+            BlockID         nextPhys    = invalidBlockID;
+            BlockID         prevFree    = invalidBlockID;
+            BlockID         nextFree    = invalidBlockID;
+            bool            isFree      = false;
+        };
+
+    private:
+
+        // Finds a free block from the bitmaps whose size is guaranteed to be at least the specified size.
+        BlockID FindFreeBlock(std::uint64_t size) const;
+
+        // Searches the free list of the specified size for a block that fits the size with alignment.
+        BlockID FindFreeBlockInList(std::uint64_t size, std::uint64_t alignment) const;
+
+        void InsertFreeBlock(BlockID block);
+        void RemoveFreeBlock(BlockID block);
+
+        BlockID NewBlock(std::uint64_t offset, std::uint64_t size);
+        void DeleteBlock(BlockID block);
+
+        // Splits the specified block at the relative offset and returns the new upper block.
+        BlockID SplitBlock(BlockID block, std::uint64_t lowerSize);
+
+        // Merges the physically next block into the specified block.
+        void MergeWithNextBlock(BlockID block);
+
+    private:
+
+        std::uint64_t           size_                               = 0;
+        std::uint64_t           allocatedSize_                      = 0;
+        std::size_t             numAllocatedBlocks_                 = 0;
+        std::size_t             numFreeBlocks_                      = 0;
+
+        VKTLSFSizeClassBitmap   freeListBitmap_;
+        BlockID                 freeLists_[flIndexCount][slIndexCount];
+
+        BlockID                 firstBlock_                         = invalidBlockID;
+        std::vector<Block>      blocks_;
+        std::vector<BlockID>    unusedBlockIDs_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -12,6 +12,7 @@
 #include "../Texture/VKTexture.h"
 #include "../Texture/VKSampler.h"
 #include "../../CheckedCast.h"
+#include "../../../Core/CoreUtils.h"
 #include <LLGL/Utils/ForRange.h>
 #include <vector>
 #include <algorithm>
@@ -29,6 +30,13 @@ static std::uint32_t SumDescriptorPoolSizes(std::uint32_t numSizes, const VkDesc
     return count;
 }
 
+// Returns the value of the specified non-dispatchable Vulkan handle, which is either a pointer or a 64-bit integer depending on the platform.
+template <typename TVkHandle>
+static std::uint64_t GetVkHandleValue(TVkHandle handle)
+{
+    return (std::uint64_t)(handle);
+}
+
 VKDescriptorCache::VKDescriptorCache(
     VkDevice                            device,
     VkDescriptorPool                    descriptorPool,
@@ -63,28 +71,46 @@ void VKDescriptorCache::Reset()
     dirty_ = true;
 }
 
-void VKDescriptorCache::EmplaceDescriptor(Resource& resource, const VKLayoutBinding& binding, VKDescriptorSetWriter& setWriter)
+void VKDescriptorCache::EmplaceDescriptor(std::uint32_t descriptor, Resource& resource, const VKLayoutBinding& binding, VKDescriptorSetWriter& setWriter)
 {
+    /* Track native handle of each bound resource in the set writer to identify descriptor sets with the same content */
+    std::uint64_t resourceHandle = 0;
+
     switch (resource.GetResourceType())
     {
         case ResourceType::Buffer:
-            EmplaceBufferDescriptor(LLGL_CAST(VKBuffer&, resource), binding, setWriter);
+        {
+            auto& bufferVK = LLGL_CAST(VKBuffer&, resource);
+            EmplaceBufferDescriptor(bufferVK, binding, setWriter);
+            resourceHandle = GetVkHandleValue(bufferVK.GetVkBuffer());
             dirty_ = true;
-            break;
+        }
+        break;
 
         case ResourceType::Texture:
-            EmplaceTextureDescriptor(LLGL_CAST(VKTexture&, resource), binding, setWriter);
+        {
+            /* Image layout is determined by the descriptor type of the binding, so the image view identifies the descriptor */
+            auto& textureVK = LLGL_CAST(VKTexture&, resource);
+            EmplaceTextureDescriptor(textureVK, binding, setWriter);
+            resourceHandle = GetVkHandleValue(textureVK.GetVkImageView());
             dirty_ = true;
-            break;
+        }
+        break;
 
         case ResourceType::Sampler:
-            EmplaceSamplerDescriptor(LLGL_CAST(VKSampler&, resource), binding, setWriter);
+        {
+            auto& samplerVK = LLGL_CAST(VKSampler&, resource);
+            EmplaceSamplerDescriptor(samplerVK, binding, setWriter);
+            resourceHandle = GetVkHandleValue(samplerVK.GetVkSampler());
             dirty_ = true;
-            break;
+        }
+        break;
 
         default:
-            break;
+            return;
     }
+
+    setWriter.SetResourceHandle(descriptor, resourceHandle);
 }
 
 VkDescriptorSet VKDescriptorCache::FlushDescriptorSet(VKStagingDescriptorSetPool& pool, VKDescriptorSetWriter& setWriter)
@@ -92,27 +118,38 @@ VkDescriptorSet VKDescriptorCache::FlushDescriptorSet(VKStagingDescriptorSetPool
     if (!dirty_ || setLayout_ == VK_NULL_HANDLE)
         return VK_NULL_HANDLE;
 
-    /*
-    Perform two operations in order:
-    1. Update previously written descriptors to cache; Descriptor writes are performed first by 'vkUpdateDescriptorSets'.
-    2. Copy cache into new descriptor set; Descriptor copies are performed second by 'vkUpdateDescriptorSets'.
-    */
-    VkDescriptorSet descriptorSetCopy = pool.AllocateDescriptorSet(setLayout_, static_cast<std::uint32_t>(poolSizes_.size()), poolSizes_.data());
-
-    /* Lock mutex to guard copy descriptors since they are shared across threads */
-    std::lock_guard<std::mutex> guard{ copyDescMutex_ };
+    /* Reuse descriptor set if the same resources have already been bound since the pool was reset; the pool belongs to the command buffer and needs no lock */
+    const std::vector<std::uint64_t>& resourceHandles = setWriter.GetResourceHandles();
+    const std::uint64_t hash = HashResourceHandles(resourceHandles);
+    VkDescriptorSet descriptorSetCopy = pool.FindCachedDescriptorSet(setLayout_, hash, resourceHandles);
 
-    UpdateCopyDescriptorSet(descriptorSetCopy);
+    if (descriptorSetCopy == VK_NULL_HANDLE)
+    {
+        descriptorSetCopy = pool.AllocateDescriptorSet(setLayout_, static_cast<std::uint32_t>(poolSizes_.size()), poolSizes_.data());
+
+        /* Lock mutex to guard cached descriptor set and copy descriptors since they are shared across threads */
+        std::lock_guard<std::mutex> guard{ copyDescMutex_ };
+
+        /*
+        Perform two operations in order:
+        1. Update all descriptors written by this command buffer to cache, since other command buffers may have overwritten them in the meantime;
+           Descriptor writes are performed first by 'vkUpdateDescriptorSets'.
+        2. Copy cache into new descriptor set; Descriptor copies are performed second by 'vkUpdateDescriptorSets'.
+        */
+        UpdateCopyDescriptorSet(descriptorSetCopy);
+
+        vkUpdateDescriptorSets(
+            device_,
+            setWriter.GetNumWrites(),
+            setWriter.GetWrites(),
+            static_cast<std::uint32_t>(copyDescs_.size()),
+            copyDescs_.data()
+        );
 
-    vkUpdateDescriptorSets(
-        device_,
-        setWriter.GetNumWrites(),
-        setWriter.GetWrites(),
-        static_cast<std::uint32_t>(copyDescs_.size()),
-        copyDescs_.data()
-    );
+        pool.CacheDescriptorSet(descriptorSetCopy, setLayout_, hash, resourceHandles);
+    }
 
-    /* Clear cache after updated  */
+    /* Clear cache after updated; written descriptors are kept to replay them with the next flush */
     dirty_ = false;
 
     return descriptorSetCopy;
@@ -129,6 +166,7 @@ VkDescriptorBufferInfo* VKDescriptorCache::NextBufferInfoOrUpdateCache(VKDescrip
     if (info == nullptr)
     {
         /* Flush descriptor set update */
+        std::lock_guard<std::mutex> guard{ copyDescMutex_ };
         setWriter.UpdateDescriptorSets(device_);
         setWriter.Reset();
         return setWriter.NextBufferInfo();
@@ -142,6 +180,7 @@ VkDescriptorImageInfo* VKDescriptorCache::NextImageInfoOrUpdateCache(VKDescripto
     if (info == nullptr)
     {
         /* Flush descriptor set update */
+        std::lock_guard<std::mutex> guard{ copyDescMutex_ };
         setWriter.UpdateDescriptorSets(device_);
         setWriter.Reset();
         return setWriter.NextImageInfo();
@@ -321,6 +360,15 @@ void VKDescriptorCache::UpdateCopyDescriptorSet(VkDescriptorSet dstSet)
         copyDesc.dstSet = dstSet;
 }
 
+std::uint64_t VKDescriptorCache::HashResourceHandles(const std::vector<std::uint64_t>& resourceHandles) const
+{
+    std::uint64_t seed = 0;
+    HashCombine(seed, GetVkHandleValue(setLayout_));
+    for (std::uint64_t handle : resourceHandles)
+        HashCombine(seed, handle);
+    return seed;
+}
+
 
 } // /namespace LLGL
 
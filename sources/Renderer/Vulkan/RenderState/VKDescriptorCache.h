@@ -14,6 +14,7 @@
 #include "VKDescriptorSetWriter.h"
 #include <LLGL/Container/SmallVector.h>
 #include <LLGL/Container/ArrayView.h>
+#include <vector>
 #include <mutex>
 
 
@@ -45,12 +46,14 @@ class VKDescriptorCache
         // Resets the descriptor cache.
         void Reset();
 
-        // Emplaces a descriptor into the cache for the specified resource.
-        void EmplaceDescriptor(Resource& resource, const VKLayoutBinding& binding, VKDescriptorSetWriter& setWriter);
+        // Emplaces a descriptor into the cache for the specified resource. The descriptor index refers to the bindings this cache was created with.
+        void EmplaceDescriptor(std::uint32_t descriptor, Resource& resource, const VKLayoutBinding& binding, VKDescriptorSetWriter& setWriter);
 
         /*
         Flushes all changed descriptor by allocating a new descriptor set.
-        Otherwise, no changes took place (i.e. IsInvalidated() is false) and VK_NULL_HANDLE is returned.
+        If a descriptor set with the same resources has already been written since the pool was reset, that descriptor set is reused.
+        Otherwise, all descriptors in the set writer are written again to the cache and copied into a new descriptor set.
+        If no changes took place (i.e. IsInvalidated() is false), VK_NULL_HANDLE is returned.
         */
         VkDescriptorSet FlushDescriptorSet(VKStagingDescriptorSetPool& pool, VKDescriptorSetWriter& setWriter);
 
@@ -78,6 +81,9 @@ class VKDescriptorCache
         void BuildCopyDescriptors(ArrayView<VKLayoutBinding> bindings);
         void UpdateCopyDescriptorSet(VkDescriptorSet dstSet);
 
+        // Returns the hash of the set layout and the specified resource handles.
+        std::uint64_t HashResourceHandles(const std::vector<std::uint64_t>& resourceHandles) const;
+
     private:
 
         VkDevice                                device_         = VK_NULL_HANDLE;
@@ -87,7 +93,7 @@ class VKDescriptorCache
 
         std::uint32_t                           numDescriptors_ = 0;                // Total number of descriptors in cache.
         SmallVector<VkCopyDescriptorSet, 4>     copyDescs_;
-        std::mutex                              copyDescMutex_;
+        std::mutex                              copyDescMutex_;                     // Guards the cached descriptor set and copy descriptors, which are shared across command buffers.
 
         bool                                    dirty_          = false;
 
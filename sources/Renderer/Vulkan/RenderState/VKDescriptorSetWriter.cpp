@@ -48,6 +48,7 @@ void VKDescriptorSetWriter::Reset(
     copies_.reserve(numReservedCopies);
     numBufferInfos_ = 0;
     numImageInfos_ = 0;
+    resourceHandles_.assign(numResourceViewsMax, 0);
 }
 
 VkDescriptorBufferInfo* VKDescriptorSetWriter::NextBufferInfo()
@@ -100,6 +101,12 @@ void VKDescriptorSetWriter::UpdateDescriptorSets(VkDevice device)
     }
 }
 
+void VKDescriptorSetWriter::SetResourceHandle(std::uint32_t descriptor, std::uint64_t handle)
+{
+    if (descriptor < resourceHandles_.size())
+        resourceHandles_[descriptor] = handle;
+}
+
 
 } // /namespace LLGL
 
@@ -72,6 +72,15 @@ class VKDescriptorSetWriter
         // Invokes vkUpdateDescrpitorSets with the current containers.
         void UpdateDescriptorSets(VkDevice device);
 
+        // Stores the native handle of the resource that has been written to the specified descriptor. Out-of-range descriptors are ignored.
+        void SetResourceHandle(std::uint32_t descriptor, std::uint64_t handle);
+
+        // Returns the native resource handles that have been written since the last call to Reset(numResourceViewsMax), indexed by descriptor.
+        inline const std::vector<std::uint64_t>& GetResourceHandles() const
+        {
+            return resourceHandles_;
+        }
+
     private:
 
         std::vector<VkDescriptorBufferInfo> bufferInfos_;
@@ -83,6 +92,8 @@ class VKDescriptorSetWriter
         std::vector<VkWriteDescriptorSet>   writes_;
         std::vector<VkCopyDescriptorSet>    copies_;
 
+        std::vector<std::uint64_t>          resourceHandles_;   // Only cleared by Reset(numResourceViewsMax), since Reset() is also used to flush pending writes.
+
 };
 
 
@@ -6,6 +6,7 @@
  */
 
 #include "VKFence.h"
+#include "../VKDevice.h"
 #include "../VKCore.h"
 
 
@@ -13,27 +14,44 @@ namespace LLGL
 {
 
 
-VKFence::VKFence(VkDevice device) :
+VKFence::VKFence(const VKDevice& device) :
     fence_ { device, vkDestroyFence }
 {
-    VkFenceCreateInfo createInfo;
+    if (device.HasTimelineSemaphore())
     {
-        createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-        createInfo.pNext = nullptr;
-        createInfo.flags = 0;
+        /* Timeline fences don't need a native object; they are signaled with the next value of the timeline semaphore */
+        timelineDevice_ = &device;
+    }
+    else
+    {
+        VkFenceCreateInfo createInfo;
+        {
+            createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+            createInfo.pNext = nullptr;
+            createInfo.flags = 0;
+        }
+        VkResult result = vkCreateFence(device, &createInfo, nullptr, fence_.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan fence");
     }
-    VkResult result = vkCreateFence(device, &createInfo, nullptr, fence_.ReleaseAndGetAddressOf());
-    VKThrowIfFailed(result, "failed to create Vulkan fence");
 }
 
 void VKFence::Reset(VkDevice device)
 {
-    vkResetFences(device, 1, fence_.GetAddressOf());
+    if (!IsTimeline())
+        vkResetFences(device, 1, fence_.GetAddressOf());
 }
 
 bool VKFence::Wait(VkDevice device, std::uint64_t timeout)
 {
-    return (vkWaitForFences(device, 1, fence_.GetAddressOf(), VK_TRUE, timeout) == VK_SUCCESS);
+    if (IsTimeline())
+        return timelineDevice_->WaitTimelineValue(timelineValue_, timeout);
+    else
+        return (vkWaitForFences(device, 1, fence_.GetAddressOf(), VK_TRUE, timeout) == VK_SUCCESS);
+}
+
+void VKFence::SetTimelineValue(std::uint64_t value)
+{
+    timelineValue_ = value;
 }
 
 
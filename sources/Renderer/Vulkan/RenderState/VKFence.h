@@ -19,25 +19,44 @@ namespace LLGL
 {
 
 
+class VKDevice;
+
+/*
+Fence implementation with two modes:
+If the device has a timeline semaphore, this fence only stores the timeline value it waits for, i.e. it has no native VkFence.
+Otherwise, it wraps a binary VkFence.
+*/
 class VKFence final : public Fence
 {
 
     public:
 
-        VKFence(VkDevice device);
+        // Initializes the fence as timeline value if the device has a timeline semaphore, otherwise creates a binary VkFence.
+        VKFence(const VKDevice& device);
 
         void Reset(VkDevice device);
         bool Wait(VkDevice device, std::uint64_t timeout);
 
-        // Returns the native VkFence handle.
+        // Sets the timeline value this fence waits for. Only valid in timeline mode.
+        void SetTimelineValue(std::uint64_t value);
+
+        // Returns the native VkFence handle. This is VK_NULL_HANDLE in timeline mode.
         inline VkFence GetVkFence() const
         {
             return fence_;
         }
 
+        // Returns true if this fence refers to a value of the device's timeline semaphore instead of a binary VkFence.
+        inline bool IsTimeline() const
+        {
+            return (timelineDevice_ != nullptr);
+        }
+
     private:
 
-        VKPtr<VkFence> fence_;
+        VKPtr<VkFence>  fence_;
+        const VKDevice* timelineDevice_ = nullptr;
+        std::uint64_t   timelineValue_  = 0;
 
 };
 
@@ -33,7 +33,8 @@ VKGraphicsPSO::VKGraphicsPSO(
     const RenderPass*                   defaultRenderPass,
     const GraphicsPipelineDescriptor&   desc,
     const VKGraphicsPipelineLimits&     limits,
-    PipelineCache*                      pipelineCache)
+    PipelineCache*                      pipelineCache,
+    VKGraphicsPipelineBatch*            pipelineBatch)
 :
     VKPipelineState    { device, VK_PIPELINE_BIND_POINT_GRAPHICS, GetShadersAsArray(desc), desc.pipelineLayout },
     scissorEnabled_    { desc.rasterizer.scissorTestEnabled                                                    },
@@ -43,12 +44,84 @@ VKGraphicsPSO::VKGraphicsPSO(
     const RenderPass* renderPass = (desc.renderPass != nullptr ? desc.renderPass : defaultRenderPass);
     LLGL_ASSERT_PTR(renderPass);
 
-    /* Create Vulkan graphics pipeline object */
+    /* Create Vulkan graphics pipeline object or defer its creation to the batch */
     const VKRenderPass* renderPassVK = LLGL_CAST(const VKRenderPass*, renderPass);
     if (VKPipelineCache* pipelineCacheVK = (pipelineCache != nullptr ? LLGL_CAST(VKPipelineCache*, pipelineCache) : nullptr))
-        CreateVkPipeline(device, *renderPassVK, limits, desc, pipelineCacheVK->GetNative());
+        CreateVkPipeline(device, *renderPassVK, limits, desc, pipelineCacheVK->GetNative(), pipelineBatch);
     else
-        CreateVkPipeline(device, *renderPassVK, limits, desc);
+        CreateVkPipeline(device, *renderPassVK, limits, desc, VK_NULL_HANDLE, pipelineBatch);
+}
+
+
+/*
+ * VKGraphicsPipelineCreateInfo structure
+ */
+
+// Vulkan graphics pipeline create-info with all of its sub-structures, so it can outlive the PSO constructor when it is appended to a batch.
+struct VKGraphicsPipelineCreateInfo
+{
+    SmallVector<VkPipelineShaderStageCreateInfo, 5>         shaderStages;
+    VkPipelineVertexInputStateCreateInfo                    vertexInputState;
+    VkPipelineInputAssemblyStateCreateInfo                  inputAssemblyState;
+    VkPipelineTessellationStateCreateInfo                   tessellationState;
+    std::vector<VkViewport>                                 viewports;
+    std::vector<VkRect2D>                                   scissors;
+    VkPipelineViewportStateCreateInfo                       viewportState;
+    VkPipelineRasterizationStateCreateInfo                  rasterizerState;
+    VkPipelineRasterizationConservativeStateCreateInfoEXT   conservativeRasterState;
+    VkPipelineMultisampleStateCreateInfo                    multisampleState;
+    VkPipelineDepthStencilStateCreateInfo                   depthStencilState;
+    std::vector<VkPipelineColorBlendAttachmentState>        colorBlendAttachments;
+    VkPipelineColorBlendStateCreateInfo                     colorBlendState;
+    std::vector<VkDynamicState>                             dynamicStates;
+    VkPipelineDynamicStateCreateInfo                        dynamicState;
+    VkGraphicsPipelineCreateInfo                            createInfo;
+    VkPipeline*                                             outPipeline         = nullptr;
+};
+
+
+/*
+ * VKGraphicsPipelineBatch class
+ */
+
+VKGraphicsPipelineBatch::VKGraphicsPipelineBatch()
+{
+}
+
+VKGraphicsPipelineBatch::~VKGraphicsPipelineBatch()
+{
+}
+
+void VKGraphicsPipelineBatch::CreateVkPipelines(VkDevice device, VkPipelineCache pipelineCache)
+{
+    if (createInfos_.empty())
+        return;
+
+    /* Create all pipelines with a single Vulkan call */
+    const std::size_t numPipelines = createInfos_.size();
+
+    std::vector<VkGraphicsPipelineCreateInfo> createInfosVK;
+    createInfosVK.reserve(numPipelines);
+    for (const auto& createInfo : createInfos_)
+        createInfosVK.push_back(createInfo->createInfo);
+
+    std::vector<VkPipeline> pipelinesVK(numPipelines, VK_NULL_HANDLE);
+    VkResult result = vkCreateGraphicsPipelines(
+        device,
+        pipelineCache,
+        static_cast<std::uint32_t>(numPipelines),
+        createInfosVK.data(),
+        nullptr,
+        pipelinesVK.data()
+    );
+
+    /* Hand over all pipelines to their PSOs; if the call failed, only the failed pipelines are null */
+    for_range(i, numPipelines)
+        *(createInfos_[i]->outPipeline) = pipelinesVK[i];
+
+    createInfos_.clear();
+
+    VKThrowIfFailed(result, "failed to create batch of Vulkan graphics pipelines");
 }
 
 
@@ -298,7 +371,8 @@ bool VKGraphicsPSO::CreateVkPipeline(
     const VKRenderPass&                 renderPass,
     const VKGraphicsPipelineLimits&     limits,
     const GraphicsPipelineDescriptor&   desc,
-    VkPipelineCache                     pipelineCache)
+    VkPipelineCache                     pipelineCache,
+    VKGraphicsPipelineBatch*            pipelineBatch)
 {
     /* Get shader program object */
     const VKShader* vertexShaderVK = LLGL_CAST(const VKShader*, desc.vertexShader);
@@ -331,84 +405,83 @@ bool VKGraphicsPSO::CreateVkPipeline(
         }
     };
 
+    /* Allocate create-info on the heap, since it must keep a fixed address until it is consumed by a batch */
+    std::unique_ptr<VKGraphicsPipelineCreateInfo> pipelineCreateInfo{ new VKGraphicsPipelineCreateInfo{} };
+    VKGraphicsPipelineCreateInfo& info = *pipelineCreateInfo;
+
     /* Get shader stages */
-    SmallVector<VkPipelineShaderStageCreateInfo, 5> shaderStageCreateInfos;
     bool shaderCreationFailed = false;
-    FillAndAppendShaderStageCreateInfo(desc.vertexShader,           shaderStageCreateInfos, shaderCreationFailed);
-    FillAndAppendShaderStageCreateInfo(desc.tessControlShader,      shaderStageCreateInfos, shaderCreationFailed);
-    FillAndAppendShaderStageCreateInfo(desc.tessEvaluationShader,   shaderStageCreateInfos, shaderCreationFailed);
-    FillAndAppendShaderStageCreateInfo(desc.geometryShader,         shaderStageCreateInfos, shaderCreationFailed);
-    FillAndAppendShaderStageCreateInfo(desc.fragmentShader,         shaderStageCreateInfos, shaderCreationFailed);
+    FillAndAppendShaderStageCreateInfo(desc.vertexShader,           info.shaderStages, shaderCreationFailed);
+    FillAndAppendShaderStageCreateInfo(desc.tessControlShader,      info.shaderStages, shaderCreationFailed);
+    FillAndAppendShaderStageCreateInfo(desc.tessEvaluationShader,   info.shaderStages, shaderCreationFailed);
+    FillAndAppendShaderStageCreateInfo(desc.geometryShader,         info.shaderStages, shaderCreationFailed);
+    FillAndAppendShaderStageCreateInfo(desc.fragmentShader,         info.shaderStages, shaderCreationFailed);
     if (shaderCreationFailed)
         return false;
 
     /* Initialize vertex input descriptor */
-    VkPipelineVertexInputStateCreateInfo vertexInputCreateInfo;
-    vertexShaderVK->FillVertexInputStateCreateInfo(vertexInputCreateInfo);
+    vertexShaderVK->FillVertexInputStateCreateInfo(info.vertexInputState);
 
     /* Initialize input assembly state */
-    VkPipelineInputAssemblyStateCreateInfo inputAssembly;
-    CreateInputAssemblyState(desc, inputAssembly);
+    CreateInputAssemblyState(desc, info.inputAssemblyState);
 
     /* Initialize tessellation state */
-    VkPipelineTessellationStateCreateInfo tessellationState;
-    CreateTessellationState(desc, tessellationState);
+    CreateTessellationState(desc, info.tessellationState);
 
     /* Initialize viewport state */
-    std::vector<VkViewport> viewportsVK;
-    std::vector<VkRect2D> scissorsVK;
-    VkPipelineViewportStateCreateInfo viewportState;
-    CreateViewportState(desc, viewportState, viewportsVK, scissorsVK);
+    CreateViewportState(desc, info.viewportState, info.viewports, info.scissors);
 
     /* Initialize rasterizer state */
-    VkPipelineRasterizationStateCreateInfo rasterizerState;
-    VkPipelineRasterizationConservativeStateCreateInfoEXT createInfoConservativeRasterExt;
-    CreateRasterizerState(desc.rasterizer, limits, rasterizerState, createInfoConservativeRasterExt);
+    CreateRasterizerState(desc.rasterizer, limits, info.rasterizerState, info.conservativeRasterState);
 
     /* Initialize multi-sample state */
-    VkPipelineMultisampleStateCreateInfo multisampleState;
     const VkSampleCountFlagBits sampleCountBits = (desc.rasterizer.multiSampleEnabled ? renderPass.GetSampleCountBits() : VK_SAMPLE_COUNT_1_BIT);
-    CreateMultisampleState(sampleCountBits, desc.blend, multisampleState);
+    CreateMultisampleState(sampleCountBits, desc.blend, info.multisampleState);
 
     /* Initialize depth-stencil state */
-    VkPipelineDepthStencilStateCreateInfo depthStencilState;
-    CreateDepthStencilState(desc, depthStencilState);
+    CreateDepthStencilState(desc, info.depthStencilState);
 
     /* Initialize color-blend state */
-    std::vector<VkPipelineColorBlendAttachmentState> attachmentStatesVK;
-    VkPipelineColorBlendStateCreateInfo colorBlendState;
-    CreateColorBlendState(desc.blend, colorBlendState, attachmentStatesVK, renderPass.GetNumColorAttachments());
+    CreateColorBlendState(desc.blend, info.colorBlendState, info.colorBlendAttachments, renderPass.GetNumColorAttachments());
 
     /* Initialize dynamic state */
-    std::vector<VkDynamicState> dynamicStatesVK;
-    VkPipelineDynamicStateCreateInfo dynamicState;
-    CreateDynamicState(desc, dynamicState, dynamicStatesVK);
+    CreateDynamicState(desc, info.dynamicState, info.dynamicStates);
 
     /* Create graphics pipeline state object */
-    VkGraphicsPipelineCreateInfo createInfo;
+    VkGraphicsPipelineCreateInfo& createInfo = info.createInfo;
     {
         createInfo.sType                = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
         createInfo.pNext                = nullptr;
         createInfo.flags                = 0;
-        createInfo.stageCount           = static_cast<std::uint32_t>(shaderStageCreateInfos.size());
-        createInfo.pStages              = shaderStageCreateInfos.data();
-        createInfo.pVertexInputState    = (&vertexInputCreateInfo);
-        createInfo.pInputAssemblyState  = (&inputAssembly);
-        createInfo.pTessellationState   = (inputAssembly.topology == VK_PRIMITIVE_TOPOLOGY_PATCH_LIST ? &tessellationState : nullptr);
-        createInfo.pViewportState       = (&viewportState);
-        createInfo.pRasterizationState  = (&rasterizerState);
-        createInfo.pMultisampleState    = (&multisampleState);
-        createInfo.pDepthStencilState   = (&depthStencilState);
-        createInfo.pColorBlendState     = (&colorBlendState);
-        createInfo.pDynamicState        = (!dynamicStatesVK.empty() ? &dynamicState : nullptr);
+        createInfo.stageCount           = static_cast<std::uint32_t>(info.shaderStages.size());
+        createInfo.pStages              = info.shaderStages.data();
+        createInfo.pVertexInputState    = (&info.vertexInputState);
+        createInfo.pInputAssemblyState  = (&info.inputAssemblyState);
+        createInfo.pTessellationState   = (info.inputAssemblyState.topology == VK_PRIMITIVE_TOPOLOGY_PATCH_LIST ? &info.tessellationState : nullptr);
+        createInfo.pViewportState       = (&info.viewportState);
+        createInfo.pRasterizationState  = (&info.rasterizerState);
+        createInfo.pMultisampleState    = (&info.multisampleState);
+        createInfo.pDepthStencilState   = (&info.depthStencilState);
+        createInfo.pColorBlendState     = (&info.colorBlendState);
+        createInfo.pDynamicState        = (!info.dynamicStates.empty() ? &info.dynamicState : nullptr);
         createInfo.layout               = GetVkPipelineLayout();
         createInfo.renderPass           = renderPass.GetVkRenderPass();
         createInfo.subpass              = 0;
         createInfo.basePipelineHandle   = VK_NULL_HANDLE;
         createInfo.basePipelineIndex    = 0;
     }
-    VkResult result = vkCreateGraphicsPipelines(device, pipelineCache, 1, &createInfo, nullptr, ReleaseAndGetAddressOfVkPipeline());
-    VKThrowIfFailed(result, "failed to create Vulkan graphics pipeline");
+
+    if (pipelineBatch != nullptr)
+    {
+        /* Defer pipeline creation until the entire batch has been collected */
+        info.outPipeline = ReleaseAndGetAddressOfVkPipeline();
+        pipelineBatch->createInfos_.push_back(std::move(pipelineCreateInfo));
+    }
+    else
+    {
+        VkResult result = vkCreateGraphicsPipelines(device, pipelineCache, 1, &createInfo, nullptr, ReleaseAndGetAddressOfVkPipeline());
+        VKThrowIfFailed(result, "failed to create Vulkan graphics pipeline");
+    }
 
     return true;
 }
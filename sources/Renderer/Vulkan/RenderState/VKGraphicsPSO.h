@@ -10,6 +10,8 @@
 
 
 #include "VKPipelineState.h"
+#include <memory>
+#include <vector>
 
 
 namespace LLGL
@@ -24,10 +26,34 @@ struct VKGraphicsPipelineLimits
 };
 
 struct GraphicsPipelineDescriptor;
+struct VKGraphicsPipelineCreateInfo;
 class RenderPass;
 class VKRenderPass;
 class PipelineCache;
 
+/*
+Collects the create-info structures of multiple graphics PSOs to create all their Vulkan pipelines with a single call to vkCreateGraphicsPipelines.
+This allows the driver to compile the pipelines concurrently and to share their intermediate results via the pipeline cache.
+*/
+class VKGraphicsPipelineBatch
+{
+
+    public:
+
+        VKGraphicsPipelineBatch();
+        ~VKGraphicsPipelineBatch();
+
+        // Creates the Vulkan pipelines of all PSOs that have been appended to this batch and hands them over to their PSOs.
+        void CreateVkPipelines(VkDevice device, VkPipelineCache pipelineCache = VK_NULL_HANDLE);
+
+    private:
+
+        friend class VKGraphicsPSO;
+
+        std::vector<std::unique_ptr<VKGraphicsPipelineCreateInfo>> createInfos_;
+
+};
+
 class VKGraphicsPSO final : public VKPipelineState
 {
 
@@ -38,7 +64,8 @@ class VKGraphicsPSO final : public VKPipelineState
             const RenderPass*                   defaultRenderPass,
             const GraphicsPipelineDescriptor&   desc,
             const VKGraphicsPipelineLimits&     limits,
-            PipelineCache*                      pipelineCache       = nullptr
+            PipelineCache*                      pipelineCache       = nullptr,
+            VKGraphicsPipelineBatch*            pipelineBatch       = nullptr
         );
 
         // Returns true if scissors are enabled.
@@ -60,7 +87,8 @@ class VKGraphicsPSO final : public VKPipelineState
             const VKRenderPass&                 renderPass,
             const VKGraphicsPipelineLimits&     limits,
             const GraphicsPipelineDescriptor&   desc,
-            VkPipelineCache                     pipelineCache   = VK_NULL_HANDLE
+            VkPipelineCache                     pipelineCache   = VK_NULL_HANDLE,
+            VKGraphicsPipelineBatch*            pipelineBatch   = nullptr
         );
 
     private:
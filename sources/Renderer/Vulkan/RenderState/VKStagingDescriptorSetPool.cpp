@@ -27,6 +27,12 @@ void VKStagingDescriptorSetPool::Reset()
             descriptorPools_[i].Reset();
         descriptorPoolIndex_ = 0;
     }
+
+    /* Cached descriptor sets are invalidated by resetting their pools */
+    cachedSets_.clear();
+    cachedHandles_.clear();
+    numCacheHits_   = 0;
+    numCacheMisses_ = 0;
 }
 
 VkDescriptorSet VKStagingDescriptorSetPool::AllocateDescriptorSet(
@@ -49,6 +55,45 @@ VkDescriptorSet VKStagingDescriptorSetPool::AllocateDescriptorSet(
     return descriptorPools_[descriptorPoolIndex_].AllocateDescriptorSet(setLayout, numSizes, sizes);
 }
 
+VkDescriptorSet VKStagingDescriptorSetPool::FindCachedDescriptorSet(
+    VkDescriptorSetLayout               setLayout,
+    std::uint64_t                       hash,
+    const ArrayView<std::uint64_t>&     resourceHandles)
+{
+    /* Compare the entire key of all entries with the same hash to rule out hash collisions */
+    auto range = cachedSets_.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        const CachedDescriptorSet& entry = it->second;
+        if (entry.setLayout == setLayout &&
+            entry.numHandles == resourceHandles.size() &&
+            std::equal(resourceHandles.begin(), resourceHandles.end(), cachedHandles_.begin() + entry.firstHandle))
+        {
+            ++numCacheHits_;
+            return entry.descriptorSet;
+        }
+    }
+    ++numCacheMisses_;
+    return VK_NULL_HANDLE;
+}
+
+void VKStagingDescriptorSetPool::CacheDescriptorSet(
+    VkDescriptorSet                     descriptorSet,
+    VkDescriptorSetLayout               setLayout,
+    std::uint64_t                       hash,
+    const ArrayView<std::uint64_t>&     resourceHandles)
+{
+    CachedDescriptorSet entry;
+    {
+        entry.setLayout     = setLayout;
+        entry.firstHandle   = cachedHandles_.size();
+        entry.numHandles    = resourceHandles.size();
+        entry.descriptorSet = descriptorSet;
+    }
+    cachedHandles_.insert(cachedHandles_.end(), resourceHandles.begin(), resourceHandles.end());
+    cachedSets_.emplace(hash, entry);
+}
+
 
 /*
  * ======= Private: =======
@@ -10,7 +10,10 @@
 
 
 #include "VKStagingDescriptorPool.h"
+#include <LLGL/Container/ArrayView.h>
 #include <vector>
+#include <unordered_map>
+#include <cstdint>
 
 
 namespace LLGL
@@ -25,7 +28,7 @@ class VKStagingDescriptorSetPool
 
         VKStagingDescriptorSetPool(VkDevice device);
 
-        // Resets all chunks in the pool.
+        // Resets all chunks in the pool and clears the cache of descriptor sets.
         void Reset();
 
         // Copies the specified source descriptors into the native D3D descriptor heap.
@@ -35,6 +38,37 @@ class VKStagingDescriptorSetPool
             const VkDescriptorPoolSize* sizes
         );
 
+        /*
+        Returns the descriptor set that was previously cached for the specified set layout and resource handles,
+        or VK_NULL_HANDLE if there is no such descriptor set since the last call to Reset().
+        The hash must be computed from the set layout and resource handles; it only accelerates the lookup.
+        */
+        VkDescriptorSet FindCachedDescriptorSet(
+            VkDescriptorSetLayout               setLayout,
+            std::uint64_t                       hash,
+            const ArrayView<std::uint64_t>&     resourceHandles
+        );
+
+        // Caches the specified descriptor set, which has been written with the specified resource handles, until the next call to Reset().
+        void CacheDescriptorSet(
+            VkDescriptorSet                     descriptorSet,
+            VkDescriptorSetLayout               setLayout,
+            std::uint64_t                       hash,
+            const ArrayView<std::uint64_t>&     resourceHandles
+        );
+
+        // Returns the number of successful cache lookups since the last call to Reset().
+        inline std::uint32_t GetNumCacheHits() const
+        {
+            return numCacheHits_;
+        }
+
+        // Returns the number of failed cache lookups since the last call to Reset().
+        inline std::uint32_t GetNumCacheMisses() const
+        {
+            return numCacheMisses_;
+        }
+
     private:
 
         // Allocates a new descriptor pool with increased capacity.
@@ -42,10 +76,26 @@ class VKStagingDescriptorSetPool
 
     private:
 
-        VkDevice                                device_                 = VK_NULL_HANDLE;
-        std::vector<VKStagingDescriptorPool>    descriptorPools_;
-        std::size_t                             descriptorPoolIndex_    = 0;
-        std::uint32_t                           capacityLevel_          = 0;
+        // Descriptor set that was written in the current frame; its resource handles are stored in 'cachedHandles_'.
+        struct CachedDescriptorSet
+        {
+            VkDescriptorSetLayout   setLayout;
+            std::size_t             firstHandle;
+            std::size_t             numHandles;
+            VkDescriptorSet         descriptorSet;
+        };
+
+    private:
+
+        VkDevice                                                    device_                 = VK_NULL_HANDLE;
+        std::vector<VKStagingDescriptorPool>                        descriptorPools_;
+        std::size_t                                                 descriptorPoolIndex_    = 0;
+        std::uint32_t                                               capacityLevel_          = 0;
+
+        std::unordered_multimap<std::uint64_t, CachedDescriptorSet> cachedSets_;
+        std::vector<std::uint64_t>                                  cachedHandles_;
+        std::uint32_t                                               numCacheHits_           = 0;
+        std::uint32_t                                               numCacheMisses_         = 0;
 
 };
 
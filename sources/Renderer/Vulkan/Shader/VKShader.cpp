@@ -413,83 +413,46 @@ static UniformType ReflectUniformType(const SpirvReflect::SpvType* type)
     return UniformType::Undefined;
 }
 
-bool VKShader::Reflect(ShaderReflection& reflection) const
+// Merges the specified resource into the output reflection; resources at the same binding slot are shared between shader stages
+static void MergeShaderResource(ShaderReflection& reflection, const ShaderResourceReflection& srcResource)
 {
-    /* Parse shader module */
-    SpirvReflect spvReflect;
-    if (spvReflect.Reflect(SpirvModuleView{ shaderCode_ }) != SpirvResult::NoError)
-        return false;
-
-    /* Gather input/output attributes */
-    for (const auto& it : spvReflect.GetVaryings())
+    for (ShaderResourceReflection& resource : reflection.resources)
     {
-        const SpirvReflect::SpvVarying& var = it.second;
-        if (GetType() == ShaderType::Vertex)
-        {
-            std::uint32_t numVectors = 1;
-
-            /* Determine vertex attribute data */
-            VertexAttribute attrib;
-            {
-                attrib.name         = GetOptString(var.name);
-                attrib.format       = SpvTypeToFormat(var.type, &numVectors);
-                attrib.location     = var.location;
-                attrib.systemValue  = SpvBuiltinToSystemValue(var.builtin);
-            }
-
-            /* Append vertex attributes for each semantic index */
-            for_range(i, numVectors)
-            {
-                attrib.semanticIndex = i;
-                if (var.input)
-                    reflection.vertex.inputAttribs.push_back(attrib);
-                else
-                    reflection.vertex.outputAttribs.push_back(attrib);
-            }
-        }
-        else if (GetType() == ShaderType::Fragment && !var.input)
+        if (resource.binding.slot == srcResource.binding.slot)
         {
-            /* Determine and append fragment attribute data */
-            FragmentAttribute attrib;
-            {
-                attrib.name         = GetOptString(var.name);
-                attrib.format       = SpvTypeToFormat(var.type);
-                attrib.location     = var.location;
-                attrib.systemValue  = SpvBuiltinToFragmentOutputSV(var.builtin);
-            }
-            reflection.fragment.outputAttribs.push_back(attrib);
+            resource.binding.stageFlags |= srcResource.binding.stageFlags;
+            return;
         }
     }
+    reflection.resources.push_back(srcResource);
+}
 
-    /* Gather shader resources */
-    for (const auto& it : spvReflect.GetUniforms())
-    {
-        const SpirvReflect::SpvUniform& var = it.second;
-        if (ShaderResourceReflection* resource = FindOrAppendShaderResource(reflection, var))
-            resource->binding.stageFlags |= ShaderTypeToStageFlags(GetType());
-    }
+template <typename T>
+static void AppendContainer(std::vector<T>& dst, const std::vector<T>& src)
+{
+    dst.insert(dst.end(), src.begin(), src.end());
+}
 
-    /* Gather push constants */
-    if (const SpirvReflect::SpvType* pushConstantType = spvReflect.GetPushConstantStructType())
-    {
-        reflection.uniforms.reserve(reflection.uniforms.size() + pushConstantType->fieldTypes.size());
-        if (pushConstantType->fieldTypes.size() == pushConstantType->fieldNames.size())
-        {
-            for_range(i, pushConstantType->fieldTypes.size())
-            {
-                const SpirvReflect::SpvType* fieldType = pushConstantType->fieldTypes[i];
-                const char* fieldName = pushConstantType->fieldNames[i];
+bool VKShader::Reflect(ShaderReflection& reflection) const
+{
+    /* Get cached reflection; the SPIR-V module is only parsed with the first call */
+    const ReflectionCache* cache = GetOrParseReflection();
+    if (cache == nullptr)
+        return false;
 
-                UniformDescriptor uniformDesc;
-                {
-                    uniformDesc.name        = fieldName;
-                    uniformDesc.type        = ReflectUniformType(fieldType);
-                    uniformDesc.arraySize   = (fieldType->opcode == spv::OpTypeArray ? fieldType->elements : 0);
-                }
-                reflection.uniforms.push_back(uniformDesc);
-            }
-        }
-    }
+    /* Append cached reflection to output, since it might already contain the reflection of other shader stages */
+    const ShaderReflection& srcReflection = cache->reflection;
+
+    AppendContainer(reflection.vertex.inputAttribs, srcReflection.vertex.inputAttribs);
+    AppendContainer(reflection.vertex.outputAttribs, srcReflection.vertex.outputAttribs);
+    AppendContainer(reflection.fragment.outputAttribs, srcReflection.fragment.outputAttribs);
+    AppendContainer(reflection.uniforms, srcReflection.uniforms);
+
+    for (const ShaderResourceReflection& resource : srcReflection.resources)
+        MergeShaderResource(reflection, resource);
+
+    if (GetType() == ShaderType::Compute)
+        reflection.compute.workGroupSize = srcReflection.compute.workGroupSize;
 
     return true;
 }
@@ -499,14 +462,12 @@ bool VKShader::ReflectLocalSize(Extent3D& outLocalSize) const
     if (GetType() != ShaderType::Compute)
         return false;
 
-    /* Parse shader module for execution mode */
-    SpirvReflect::SpvExecutionMode executionMode;
-    SpirvReflectExecutionMode(SpirvModuleView{ shaderCode_ }, executionMode);
+    const ReflectionCache* cache = GetOrParseReflection();
+    if (cache == nullptr)
+        return false;
 
     /* Return local work group size */
-    outLocalSize.width  = executionMode.localSizeX;
-    outLocalSize.height = executionMode.localSizeY;
-    outLocalSize.depth  = executionMode.localSizeZ;
+    outLocalSize = cache->reflection.compute.workGroupSize;
 
     return true;
 }
@@ -518,10 +479,8 @@ bool VKShader::ReflectPushConstants(
     /* Initialize output container with zero-ranges */
     outUniformRanges.resize(inUniformDescs.size());
 
-    /* Parse shader module for push-constants */
-    SpirvReflect::SpvBlock block;
-    SpirvResult result = SpirvReflectPushConstants(SpirvModuleView{ shaderCode_ }, block);
-    if (result != SpirvResult::NoError)
+    const ReflectionCache* cache = GetOrParseReflection();
+    if (cache == nullptr)
         return false;
 
     /* Build push constant ranges */
@@ -529,7 +488,7 @@ bool VKShader::ReflectPushConstants(
     {
         /* Find name of uniform descriptor in push-constant block fields */
         const UniformDescriptor& uniformDesc = inUniformDescs[i];
-        for (const SpirvReflect::SpvBlockField& field : block.fields)
+        for (const PushConstantField& field : cache->pushConstantFields)
         {
             if (field.name != nullptr && ::strcmp(field.name, uniformDesc.name.c_str()) == 0)
             {
@@ -546,6 +505,123 @@ bool VKShader::ReflectPushConstants(
     return true;
 }
 
+const VKShader::ReflectionCache* VKShader::GetOrParseReflection() const
+{
+    std::lock_guard<std::mutex> guard{ reflectionMutex_ };
+
+    if (!reflectionCache_.parsed)
+    {
+        reflectionCache_.parsed = true;
+
+        /* Parse shader module with a single pass */
+        SpirvReflect spvReflect;
+        if (spvReflect.Reflect(SpirvModuleView{ shaderCode_ }) != SpirvResult::NoError)
+            return nullptr;
+
+        ShaderReflection& reflection = reflectionCache_.reflection;
+
+        /* Gather input/output attributes in the order of their SPIR-V IDs */
+        const SpirvIdTable<SpirvReflect::SpvVarying>& varyings = spvReflect.GetVaryings();
+        for_range(id, varyings.GetIdBound())
+        {
+            const SpirvReflect::SpvVarying* var = varyings.Find(id);
+            if (var == nullptr)
+                continue;
+
+            if (GetType() == ShaderType::Vertex)
+            {
+                std::uint32_t numVectors = 1;
+
+                /* Determine vertex attribute data */
+                VertexAttribute attrib;
+                {
+                    attrib.name         = GetOptString(var->name);
+                    attrib.format       = SpvTypeToFormat(var->type, &numVectors);
+                    attrib.location     = var->location;
+                    attrib.systemValue  = SpvBuiltinToSystemValue(var->builtin);
+                }
+
+                /* Append vertex attributes for each semantic index */
+                for_range(i, numVectors)
+                {
+                    attrib.semanticIndex = i;
+                    if (var->input)
+                        reflection.vertex.inputAttribs.push_back(attrib);
+                    else
+                        reflection.vertex.outputAttribs.push_back(attrib);
+                }
+            }
+            else if (GetType() == ShaderType::Fragment && !var->input)
+            {
+                /* Determine and append fragment attribute data */
+                FragmentAttribute attrib;
+                {
+                    attrib.name         = GetOptString(var->name);
+                    attrib.format       = SpvTypeToFormat(var->type);
+                    attrib.location     = var->location;
+                    attrib.systemValue  = SpvBuiltinToFragmentOutputSV(var->builtin);
+                }
+                reflection.fragment.outputAttribs.push_back(attrib);
+            }
+        }
+
+        /* Gather shader resources */
+        const SpirvIdTable<SpirvReflect::SpvUniform>& uniforms = spvReflect.GetUniforms();
+        for_range(id, uniforms.GetIdBound())
+        {
+            if (const SpirvReflect::SpvUniform* var = uniforms.Find(id))
+            {
+                if (ShaderResourceReflection* resource = FindOrAppendShaderResource(reflection, *var))
+                    resource->binding.stageFlags |= ShaderTypeToStageFlags(GetType());
+            }
+        }
+
+        /* Gather push constants */
+        if (const SpirvReflect::SpvType* pushConstantType = spvReflect.GetPushConstantStructType())
+        {
+            reflection.uniforms.reserve(reflection.uniforms.size() + pushConstantType->fieldTypes.size());
+            if (pushConstantType->fieldTypes.size() == pushConstantType->fieldNames.size())
+            {
+                for_range(i, pushConstantType->fieldTypes.size())
+                {
+                    const SpirvReflect::SpvType* fieldType = pushConstantType->fieldTypes[i];
+                    const char* fieldName = pushConstantType->fieldNames[i];
+
+                    UniformDescriptor uniformDesc;
+                    {
+                        uniformDesc.name        = fieldName;
+                        uniformDesc.type        = ReflectUniformType(fieldType);
+                        uniformDesc.arraySize   = (fieldType->opcode == spv::OpTypeArray ? fieldType->elements : 0);
+                    }
+                    reflection.uniforms.push_back(uniformDesc);
+                }
+            }
+        }
+
+        /* Store push constant block fields; their names point into the SPIR-V module of this shader */
+        SpirvReflect::SpvBlock pushConstantBlock;
+        if (spvReflect.GetPushConstantBlock(pushConstantBlock))
+        {
+            reflectionCache_.pushConstantFields.reserve(pushConstantBlock.fields.size());
+            for (const SpirvReflect::SpvBlockField& field : pushConstantBlock.fields)
+                reflectionCache_.pushConstantFields.push_back(PushConstantField{ field.name, field.offset });
+        }
+
+        /* Store local work group size */
+        if (GetType() == ShaderType::Compute)
+        {
+            const SpirvReflect::SpvExecutionMode& executionMode = spvReflect.GetExecutionMode();
+            reflection.compute.workGroupSize.width  = executionMode.localSizeX;
+            reflection.compute.workGroupSize.height = executionMode.localSizeY;
+            reflection.compute.workGroupSize.depth  = executionMode.localSizeZ;
+        }
+
+        reflectionCache_.valid = true;
+    }
+
+    return (reflectionCache_.valid ? &reflectionCache_ : nullptr);
+}
+
 #else // LLGL_VK_ENABLE_SPIRV_REFLECT
 
 bool VKShader::Reflect(ShaderReflection& /*reflection*/) const
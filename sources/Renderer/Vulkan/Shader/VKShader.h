@@ -10,19 +10,20 @@
 
 
 #include <LLGL/Shader.h>
+#include <LLGL/ShaderReflection.h>
 #include <LLGL/Report.h>
 #include "../Vulkan.h"
 #include "../VKPtr.h"
 #include "VKShaderBindingLayout.h"
 #include <vector>
 #include <functional>
+#include <mutex>
 
 
 namespace LLGL
 {
 
 
-struct ShaderReflection;
 struct Extent3D;
 
 // Container type of 32-bit words for Vulkan shader binary code.
@@ -107,12 +108,33 @@ class VKShader final : public Shader
 
     private:
 
+        // Field of the push constant block. The name refers to a string within the SPIR-V module.
+        struct PushConstantField
+        {
+            const char*     name;
+            std::uint32_t   offset;
+        };
+
+        // Reflection of the SPIR-V module that is shared by all reflection queries of this shader.
+        struct ReflectionCache
+        {
+            bool                            parsed  = false;
+            bool                            valid   = false;
+            ShaderReflection                reflection;
+            std::vector<PushConstantField>  pushConstantFields;
+        };
+
         struct VertexInputLayout
         {
             std::vector<VkVertexInputBindingDescription>    bindingDescs;
             std::vector<VkVertexInputAttributeDescription>  attribDescs;
         };
 
+    private:
+
+        // Returns the reflection of the SPIR-V module, which is only parsed once with the first call. Returns null if the reflection failed.
+        const ReflectionCache* GetOrParseReflection() const;
+
     private:
 
         VkDevice                device_             = VK_NULL_HANDLE;
@@ -127,6 +149,9 @@ class VKShader final : public Shader
         std::string             entryPoint_;
         Report                  report_;
 
+        mutable std::mutex      reflectionMutex_;
+        mutable ReflectionCache reflectionCache_;
+
 };
 
 
@@ -8,7 +8,6 @@
 #include "VKShaderModulePool.h"
 #include "../RenderState/VKPipelineLayout.h"
 #include "../../../Core/CoreUtils.h"
-#include "../../../Core/MacroUtils.h"
 
 
 namespace LLGL
@@ -23,72 +22,74 @@ VKShaderModulePool& VKShaderModulePool::Get()
 
 void VKShaderModulePool::Clear()
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
     permutations_.clear();
+    shaderPipelineLayouts_.clear();
 }
 
 VkShaderModule VKShaderModulePool::GetOrCreateVkShaderModulePermutation(VKShader& shader, const VKPipelineLayout& pipelineLayout)
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
     /* Try to find existing pair of shader/pipeline-layout */
-    const auto* shaderPtr = &shader;
-    const auto* pipelineLayoutPtr = &pipelineLayout;
-
-    std::size_t insertionPos = 0;
-    auto* permutation = FindInSortedArray<ShaderModulePermutation>(
-        permutations_.data(),
-        permutations_.size(),
-        [shaderPtr, pipelineLayoutPtr](const ShaderModulePermutation& entry) -> int
-        {
-            LLGL_COMPARE_SEPARATE_MEMBERS_SWO(pipelineLayoutPtr, entry.pipelineLayout);
-            LLGL_COMPARE_SEPARATE_MEMBERS_SWO(shaderPtr, entry.shader);
-            return 0;
-        },
-        &insertionPos
-    );
-
-    if (permutation == nullptr)
-    {
-        /* Create new shader module permutation */
-        VKPtr<VkShaderModule> shaderModule = pipelineLayout.CreateVkShaderModulePermutation(shader);
-        VkShaderModule nativeHandle = shaderModule.Get();
+    ShaderModuleMap& shaderModules = permutations_[&pipelineLayout];
 
-        if (nativeHandle != VK_NULL_HANDLE)
-        {
-            ShaderModulePermutation newPermutation;
-            {
-                newPermutation.pipelineLayout   = pipelineLayoutPtr;
-                newPermutation.shader           = shaderPtr;
-                newPermutation.shaderModule     = std::move(shaderModule);
-            }
-            permutations_.insert(permutations_.begin() + insertionPos, std::move(newPermutation));
-        }
-        return nativeHandle;
-    }
+    auto it = shaderModules.find(&shader);
+    if (it != shaderModules.end())
+        return it->second.Get();
+
+    /* Create new shader module permutation and also cache the result if no permutation was necessary, so the SPIR-V module is only patched once */
+    VKPtr<VkShaderModule> shaderModule = pipelineLayout.CreateVkShaderModulePermutation(shader);
+    VkShaderModule nativeHandle = shaderModule.Get();
+
+    shaderModules.emplace(&shader, std::move(shaderModule));
+    shaderPipelineLayouts_[&shader].push_back(&pipelineLayout);
 
-    return permutation->shaderModule.Get();
+    return nativeHandle;
 }
 
 void VKShaderModulePool::NotifyReleaseShader(VKShader* shader)
 {
-    /* Since shader is the second key, we have to iterate over the entire list */
-    RemoveAllFromListIf(
-        permutations_,
-        [shader](const ShaderModulePermutation& entry) -> bool
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    /* Only visit the pipeline layouts that have a permutation of this shader */
+    auto it = shaderPipelineLayouts_.find(shader);
+    if (it != shaderPipelineLayouts_.end())
+    {
+        for (const VKPipelineLayout* pipelineLayout : it->second)
         {
-            return (entry.shader == shader);
+            auto permutationIt = permutations_.find(pipelineLayout);
+            if (permutationIt != permutations_.end())
+            {
+                permutationIt->second.erase(shader);
+                if (permutationIt->second.empty())
+                    permutations_.erase(permutationIt);
+            }
         }
-    );
+        shaderPipelineLayouts_.erase(it);
+    }
 }
 
 void VKShaderModulePool::NotifyReleasePipelineLayout(VKPipelineLayout* pipelineLayout)
 {
-    /* Since pipeline layout is the first key, we can search for the first occurance and then delete all consecutive entries that match the key */
-    RemoveAllConsecutiveFromListIf(
-        permutations_,
-        [pipelineLayout](const ShaderModulePermutation& entry) -> bool
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    auto it = permutations_.find(pipelineLayout);
+    if (it != permutations_.end())
+    {
+        /* Remove pipeline layout from the reverse index of all its shaders */
+        for (const auto& shaderModule : it->second)
         {
-            return (entry.pipelineLayout == pipelineLayout);
+            auto shaderIt = shaderPipelineLayouts_.find(shaderModule.first);
+            if (shaderIt != shaderPipelineLayouts_.end())
+            {
+                RemoveFromList(shaderIt->second, pipelineLayout);
+                if (shaderIt->second.empty())
+                    shaderPipelineLayouts_.erase(shaderIt);
+            }
         }
-    );
+        permutations_.erase(it);
+    }
 }
 
 
@@ -11,7 +11,9 @@
 
 #include "../Vulkan.h"
 #include "../VKPtr.h"
+#include <unordered_map>
 #include <vector>
+#include <mutex>
 
 
 namespace LLGL
@@ -21,7 +23,7 @@ namespace LLGL
 class VKShader;
 class VKPipelineLayout;
 
-// Singleton pool for Vulkan shader/pipeline-layout permutations.
+// Singleton pool for Vulkan shader/pipeline-layout permutations. All functions of this pool are thread-safe.
 class VKShaderModulePool
 {
 
@@ -36,8 +38,13 @@ class VKShaderModulePool
         // Clear all resource containers of this pool (used by VKRenderSystem).
         void Clear();
 
-        /* ----- Depth-stencil states ----- */
+        /* ----- Shader module permutations ----- */
 
+        /*
+        Returns the shader module permutation for the specified pair of shader and pipeline layout.
+        The SPIR-V module is patched at most once per pair, i.e. even if the permutation turns out to be unnecessary, that result is cached as well.
+        Returns VK_NULL_HANDLE if the shader does not need a permutation for this pipeline layout.
+        */
         VkShaderModule GetOrCreateVkShaderModulePermutation(VKShader& shader, const VKPipelineLayout& pipelineLayout);
 
         void NotifyReleaseShader(VKShader* shader);
@@ -45,12 +52,8 @@ class VKShaderModulePool
 
     private:
 
-        struct ShaderModulePermutation
-        {
-            const VKPipelineLayout* pipelineLayout  = nullptr;
-            const VKShader*         shader          = nullptr;
-            VKPtr<VkShaderModule>   shaderModule;
-        };
+        // Shader module permutations of a single pipeline layout. Null handles denote shaders that don't need a permutation.
+        using ShaderModuleMap = std::unordered_map<const VKShader*, VKPtr<VkShaderModule>>;
 
     private:
 
@@ -58,7 +61,13 @@ class VKShaderModulePool
 
     private:
 
-        std::vector<ShaderModulePermutation> permutations_;
+        std::mutex                                                                  mutex_;
+
+        // Primary map from pipeline layout to the permutations of all its shaders.
+        std::unordered_map<const VKPipelineLayout*, ShaderModuleMap>                permutations_;
+
+        // Reverse index from shader to all pipeline layouts that have a permutation of this shader.
+        std::unordered_map<const VKShader*, std::vector<const VKPipelineLayout*>>   shaderPipelineLayouts_;
 
 };
 
@@ -29,6 +29,7 @@ VKDeviceImage::VKDeviceImage(VKDeviceImage&& rhs) :
     memoryRequirements_ { rhs.memoryRequirements_ },
     memoryRegion_       { rhs.memoryRegion_       }
 {
+    rhs.memoryRegion_ = nullptr;
 }
 
 VKDeviceImage& VKDeviceImage::operator = (VKDeviceImage&& rhs)
@@ -37,6 +38,7 @@ VKDeviceImage& VKDeviceImage::operator = (VKDeviceImage&& rhs)
     layout_             = rhs.layout_;
     memoryRequirements_ = rhs.memoryRequirements_;
     memoryRegion_       = rhs.memoryRegion_;
+    rhs.memoryRegion_   = nullptr;
     return *this;
 }
 
@@ -52,7 +54,8 @@ void VKDeviceImage::AllocateMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr
         memoryRequirements_.size,
         memoryRequirements_.alignment,
         memoryRequirements_.memoryTypeBits,
-        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+        /*optimalTiling:*/ true
     );
 
     /* Bind image to device memory region */
@@ -143,6 +143,18 @@ class VKTexture final : public Texture
             return image_.GetMemoryRegion();
         }
 
+        // Returns the device image of this texture. Used to defer its release.
+        inline VKDeviceImage& GetDeviceImage()
+        {
+            return image_;
+        }
+
+        // Returns the primary image view of this texture. Used to defer its release.
+        inline VKPtr<VkImageView>& GetImageViewPtr()
+        {
+            return imageView_;
+        }
+
     private:
 
         void CreateImage(VkDevice device, const TextureDescriptor& desc);
@@ -7,6 +7,7 @@
 
 #include "VKDevice.h"
 #include "VKTypes.h"
+#include "Ext/VKExtensions.h"
 #include "RenderState/VKFence.h"
 #include "Buffer/VKBuffer.h"
 #include "Texture/VKTexture.h"
@@ -25,16 +26,19 @@ namespace LLGL
 /* ----- Common ----- */
 
 VKDevice::VKDevice() :
-    device_      { vkDestroyDevice               },
-    commandPool_ { device_, vkDestroyCommandPool }
+    device_             { vkDestroyDevice               },
+    commandPool_        { device_, vkDestroyCommandPool },
+    timelineSemaphore_  { device_, vkDestroySemaphore   }
 {
 }
 
 VKDevice::VKDevice(VKDevice&& device) :
-    device_             { std::move(device.device_)      },
-    queueFamilyIndices_ { device.queueFamilyIndices_     },
-    graphicsQueue_      { device.graphicsQueue_          },
-    commandPool_        { std::move(device.commandPool_) }
+    device_             { std::move(device.device_)            },
+    queueFamilyIndices_ { device.queueFamilyIndices_           },
+    graphicsQueue_      { device.graphicsQueue_                },
+    commandPool_        { std::move(device.commandPool_)       },
+    timelineSemaphore_  { std::move(device.timelineSemaphore_) },
+    timelineValue_      { device.timelineValue_                }
 {
 }
 
@@ -44,6 +48,8 @@ VKDevice& VKDevice::operator = (VKDevice&& device)
     queueFamilyIndices_ = device.queueFamilyIndices_;
     graphicsQueue_      = device.graphicsQueue_;
     commandPool_        = std::move(device.commandPool_);
+    timelineSemaphore_  = std::move(device.timelineSemaphore_);
+    timelineValue_      = device.timelineValue_;
     return *this;
 }
 
@@ -192,9 +198,18 @@ void VKDevice::FlushCommandBuffer(VkCommandBuffer cmdBuffer, bool release)
     VkResult result = vkEndCommandBuffer(cmdBuffer);
     VKThrowIfFailed(result, "failed to end recording Vulkan command buffer");
 
-    /* Create fence to ensure the command buffer has finished execution */
+    if (HasTimelineSemaphore())
     {
-        VKFence fence{ device_ };
+        /* Wait for the timeline value of this submission, which does not require a fence object */
+        std::uint64_t value = 0;
+        result = SubmitAndSignalTimeline(1, &cmdBuffer, VK_NULL_HANDLE, value);
+        VKThrowIfFailed(result, "failed to submit Vulkan command buffer");
+        WaitTimelineValue(value, ULLONG_MAX);
+    }
+    else
+    {
+        /* Create fence to ensure the command buffer has finished execution */
+        VKFence fence{ *this };
 
         /* Submit command buffer to queue */
         VkSubmitInfo submitInfo = {};
@@ -214,6 +229,112 @@ void VKDevice::FlushCommandBuffer(VkCommandBuffer cmdBuffer, bool release)
         vkFreeCommandBuffers(device_, commandPool_, 1, &cmdBuffer);
 }
 
+/* ----- Timeline semaphore ----- */
+
+void VKDevice::CreateTimelineSemaphore()
+{
+    #if VK_KHR_timeline_semaphore
+
+    VkSemaphoreTypeCreateInfoKHR typeCreateInfo;
+    {
+        typeCreateInfo.sType            = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+        typeCreateInfo.pNext            = nullptr;
+        typeCreateInfo.semaphoreType    = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+        typeCreateInfo.initialValue     = 0;
+    }
+    VkSemaphoreCreateInfo createInfo;
+    {
+        createInfo.sType                = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        createInfo.pNext                = &typeCreateInfo;
+        createInfo.flags                = 0;
+    }
+    VKPtr<VkSemaphore> timelineSemaphore{ device_, vkDestroySemaphore };
+    VkResult result = vkCreateSemaphore(device_, &createInfo, nullptr, timelineSemaphore.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan timeline semaphore");
+
+    timelineSemaphore_  = std::move(timelineSemaphore);
+    timelineValue_      = 0;
+
+    #endif // /VK_KHR_timeline_semaphore
+}
+
+VkResult VKDevice::SubmitAndSignalTimeline(
+    std::uint32_t           numCommandBuffers,
+    const VkCommandBuffer*  commandBuffers,
+    VkFence                 fence,
+    std::uint64_t&          outValue)
+{
+    #if VK_KHR_timeline_semaphore
+
+    const std::uint64_t signalValue = timelineValue_ + 1;
+
+    VkTimelineSemaphoreSubmitInfoKHR timelineSubmitInfo;
+    {
+        timelineSubmitInfo.sType                        = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+        timelineSubmitInfo.pNext                        = nullptr;
+        timelineSubmitInfo.waitSemaphoreValueCount      = 0;
+        timelineSubmitInfo.pWaitSemaphoreValues         = nullptr;
+        timelineSubmitInfo.signalSemaphoreValueCount    = 1;
+        timelineSubmitInfo.pSignalSemaphoreValues       = &signalValue;
+    }
+    VkSubmitInfo submitInfo;
+    {
+        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.pNext                = &timelineSubmitInfo;
+        submitInfo.waitSemaphoreCount   = 0;
+        submitInfo.pWaitSemaphores      = nullptr;
+        submitInfo.pWaitDstStageMask    = nullptr;
+        submitInfo.commandBufferCount   = numCommandBuffers;
+        submitInfo.pCommandBuffers      = commandBuffers;
+        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.pSignalSemaphores    = timelineSemaphore_.GetAddressOf();
+    }
+    VkResult result = vkQueueSubmit(graphicsQueue_, 1, &submitInfo, fence);
+
+    /* Only advance the timeline if the submission succeeded, since values must be strictly increasing */
+    if (result == VK_SUCCESS)
+        timelineValue_ = signalValue;
+
+    outValue = signalValue;
+    return result;
+
+    #else // VK_KHR_timeline_semaphore
+
+    outValue = 0;
+    return VK_ERROR_FEATURE_NOT_PRESENT;
+
+    #endif // /VK_KHR_timeline_semaphore
+}
+
+bool VKDevice::IsTimelineValueReached(std::uint64_t value) const
+{
+    #if VK_KHR_timeline_semaphore
+    std::uint64_t currentValue = 0;
+    vkGetSemaphoreCounterValueKHR(device_, timelineSemaphore_, &currentValue);
+    return (currentValue >= value);
+    #else
+    return true;
+    #endif
+}
+
+bool VKDevice::WaitTimelineValue(std::uint64_t value, std::uint64_t timeout) const
+{
+    #if VK_KHR_timeline_semaphore
+    VkSemaphoreWaitInfoKHR waitInfo;
+    {
+        waitInfo.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+        waitInfo.pNext          = nullptr;
+        waitInfo.flags          = 0;
+        waitInfo.semaphoreCount = 1;
+        waitInfo.pSemaphores    = timelineSemaphore_.GetAddressOf();
+        waitInfo.pValues        = &value;
+    }
+    return (vkWaitSemaphoresKHR(device_, &waitInfo, timeout) == VK_SUCCESS);
+    #else
+    return true;
+    #endif
+}
+
 void VKDevice::CopyBuffer(
     VkBuffer        srcBuffer,
     VkBuffer        dstBuffer,
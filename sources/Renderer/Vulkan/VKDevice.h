@@ -56,6 +56,43 @@ class VKDevice
         VkCommandBuffer AllocCommandBuffer(bool begin = true);
         void FlushCommandBuffer(VkCommandBuffer cmdBuffer, bool release = true);
 
+        /* ----- Timeline semaphore ----- */
+
+        /*
+        Creates a timeline semaphore for the graphics queue (requires VK_KHR_timeline_semaphore).
+        Submissions can then be tracked by a monotonically increasing 64-bit value instead of a binary VkFence each.
+        */
+        void CreateTimelineSemaphore();
+
+        /*
+        Submits the specified command buffers to the graphics queue and signals the next value of the timeline semaphore.
+        The optional fence is signaled as well. Returns the signaled value in 'outValue'.
+        */
+        VkResult SubmitAndSignalTimeline(
+            std::uint32_t           numCommandBuffers,
+            const VkCommandBuffer*  commandBuffers,
+            VkFence                 fence,
+            std::uint64_t&          outValue
+        );
+
+        // Returns true if the timeline semaphore has reached the specified value, i.e. all submissions up to this value have completed.
+        bool IsTimelineValueReached(std::uint64_t value) const;
+
+        // Blocks until the timeline semaphore has reached the specified value or the timeout (in nanoseconds) has expired.
+        bool WaitTimelineValue(std::uint64_t value, std::uint64_t timeout) const;
+
+        // Returns true if this device tracks submissions with a timeline semaphore.
+        inline bool HasTimelineSemaphore() const
+        {
+            return (timelineSemaphore_.Get() != VK_NULL_HANDLE);
+        }
+
+        // Returns the native VkSemaphore handle of the timeline semaphore or VK_NULL_HANDLE if there is none.
+        inline VkSemaphore GetTimelineSemaphore() const
+        {
+            return timelineSemaphore_.Get();
+        }
+
         /* ----- Buffer/Image operatons ----- */
 
         void CopyBuffer(
@@ -115,6 +152,9 @@ class VKDevice
         VkQueue                 graphicsQueue_      = VK_NULL_HANDLE;
         VKPtr<VkCommandPool>    commandPool_;
 
+        VKPtr<VkSemaphore>      timelineSemaphore_;
+        std::uint64_t           timelineValue_      = 0; // Last value that was submitted to be signaled
+
 };
 
 
@@ -388,6 +388,15 @@ std::uint32_t VKPhysicalDevice::FindMemoryType(std::uint32_t memoryTypeBits, VkM
     return VKFindMemoryType(memoryProperties_, memoryTypeBits, properties);
 }
 
+bool VKPhysicalDevice::SupportsTimelineSemaphores() const
+{
+    #if VK_KHR_timeline_semaphore
+    return (featuresTimelineSemaphore_.timelineSemaphore != VK_FALSE);
+    #else
+    return false;
+    #endif
+}
+
 bool VKPhysicalDevice::SupportsExtension(const char* extension) const
 {
     auto it = std::find_if(
@@ -471,6 +480,11 @@ void VKPhysicalDevice::QueryDeviceFeatures()
         ChainDescriptor(&transformFeedbackFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_FEATURES_EXT);
     #endif
 
+    #if VK_KHR_timeline_semaphore
+    if (SupportsExtension(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME))
+        ChainDescriptor(&featuresTimelineSemaphore_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR);
+    #endif
+
     vkGetPhysicalDeviceFeatures2(physicalDevice_, &features_);
 
     #else // VK_KHR_get_physical_device_properties2
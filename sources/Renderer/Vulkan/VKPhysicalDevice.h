@@ -47,6 +47,9 @@ class VKPhysicalDevice
         // Returns true if the specified Vulkan extension is supported by this physical device.
         bool SupportsExtension(const char* extension) const;
 
+        // Returns true if the timeline semaphore feature (VK_KHR_timeline_semaphore) is supported and enabled.
+        bool SupportsTimelineSemaphores() const;
+
         /* ----- Handles ----- */
 
         // Returns the native VkPhysicalDevice handle.
@@ -118,6 +121,9 @@ class VKPhysicalDevice
         #if VK_EXT_nested_command_buffer
         VkPhysicalDeviceNestedCommandBufferFeaturesEXT          featuresNestedCmdBuffers_   = {};
         #endif
+        #if VK_KHR_timeline_semaphore
+        VkPhysicalDeviceTimelineSemaphoreFeaturesKHR            featuresTimelineSemaphore_  = {};
+        #endif
         VkPhysicalDeviceProperties                              properties_                 = {};
         VkPhysicalDeviceMemoryProperties                        memoryProperties_           = {};
 
@@ -24,6 +24,8 @@
 #include "Shader/VKShaderModulePool.h"
 #include "../../Platform/Debug.h"
 #include <LLGL/ImageFlags.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
 #include <limits>
 
 #include <LLGL/Backend/Vulkan/NativeHandle.h>
@@ -33,9 +35,13 @@ namespace LLGL
 {
 
 
+// Size of the staging ring buffer for batched buffer and texture writes.
+static constexpr VkDeviceSize k_stagingRingSize = 8*1024*1024;
+
 VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
     instance_          { vkDestroyInstance                                                },
-    debugLayerEnabled_ { ((renderSystemDesc.flags & RenderSystemFlags::DebugDevice) != 0) }
+    debugLayerEnabled_ { ((renderSystemDesc.flags & RenderSystemFlags::DebugDevice) != 0) },
+    debugger_          { renderSystemDesc.debugger                                        }
 {
     /* Extract optional renderer configuartion */
     auto* rendererConfigVK = GetRendererConfiguration<RendererConfigurationVulkan>(renderSystemDesc);
@@ -76,6 +82,16 @@ VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
         (rendererConfigVK != nullptr ? rendererConfigVK->minDeviceMemoryAllocationSize : 1024*1024),
         (rendererConfigVK != nullptr ? rendererConfigVK->reduceDeviceMemoryFragmentation : false)
     );
+
+    /* Create staging buffer pool for batched transfers and command queue interface */
+    stagingBufferPool_ = MakeUnique<VKStagingBufferPool>(
+        device_,
+        *deviceMemoryMngr_,
+        physicalDevice_.GetMemoryProperties(),
+        k_stagingRingSize,
+        debugger_
+    );
+    commandQueue_ = MakeUnique<VKCommandQueue>(device_, stagingBufferPool_.get());
 }
 
 VKRenderSystem::~VKRenderSystem()
@@ -108,7 +124,7 @@ CommandQueue* VKRenderSystem::GetCommandQueue()
 
 CommandBuffer* VKRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& commandBufferDesc)
 {
-    return commandBuffers_.emplace<VKCommandBuffer>(physicalDevice_, device_, device_.GetVkQueue(), device_.GetQueueFamilyIndices(), commandBufferDesc);
+    return commandBuffers_.emplace<VKCommandBuffer>(physicalDevice_, device_, *commandQueue_, device_.GetQueueFamilyIndices(), commandBufferDesc, debugger_);
 }
 
 void VKRenderSystem::Release(CommandBuffer& commandBuffer)
@@ -175,9 +191,12 @@ BufferArray* VKRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer*
 
 void VKRenderSystem::Release(Buffer& buffer)
 {
-    /* Release device memory regions for primary buffer and internal staging buffer, then release buffer object */
+    /*
+    Hand primary buffer over to the staging pool, which destroys it once all previously submitted commands have completed.
+    The internal staging buffer is only accessed by synchronous copies, so its memory region can be released right away.
+    */
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
-    bufferVK.GetDeviceBuffer().ReleaseMemoryRegion(*deviceMemoryMngr_);
+    stagingBufferPool_->ReleaseDeviceBuffer(std::move(bufferVK.GetDeviceBuffer()));
     bufferVK.GetStagingDeviceBuffer().ReleaseMemoryRegion(*deviceMemoryMngr_);
     buffers_.erase(&buffer);
 }
@@ -191,6 +210,18 @@ void VKRenderSystem::WriteBuffer(Buffer& buffer, std::uint64_t offset, const voi
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
 
+    /* Record copy command into the pending transfer batch without waiting for the GPU */
+    if (stagingBufferPool_->WriteBuffer(bufferVK.GetVkBuffer(), offset, data, dataSize))
+    {
+        /* Keep internal staging buffer in sync, since Map() with write access only uploads the mapped range back to the primary buffer */
+        if (bufferVK.GetStagingVkBuffer() != VK_NULL_HANDLE)
+            device_.WriteBuffer(bufferVK.GetStagingDeviceBuffer(), data, dataSize, offset);
+        return;
+    }
+
+    /* Data exceeds the staging ring, so submit pending transfers first to preserve the order of writes */
+    stagingBufferPool_->Flush();
+
     if (bufferVK.GetStagingVkBuffer() != VK_NULL_HANDLE)
     {
         /* Copy input data to staging buffer memory */
@@ -223,6 +254,9 @@ void VKRenderSystem::ReadBuffer(Buffer& buffer, std::uint64_t offset, void* data
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
 
+    /* Submit pending transfers, so the read-back copy is executed after them */
+    stagingBufferPool_->Flush();
+
     if (bufferVK.GetStagingVkBuffer() != VK_NULL_HANDLE)
     {
         /* Copy hardware buffer into staging buffer */
@@ -257,12 +291,20 @@ void VKRenderSystem::ReadBuffer(Buffer& buffer, std::uint64_t offset, void* data
 void* VKRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+
+    /* Wait for pending transfers, so the mapped memory is up to date and not written by the GPU concurrently */
+    stagingBufferPool_->FlushAndWait();
+
     return bufferVK.Map(device_, access, 0, bufferVK.GetSize());
 }
 
 void* VKRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access, std::uint64_t offset, std::uint64_t length)
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+
+    /* Wait for pending transfers, so the mapped memory is up to date and not written by the GPU concurrently */
+    stagingBufferPool_->FlushAndWait();
+
     return bufferVK.Map(device_, access, static_cast<VkDeviceSize>(offset), static_cast<VkDeviceSize>(length));
 }
 
@@ -418,9 +460,9 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
 
 void VKRenderSystem::Release(Texture& texture)
 {
-    /* Release device memory region, then release texture object */
+    /* Hand image over to the staging pool, which destroys it once all previously submitted commands have completed, then release texture object */
     auto& textureVK = LLGL_CAST(VKTexture&, texture);
-    deviceMemoryMngr_->Release(textureVK.GetMemoryRegion());
+    stagingBufferPool_->ReleaseDeviceImage(std::move(textureVK.GetDeviceImage()), std::move(textureVK.GetImageViewPtr()));
     textures_.erase(&texture);
 }
 
@@ -469,6 +511,17 @@ void VKRenderSystem::WriteTexture(Texture& texture, const TextureRegion& texture
         imageData = srcImageView.data;
     }
 
+    /*
+    Record copy command into the pending transfer batch without waiting for the GPU.
+    Buffer offsets for image copies must be a multiple of 4 and of the texel block size.
+    */
+    const VkDeviceSize blockSize = std::max<VkDeviceSize>(1, formatAttribs.bitSize / 8);
+    if (stagingBufferPool_->WriteTexture(textureVK, textureRegion, imageData, imageDataSize, blockSize * 4))
+        return;
+
+    /* Image data exceeds the staging ring, so submit pending transfers first to preserve the order of writes */
+    stagingBufferPool_->Flush();
+
     /* Create staging buffer */
     VkBufferCreateInfo stagingCreateInfo;
     BuildVkBufferCreateInfo(
@@ -516,6 +569,9 @@ void VKRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureR
     const std::uint32_t         imageSize       = extent.width * extent.height * extent.depth * subresource.numArrayLayers;
     const VkDeviceSize          imageDataSize   = static_cast<VkDeviceSize>(GetMemoryFootprint(format, imageSize));
 
+    /* Submit pending transfers, so the read-back copy is executed after them */
+    stagingBufferPool_->Flush();
+
     /* Create staging buffer */
     VkBufferCreateInfo stagingCreateInfo;
     BuildVkBufferCreateInfo(stagingCreateInfo, imageDataSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
@@ -657,13 +713,36 @@ PipelineState* VKRenderSystem::CreatePipelineState(const GraphicsPipelineDescrip
         (!swapChains_.empty() ? (*swapChains_.begin())->GetRenderPass() : nullptr),
         pipelineStateDesc,
         graphicsPipelineLimits_,
-        pipelineCache
+        GetPipelineCacheOrDefault(pipelineCache)
     );
 }
 
 PipelineState* VKRenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
 {
-    return pipelineStates_.emplace<VKComputePSO>(device_, pipelineStateDesc, pipelineCache);
+    return pipelineStates_.emplace<VKComputePSO>(device_, pipelineStateDesc, GetPipelineCacheOrDefault(pipelineCache));
+}
+
+void VKRenderSystem::CreatePipelineStates(std::uint32_t numPipelineStates, const GraphicsPipelineDescriptor* pipelineStateDescs, PipelineState** outPipelineStates)
+{
+    /* Collect the create-info structures of all PSOs first */
+    const RenderPass* defaultRenderPass = (!swapChains_.empty() ? (*swapChains_.begin())->GetRenderPass() : nullptr);
+
+    VKGraphicsPipelineBatch pipelineBatch;
+    for_range(i, numPipelineStates)
+    {
+        outPipelineStates[i] = pipelineStates_.emplace<VKGraphicsPSO>(
+            device_,
+            defaultRenderPass,
+            pipelineStateDescs[i],
+            graphicsPipelineLimits_,
+            nullptr,
+            &pipelineBatch
+        );
+    }
+
+    /* Create all Vulkan pipelines with a single call, so the driver can compile them concurrently and share the default pipeline cache */
+    VKPipelineCache* pipelineCacheVK = LLGL_CAST(VKPipelineCache*, GetPipelineCacheOrDefault(nullptr));
+    pipelineBatch.CreateVkPipelines(device_, pipelineCacheVK->GetNative());
 }
 
 void VKRenderSystem::Release(PipelineState& pipelineState)
@@ -722,6 +801,15 @@ bool VKRenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHandl
 #define VK_LAYER_KHRONOS_VALIDATION_NAME "VK_LAYER_KHRONOS_validation"
 #endif
 
+PipelineCache* VKRenderSystem::GetPipelineCacheOrDefault(PipelineCache* pipelineCache)
+{
+    if (pipelineCache != nullptr)
+        return pipelineCache;
+    if (!defaultPipelineCache_)
+        defaultPipelineCache_ = MakeUnique<VKPipelineCache>(device_, Blob{});
+    return defaultPipelineCache_.get();
+}
+
 void VKRenderSystem::CreateInstance(const RendererConfigurationVulkan* config)
 {
     /* Determine supported Vulkan API version */
@@ -908,11 +996,13 @@ void VKRenderSystem::CreateLogicalDevice(VkDevice customLogicalDevice)
     /* Create logical device with all supported physical device feature */
     device_ = physicalDevice_.CreateLogicalDevice(customLogicalDevice);
 
-    /* Create command queue interface */
-    commandQueue_ = MakeUnique<VKCommandQueue>(device_, device_.GetVkQueue());
-
     /* Load Vulkan device extensions */
     VKLoadDeviceExtensions(device_, physicalDevice_.GetExtensionNames());
+
+    /* Track queue submissions with a timeline semaphore if supported; a custom device might not have enabled this feature */
+    if (customLogicalDevice == VK_NULL_HANDLE && HasExtension(VKExt::KHR_timeline_semaphore) && physicalDevice_.SupportsTimelineSemaphores())
+        device_.CreateTimelineSemaphore();
+
 }
 
 bool VKRenderSystem::IsLayerRequired(const char* name, const RendererConfigurationVulkan* config) const
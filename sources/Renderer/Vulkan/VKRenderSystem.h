@@ -22,6 +22,7 @@
 
 #include "Buffer/VKBuffer.h"
 #include "Buffer/VKBufferArray.h"
+#include "Buffer/VKStagingBufferPool.h"
 
 #include "Shader/VKShader.h"
 
@@ -60,6 +61,12 @@ class VKRenderSystem final : public RenderSystem
         VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc);
         ~VKRenderSystem();
 
+        void CreatePipelineStates(
+            std::uint32_t                       numPipelineStates,
+            const GraphicsPipelineDescriptor*   pipelineStateDescs,
+            PipelineState**                     outPipelineStates
+        ) override;
+
     private:
 
         #include <LLGL/Backend/RenderSystem.Internal.inl>
@@ -84,6 +91,9 @@ class VKRenderSystem final : public RenderSystem
         VkCommandBuffer AllocCommandBuffer(bool begin = true);
         void FlushCommandBuffer(VkCommandBuffer commandBuffer);
 
+        // Returns the specified pipeline cache or the default pipeline cache if the specified one is null. The default cache is created on demand.
+        PipelineCache* GetPipelineCacheOrDefault(PipelineCache* pipelineCache);
+
     private:
 
         /* ----- Common objects ----- */
@@ -96,11 +106,15 @@ class VKRenderSystem final : public RenderSystem
 
         bool                                    debugLayerEnabled_      = false;
         VKPtr<VkDebugReportCallbackEXT>         debugReportCallback_;
+        RenderingDebugger*                      debugger_               = nullptr;
 
         std::unique_ptr<VKDeviceMemoryManager>  deviceMemoryMngr_;
+        std::unique_ptr<VKStagingBufferPool>    stagingBufferPool_;
 
         VKGraphicsPipelineLimits                graphicsPipelineLimits_;
 
+        std::unique_ptr<VKPipelineCache>        defaultPipelineCache_;  // Shared by all PSOs that are created without an explicit pipeline cache
+
         /* ----- Hardware object containers ----- */
 
         HWObjectContainer<VKSwapChain>          swapChains_;
@@ -0,0 +1,159 @@
+/*
+ * Test_DebugLayer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/LLGL.h>
+#include <LLGL/Utils/VertexFormat.h>
+#include <chrono>
+
+
+// Measures the CPU overhead of the debug layer per draw call against the plain backend (Null renderer by default)
+enum class DebugLayerMode
+{
+    Disabled,
+    Validation,
+    ProfileOnly,
+};
+
+static const char* ToString(DebugLayerMode mode)
+{
+    switch (mode)
+    {
+        case DebugLayerMode::Disabled:      return "plain backend";
+        case DebugLayerMode::Validation:    return "debug layer";
+        case DebugLayerMode::ProfileOnly:   return "debug layer (profile only)";
+    }
+    return "";
+}
+
+// Returns the average CPU time (in nanoseconds) to encode a single draw call or a negative value if the renderer could not be loaded.
+static double MeasureDrawCalls(const char* moduleName, DebugLayerMode mode, std::uint32_t numDraws, std::uint32_t numIterations)
+{
+    LLGL::RenderingDebugger debugger;
+    debugger.SetValidation(mode != DebugLayerMode::ProfileOnly);
+
+    LLGL::RenderSystemDescriptor rendererDesc = moduleName;
+    {
+        rendererDesc.debugger = (mode != DebugLayerMode::Disabled ? &debugger : nullptr);
+    }
+    LLGL::Report report;
+    LLGL::RenderSystemPtr renderer = LLGL::RenderSystem::Load(rendererDesc, &report);
+    if (!renderer)
+    {
+        LLGL::Log::Errorf("%s", report.GetText());
+        return -1.0;
+    }
+
+    // Create vertex buffer with a single triangle
+    LLGL::VertexFormat vertexFormat;
+    vertexFormat.AppendAttribute({ "position", LLGL::Format::RG32Float });
+
+    const float vertices[] = { 0.0f, 1.0f, 1.0f, -1.0f, -1.0f, -1.0f };
+
+    LLGL::BufferDescriptor vertexBufferDesc;
+    {
+        vertexBufferDesc.size           = sizeof(vertices);
+        vertexBufferDesc.bindFlags      = LLGL::BindFlags::VertexBuffer;
+        vertexBufferDesc.vertexAttribs  = vertexFormat.attributes;
+    }
+    LLGL::Buffer* vertexBuffer = renderer->CreateBuffer(vertexBufferDesc, vertices);
+
+    // Create render target for the render pass
+    LLGL::TextureDescriptor colorTextureDesc;
+    {
+        colorTextureDesc.bindFlags  = LLGL::BindFlags::ColorAttachment;
+        colorTextureDesc.format     = LLGL::Format::RGBA8UNorm;
+        colorTextureDesc.extent     = { 16, 16, 1 };
+        colorTextureDesc.mipLevels  = 1;
+    }
+    LLGL::Texture* colorTexture = renderer->CreateTexture(colorTextureDesc);
+
+    LLGL::RenderTargetDescriptor renderTargetDesc;
+    {
+        renderTargetDesc.resolution             = { 16, 16 };
+        renderTargetDesc.colorAttachments[0]    = colorTexture;
+    }
+    LLGL::RenderTarget* renderTarget = renderer->CreateRenderTarget(renderTargetDesc);
+
+    // Create graphics pipeline
+    LLGL::ShaderDescriptor vsDesc{ LLGL::ShaderType::Vertex, "Null.vert" };
+    {
+        vsDesc.vertex.inputAttribs = vertexFormat.attributes;
+    }
+    LLGL::ShaderDescriptor fsDesc{ LLGL::ShaderType::Fragment, "Null.frag" };
+    {
+        fsDesc.fragment.outputAttribs = { { "color", LLGL::Format::RGBA8UNorm, 0, LLGL::SystemValue::Color } };
+    }
+
+    LLGL::GraphicsPipelineDescriptor psoDesc;
+    {
+        psoDesc.vertexShader    = renderer->CreateShader(vsDesc);
+        psoDesc.fragmentShader  = renderer->CreateShader(fsDesc);
+        psoDesc.renderPass      = renderTarget->GetRenderPass();
+        psoDesc.viewports       = { LLGL::Viewport{ 0.0f, 0.0f, 16.0f, 16.0f } };
+    }
+    LLGL::PipelineState* pso = renderer->CreatePipelineState(psoDesc);
+
+    LLGL::CommandBuffer* commandBuffer = renderer->CreateCommandBuffer();
+
+    // Measure encoding only; the command buffer is not submitted, so the Null backend does not execute the draw calls
+    long long duration = 0;
+
+    for (std::uint32_t i = 0; i < numIterations; ++i)
+    {
+        const auto startTime = std::chrono::high_resolution_clock::now();
+
+        commandBuffer->Begin();
+        {
+            commandBuffer->BeginRenderPass(*renderTarget);
+            {
+                commandBuffer->SetPipelineState(*pso);
+                commandBuffer->SetVertexBuffer(*vertexBuffer);
+                for (std::uint32_t j = 0; j < numDraws; ++j)
+                    commandBuffer->Draw(3, 0);
+            }
+            commandBuffer->EndRenderPass();
+        }
+        commandBuffer->End();
+
+        const auto endTime = std::chrono::high_resolution_clock::now();
+        duration += std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+    }
+
+    return (static_cast<double>(duration) / static_cast<double>(numDraws * numIterations));
+}
+
+int main(int argc, char* argv[])
+{
+    LLGL::Log::RegisterCallbackStd();
+
+    const char* moduleName = (argc > 1 ? argv[1] : "Null");
+
+    constexpr std::uint32_t numDraws        = 10000;
+    constexpr std::uint32_t numIterations   = 100;
+
+    LLGL::Log::Printf("encode %u draw calls %u times with renderer: %s\n\n", numDraws, numIterations, moduleName);
+
+    const double plainTime = MeasureDrawCalls(moduleName, DebugLayerMode::Disabled, numDraws, numIterations);
+    if (plainTime < 0.0)
+        return 1;
+
+    for (DebugLayerMode mode : { DebugLayerMode::Disabled, DebugLayerMode::Validation, DebugLayerMode::ProfileOnly })
+    {
+        const double drawTime = (mode == DebugLayerMode::Disabled ? plainTime : MeasureDrawCalls(moduleName, mode, numDraws, numIterations));
+        LLGL::Log::Printf(
+            "%s\n\taverage: %.1f ns per draw call (overhead: %.1f ns)\n\n",
+            ToString(mode), drawTime, (drawTime - plainTime)
+        );
+    }
+
+    return 0;
+}
+
+
+
+// ================================================================================
+
@@ -7,8 +7,11 @@
 
 #include <LLGL/LLGL.h>
 #include <LLGL/Utils/Image.h>
+#include <LLGL/Utils/Parse.h>
 #include <vector>
 #include <functional>
+#include <algorithm>
+#include <chrono>
 
 
 static unsigned int g_seed;
@@ -51,6 +54,9 @@ struct TestConfig
     std::uint32_t   textureSize = 512;
     std::uint32_t   arrayLayers = 32;
     std::uint32_t   numMipMaps  = 5;
+    std::uint32_t   numPSOs     = 64;
+    std::uint32_t   numFrames   = 100;
+    std::uint32_t   numUpdates  = 64;
 };
 
 class PerformanceTest
@@ -65,6 +71,12 @@ class PerformanceTest
 
         LLGL::QueryHeap*            timerQuery      = nullptr;
         std::vector<LLGL::Texture*> textures;
+        std::vector<LLGL::Shader*>  shaders;
+
+        std::vector<LLGL::PipelineState*> pipelineStates;
+
+        LLGL::PipelineLayout*       cbufferLayout   = nullptr;
+        LLGL::PipelineState*        cbufferPSO      = nullptr;
 
         TestConfig                  config;
 
@@ -136,6 +148,162 @@ class PerformanceTest
             }
         }
 
+        void MeasureCPUTime(const std::string& title, const std::function<void()>& callback)
+        {
+            // Measure time on the CPU, since PSO creation is not recorded into a command buffer
+            const auto startTime = std::chrono::high_resolution_clock::now();
+            {
+                callback();
+            }
+            const auto endTime = std::chrono::high_resolution_clock::now();
+
+            // Print result
+            const long long result = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+            LLGL::Log::Printf("%s\n", title.c_str());
+            LLGL::Log::Printf(
+                "\tduration: %lld ns (%f ms)\n\n",
+                result, (static_cast<double>(result) / 1000000.0)
+            );
+        }
+
+        // Creates PSO descriptors with a unique fragment shader each
+        std::vector<LLGL::GraphicsPipelineDescriptor> CreatePSODescs(std::uint32_t numPSOs, std::uint32_t seed)
+        {
+            LLGL::ShaderDescriptor vsDesc;
+            {
+                vsDesc.type     = LLGL::ShaderType::Vertex;
+                vsDesc.source   =
+                    "#version 330 core\n"
+                    "void main() {\n"
+                    "    vec2 coord = vec2(float(gl_VertexID & 1), float((gl_VertexID >> 1) & 1));\n"
+                    "    gl_Position = vec4(coord * 2.0 - 1.0, 0.0, 1.0);\n"
+                    "}\n";
+                vsDesc.sourceType = LLGL::ShaderSourceType::CodeString;
+            }
+            LLGL::Shader* vs = renderer->CreateShader(vsDesc);
+            shaders.push_back(vs);
+
+            std::vector<LLGL::GraphicsPipelineDescriptor> psoDescs(numPSOs);
+            for (std::uint32_t i = 0; i < numPSOs; ++i)
+            {
+                const std::string psSource =
+                    "#version 330 core\n"
+                    "out vec4 outColor;\n"
+                    "void main() {\n"
+                    "    vec4 color = vec4(0.0);\n"
+                    "    for (int i = 0; i < " + std::to_string(8 + (seed + i) % 8) + "; ++i)\n"
+                    "        color += sin(gl_FragCoord.xyxy * " + std::to_string(seed * numPSOs + i + 1) + ".0 + float(i));\n"
+                    "    outColor = color;\n"
+                    "}\n";
+
+                LLGL::ShaderDescriptor psDesc;
+                {
+                    psDesc.type         = LLGL::ShaderType::Fragment;
+                    psDesc.source       = psSource.c_str();
+                    psDesc.sourceType   = LLGL::ShaderSourceType::CodeString;
+                }
+                LLGL::Shader* ps = renderer->CreateShader(psDesc);
+                shaders.push_back(ps);
+
+                psoDescs[i].vertexShader    = vs;
+                psoDescs[i].fragmentShader  = ps;
+            }
+
+            return psoDescs;
+        }
+
+        void TestPSOCreation(const std::vector<LLGL::GraphicsPipelineDescriptor>& psoDescs)
+        {
+            for (const LLGL::GraphicsPipelineDescriptor& psoDesc : psoDescs)
+                pipelineStates.push_back(renderer->CreatePipelineState(psoDesc));
+        }
+
+        // Creates a PSO that reads its color from a constant buffer
+        void CreateConstantBufferPSO()
+        {
+            LLGL::ShaderDescriptor vsDesc;
+            {
+                vsDesc.type     = LLGL::ShaderType::Vertex;
+                vsDesc.source   =
+                    "#version 330 core\n"
+                    "void main() {\n"
+                    "    vec2 coord = vec2(float(gl_VertexID & 1), float((gl_VertexID >> 1) & 1));\n"
+                    "    gl_Position = vec4(coord * 2.0 - 1.0, 0.0, 1.0);\n"
+                    "}\n";
+                vsDesc.sourceType = LLGL::ShaderSourceType::CodeString;
+            }
+            LLGL::Shader* vs = renderer->CreateShader(vsDesc);
+            shaders.push_back(vs);
+
+            LLGL::ShaderDescriptor psDesc;
+            {
+                psDesc.type     = LLGL::ShaderType::Fragment;
+                psDesc.source   =
+                    "#version 330 core\n"
+                    "layout(std140) uniform Settings {\n"
+                    "    vec4 color;\n"
+                    "};\n"
+                    "out vec4 outColor;\n"
+                    "void main() {\n"
+                    "    outColor = color;\n"
+                    "}\n";
+                psDesc.sourceType = LLGL::ShaderSourceType::CodeString;
+            }
+            LLGL::Shader* ps = renderer->CreateShader(psDesc);
+            shaders.push_back(ps);
+
+            cbufferLayout = renderer->CreatePipelineLayout(LLGL::Parse("cbuffer(Settings@0):frag"));
+
+            LLGL::GraphicsPipelineDescriptor psoDesc;
+            {
+                psoDesc.vertexShader        = vs;
+                psoDesc.fragmentShader      = ps;
+                psoDesc.pipelineLayout      = cbufferLayout;
+                psoDesc.renderPass          = swapChain->GetRenderPass();
+                psoDesc.primitiveTopology   = LLGL::PrimitiveTopology::TriangleStrip;
+            }
+            cbufferPSO = renderer->CreatePipelineState(psoDesc);
+        }
+
+        // Updates the specified constant buffer several times per frame, each time followed by a draw command that reads from it
+        void TestConstantBufferUpdates(LLGL::Buffer* cbuffer)
+        {
+            const LLGL::Extent2D resolution = swapChain->GetResolution();
+
+            for (std::uint32_t frame = 0; frame < config.numFrames; ++frame)
+            {
+                commands->Begin();
+                {
+                    commands->BeginRenderPass(*swapChain);
+                    {
+                        commands->SetViewport(resolution);
+                        commands->SetPipelineState(*cbufferPSO);
+
+                        for (std::uint32_t i = 0; i < config.numUpdates; ++i)
+                        {
+                            const float color[4] = { RandFloat(), RandFloat(), RandFloat(), 1.0f };
+                            commands->UpdateBuffer(*cbuffer, 0, color, sizeof(color));
+                            commands->SetResource(0, *cbuffer);
+                            commands->Draw(4, 0);
+                        }
+                    }
+                    commands->EndRenderPass();
+                }
+                commands->End();
+                commandQueue->Submit(*commands);
+                swapChain->Present();
+            }
+
+            commandQueue->WaitIdle();
+        }
+
+        void TestBatchPSOCreation(const std::vector<LLGL::GraphicsPipelineDescriptor>& psoDescs)
+        {
+            std::vector<LLGL::PipelineState*> psos(psoDescs.size(), nullptr);
+            renderer->CreatePipelineStates(static_cast<std::uint32_t>(psoDescs.size()), psoDescs.data(), psos.data());
+            pipelineStates.insert(pipelineStates.end(), psos.begin(), psos.end());
+        }
+
         void TestMIPMapGeneration()
         {
             for (std::size_t i = 0; i < config.numTextures; ++i)
@@ -203,6 +371,55 @@ class PerformanceTest
             }
             commands->End();
             commandQueue->Submit(*commands);
+
+            // Shader sources of the PSO tests are written in GLSL
+            const auto& languages = renderer->GetRenderingCaps().shadingLanguages;
+            if (std::find(languages.begin(), languages.end(), LLGL::ShadingLanguage::GLSL) != languages.end())
+            {
+                // Use different shaders for each test, since identical shader programs are shared between PSOs
+                const std::vector<LLGL::GraphicsPipelineDescriptor> psoDescs        = CreatePSODescs(config.numPSOs, 0);
+                const std::vector<LLGL::GraphicsPipelineDescriptor> psoBatchDescs   = CreatePSODescs(config.numPSOs, 1);
+
+                MeasureCPUTime(
+                    ( "Creation of " + std::to_string(config.numPSOs) + " graphics PSOs one by one" ),
+                    std::bind(&PerformanceTest::TestPSOCreation, this, std::cref(psoDescs))
+                );
+                MeasureCPUTime(
+                    ( "Creation of " + std::to_string(config.numPSOs) + " graphics PSOs in a single batch" ),
+                    std::bind(&PerformanceTest::TestBatchPSOCreation, this, std::cref(psoBatchDescs))
+                );
+
+                // Compare constant buffer updates of a regular buffer with a streaming buffer (see MiscFlags::Streaming)
+                CreateConstantBufferPSO();
+
+                LLGL::BufferDescriptor cbufferDesc;
+                {
+                    cbufferDesc.size        = sizeof(float) * 4;
+                    cbufferDesc.bindFlags   = LLGL::BindFlags::ConstantBuffer | LLGL::BindFlags::CopyDst;
+                }
+                LLGL::Buffer* cbuffer = renderer->CreateBuffer(cbufferDesc);
+
+                cbufferDesc.miscFlags = LLGL::MiscFlags::Streaming;
+                LLGL::Buffer* streamingCbuffer = renderer->CreateBuffer(cbufferDesc);
+
+                const std::string updatesInfo =
+                (
+                    std::to_string(config.numUpdates) + " constant buffer updates per frame for " +
+                    std::to_string(config.numFrames) + " frames"
+                );
+
+                MeasureCPUTime(
+                    ( updatesInfo + " with regular buffer" ),
+                    std::bind(&PerformanceTest::TestConstantBufferUpdates, this, cbuffer)
+                );
+                MeasureCPUTime(
+                    ( updatesInfo + " with streaming buffer" ),
+                    std::bind(&PerformanceTest::TestConstantBufferUpdates, this, streamingCbuffer)
+                );
+
+                renderer->Release(*cbuffer);
+                renderer->Release(*streamingCbuffer);
+            }
         }
 
 };
@@ -218,6 +435,9 @@ int main(int argc, char* argv[])
     testConfig.textureSize  = 512;
     testConfig.arrayLayers  = 32;//512 or 32
     testConfig.numMipMaps   = 3;
+    testConfig.numPSOs      = 64;
+    testConfig.numFrames    = 100;
+    testConfig.numUpdates   = 64;
 
     PerformanceTest test;
     test.Load(rendererModule, testConfig);
@@ -0,0 +1,150 @@
+/*
+ * Test_SpirvReflect.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/LLGL.h>
+#include "../sources/Renderer/SPIRV/SpirvReflect.h"
+#include "../sources/Renderer/SPIRV/SpirvModule.h"
+#include <vector>
+#include <string>
+#include <fstream>
+#include <iterator>
+#include <chrono>
+
+
+// Default corpus of SPIR-V modules if no filenames are passed via command line (relative to the tests folder)
+static const char* g_defaultCorpus[] =
+{
+    "Shaders/SpirvReflectTest.comp.spv",
+    "../examples/Cpp/Animation/Example.450core.vert.spv",
+    "../examples/Cpp/Animation/Example.450core.frag.spv",
+    "../examples/Cpp/ClothPhysics/Example.CSForces.450core.comp.spv",
+    "../examples/Cpp/ClothPhysics/Example.CSRelaxation.450core.comp.spv",
+    "../examples/Cpp/ClothPhysics/Example.PS.450core.frag.spv",
+    "../examples/Cpp/HelloGame/HelloGame.VSInstance.450core.vert.spv",
+    "../examples/Cpp/HelloGame/HelloGame.PSInstance.450core.frag.spv",
+    "../examples/Cpp/MultiContext/Example.450core.geom.spv",
+    "../examples/Cpp/ShadowMapping/Scene.450core.vert.spv",
+    "../examples/Cpp/ShadowMapping/Scene.450core.frag.spv",
+    "../examples/Cpp/Tessellation/Example.450core.tesc.spv",
+    "../examples/Cpp/Tessellation/Example.450core.tese.spv",
+    "../examples/Cpp/Texturing/Example.450core.frag.spv",
+};
+
+static bool ReadSpirvModule(const std::string& filename, std::vector<std::uint32_t>& outWords)
+{
+    std::ifstream file{ filename, std::ios::binary | std::ios::ate };
+    if (!file.good())
+        return false;
+
+    const std::streamsize size = file.tellg();
+    if (size <= 0 || size % 4 != 0)
+        return false;
+
+    outWords.resize(static_cast<std::size_t>(size) / 4);
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(outWords.data()), size);
+    return file.good();
+}
+
+// Measures the average CPU time of the specified callback per module in nanoseconds
+template <typename TCallback>
+static double MeasureAverageTime(std::size_t numModules, unsigned numIterations, TCallback callback)
+{
+    const auto startTime = std::chrono::high_resolution_clock::now();
+    {
+        for (unsigned i = 0; i < numIterations; ++i)
+            callback();
+    }
+    const auto endTime = std::chrono::high_resolution_clock::now();
+
+    const long long duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+    return (static_cast<double>(duration) / static_cast<double>(numModules * numIterations));
+}
+
+int main(int argc, char* argv[])
+{
+    LLGL::Log::RegisterCallbackStd();
+
+    // Gather corpus of SPIR-V modules from the command line or use the default corpus
+    std::vector<std::string> filenames;
+    if (argc > 1)
+        filenames.assign(argv + 1, argv + argc);
+    else
+        filenames.assign(std::begin(g_defaultCorpus), std::end(g_defaultCorpus));
+
+    std::vector<std::vector<std::uint32_t>> modules;
+    std::vector<std::string> moduleNames;
+    modules.reserve(filenames.size());
+
+    std::size_t numWords = 0;
+    for (const std::string& filename : filenames)
+    {
+        std::vector<std::uint32_t> words;
+        if (ReadSpirvModule(filename, words))
+        {
+            numWords += words.size();
+            modules.push_back(std::move(words));
+            moduleNames.push_back(filename);
+        }
+        else
+            LLGL::Log::Errorf("failed to read SPIR-V module: %s\n", filename.c_str());
+    }
+
+    if (modules.empty())
+    {
+        LLGL::Log::Errorf("no SPIR-V modules to reflect\n");
+        return 1;
+    }
+
+    // Validate all modules once before measuring
+    for (std::size_t i = 0; i < modules.size(); ++i)
+    {
+        LLGL::SpirvReflect reflect;
+        if (reflect.Reflect(LLGL::SpirvModuleView{ modules[i] }) != LLGL::SpirvResult::NoError)
+            LLGL::Log::Errorf("failed to reflect SPIR-V module: %s\n", moduleNames[i].c_str());
+    }
+
+    constexpr unsigned numIterations = 1000;
+
+    LLGL::Log::Printf(
+        "reflect %zu SPIR-V modules (%zu words in total) %u times ...\n\n",
+        modules.size(), numWords, numIterations
+    );
+
+    // Measure full reflection, i.e. what Shader::Reflect and the push constant reflection for PSOs need
+    const double reflectTime = MeasureAverageTime(
+        modules.size(), numIterations,
+        [&modules]()
+        {
+            for (const std::vector<std::uint32_t>& words : modules)
+            {
+                LLGL::SpirvReflect reflect;
+                reflect.Reflect(LLGL::SpirvModuleView{ words });
+            }
+        }
+    );
+
+    // Measure binding point reflection, i.e. what each Vulkan shader needs for its binding layout
+    const double bindingPointsTime = MeasureAverageTime(
+        modules.size(), numIterations,
+        [&modules]()
+        {
+            std::vector<LLGL::SpirvReflect::SpvBindingPoint> bindingPoints;
+            for (const std::vector<std::uint32_t>& words : modules)
+                LLGL::SpirvReflectBindingPoints(LLGL::SpirvModuleView{ words }, bindingPoints);
+        }
+    );
+
+    LLGL::Log::Printf("SpirvReflect::Reflect\n\taverage: %.1f ns per module\n\n", reflectTime);
+    LLGL::Log::Printf("SpirvReflectBindingPoints\n\taverage: %.1f ns per module\n\n", bindingPointsTime);
+
+    return 0;
+}
+
+
+
+// ================================================================================
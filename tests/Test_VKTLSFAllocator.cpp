@@ -0,0 +1,312 @@
+/*
+ * Test_VKTLSFAllocator.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/LLGL.h>
+#include "../sources/Renderer/Vulkan/Memory/VKTLSFAllocator.h"
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <chrono>
+
+
+using BlockID = LLGL::VKTLSFAllocator::BlockID;
+
+static const BlockID g_invalidBlockID = LLGL::VKTLSFAllocator::invalidBlockID;
+
+static unsigned g_numErrors = 0;
+
+#define TEST_CHECK(EXPR, ...)                               \
+    if (!(EXPR))                                            \
+    {                                                       \
+        LLGL::Log::Errorf("check failed: %s\n", #EXPR);     \
+        LLGL::Log::Errorf(__VA_ARGS__);                     \
+        ++g_numErrors;                                      \
+        return false;                                       \
+    }
+
+struct AllocatedBlock
+{
+    BlockID         block;
+    std::uint64_t   size;
+    std::uint64_t   alignment;
+};
+
+/*
+Walks all blocks in memory order and validates the allocator's bookkeeping against the list of allocated blocks:
+blocks must cover the entire range without gaps, free blocks must always be coalesced, and all counters must match.
+*/
+static bool ValidateAllocator(const LLGL::VKTLSFAllocator& allocator, const std::vector<AllocatedBlock>& allocatedBlocks)
+{
+    std::uint64_t   offset          = 0;
+    std::uint64_t   allocatedSize   = 0;
+    std::uint64_t   maxFreeSize     = 0;
+    std::size_t     numAllocated    = 0;
+    std::size_t     numFree         = 0;
+    bool            prevIsFree      = false;
+
+    for (BlockID block = allocator.GetFirstBlock(); block != g_invalidBlockID; block = allocator.GetNextBlock(block))
+    {
+        TEST_CHECK(allocator.GetBlockOffset(block) == offset, "block %u at offset %llu, expected %llu\n", block, (unsigned long long)allocator.GetBlockOffset(block), (unsigned long long)offset);
+
+        const std::uint64_t size = allocator.GetBlockSize(block);
+        TEST_CHECK(size > 0, "block %u has zero size\n", block);
+
+        if (allocator.IsBlockFree(block))
+        {
+            TEST_CHECK(!prevIsFree, "free block %u was not coalesced with its lower neighbor\n", block);
+            maxFreeSize = std::max(maxFreeSize, size);
+            ++numFree;
+        }
+        else
+        {
+            allocatedSize += size;
+            ++numAllocated;
+        }
+
+        prevIsFree  = allocator.IsBlockFree(block);
+        offset      += size;
+    }
+
+    TEST_CHECK(offset == allocator.GetSize(), "blocks cover %llu bytes, expected %llu\n", (unsigned long long)offset, (unsigned long long)allocator.GetSize());
+    TEST_CHECK(allocatedSize == allocator.GetAllocatedSize(), "allocated size %llu, expected %llu\n", (unsigned long long)allocator.GetAllocatedSize(), (unsigned long long)allocatedSize);
+    TEST_CHECK(numAllocated == allocator.GetNumAllocatedBlocks(), "%zu allocated blocks, expected %zu\n", allocator.GetNumAllocatedBlocks(), numAllocated);
+    TEST_CHECK(numFree == allocator.GetNumFreeBlocks(), "%zu free blocks, expected %zu\n", allocator.GetNumFreeBlocks(), numFree);
+    TEST_CHECK(maxFreeSize == allocator.GetMaxFreeBlockSize(), "max free block size %llu, expected %llu\n", (unsigned long long)allocator.GetMaxFreeBlockSize(), (unsigned long long)maxFreeSize);
+    TEST_CHECK(numAllocated == allocatedBlocks.size(), "%zu allocated blocks, but %zu were not freed yet\n", numAllocated, allocatedBlocks.size());
+
+    for (const AllocatedBlock& entry : allocatedBlocks)
+    {
+        TEST_CHECK(!allocator.IsBlockFree(entry.block), "block %u is free but was not freed\n", entry.block);
+        TEST_CHECK(allocator.GetBlockSize(entry.block) == entry.size, "block %u has size %llu, expected %llu\n", entry.block, (unsigned long long)allocator.GetBlockSize(entry.block), (unsigned long long)entry.size);
+        TEST_CHECK(allocator.GetBlockOffset(entry.block) % entry.alignment == 0, "block %u at offset %llu is not aligned to %llu\n", entry.block, (unsigned long long)allocator.GetBlockOffset(entry.block), (unsigned long long)entry.alignment);
+    }
+
+    return true;
+}
+
+// Allocates and frees blocks in random order and validates the allocator after each step.
+static bool TestRandomAllocations(std::uint64_t chunkSize, unsigned numSteps, unsigned seed)
+{
+    LLGL::VKTLSFAllocator allocator{ chunkSize };
+    std::vector<AllocatedBlock> allocatedBlocks;
+
+    std::mt19937 rng{ seed };
+    std::uniform_int_distribution<std::uint64_t> sizeDist{ 1, chunkSize / 16 };
+    std::uniform_int_distribution<unsigned> alignmentDist{ 0, 8 };
+
+    for (unsigned step = 0; step < numSteps; ++step)
+    {
+        if (allocatedBlocks.empty() || rng() % 3 != 0)
+        {
+            /* Allocate block with random size and power-of-two alignment between 1 and 256 */
+            const std::uint64_t size        = sizeDist(rng);
+            const std::uint64_t alignment   = (1ull << alignmentDist(rng));
+            const BlockID block = allocator.Allocate(size, alignment);
+            if (block != g_invalidBlockID)
+                allocatedBlocks.push_back(AllocatedBlock{ block, size, alignment });
+            else
+            {
+                /* TLSF is a good-fit allocator: it may only fail if no free block covers the request rounded up to its next size class */
+                TEST_CHECK(allocator.GetMaxFreeBlockSize() < (size + alignment - 1) * 2, "allocation of %llu bytes failed, but largest free block has %llu bytes\n", (unsigned long long)size, (unsigned long long)allocator.GetMaxFreeBlockSize());
+            }
+        }
+        else
+        {
+            /* Free random block */
+            const std::size_t index = rng() % allocatedBlocks.size();
+            allocator.Free(allocatedBlocks[index].block);
+            allocatedBlocks.erase(allocatedBlocks.begin() + index);
+        }
+
+        if (!ValidateAllocator(allocator, allocatedBlocks))
+        {
+            LLGL::Log::Errorf("random allocation test failed in step %u (seed = %u)\n", step, seed);
+            return false;
+        }
+    }
+
+    /* Free all remaining blocks; this must leave a single free block that spans the entire chunk */
+    for (const AllocatedBlock& entry : allocatedBlocks)
+        allocator.Free(entry.block);
+    allocatedBlocks.clear();
+
+    if (!ValidateAllocator(allocator, allocatedBlocks))
+        return false;
+
+    TEST_CHECK(allocator.GetNumFreeBlocks() == 1, "%zu free blocks remain after freeing all blocks\n", allocator.GetNumFreeBlocks());
+    TEST_CHECK(allocator.GetMaxFreeBlockSize() == chunkSize, "largest free block has %llu bytes after freeing all blocks\n", (unsigned long long)allocator.GetMaxFreeBlockSize());
+
+    return true;
+}
+
+// Fills the allocator completely and checks that freed neighbors are merged, so a block of the combined size fits again.
+static bool TestCoalescing()
+{
+    constexpr std::uint64_t blockSize = 256;
+    constexpr std::uint64_t numBlocks = 16;
+
+    LLGL::VKTLSFAllocator allocator{ blockSize * numBlocks };
+    std::vector<BlockID> blocks;
+
+    for (std::uint64_t i = 0; i < numBlocks; ++i)
+    {
+        const BlockID block = allocator.Allocate(blockSize, blockSize);
+        TEST_CHECK(block != g_invalidBlockID, "allocation %llu of %llu bytes failed\n", (unsigned long long)i, (unsigned long long)blockSize);
+        TEST_CHECK(allocator.GetBlockOffset(block) == i * blockSize, "block %llu at offset %llu\n", (unsigned long long)i, (unsigned long long)allocator.GetBlockOffset(block));
+        blocks.push_back(block);
+    }
+
+    TEST_CHECK(allocator.Allocate(1, 1) == g_invalidBlockID, "allocation in full allocator succeeded\n");
+    TEST_CHECK(allocator.GetMaxFreeBlockSize() == 0, "full allocator reports free memory\n");
+
+    /* Free three neighbors in the order upper, lower, middle; the last one must merge with both */
+    allocator.Free(blocks[6]);
+    allocator.Free(blocks[4]);
+    TEST_CHECK(allocator.GetNumFreeBlocks() == 2, "%zu free blocks, expected 2\n", allocator.GetNumFreeBlocks());
+
+    allocator.Free(blocks[5]);
+    TEST_CHECK(allocator.GetNumFreeBlocks() == 1, "%zu free blocks, expected 1 after merging\n", allocator.GetNumFreeBlocks());
+    TEST_CHECK(allocator.GetMaxFreeBlockSize() == 3 * blockSize, "largest free block has %llu bytes after merging\n", (unsigned long long)allocator.GetMaxFreeBlockSize());
+
+    const BlockID merged = allocator.Allocate(3 * blockSize, blockSize);
+    TEST_CHECK(merged != g_invalidBlockID, "allocation of merged range failed\n");
+    TEST_CHECK(allocator.GetBlockOffset(merged) == 4 * blockSize, "merged block at offset %llu\n", (unsigned long long)allocator.GetBlockOffset(merged));
+
+    return true;
+}
+
+/*
+Sets random size classes in the bitmap that the device memory pools use to select chunks,
+and checks that the lowest and highest non-empty classes match a linear search over all classes.
+*/
+static bool TestSizeClassBitmap(unsigned seed)
+{
+    using Bitmap = LLGL::VKTLSFSizeClassBitmap;
+
+    constexpr std::uint32_t numClasses = Bitmap::flIndexCount * Bitmap::slIndexCount;
+
+    Bitmap bitmap;
+    std::vector<bool> classes(numClasses, false);
+
+    std::mt19937 rng{ seed };
+    for (unsigned step = 0; step < 1000; ++step)
+    {
+        /* Toggle random size class */
+        const std::uint32_t index = rng() % numClasses;
+        if (classes[index])
+            bitmap.Clear(index / Bitmap::slIndexCount, index % Bitmap::slIndexCount);
+        else
+            bitmap.Set(index / Bitmap::slIndexCount, index % Bitmap::slIndexCount);
+        classes[index] = !classes[index];
+
+        /* Search lowest non-empty class at or above a random class */
+        const std::uint32_t start = rng() % numClasses;
+        std::uint32_t expected = start;
+        while (expected < numClasses && !classes[expected])
+            ++expected;
+
+        std::uint32_t fl = start / Bitmap::slIndexCount, sl = start % Bitmap::slIndexCount;
+        const bool found = bitmap.FindLowest(fl, sl);
+        TEST_CHECK(found == (expected < numClasses), "FindLowest from class %u returned %d in step %u\n", start, (int)found, step);
+        if (found)
+            TEST_CHECK(fl * Bitmap::slIndexCount + sl == expected, "FindLowest from class %u found %u, expected %u\n", start, fl * Bitmap::slIndexCount + sl, expected);
+
+        /* Search highest non-empty class */
+        std::uint32_t expectedMax = numClasses;
+        for (std::uint32_t i = numClasses; i-- > 0;)
+        {
+            if (classes[i])
+            {
+                expectedMax = i;
+                break;
+            }
+        }
+
+        const bool foundMax = bitmap.FindHighest(fl, sl);
+        TEST_CHECK(foundMax == (expectedMax < numClasses), "FindHighest returned %d in step %u\n", (int)foundMax, step);
+        if (foundMax)
+            TEST_CHECK(fl * Bitmap::slIndexCount + sl == expectedMax, "FindHighest found %u, expected %u\n", fl * Bitmap::slIndexCount + sl, expectedMax);
+    }
+
+    return true;
+}
+
+// Measures the average CPU time of allocating and freeing blocks with many live allocations in nanoseconds.
+static double MeasureAllocationTime(std::uint64_t chunkSize, std::size_t numLiveBlocks, unsigned numIterations)
+{
+    LLGL::VKTLSFAllocator allocator{ chunkSize };
+    std::vector<BlockID> blocks;
+    blocks.reserve(numLiveBlocks);
+
+    std::mt19937 rng{ 1234 };
+    std::uniform_int_distribution<std::uint64_t> sizeDist{ 64, chunkSize / numLiveBlocks };
+
+    for (std::size_t i = 0; i < numLiveBlocks; ++i)
+    {
+        const BlockID block = allocator.Allocate(sizeDist(rng), 64);
+        if (block != g_invalidBlockID)
+            blocks.push_back(block);
+    }
+
+    const auto startTime = std::chrono::high_resolution_clock::now();
+    {
+        for (unsigned i = 0; i < numIterations; ++i)
+        {
+            const std::size_t index = rng() % blocks.size();
+            allocator.Free(blocks[index]);
+            blocks[index] = allocator.Allocate(sizeDist(rng), 64);
+            if (blocks[index] == g_invalidBlockID)
+                blocks[index] = allocator.Allocate(64, 64);
+        }
+    }
+    const auto endTime = std::chrono::high_resolution_clock::now();
+
+    const long long duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+    return (static_cast<double>(duration) / static_cast<double>(numIterations));
+}
+
+int main()
+{
+    LLGL::Log::RegisterCallbackStd();
+
+    TestCoalescing();
+
+    for (unsigned seed = 0; seed < 4; ++seed)
+    {
+        if (!TestSizeClassBitmap(seed))
+            break;
+    }
+
+    for (unsigned seed = 0; seed < 16; ++seed)
+    {
+        if (!TestRandomAllocations(1024*1024, 2000, seed))
+            break;
+    }
+
+    if (g_numErrors > 0)
+    {
+        LLGL::Log::Errorf("VKTLSFAllocator: %u check(s) failed\n", g_numErrors);
+        return 1;
+    }
+
+    LLGL::Log::Printf("VKTLSFAllocator: all checks passed\n\n");
+
+    /* Allocation time must remain constant, regardless of the number of live blocks */
+    constexpr unsigned numIterations = 100000;
+    for (std::size_t numLiveBlocks : { 64u, 1024u, 16384u })
+    {
+        const double allocTime = MeasureAllocationTime(256*1024*1024, numLiveBlocks, numIterations);
+        LLGL::Log::Printf("free + allocate with %zu live blocks\n\taverage: %.1f ns\n\n", numLiveBlocks, allocTime);
+    }
+
+    return 0;
+}
+
+
+
+// ================================================================================
+
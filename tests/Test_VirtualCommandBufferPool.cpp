@@ -0,0 +1,258 @@
+/*
+ * Test_VirtualCommandBufferPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/LLGL.h>
+#include "../sources/Renderer/VirtualCommandBufferPool.h"
+#include <vector>
+#include <thread>
+#include <random>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+
+
+using VirtualCommandBufferPool = LLGL::VirtualCommandBufferPool;
+
+static const std::size_t g_minChunkSize = (static_cast<std::size_t>(1) << VirtualCommandBufferPool::minChunkSizeLog2);
+static const std::size_t g_maxChunkSize = (g_minChunkSize << (VirtualCommandBufferPool::numSizeClasses - 1));
+
+// Maximal chunk size for the stress test, i.e. chunks are distributed over the four smallest size classes.
+static const std::size_t g_maxStressChunkSize = g_minChunkSize * 8;
+
+static std::atomic<unsigned> g_numErrors{ 0 };
+
+#define TEST_CHECK(EXPR, ...)                               \
+    if (!(EXPR))                                            \
+    {                                                       \
+        LLGL::Log::Errorf("check failed: %s\n", #EXPR);     \
+        LLGL::Log::Errorf(__VA_ARGS__);                     \
+        ++g_numErrors;                                      \
+        return false;                                       \
+    }
+
+struct AllocatedChunk
+{
+    void*       chunk;
+    std::size_t size;
+};
+
+// Allocates chunks of each size class, returns them, and checks that they are recycled without allocating new memory.
+static bool TestRecycling()
+{
+    VirtualCommandBufferPool pool;
+    std::vector<AllocatedChunk> chunks;
+
+    /* Allocate one chunk per size class with a size that is slightly bigger than the previous class */
+    std::size_t expectedAllocatedSize = 0;
+    for (std::size_t capacity = g_minChunkSize; capacity <= g_maxChunkSize; capacity *= 2)
+    {
+        std::size_t size = capacity / 2 + 1;
+        void* chunk = pool.AllocChunk(size);
+        TEST_CHECK(chunk != nullptr, "allocation of %zu bytes failed\n", capacity / 2 + 1);
+        TEST_CHECK(size == capacity, "chunk capacity %zu, expected %zu\n", size, capacity);
+        chunks.push_back(AllocatedChunk{ chunk, size });
+        expectedAllocatedSize += size;
+    }
+
+    TEST_CHECK(pool.GetAllocatedSize() == expectedAllocatedSize, "allocated size %zu, expected %zu\n", pool.GetAllocatedSize(), expectedAllocatedSize);
+    TEST_CHECK(pool.GetPooledSize() == 0, "pooled size %zu, expected 0\n", pool.GetPooledSize());
+
+    /* Return all chunks; they must all be pooled */
+    for (const AllocatedChunk& entry : chunks)
+        pool.FreeChunk(entry.chunk, entry.size);
+
+    TEST_CHECK(pool.GetAllocatedSize() == expectedAllocatedSize, "allocated size %zu after free, expected %zu\n", pool.GetAllocatedSize(), expectedAllocatedSize);
+    TEST_CHECK(pool.GetPooledSize() == expectedAllocatedSize, "pooled size %zu after free, expected %zu\n", pool.GetPooledSize(), expectedAllocatedSize);
+
+    /* Allocate the same sizes again; every chunk must be recycled in LIFO order per size class */
+    for (const AllocatedChunk& entry : chunks)
+    {
+        std::size_t size = entry.size;
+        void* chunk = pool.AllocChunk(size);
+        TEST_CHECK(chunk == entry.chunk, "chunk of %zu bytes was not recycled\n", entry.size);
+    }
+
+    TEST_CHECK(pool.GetAllocatedSize() == expectedAllocatedSize, "allocated size %zu after recycling, expected %zu\n", pool.GetAllocatedSize(), expectedAllocatedSize);
+    TEST_CHECK(pool.GetPooledSize() == 0, "pooled size %zu after recycling, expected 0\n", pool.GetPooledSize());
+
+    /* Oversized chunks must bypass the freelists */
+    std::size_t oversize = g_maxChunkSize + 1;
+    void* oversizedChunk = pool.AllocChunk(oversize);
+    TEST_CHECK(oversize == g_maxChunkSize + 1, "oversized chunk capacity %zu, expected %zu\n", oversize, g_maxChunkSize + 1);
+    TEST_CHECK(pool.GetAllocatedSize() == expectedAllocatedSize + oversize, "allocated size %zu with oversized chunk\n", pool.GetAllocatedSize());
+
+    pool.FreeChunk(oversizedChunk, oversize);
+    TEST_CHECK(pool.GetAllocatedSize() == expectedAllocatedSize, "allocated size %zu after freeing oversized chunk, expected %zu\n", pool.GetAllocatedSize(), expectedAllocatedSize);
+    TEST_CHECK(pool.GetPooledSize() == 0, "oversized chunk was pooled\n");
+
+    /* Trim must release all pooled chunks */
+    for (const AllocatedChunk& entry : chunks)
+        pool.FreeChunk(entry.chunk, entry.size);
+
+    pool.Trim();
+    TEST_CHECK(pool.GetAllocatedSize() == 0, "allocated size %zu after trim, expected 0\n", pool.GetAllocatedSize());
+    TEST_CHECK(pool.GetPooledSize() == 0, "pooled size %zu after trim, expected 0\n", pool.GetPooledSize());
+
+    return true;
+}
+
+/*
+Allocates and frees chunks of random sizes from multiple threads at once.
+Each thread fills its chunks with a unique pattern and validates it before returning the chunk,
+so a chunk that is handed out to two threads at the same time is detected.
+*/
+static bool StressThread(VirtualCommandBufferPool& pool, unsigned threadIndex, unsigned numIterations, std::size_t maxLiveChunks)
+{
+    std::vector<AllocatedChunk> chunks;
+    chunks.reserve(maxLiveChunks);
+
+    std::mt19937 rng{ threadIndex };
+    std::uniform_int_distribution<std::size_t> sizeDist{ 1, g_maxStressChunkSize };
+
+    const unsigned char pattern = static_cast<unsigned char>(0x10 + threadIndex);
+
+    auto ValidateAndFree = [&pool, pattern](const AllocatedChunk& entry) -> bool
+    {
+        const unsigned char* bytes = static_cast<const unsigned char*>(entry.chunk);
+        TEST_CHECK(bytes[0] == pattern && bytes[entry.size / 2] == pattern && bytes[entry.size - 1] == pattern, "chunk %p was modified by another thread\n", entry.chunk);
+        pool.FreeChunk(entry.chunk, entry.size);
+        return true;
+    };
+
+    for (unsigned i = 0; i < numIterations; ++i)
+    {
+        if (chunks.size() < maxLiveChunks && (chunks.empty() || rng() % 2 == 0))
+        {
+            std::size_t size = sizeDist(rng);
+            void* chunk = pool.AllocChunk(size);
+            TEST_CHECK(chunk != nullptr, "allocation of %zu bytes failed\n", size);
+            ::memset(chunk, pattern, size);
+            chunks.push_back(AllocatedChunk{ chunk, size });
+        }
+        else
+        {
+            const std::size_t index = rng() % chunks.size();
+            if (!ValidateAndFree(chunks[index]))
+                return false;
+            chunks[index] = chunks.back();
+            chunks.pop_back();
+        }
+    }
+
+    for (const AllocatedChunk& entry : chunks)
+    {
+        if (!ValidateAndFree(entry))
+            return false;
+    }
+
+    return true;
+}
+
+static bool TestMultiThreadedStress(unsigned numThreads, unsigned numIterations, std::size_t maxLiveChunks)
+{
+    VirtualCommandBufferPool pool;
+
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < numThreads; ++i)
+        threads.emplace_back(StressThread, std::ref(pool), i, numIterations, maxLiveChunks);
+    for (std::thread& thread : threads)
+        thread.join();
+
+    if (g_numErrors > 0)
+        return false;
+
+    /* All chunks have been returned, so everything that was allocated must be pooled */
+    TEST_CHECK(pool.GetAllocatedSize() == pool.GetPooledSize(), "allocated size %zu and pooled size %zu differ after all chunks were returned\n", pool.GetAllocatedSize(), pool.GetPooledSize());
+
+    /*
+    Recycling must bound the memory footprint to what can be alive at the same time per size class,
+    since chunks are only recycled within their own size class, i.e. the sum of all capacities up to the maximal stress chunk size
+    */
+    const std::size_t maxFootprint = numThreads * maxLiveChunks * (g_maxStressChunkSize * 2 - g_minChunkSize);
+    TEST_CHECK(pool.GetAllocatedSize() <= maxFootprint, "allocated size %zu exceeds maximal footprint of %zu\n", pool.GetAllocatedSize(), maxFootprint);
+
+    LLGL::Log::Printf(
+        "%u threads with %u iterations each: %.1f KB allocated, %.1f KB pooled\n",
+        numThreads, numIterations, static_cast<double>(pool.GetAllocatedSize()) / 1024.0, static_cast<double>(pool.GetPooledSize()) / 1024.0
+    );
+
+    pool.Trim();
+    TEST_CHECK(pool.GetAllocatedSize() == 0, "allocated size %zu after trim, expected 0\n", pool.GetAllocatedSize());
+
+    return true;
+}
+
+// Measures the average CPU time of allocating and freeing a chunk with the pool and with the global heap in nanoseconds.
+static void MeasureAllocationTime(unsigned numIterations, double& outPoolTime, double& outHeapTime)
+{
+    VirtualCommandBufferPool pool;
+    std::vector<AllocatedChunk> chunks(16);
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+    {
+        for (unsigned i = 0; i < numIterations; ++i)
+        {
+            for (AllocatedChunk& entry : chunks)
+            {
+                entry.size  = g_minChunkSize * 4;
+                entry.chunk = pool.AllocChunk(entry.size);
+            }
+            for (const AllocatedChunk& entry : chunks)
+                pool.FreeChunk(entry.chunk, entry.size);
+        }
+    }
+    auto endTime = std::chrono::high_resolution_clock::now();
+
+    outPoolTime = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count()) / (numIterations * chunks.size());
+
+    startTime = std::chrono::high_resolution_clock::now();
+    {
+        for (unsigned i = 0; i < numIterations; ++i)
+        {
+            for (AllocatedChunk& entry : chunks)
+                entry.chunk = ::operator new(g_minChunkSize * 4);
+            for (const AllocatedChunk& entry : chunks)
+                ::operator delete(entry.chunk);
+        }
+    }
+    endTime = std::chrono::high_resolution_clock::now();
+
+    outHeapTime = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count()) / (numIterations * chunks.size());
+}
+
+int main()
+{
+    LLGL::Log::RegisterCallbackStd();
+
+    if (TestRecycling())
+    {
+        for (unsigned numThreads : { 2u, 4u, 8u })
+        {
+            if (!TestMultiThreadedStress(numThreads, 20000, 16))
+                break;
+        }
+    }
+
+    if (g_numErrors > 0)
+    {
+        LLGL::Log::Errorf("VirtualCommandBufferPool: %u check(s) failed\n", g_numErrors.load());
+        return 1;
+    }
+
+    LLGL::Log::Printf("VirtualCommandBufferPool: all checks passed\n\n");
+
+    double poolTime = 0.0, heapTime = 0.0;
+    MeasureAllocationTime(100000, poolTime, heapTime);
+    LLGL::Log::Printf("allocate + free %zu KB chunk\n\tpool:   %.1f ns\n\theap:   %.1f ns\n\n", g_minChunkSize * 4 / 1024, poolTime, heapTime);
+
+    return 0;
+}
+
+
+
+// ================================================================================
+
@@ -133,9 +133,12 @@ TestbedContext::TestbedContext(const char* moduleName, int version, int argc, ch
     const bool  preferAMD               = HasArgument(argc, argv, "--amd");
     const bool  preferIntel             = HasArgument(argc, argv, "--intel");
     const bool  preferNVIDIA            = HasArgument(argc, argv, "--nvidia");
+    const bool  isDeferredSubmission    = HasArgument(argc, argv, "--deferred");
+    const bool  isOptimizedCmdBuffers   = HasArgument(argc, argv, "--optimize");
 
     // Configure render system
     RendererConfigurationOpenGL cfgGL;
+    RendererConfigurationNull cfgNull;
 
     RenderSystemDescriptor rendererDesc;
     {
@@ -146,7 +149,10 @@ TestbedContext::TestbedContext(const char* moduleName, int version, int argc, ch
             if (isGpuDebugMode)
                 rendererDesc.flags = RenderSystemFlags::DebugDevice;
             if (isCpuDebugMode)
+            {
                 rendererDesc.debugger = &debugger;
+                isDebugLayerEnabled = true;
+            }
         }
 
         if (preferAMD)
@@ -160,9 +166,18 @@ TestbedContext::TestbedContext(const char* moduleName, int version, int argc, ch
         {
             // OpenGL specific configuration
             ConfigureOpenGL(cfgGL, version);
+            cfgGL.optimizeCommandBuffers    = isOptimizedCmdBuffers;
+            isCmdBufferOptimizationEnabled  = isOptimizedCmdBuffers;
             rendererDesc.rendererConfig     = &cfgGL;
             rendererDesc.rendererConfigSize = sizeof(cfgGL);
         }
+        else if (::strcmp(moduleName, "Null") == 0)
+        {
+            // Null specific configuration
+            cfgNull.deferredSubmission      = isDeferredSubmission;
+            rendererDesc.rendererConfig     = &cfgNull;
+            rendererDesc.rendererConfigSize = sizeof(cfgNull);
+        }
     }
     if ((renderer = RenderSystem::Load(rendererDesc)) != nullptr)
     {
@@ -337,20 +352,28 @@ unsigned TestbedContext::RunAllTests()
 
     // Run all command buffer tests
     RUN_TEST( CommandBufferSubmit         );
+    RUN_TEST( CommandBufferBatchSubmit    );
     RUN_TEST( CommandBufferEncode         );
+    RUN_TEST( ReleaseAfterSubmit          );
+    RUN_TEST( FenceAndTimerQuery          );
+    RUN_TEST( CommandBufferOptimization   );
+    RUN_TEST( CommandBufferMultiDraw      );
 
     // Run all resource tests
     RUN_TEST( NativeHandle                );
     RUN_TEST( BufferWriteAndRead          );
     RUN_TEST( BufferMap                   );
+    RUN_TEST( BufferWriteBatch            );
     RUN_TEST( BufferFill                  );
     RUN_TEST( BufferUpdate                );
     RUN_TEST( BufferCopy                  );
     RUN_TEST( TextureTypes                );
     RUN_TEST( TextureWriteAndRead         );
+    RUN_TEST( TextureReadAsync            );
     RUN_TEST( TextureCopy                 );
     RUN_TEST( TextureToBufferCopy         );
     RUN_TEST( BufferToTextureCopy         );
+    RUN_TEST( TextureCopyPaths            );
     RUN_TEST( RenderTargetNoAttachments   );
     RUN_TEST( RenderTarget1Attachment     );
     RUN_TEST( RenderTargetNAttachments    );
@@ -367,11 +390,13 @@ unsigned TestbedContext::RunAllTests()
     RUN_TEST( DualSourceBlending          );
     //RUN_TEST( CommandBufferMultiThreading ); //TODO: this must be rewritten as CommandBuffer constraints are violated in this test
     RUN_TEST( CommandBufferSecondary      );
+    RUN_TEST( CommandBufferInterleaved    );
     RUN_TEST( TriangleStripCutOff         );
     RUN_TEST( TextureViews                );
     RUN_TEST( Uniforms                    );
     RUN_TEST( ShadowMapping               );
     RUN_TEST( ViewportAndScissor          );
+    RUN_TEST( SwapChainResizeAfterEncode  );
     RUN_TEST( ResourceBinding             );
     RUN_TEST( ResourceArrays              );
     RUN_TEST( StreamOutput                );
@@ -425,6 +450,7 @@ unsigned TestbedContext::RunRendererIndependentTests(int argc, char* argv[])
     RUN_TEST( ContainerStringOperators );
     RUN_TEST( ParseUtil );
     RUN_TEST( ImageConversions );
+    RUN_TEST( ProfileTraceWriter );
 
     #undef RUN_TEST
 
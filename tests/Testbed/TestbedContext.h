@@ -312,6 +312,8 @@ class TestbedContext
         unsigned                        failures                = 0;
 
         LLGL::RenderingDebugger         debugger;
+        bool                            isDebugLayerEnabled     = false; // True if the debugger is attached to the renderer, i.e. invalid arguments are caught by the debug layer
+        bool                            isCmdBufferOptimizationEnabled = false; // True if the renderer optimizes deferred command buffers when their encoding ends (OpenGL only)
         LLGL::RenderSystemPtr           renderer;
         LLGL::RendererInfo              rendererInfo;
         LLGL::RenderingCapabilities     caps;
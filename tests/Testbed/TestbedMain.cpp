@@ -136,8 +136,10 @@ static void PrintHelpDocs()
         "  -t, --timing ....................... Print timing results\n"
         "  -v, --verbose ...................... Print more information\n"
         "  --amd .............................. Prefer AMD device\n"
+        "  --deferred ......................... Submit command buffers on a worker thread (Null only)\n"
         "  --intel ............................ Prefer Intel device\n"
-        "  --nvidia ........................... Prefer NVIDIA device\n",
+        "  --nvidia ........................... Prefer NVIDIA device\n"
+        "  --optimize ......................... Remove redundant commands when encoding ends (OpenGL only)\n",
         availableModulesStr.c_str()
     );
 }
@@ -25,6 +25,7 @@ DECL_RITEST( ContainerStringLiteral );
 DECL_RITEST( ContainerStringOperators );
 DECL_RITEST( ParseUtil );
 DECL_RITEST( ImageConversions );
+DECL_RITEST( ProfileTraceWriter );
 
 #undef DECL_RITEST
 
@@ -42,20 +43,29 @@ DECL_RITEST( ImageConversions );
 
 // Command buffer tests
 DECL_TEST( CommandBufferSubmit );
+DECL_TEST( CommandBufferBatchSubmit );
 DECL_TEST( CommandBufferEncode );
+DECL_TEST( ReleaseAfterSubmit );
+DECL_TEST( FenceAndTimerQuery );
+DECL_TEST( CommandBufferOptimization );
+DECL_TEST( CommandBufferMultiDraw );
 DECL_TEST( CommandBufferSecondary );
 DECL_TEST( CommandBufferMultiThreading );
+DECL_TEST( CommandBufferInterleaved );
 
 // Resource tests
 DECL_TEST( BufferWriteAndRead );
 DECL_TEST( BufferMap );
+DECL_TEST( BufferWriteBatch );
 DECL_TEST( BufferFill );
 DECL_TEST( BufferUpdate );
 DECL_TEST( BufferCopy );
 DECL_TEST( BufferToTextureCopy );
 DECL_TEST( TextureCopy );
 DECL_TEST( TextureToBufferCopy );
+DECL_TEST( TextureCopyPaths );
 DECL_TEST( TextureWriteAndRead );
+DECL_TEST( TextureReadAsync );
 DECL_TEST( TextureTypes );
 DECL_TEST( RenderTargetNoAttachments );
 DECL_TEST( RenderTarget1Attachment );
@@ -77,6 +87,7 @@ DECL_TEST( TextureViews );
 DECL_TEST( Uniforms );
 DECL_TEST( ShadowMapping );
 DECL_TEST( ViewportAndScissor );
+DECL_TEST( SwapChainResizeAfterEncode );
 DECL_TEST( ResourceBinding );
 DECL_TEST( ResourceArrays );
 DECL_TEST( StreamOutput );
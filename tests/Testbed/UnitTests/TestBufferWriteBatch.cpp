@@ -0,0 +1,123 @@
+/*
+ * TestBufferWriteBatch.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+
+
+/*
+Write a buffer element by element and release a buffer in between without submitting any commands.
+Backends that batch these writes (i.e. Vulkan) must neither stall nor submit until the command queue submits the next command buffer,
+and a subsequent partial CPU mapping with write access must not overwrite the batched writes with stale data.
+*/
+DEF_TEST( BufferWriteBatch )
+{
+    constexpr std::uint32_t numValues = 64;
+
+    BufferDescriptor bufDesc;
+    {
+        bufDesc.size            = sizeof(std::uint32_t) * numValues;
+        bufDesc.bindFlags       = BindFlags::CopySrc | BindFlags::CopyDst;
+        bufDesc.cpuAccessFlags  = CPUAccessFlags::ReadWrite;
+    }
+    CREATE_BUFFER(buf, bufDesc, "BufferWriteBatch.buf", nullptr);
+
+    BufferDescriptor tmpBufDesc;
+    {
+        tmpBufDesc.size         = sizeof(std::uint32_t) * numValues;
+        tmpBufDesc.bindFlags    = BindFlags::CopyDst;
+    }
+    CREATE_BUFFER(tmpBuf, tmpBufDesc, "BufferWriteBatch.tmpBuf", nullptr);
+
+    CommandBuffer* cmdBuf = renderer->CreateCommandBuffer();
+
+    // Only Vulkan records transfer submissions
+    const bool recordsTransfers = (isDebugLayerEnabled && moduleName == "Vulkan");
+
+    if (recordsTransfers)
+        debugger.FlushProfile();
+
+    // Write each value separately and release the temporary buffer without submitting anything
+    std::uint32_t expectedValues[numValues];
+    for_range(i, numValues)
+    {
+        expectedValues[i] = 0xC0DE0000u | i;
+        renderer->WriteBuffer(*buf, sizeof(std::uint32_t) * i, &expectedValues[i], sizeof(std::uint32_t));
+        renderer->WriteBuffer(*tmpBuf, sizeof(std::uint32_t) * i, &expectedValues[i], sizeof(std::uint32_t));
+    }
+    renderer->Release(*tmpBuf);
+
+    if (recordsTransfers)
+    {
+        FrameProfile profile;
+        debugger.FlushProfile(&profile);
+        if (profile.commandQueueRecord.transferSubmissions != 0)
+        {
+            Log::Errorf(
+                "Mismatch between number of transfer submissions (%u) and expected value (0) for %u buffer writes and 1 release without command submission\n",
+                profile.commandQueueRecord.transferSubmissions, numValues * 2
+            );
+            return TestResult::FailedMismatch;
+        }
+    }
+
+    // Submit empty command buffer, which must submit all batched writes at once
+    cmdBuf->Begin();
+    cmdBuf->End();
+    cmdQueue->Submit(*cmdBuf);
+    cmdQueue->WaitIdle();
+
+    if (recordsTransfers)
+    {
+        FrameProfile profile;
+        debugger.FlushProfile(&profile);
+        if (profile.commandQueueRecord.transferSubmissions != 1)
+        {
+            Log::Errorf(
+                "Mismatch between number of transfer submissions (%u) and expected value (1) for %u buffer writes and 1 release\n",
+                profile.commandQueueRecord.transferSubmissions, numValues * 2
+            );
+            return TestResult::FailedMismatch;
+        }
+    }
+
+    // Overwrite a single value via CPU mapping; all other values must remain
+    const std::uint32_t mappedIndex = numValues / 2;
+    expectedValues[mappedIndex] = 0xFEEDFACE;
+
+    if (void* mappedData = renderer->MapBuffer(*buf, CPUAccess::WriteOnly, sizeof(std::uint32_t) * mappedIndex, sizeof(std::uint32_t)))
+    {
+        ::memcpy(mappedData, &expectedValues[mappedIndex], sizeof(std::uint32_t));
+        renderer->UnmapBuffer(*buf);
+    }
+    else
+    {
+        Log::Errorf("Failed to map buffer into CPU memory space for writing (WriteOnly)\n");
+        return TestResult::FailedErrors;
+    }
+
+    // Read entire buffer back and compare with expected values
+    std::uint32_t feedbackValues[numValues] = {};
+    renderer->ReadBuffer(*buf, 0, feedbackValues, sizeof(feedbackValues));
+
+    renderer->Release(*buf);
+    renderer->Release(*cmdBuf);
+
+    for_range(i, numValues)
+    {
+        if (feedbackValues[i] != expectedValues[i])
+        {
+            Log::Errorf(
+                "Mismatch between buffer value [%u] after batched writes (0x%08X) and expected value (0x%08X)\n",
+                i, feedbackValues[i], expectedValues[i]
+            );
+            return TestResult::FailedMismatch;
+        }
+    }
+
+    return TestResult::Passed;
+}
+
@@ -0,0 +1,79 @@
+/*
+ * TestCommandBufferBatchSubmit.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+
+
+/*
+Submits several command buffers at once and checks that they are executed in order.
+Each command buffer fills the buffer from its own offset to the end, so each value is only preserved if the subsequent command buffers are executed afterwards.
+*/
+DEF_TEST( CommandBufferBatchSubmit )
+{
+    constexpr unsigned numCmdBuffers = 4;
+
+    const std::uint32_t fillData[numCmdBuffers] = { 0x12345678, 0xFF00FF00, 0xCC20EF90, 0x80706050 };
+
+    BufferDescriptor bufDesc;
+    {
+        bufDesc.size        = sizeof(fillData);
+        bufDesc.bindFlags   = BindFlags::CopyDst;
+    }
+    CREATE_BUFFER(buf, bufDesc, "buf{size=16}", nullptr);
+
+    // Encode command buffers that fill overlapping ranges of the buffer
+    CommandBuffer* cmdBuffers[numCmdBuffers] = {};
+
+    for_range(i, numCmdBuffers)
+    {
+        cmdBuffers[i] = renderer->CreateCommandBuffer();
+
+        const std::uint64_t offset = i * sizeof(std::uint32_t);
+
+        cmdBuffers[i]->Begin();
+        {
+            cmdBuffers[i]->FillBuffer(*buf, offset, fillData[i], bufDesc.size - offset);
+        }
+        cmdBuffers[i]->End();
+    }
+
+    // Submit a batch with a null entry; the debug layer must reject it without forwarding any command buffer to the backend
+    if (isDebugLayerEnabled)
+    {
+        CommandBuffer* invalidBatch[] = { cmdBuffers[0], nullptr, cmdBuffers[1] };
+        if (opt.verbose)
+            Log::Printf("Expecting debug layer error for null command buffer in batch submission:\n");
+        cmdQueue->Submit(invalidBatch);
+        cmdQueue->WaitIdle();
+    }
+
+    // Submit all command buffers with a single call
+    cmdQueue->Submit(cmdBuffers);
+    cmdQueue->WaitIdle();
+
+    // Read buffer feedback data
+    std::uint32_t bufDataFeedback[numCmdBuffers] = {};
+
+    renderer->ReadBuffer(*buf, 0, bufDataFeedback, sizeof(bufDataFeedback));
+    if (::memcmp(bufDataFeedback, fillData, sizeof(fillData)) != 0)
+    {
+        Log::Errorf(
+            "Mismatch between data of buffer feedback data [0x%08X, 0x%08X, 0x%08X, 0x%08X] and fill data [0x%08X, 0x%08X, 0x%08X, 0x%08X]\n",
+            bufDataFeedback[0], bufDataFeedback[1], bufDataFeedback[2], bufDataFeedback[3],
+            fillData[0], fillData[1], fillData[2], fillData[3]
+        );
+        return TestResult::FailedMismatch;
+    }
+
+    // Delete old command buffers and buffer
+    for (CommandBuffer* cmdBuf : cmdBuffers)
+        renderer->Release(*cmdBuf);
+    renderer->Release(*buf);
+
+    return TestResult::Passed;
+}
+
@@ -0,0 +1,201 @@
+/*
+ * TestCommandBufferInterleaved.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/Utils/Utility.h>
+
+
+/*
+Encode two command buffers in an interleaved order that share the same PSO with dynamic resource bindings.
+Each command buffer binds its own texture for the left half of its render target and then only changes the constant buffer for the right half.
+Both halves must show the texture of their own command buffer, i.e. descriptors written by one command buffer must not leak into the other one,
+even though both command buffers share the same pipeline layout (and in turn the same descriptor cache for the Vulkan backend).
+*/
+DEF_TEST( CommandBufferInterleaved )
+{
+    constexpr std::uint32_t numCmdBuffers   = 2;
+    constexpr std::uint32_t texSize         = 4;
+    constexpr std::uint32_t targetSize      = 32;
+
+    if (shaders[VSTextured] == nullptr || shaders[PSTextured] == nullptr)
+    {
+        Log::Errorf("Missing shaders for backend\n");
+        return TestResult::FailedErrors;
+    }
+
+    const ColorRGBAub texColors[numCmdBuffers] =
+    {
+        ColorRGBAub{ 255,   0,   0, 255 },
+        ColorRGBAub{   0, 255,   0, 255 },
+    };
+
+    // Create one solid color texture and render target per command buffer
+    Texture*        colorMaps       [numCmdBuffers] = {};
+    Texture*        outputTextures  [numCmdBuffers] = {};
+    RenderTarget*   renderTargets   [numCmdBuffers] = {};
+    CommandBuffer*  cmdBuffers      [numCmdBuffers] = {};
+
+    for_range(i, numCmdBuffers)
+    {
+        const std::vector<ColorRGBAub> texels(texSize * texSize, texColors[i]);
+        const ImageView initialImage
+        {
+            ImageFormat::RGBA,
+            DataType::UInt8,
+            texels.data(),
+            texels.size() * sizeof(ColorRGBAub)
+        };
+
+        TextureDescriptor colorMapDesc;
+        {
+            colorMapDesc.format     = Format::RGBA8UNorm;
+            colorMapDesc.extent     = { texSize, texSize, 1 };
+            colorMapDesc.mipLevels  = 1;
+        }
+        TestResult result = CreateTexture(colorMapDesc, "CommandBufferInterleaved.colorMap", &colorMaps[i], &initialImage);
+        if (result != TestResult::Passed)
+            return result;
+
+        TextureDescriptor outputTexDesc;
+        {
+            outputTexDesc.format    = Format::RGBA8UNorm;
+            outputTexDesc.extent    = { targetSize, targetSize, 1 };
+            outputTexDesc.mipLevels = 1;
+        }
+        result = CreateTexture(outputTexDesc, "CommandBufferInterleaved.outputTexture", &outputTextures[i]);
+        if (result != TestResult::Passed)
+            return result;
+
+        RenderTargetDescriptor rtDesc;
+        {
+            rtDesc.resolution           = { targetSize, targetSize };
+            rtDesc.colorAttachments[0]  = outputTextures[i];
+        }
+        result = CreateRenderTarget(rtDesc, "CommandBufferInterleaved.renderTarget", &renderTargets[i]);
+        if (result != TestResult::Passed)
+            return result;
+
+        cmdBuffers[i] = renderer->CreateCommandBuffer();
+    }
+
+    // Create two constant buffers with the same content, so only their handles differ
+    sceneConstants = SceneConstants{};
+    sceneConstants.vpMatrix.LoadIdentity();
+    sceneConstants.wMatrix.LoadIdentity();
+
+    CREATE_BUFFER(sceneBufferLeft, ConstantBufferDesc(sizeof(SceneConstants)), "CommandBufferInterleaved.sceneBufferLeft", &sceneConstants);
+    CREATE_BUFFER(sceneBufferRight, ConstantBufferDesc(sizeof(SceneConstants)), "CommandBufferInterleaved.sceneBufferRight", &sceneConstants);
+
+    GraphicsPipelineDescriptor psoDesc;
+    {
+        psoDesc.pipelineLayout  = layouts[PipelineTextured];
+        psoDesc.renderPass      = renderTargets[0]->GetRenderPass();
+        psoDesc.vertexShader    = shaders[VSTextured];
+        psoDesc.fragmentShader  = shaders[PSTextured];
+    }
+    CREATE_GRAPHICS_PSO(pso, psoDesc, "CommandBufferInterleaved.PSO");
+
+    // Encode both command buffers in lockstep, so each flush of dynamic descriptors happens between the flushes of the other command buffer
+    const IndexedTriangleMesh& mesh = models[ModelRect];
+
+    const float halfSize = static_cast<float>(targetSize / 2);
+    const Viewport viewports[2] =
+    {
+        Viewport{ 0.0f,     0.0f, halfSize, static_cast<float>(targetSize) },
+        Viewport{ halfSize, 0.0f, halfSize, static_cast<float>(targetSize) },
+    };
+
+    for_range(i, numCmdBuffers)
+    {
+        cmdBuffers[i]->Begin();
+        cmdBuffers[i]->SetVertexBuffer(*meshBuffer);
+        cmdBuffers[i]->SetIndexBuffer(*meshBuffer, Format::R32UInt, mesh.indexBufferOffset);
+        cmdBuffers[i]->BeginRenderPass(*renderTargets[i]);
+        cmdBuffers[i]->Clear(ClearFlags::Color);
+        cmdBuffers[i]->SetPipelineState(*pso);
+    }
+
+    for_range(i, numCmdBuffers)
+    {
+        cmdBuffers[i]->SetViewport(viewports[0]);
+        cmdBuffers[i]->SetResource(0, *sceneBufferLeft);
+        cmdBuffers[i]->SetResource(1, *colorMaps[i]);
+        cmdBuffers[i]->SetResource(2, *samplers[SamplerNearestClamp]);
+        cmdBuffers[i]->DrawIndexed(mesh.numIndices, 0);
+    }
+
+    for_range(i, numCmdBuffers)
+    {
+        cmdBuffers[i]->SetViewport(viewports[1]);
+        cmdBuffers[i]->SetResource(0, *sceneBufferRight);
+        cmdBuffers[i]->DrawIndexed(mesh.numIndices, 0);
+    }
+
+    for_range(i, numCmdBuffers)
+    {
+        cmdBuffers[i]->EndRenderPass();
+        cmdBuffers[i]->End();
+        cmdQueue->Submit(*cmdBuffers[i]);
+    }
+
+    cmdQueue->WaitIdle();
+
+    // Read back the center of both halves of each render target
+    TestResult result = TestResult::Passed;
+
+    for_range(i, numCmdBuffers)
+    {
+        for_range(half, 2)
+        {
+            ColorRGBAub actualColor;
+            const MutableImageView dstImage
+            {
+                ImageFormat::RGBA,
+                DataType::UInt8,
+                &actualColor,
+                sizeof(actualColor)
+            };
+            const Offset3D texelOffset
+            {
+                static_cast<std::int32_t>(targetSize / 4 + half * targetSize / 2),
+                static_cast<std::int32_t>(targetSize / 2),
+                0
+            };
+            renderer->ReadTexture(*outputTextures[i], TextureRegion{ texelOffset, Extent3D{ 1, 1, 1 } }, dstImage);
+
+            if (actualColor != texColors[i])
+            {
+                Log::Errorf(
+                    "Mismatch between %s half of command buffer [%u] (%u, %u, %u, %u) and expected color (%u, %u, %u, %u) after interleaved encoding\n",
+                    (half == 0 ? "left" : "right"), static_cast<unsigned>(i),
+                    actualColor.r, actualColor.g, actualColor.b, actualColor.a,
+                    texColors[i].r, texColors[i].g, texColors[i].b, texColors[i].a
+                );
+                result = TestResult::FailedMismatch;
+                if (!opt.greedy)
+                    break;
+            }
+        }
+    }
+
+    // Release resources
+    for_range(i, numCmdBuffers)
+    {
+        renderer->Release(*cmdBuffers[i]);
+        renderer->Release(*renderTargets[i]);
+        renderer->Release(*outputTextures[i]);
+        renderer->Release(*colorMaps[i]);
+    }
+
+    renderer->Release(*pso);
+    renderer->Release(*sceneBufferLeft);
+    renderer->Release(*sceneBufferRight);
+
+    return result;
+}
+
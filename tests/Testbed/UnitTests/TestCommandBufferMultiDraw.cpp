@@ -0,0 +1,176 @@
+/*
+ * TestCommandBufferMultiDraw.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <algorithm>
+
+
+/*
+Draw four quads with separate draw commands under the same state, separated by redundant state changes,
+and check that the OpenGL backend folds them into a single multi-draw command and still renders all four quads.
+Only runs with the OpenGL backend, the debug layer, and the '--optimize' option, since only then the optimizer runs and reports its statistics.
+The eliminated commands are the redundant SetVertexBuffer() and SetViewport() commands between the draws
+plus all but one draw command if GL_EXT_multi_draw_arrays is supported.
+*/
+DEF_TEST( CommandBufferMultiDraw )
+{
+    if (!(moduleName == "OpenGL" && isDebugLayerEnabled && isCmdBufferOptimizationEnabled))
+        return TestResult::Skipped;
+
+    constexpr std::uint32_t numQuads = 4;
+
+    const std::vector<UTF8String>& extensionNames = renderer->GetRendererInfo().extensionNames;
+    const bool isMultiDrawSupported = (std::find(extensionNames.begin(), extensionNames.end(), "GL_EXT_multi_draw_arrays") != extensionNames.end());
+
+    const std::uint32_t numExpectedEliminatedCommands = (numQuads - 1) * 2 + (isMultiDrawSupported ? numQuads - 1 : 0);
+
+    // Create one quad with a solid color per screen quadrant
+    const std::uint8_t quadColors[numQuads][4] =
+    {
+        { 255,   0,   0, 255 },
+        {   0, 255,   0, 255 },
+        {   0,   0, 255, 255 },
+        { 255, 255,   0, 255 },
+    };
+
+    const float quadCenters[numQuads][2] =
+    {
+        { -0.5f, +0.5f },
+        { +0.5f, +0.5f },
+        { -0.5f, -0.5f },
+        { +0.5f, -0.5f },
+    };
+
+    UnprojectedVertex vertices[numQuads * 4];
+    for_range(i, numQuads)
+    {
+        const float left    = quadCenters[i][0] - 0.4f;
+        const float right   = quadCenters[i][0] + 0.4f;
+        const float top     = quadCenters[i][1] + 0.4f;
+        const float bottom  = quadCenters[i][1] - 0.4f;
+        const std::uint8_t* c = quadColors[i];
+
+        vertices[i*4 + 0] = UnprojectedVertex{ { right, top    }, { c[0], c[1], c[2], c[3] } };
+        vertices[i*4 + 1] = UnprojectedVertex{ { right, bottom }, { c[0], c[1], c[2], c[3] } };
+        vertices[i*4 + 2] = UnprojectedVertex{ { left,  top    }, { c[0], c[1], c[2], c[3] } };
+        vertices[i*4 + 3] = UnprojectedVertex{ { left,  bottom }, { c[0], c[1], c[2], c[3] } };
+    }
+
+    BufferDescriptor vertexBufDesc;
+    {
+        vertexBufDesc.size          = sizeof(vertices);
+        vertexBufDesc.bindFlags     = BindFlags::VertexBuffer;
+        vertexBufDesc.vertexAttribs = vertexFormats[VertFmtUnprojected].attributes;
+    }
+    CREATE_BUFFER(vertexBuf, vertexBufDesc, "CommandBufferMultiDraw.vertexBuf", vertices);
+
+    GraphicsPipelineDescriptor psoDesc;
+    {
+        psoDesc.pipelineLayout      = nullptr; // No resource bindings, therefore no pipeline layout
+        psoDesc.renderPass          = swapChain->GetRenderPass();
+        psoDesc.vertexShader        = shaders[VSUnprojected];
+        psoDesc.fragmentShader      = shaders[PSUnprojected];
+        psoDesc.primitiveTopology   = PrimitiveTopology::TriangleStrip;
+    }
+    CREATE_GRAPHICS_PSO(pso, psoDesc, "CommandBufferMultiDraw.PSO");
+
+    // Encode one draw command per quad into a deferred command buffer, which is optimized when its encoding ends
+    const Viewport viewport{ 0.0f, 0.0f, static_cast<float>(opt.resolution.width), static_cast<float>(opt.resolution.height) };
+
+    CommandBuffer* cmdBuf = renderer->CreateCommandBuffer();
+    Texture* readbackTex = nullptr;
+
+    cmdBuf->Begin();
+    {
+        cmdBuf->BeginRenderPass(*swapChain);
+        {
+            cmdBuf->Clear(ClearFlags::Color);
+            cmdBuf->SetViewport(viewport);
+            cmdBuf->SetPipelineState(*pso);
+            cmdBuf->SetVertexBuffer(*vertexBuf);
+
+            for_range(i, numQuads)
+            {
+                if (i > 0)
+                {
+                    cmdBuf->SetVertexBuffer(*vertexBuf);
+                    cmdBuf->SetViewport(viewport);
+                }
+                cmdBuf->Draw(4, i * 4);
+            }
+
+            readbackTex = CaptureFramebuffer(*cmdBuf, swapChain->GetColorFormat(), opt.resolution);
+        }
+        cmdBuf->EndRenderPass();
+    }
+    cmdBuf->End();
+
+    debugger.FlushProfile();
+
+    cmdQueue->Submit(*cmdBuf);
+    cmdQueue->WaitIdle();
+
+    FrameProfile profile;
+    debugger.FlushProfile(&profile);
+
+    // Read back the color at the center of each screen quadrant
+    std::uint32_t actualColors[numQuads] = {};
+    for_range(i, numQuads)
+    {
+        const Offset3D texelOffset
+        {
+            static_cast<std::int32_t>((quadCenters[i][0] * 0.5f + 0.5f) * opt.resolution.width),
+            static_cast<std::int32_t>((quadCenters[i][1] * 0.5f + 0.5f) * opt.resolution.height),
+            0
+        };
+        MutableImageView dstImage;
+        {
+            dstImage.format     = ImageFormat::RGBA;
+            dstImage.dataType   = DataType::UInt8;
+            dstImage.data       = &actualColors[i];
+            dstImage.dataSize   = sizeof(actualColors[i]);
+        }
+        renderer->ReadTexture(*readbackTex, TextureRegion{ texelOffset, Extent3D{ 1, 1, 1 } }, dstImage);
+    }
+
+    renderer->Release(*readbackTex);
+    renderer->Release(*cmdBuf);
+    renderer->Release(*pso);
+    renderer->Release(*vertexBuf);
+
+    if (profile.commandBufferRecord.eliminatedCommands != numExpectedEliminatedCommands)
+    {
+        Log::Errorf(
+            "Mismatch between number of eliminated commands (%u) and expected value (%u) for %u draws %s multi-draw support\n",
+            profile.commandBufferRecord.eliminatedCommands, numExpectedEliminatedCommands, numQuads, (isMultiDrawSupported ? "with" : "without")
+        );
+        return TestResult::FailedMismatch;
+    }
+
+    // Framebuffer may be flipped vertically, so only compare the set of colors, which must all be distinct
+    std::uint32_t expectedColors[numQuads] = {};
+    for_range(i, numQuads)
+        ::memcpy(&expectedColors[i], quadColors[i], sizeof(expectedColors[i]));
+
+    std::sort(std::begin(actualColors), std::end(actualColors));
+    std::sort(std::begin(expectedColors), std::end(expectedColors));
+
+    for_range(i, numQuads)
+    {
+        if (actualColors[i] != expectedColors[i])
+        {
+            Log::Errorf(
+                "Mismatch between quad color [%u] (0x%08X) and expected value (0x%08X) after folding %u draw commands\n",
+                static_cast<unsigned>(i), actualColors[i], expectedColors[i], numQuads
+            );
+            return TestResult::FailedMismatch;
+        }
+    }
+
+    return TestResult::Passed;
+}
+
@@ -0,0 +1,119 @@
+/*
+ * TestCommandBufferOptimization.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+
+
+/*
+Encode a command buffer with a known number of redundant commands and check how many of them the OpenGL backend eliminates.
+Only runs with the OpenGL backend, the debug layer, and the '--optimize' option, since only then the optimizer runs and reports its statistics.
+The eliminated commands are:
+ - Second UpdateBuffer() that continues the first one and is merged into a single buffer update.
+ - Second SetViewport() with the same viewport.
+ - Second SetPipelineState() with the same PSO.
+ - Second SetVertexBuffer() with the same buffer.
+The single draw command is not batched, so it does not contribute to the count.
+*/
+DEF_TEST( CommandBufferOptimization )
+{
+    if (!(moduleName == "OpenGL" && isDebugLayerEnabled && isCmdBufferOptimizationEnabled))
+        return TestResult::Skipped;
+
+    constexpr std::uint32_t numExpectedEliminatedCommands = 4;
+
+    // Create constant buffer for the buffer updates and vertex buffer for the draw command
+    BufferDescriptor cbufferDesc;
+    {
+        cbufferDesc.size        = sizeof(float) * 8;
+        cbufferDesc.bindFlags   = BindFlags::ConstantBuffer | BindFlags::CopyDst;
+    }
+    CREATE_BUFFER(cbuffer, cbufferDesc, "CommandBufferOptimization.cbuffer", nullptr);
+
+    const UnprojectedVertex vertices[3] =
+    {
+        UnprojectedVertex{ {  0.0f, +0.5f }, { 255,   0,   0, 255 } },
+        UnprojectedVertex{ { +0.5f, -0.5f }, {   0, 255,   0, 255 } },
+        UnprojectedVertex{ { -0.5f, -0.5f }, {   0,   0, 255, 255 } },
+    };
+
+    BufferDescriptor vertexBufDesc;
+    {
+        vertexBufDesc.size          = sizeof(vertices);
+        vertexBufDesc.bindFlags     = BindFlags::VertexBuffer;
+        vertexBufDesc.vertexAttribs = vertexFormats[VertFmtUnprojected].attributes;
+    }
+    CREATE_BUFFER(vertexBuf, vertexBufDesc, "CommandBufferOptimization.vertexBuf", vertices);
+
+    GraphicsPipelineDescriptor psoDesc;
+    {
+        psoDesc.pipelineLayout      = nullptr; // No resource bindings, therefore no pipeline layout
+        psoDesc.renderPass          = swapChain->GetRenderPass();
+        psoDesc.vertexShader        = shaders[VSUnprojected];
+        psoDesc.fragmentShader      = shaders[PSUnprojected];
+        psoDesc.primitiveTopology   = PrimitiveTopology::TriangleList;
+    }
+    CREATE_GRAPHICS_PSO(pso, psoDesc, "CommandBufferOptimization.PSO");
+
+    // Encode redundant commands into a deferred command buffer, which is optimized when its encoding ends
+    const float constants[8] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f };
+    const Viewport viewport{ 0.0f, 0.0f, static_cast<float>(opt.resolution.width), static_cast<float>(opt.resolution.height) };
+
+    CommandBuffer* cmdBuf = renderer->CreateCommandBuffer();
+
+    cmdBuf->Begin();
+    {
+        cmdBuf->UpdateBuffer(*cbuffer, 0, &constants[0], sizeof(float) * 4);
+        cmdBuf->UpdateBuffer(*cbuffer, sizeof(float) * 4, &constants[4], sizeof(float) * 4);
+
+        cmdBuf->BeginRenderPass(*swapChain);
+        {
+            cmdBuf->SetViewport(viewport);
+            cmdBuf->SetViewport(viewport);
+            cmdBuf->SetPipelineState(*pso);
+            cmdBuf->SetPipelineState(*pso);
+            cmdBuf->SetVertexBuffer(*vertexBuf);
+            cmdBuf->SetVertexBuffer(*vertexBuf);
+            cmdBuf->Draw(3, 0);
+        }
+        cmdBuf->EndRenderPass();
+    }
+    cmdBuf->End();
+
+    // The eliminated commands must be reported once per encoding, i.e. only for the first submission
+    TestResult result = TestResult::Passed;
+
+    debugger.FlushProfile();
+
+    for_range(i, 2)
+    {
+        cmdQueue->Submit(*cmdBuf);
+
+        FrameProfile profile;
+        debugger.FlushProfile(&profile);
+
+        const std::uint32_t expectedCount = (i == 0 ? numExpectedEliminatedCommands : 0);
+        if (profile.commandBufferRecord.eliminatedCommands != expectedCount)
+        {
+            Log::Errorf(
+                "Mismatch between number of eliminated commands (%u) and expected value (%u) for submission [%u]\n",
+                profile.commandBufferRecord.eliminatedCommands, expectedCount, static_cast<unsigned>(i)
+            );
+            result = TestResult::FailedMismatch;
+            break;
+        }
+    }
+
+    cmdQueue->WaitIdle();
+
+    renderer->Release(*cmdBuf);
+    renderer->Release(*pso);
+    renderer->Release(*cbuffer);
+    renderer->Release(*vertexBuf);
+
+    return result;
+}
+
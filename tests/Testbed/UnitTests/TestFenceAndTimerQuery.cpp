@@ -0,0 +1,131 @@
+/*
+ * TestFenceAndTimerQuery.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <vector>
+
+
+/*
+Submit a command buffer that copies a large buffer inside a TimeElapsed query, followed by a fence.
+Waiting for the fence must succeed and the copy must be complete afterwards,
+and the query must report a non-zero elapsed time for the copy.
+The fence is then submitted several times in a row to make sure each wait refers to the latest submission.
+*/
+DEF_TEST( FenceAndTimerQuery )
+{
+    constexpr std::uint32_t numValues   = 1024 * 1024;
+    constexpr std::uint64_t timeout     = 1000000000ull; // 1 second in nanoseconds
+    constexpr std::uint32_t numRepeats  = 3;
+
+    std::vector<std::uint32_t> initialValues(numValues);
+    for_range(i, numValues)
+        initialValues[i] = 0xA5000000u | i;
+
+    BufferDescriptor bufDesc;
+    {
+        bufDesc.size        = sizeof(std::uint32_t) * numValues;
+        bufDesc.bindFlags   = BindFlags::CopySrc;
+    }
+    CREATE_BUFFER(srcBuf, bufDesc, "FenceAndTimerQuery.srcBuf", initialValues.data());
+    {
+        bufDesc.bindFlags   = BindFlags::CopyDst;
+    }
+    CREATE_BUFFER(dstBuf, bufDesc, "FenceAndTimerQuery.dstBuf", nullptr);
+
+    QueryHeapDescriptor queryHeapDesc;
+    {
+        queryHeapDesc.debugName     = "FenceAndTimerQuery.timer";
+        queryHeapDesc.type          = QueryType::TimeElapsed;
+        queryHeapDesc.numQueries    = 1;
+    }
+    QueryHeap* timerQuery = renderer->CreateQueryHeap(queryHeapDesc);
+
+    Fence* fence = renderer->CreateFence();
+    CommandBuffer* cmdBuf = renderer->CreateCommandBuffer();
+
+    auto ReleaseResources = [&]()
+    {
+        renderer->Release(*cmdBuf);
+        renderer->Release(*fence);
+        renderer->Release(*timerQuery);
+        renderer->Release(*srcBuf);
+        renderer->Release(*dstBuf);
+    };
+
+    // Copy entire buffer inside a timer query
+    cmdBuf->Begin();
+    {
+        cmdBuf->BeginQuery(*timerQuery, 0);
+        {
+            cmdBuf->CopyBuffer(*dstBuf, 0, *srcBuf, 0, bufDesc.size);
+        }
+        cmdBuf->EndQuery(*timerQuery, 0);
+    }
+    cmdBuf->End();
+
+    cmdQueue->Submit(*cmdBuf);
+    cmdQueue->Submit(*fence);
+
+    if (!cmdQueue->WaitFence(*fence, timeout))
+    {
+        Log::Errorf("Waiting for fence after command buffer submission timed out\n");
+        ReleaseResources();
+        return TestResult::FailedErrors;
+    }
+
+    // Copy must be complete once the fence has been signaled
+    std::uint32_t lastValue = 0;
+    renderer->ReadBuffer(*dstBuf, bufDesc.size - sizeof(lastValue), &lastValue, sizeof(lastValue));
+
+    if (lastValue != initialValues.back())
+    {
+        Log::Errorf(
+            "Mismatch between last buffer value after fence was signaled (0x%08X) and expected value (0x%08X)\n",
+            lastValue, initialValues.back()
+        );
+        ReleaseResources();
+        return TestResult::FailedMismatch;
+    }
+
+    // Query elapsed time of the copy command
+    std::uint64_t elapsedTime = 0;
+    if (!QueryResultsWithTimeout(*timerQuery, 0, 1, &elapsedTime, sizeof(elapsedTime)))
+    {
+        ReleaseResources();
+        return TestResult::FailedErrors;
+    }
+
+    if (elapsedTime == 0)
+    {
+        Log::Errorf("Timer query reported zero elapsed time for copying %u bytes\n", static_cast<unsigned>(bufDesc.size));
+        ReleaseResources();
+        return TestResult::FailedMismatch;
+    }
+
+    if (opt.verbose)
+        Log::Printf("Copying %u bytes took %" PRIu64 " ns\n", static_cast<unsigned>(bufDesc.size), elapsedTime);
+
+    // Submit the same fence multiple times; each wait must refer to the latest submission
+    for_range(i, numRepeats)
+    {
+        cmdQueue->Submit(*cmdBuf);
+        for_range(j, i + 1)
+            cmdQueue->Submit(*fence);
+
+        if (!cmdQueue->WaitFence(*fence, timeout))
+        {
+            Log::Errorf("Waiting for fence after %u repeated submissions timed out\n", i + 1);
+            ReleaseResources();
+            return TestResult::FailedErrors;
+        }
+    }
+
+    ReleaseResources();
+
+    return TestResult::Passed;
+}
+
@@ -10,6 +10,10 @@
 #include <LLGL/Utils/Image.h>
 #include <LLGL/Utils/TypeNames.h>
 #include <thread>
+#include <vector>
+#include <cstring>
+#include <limits>
+#include <cstdlib>
 
 
 DEF_RITEST( ImageConversions )
@@ -144,6 +148,220 @@ DEF_RITEST( ImageConversions )
             }                                                                                                       \
         }
 
+    // Converts the image with the generic (variant based) path of ConvertImageBuffer().
+    // There are no fast-path kernels for Float64, so converting through a Float64 image runs the generic path in both steps.
+    // This is bit-identical to a single generic conversion, because UInt8 and Float32 values round-trip exactly through Float64.
+    auto ConvertImageGeneric = [](const ImageView& srcView, const MutableImageView& dstView, std::size_t numPixels)
+    {
+        std::vector<char> intermediateBuffer(GetMemoryFootprint(srcView.format, DataType::Float64, numPixels));
+        const MutableImageView intermediateView{ srcView.format, DataType::Float64, intermediateBuffer.data(), intermediateBuffer.size() };
+        ConvertImageBuffer(srcView, intermediateView);
+        ConvertImageBuffer(ImageView{ intermediateView.format, intermediateView.dataType, intermediateView.data, intermediateView.dataSize }, dstView);
+    };
+
+    // Benchmark fast-path conversions against the generic conversion and compare their results
+    auto BenchmarkConversion = [&](const char* name, ImageFormat srcFormat, DataType srcDataType, ImageFormat dstFormat, DataType dstDataType) -> TestResult
+    {
+        const std::size_t numPixels = (opt.fastTest ? 256u*256u : 2048u*2048u);
+
+        std::vector<char> srcBuffer(GetMemoryFootprint(srcFormat, srcDataType, numPixels));
+        std::vector<char> dstBuffer(GetMemoryFootprint(dstFormat, dstDataType, numPixels));
+        std::vector<char> refBuffer(dstBuffer.size());
+
+        const std::size_t numComponents = numPixels * ImageFormatSize(srcFormat);
+        for_range(i, numComponents)
+        {
+            if (srcDataType == DataType::UInt8)
+                reinterpret_cast<std::uint8_t*>(srcBuffer.data())[i] = static_cast<std::uint8_t>((i * 7) % 256);
+            else
+                reinterpret_cast<float*>(srcBuffer.data())[i] = static_cast<float>((i * 7) % 256) / 255.0f;
+        }
+
+        const ImageView         srcView{ srcFormat, srcDataType, srcBuffer.data(), srcBuffer.size() };
+        const MutableImageView  dstView{ dstFormat, dstDataType, dstBuffer.data(), dstBuffer.size() };
+        const MutableImageView  refView{ dstFormat, dstDataType, refBuffer.data(), refBuffer.size() };
+
+        const std::uint64_t startTime = Timer::Tick();
+        ConvertImageBuffer(srcView, dstView);
+        const std::uint64_t midTime = Timer::Tick();
+        ConvertImageGeneric(srcView, refView, numPixels);
+        const std::uint64_t endTime = Timer::Tick();
+
+        if (::memcmp(dstBuffer.data(), refBuffer.data(), dstBuffer.size()) != 0)
+        {
+            Log::Errorf("Mismatch between fast-path and generic image conversion: %s\n", name);
+            return TestResult::FailedMismatch;
+        }
+
+        if (opt.showTiming)
+        {
+            const double fastTime   = static_cast<double>(midTime - startTime) / static_cast<double>(Timer::Frequency()) * 1000.0;
+            const double genericTime   = static_cast<double>(endTime - midTime) / static_cast<double>(Timer::Frequency()) * 1000.0;
+            Log::Printf(
+                "Conversion %s (%u pixels): fast path (%.4f ms), generic path via Float64 (%.4f ms)\n",
+                name, static_cast<unsigned>(numPixels), fastTime, genericTime
+            );
+        }
+
+        return TestResult::Passed;
+    };
+
+    #define BENCHMARK_CONVERSION(SRC_FORMAT, SRC_TYPE, DST_FORMAT, DST_TYPE)                                \
+        {                                                                                                   \
+            TestResult result = BenchmarkConversion(                                                        \
+                #SRC_FORMAT "/" #SRC_TYPE " -> " #DST_FORMAT "/" #DST_TYPE,                                 \
+                (SRC_FORMAT), (SRC_TYPE), (DST_FORMAT), (DST_TYPE)                                          \
+            );                                                                                              \
+            if (result != TestResult::Passed)                                                               \
+                return result;                                                                              \
+        }
+
+    BENCHMARK_CONVERSION(ImageFormat::RGB,  DataType::UInt8,   ImageFormat::RGBA, DataType::UInt8  );
+    BENCHMARK_CONVERSION(ImageFormat::BGR,  DataType::UInt8,   ImageFormat::RGBA, DataType::UInt8  );
+    BENCHMARK_CONVERSION(ImageFormat::RGBA, DataType::UInt8,   ImageFormat::BGRA, DataType::UInt8  );
+    BENCHMARK_CONVERSION(ImageFormat::RGBA, DataType::UInt8,   ImageFormat::RGB,  DataType::UInt8  );
+    BENCHMARK_CONVERSION(ImageFormat::RGBA, DataType::UInt8,   ImageFormat::RGBA, DataType::Float16);
+    BENCHMARK_CONVERSION(ImageFormat::RGB,  DataType::UInt8,   ImageFormat::RGBA, DataType::Float16);
+    BENCHMARK_CONVERSION(ImageFormat::RGBA, DataType::UInt8,   ImageFormat::RGBA, DataType::Float32);
+    BENCHMARK_CONVERSION(ImageFormat::RGBA, DataType::Float32, ImageFormat::RGBA, DataType::UInt8  );
+
+    // Reference filter taps along one axis: 2-tap box filter for even sizes, 3-tap polyphase box filter for odd sizes
+    struct MipRefTaps
+    {
+        std::uint32_t   first;
+        std::uint32_t   count;
+        double          weights[3];
+    };
+
+    auto GetMipRefTaps = [](std::uint32_t srcSize, std::uint32_t dstSize, std::uint32_t i) -> MipRefTaps
+    {
+        if (srcSize == 1)
+            return MipRefTaps{ 0, 1, { 1.0, 0.0, 0.0 } };
+        if (srcSize % 2 == 0)
+            return MipRefTaps{ i*2, 2, { 0.5, 0.5, 0.0 } };
+        const double n = static_cast<double>(srcSize);
+        return MipRefTaps{ i*2, 3, { (dstSize - i) / n, dstSize / n, (i + 1) / n } };
+    };
+
+    // Generate MIP-map chain and compare each level against a box-filter reduction of the previous level
+    auto TestMipChain = [&](const char* name, const Extent3D& extent, std::uint32_t numArrayLayers) -> TestResult
+    {
+        const std::uint32_t numMipLevels = NumMipLevels(extent.width, extent.height, extent.depth);
+
+        std::vector<std::vector<std::uint8_t>> mipBuffers(numMipLevels);
+        std::vector<MutableImageView> dstViews;
+
+        for_range(mip, numMipLevels)
+        {
+            const Extent3D mipExtent = GetMipExtent(TextureType::Texture2D, extent, mip);
+            mipBuffers[mip].resize(mipExtent.width * mipExtent.height * mipExtent.depth * numArrayLayers * 4);
+            if (mip > 0)
+                dstViews.push_back(MutableImageView{ ImageFormat::RGBA, DataType::UInt8, mipBuffers[mip].data(), mipBuffers[mip].size() });
+        }
+
+        for_range(i, mipBuffers[0].size())
+            mipBuffers[0][i] = static_cast<std::uint8_t>((i * 7) % 256);
+
+        const std::uint64_t startTime = Timer::Tick();
+        GenerateMipChain(ImageView{ ImageFormat::RGBA, DataType::UInt8, mipBuffers[0].data(), mipBuffers[0].size() }, extent, numArrayLayers, dstViews, false, LLGL_MAX_THREAD_COUNT);
+        const std::uint64_t endTime = Timer::Tick();
+
+        for_subrange(mip, 1, numMipLevels)
+        {
+            const Extent3D srcExtent = GetMipExtent(TextureType::Texture2D, extent, mip - 1);
+            const Extent3D dstExtent = GetMipExtent(TextureType::Texture2D, extent, mip);
+
+            /* Even sizes are filtered with exact integer arithmetic, odd sizes go through floating-point weights and may differ by one due to rounding */
+            const bool          isBox2x2    = (srcExtent.width % 2 == 0 && srcExtent.height % 2 == 0);
+            const int           tolerance   = (isBox2x2 ? 0 : 1);
+            const std::size_t   srcRowStride = srcExtent.width * 4;
+
+            for_range(i, mipBuffers[mip].size())
+            {
+                const std::size_t c     = i % 4;
+                const std::size_t x     = (i / 4) % dstExtent.width;
+                const std::size_t y     = (i / 4 / dstExtent.width) % dstExtent.height;
+                const std::size_t layer = (i / 4 / dstExtent.width / dstExtent.height);
+
+                const MipRefTaps tapsX = GetMipRefTaps(srcExtent.width, dstExtent.width, static_cast<std::uint32_t>(x));
+                const MipRefTaps tapsY = GetMipRefTaps(srcExtent.height, dstExtent.height, static_cast<std::uint32_t>(y));
+
+                /* Filter source texels of the same layer only; taps never exceed the source extent */
+                const std::uint8_t* src = &(mipBuffers[mip - 1][layer * srcExtent.height * srcRowStride + c]);
+                double sum = 0.0;
+                for_range(ty, tapsY.count)
+                {
+                    for_range(tx, tapsX.count)
+                    {
+                        const std::uint8_t value = src[(tapsY.first + ty) * srcRowStride + (tapsX.first + tx) * 4];
+                        sum += static_cast<double>(value) * tapsX.weights[tx] * tapsY.weights[ty];
+                    }
+                }
+
+                const int expected  = static_cast<int>(sum + 0.5);
+                const int actual    = static_cast<int>(mipBuffers[mip][i]);
+                if (std::abs(actual - expected) > tolerance)
+                {
+                    Log::Errorf(
+                        "Mismatch between MIP-map %u of %s and reference box filter at (%u, %u, layer %u): %d (expected %d)\n",
+                        mip, name, static_cast<unsigned>(x), static_cast<unsigned>(y), static_cast<unsigned>(layer), actual, expected
+                    );
+                    return TestResult::FailedMismatch;
+                }
+            }
+        }
+
+        if (opt.showTiming)
+        {
+            const double time = static_cast<double>(endTime - startTime) / static_cast<double>(Timer::Frequency()) * 1000.0;
+            Log::Printf("GenerateMipChain %s (%u MIP-maps): %.4f ms\n", name, numMipLevels, time);
+        }
+
+        return TestResult::Passed;
+    };
+
+    #define TEST_MIP_CHAIN(WIDTH, HEIGHT, LAYERS)                                                                   \
+        {                                                                                                           \
+            TestResult result = TestMipChain(#WIDTH "x" #HEIGHT "x" #LAYERS, Extent3D{ WIDTH, HEIGHT, 1 }, LAYERS);  \
+            if (result != TestResult::Passed)                                                                       \
+                return result;                                                                                      \
+        }
+
+    TEST_MIP_CHAIN(256, 128, 6);
+    TEST_MIP_CHAIN(255, 77, 3);
+
+    if (!opt.fastTest)
+        TEST_MIP_CHAIN(2048, 2048, 1);
+
+    // Out-of-range values and NaN must be converted the same way by the SIMD kernels and their scalar tail
+    {
+        const float specialValues[] = { std::numeric_limits<float>::quiet_NaN(), -1.0f, 2.0f, std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), 0.5f, 0.0f, 1.0f };
+        const std::uint8_t expectedValues[] = { 0, 0, 255, 255, 0, 127, 0, 255 };
+
+        // Repeat values so that they are converted by both the 16-component SIMD loop and the remainder
+        constexpr std::size_t numSpecialComponents = 36;
+        float srcComponents[numSpecialComponents];
+        std::uint8_t dstComponents[numSpecialComponents] = {};
+        for_range(i, numSpecialComponents)
+            srcComponents[i] = specialValues[i % 8];
+
+        const ImageView         srcView{ ImageFormat::RGBA, DataType::Float32, srcComponents, sizeof(srcComponents) };
+        const MutableImageView  dstView{ ImageFormat::RGBA, DataType::UInt8, dstComponents, sizeof(dstComponents) };
+        ConvertImageBuffer(srcView, dstView);
+
+        for_range(i, numSpecialComponents)
+        {
+            if (dstComponents[i] != expectedValues[i % 8])
+            {
+                Log::Errorf(
+                    "Mismatch between converted Float32 component [%u] = %f and UInt8 component (%u), expected %u\n",
+                    static_cast<unsigned>(i), static_cast<double>(srcComponents[i]), dstComponents[i], expectedValues[i % 8]
+                );
+                return TestResult::FailedMismatch;
+            }
+        }
+    }
+
     TEST_CONVERSION("Gradient.png");
 
     if (!opt.fastTest)
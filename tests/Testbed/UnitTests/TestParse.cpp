@@ -7,6 +7,10 @@
 
 #include "Testbed.h"
 #include <LLGL/Utils/Parse.h>
+#include <LLGL/Utils/PipelineLayoutBinary.h>
+#include <LLGL/Timer.h>
+#include <string>
+#include <vector>
 
 
 DEF_RITEST( ParseUtil )
@@ -223,6 +227,11 @@ DEF_RITEST( ParseUtil )
             if (!CompareUniformDescEqual(lhs.uniforms[i], rhs.uniforms[i]))
                 return false;
         }
+        for_range(i, lhs.combinedTextureSamplers.size())
+        {
+            if (!CompareCombinedTextureSamplerDescEqual(lhs.combinedTextureSamplers[i], rhs.combinedTextureSamplers[i]))
+                return false;
+        }
         TEST_ATTRIB(barrierFlags);
         return true;
     };
@@ -307,6 +316,117 @@ DEF_RITEST( ParseUtil )
         2, 3, 3
     );
 
+    // Parsing the same layout again must return an equal layout, whether or not it is served from the layout cache
+    TEST_PARSE_PSO_LAYOUT(
+        psoLayoutA,
+        "heap{"
+        "cbuffer(Scene@0):vert,"
+        "rwbuffer(outVertices@0):vert,"
+        "},"
+        "texture(texA@1[2],texB@3):vert:frag,"
+        "sampler(smplA@4):frag,"
+        "sampler(smplB@5){filter=nearest}:frag,"
+        "sampler<texB,smplA>(texB_smplA@4),"
+        "sampler<texB,smplB>(texB_smplB@5),"
+        "float4x4(wvpMatrix),"
+        "int4(offsets[3],origin),"
+        "barriers{rwbuffer},"
+    );
+
+    // Test binary encoding of PSO layout and sampler descriptors
+    Blob psoLayoutBinary = EncodePipelineLayoutBinary(psoLayoutA);
+    PipelineLayoutBinaryView psoLayoutView{ psoLayoutBinary.GetData(), psoLayoutBinary.GetSize() };
+    if (!psoLayoutView)
+    {
+        Log::Errorf("LLGL::PipelineLayoutBinaryView rejected encoded PSO layout\n");
+        return TestResult::FailedErrors;
+    }
+
+    PipelineLayoutDescriptor psoLayoutDecoded;
+    psoLayoutView.Decode(psoLayoutDecoded);
+    if (!ComparePSOLayoutDescsEqual(psoLayoutDecoded, psoLayoutA))
+    {
+        Log::Errorf("Mismatch between decoded binary PSO layout and original PSO layout\n");
+        return TestResult::FailedMismatch;
+    }
+
+    if (PipelineLayoutBinaryView{ psoLayoutBinary.GetData(), psoLayoutBinary.GetSize() - 4 })
+    {
+        Log::Errorf("LLGL::PipelineLayoutBinaryView accepted truncated PSO layout\n");
+        return TestResult::FailedMismatch;
+    }
+
+    Blob samplerBinary = EncodeSamplerBinary(samplerDesc2A);
+    SamplerDescriptor samplerDecoded;
+    if (!DecodeSamplerBinary(samplerBinary.GetData(), samplerBinary.GetSize(), samplerDecoded) || !CompareSamplerDescsEqual(samplerDecoded, samplerDesc2A))
+    {
+        Log::Errorf("Mismatch between decoded binary sampler and original sampler\n");
+        return TestResult::FailedMismatch;
+    }
+
+    // Benchmark parsing unique PSO layouts against parsing cached PSO layouts and decoding their binary representation
+    const std::size_t numLayouts = (opt.fastTest ? 64 : 1024);
+
+    std::vector<std::string> psoLayoutStrings(numLayouts);
+    for_range(i, numLayouts)
+    {
+        psoLayoutStrings[i] =
+        (
+            "heap{cbuffer(Scene@0):vert:frag,rwbuffer(outVertices@1):vert},"
+            "texture(colorMap@2,normalMap@3,specularMap@" + std::to_string(4 + i) + "):frag,"
+            "sampler(linearSampler@0){filter=linear,address=clamp}:frag,"
+            "sampler<colorMap,linearSampler>(colorMap_linearSampler@0),"
+            "float4x4(wvpMatrix),float4(lightDir),"
+        );
+    }
+
+    std::vector<PipelineLayoutDescriptor> psoLayoutsParsed(numLayouts);
+    std::vector<PipelineLayoutDescriptor> psoLayoutsCached(numLayouts);
+    std::vector<PipelineLayoutDescriptor> psoLayoutsDecoded(numLayouts);
+    std::vector<Blob> psoLayoutBinaries(numLayouts);
+
+    const std::uint64_t parseStartTime = Timer::Tick();
+    for_range(i, numLayouts)
+        psoLayoutsParsed[i] = Parse(psoLayoutStrings[i].c_str());
+    const std::uint64_t parseEndTime = Timer::Tick();
+
+    for_range(i, numLayouts)
+        psoLayoutsCached[i] = Parse(psoLayoutStrings[i].c_str());
+    const std::uint64_t cachedEndTime = Timer::Tick();
+
+    for_range(i, numLayouts)
+        psoLayoutBinaries[i] = EncodePipelineLayoutBinary(psoLayoutsParsed[i]);
+
+    const std::uint64_t decodeStartTime = Timer::Tick();
+    for_range(i, numLayouts)
+        PipelineLayoutBinaryView{ psoLayoutBinaries[i].GetData(), psoLayoutBinaries[i].GetSize() }.Decode(psoLayoutsDecoded[i]);
+    const std::uint64_t decodeEndTime = Timer::Tick();
+
+    for_range(i, numLayouts)
+    {
+        if (!ComparePSOLayoutDescsEqual(psoLayoutsCached[i], psoLayoutsParsed[i]) ||
+            !ComparePSOLayoutDescsEqual(psoLayoutsDecoded[i], psoLayoutsParsed[i]))
+        {
+            Log::Errorf("Mismatch between parsed, cached, and decoded PSO layout: %s\n", psoLayoutStrings[i].c_str());
+            return TestResult::FailedMismatch;
+        }
+    }
+
+    if (opt.showTiming)
+    {
+        auto TicksToMicroseconds = [](std::uint64_t ticks, std::size_t count) -> double
+        {
+            return static_cast<double>(ticks) / static_cast<double>(Timer::Frequency()) * 1000000.0 / static_cast<double>(count);
+        };
+        Log::Printf(
+            "Pipeline layouts (%u): parse (%.2f us), parse cached (%.2f us), decode binary (%.2f us)\n",
+            static_cast<unsigned>(numLayouts),
+            TicksToMicroseconds(parseEndTime - parseStartTime, numLayouts),
+            TicksToMicroseconds(cachedEndTime - parseEndTime, numLayouts),
+            TicksToMicroseconds(decodeEndTime - decodeStartTime, numLayouts)
+        );
+    }
+
     return TestResult::Passed;
 }
 
@@ -0,0 +1,123 @@
+/*
+ * TestProfileTraceWriter.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ProfileTraceWriter.h>
+#include <LLGL/Timer.h>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+
+DEF_RITEST( ProfileTraceWriter )
+{
+    auto ReadFileContent = [](const std::string& filename) -> std::string
+    {
+        std::ifstream file{ filename };
+        return std::string{ std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{} };
+    };
+
+    auto CountOccurrences = [](const std::string& str, const char* search) -> std::size_t
+    {
+        std::size_t n = 0;
+        for (std::size_t pos = str.find(search); pos != std::string::npos; pos = str.find(search, pos + 1))
+            ++n;
+        return n;
+    };
+
+    // Generate frame profile with nested time records, one of them with a name that must be escaped
+    FrameProfile frameProfile;
+    {
+        const std::uint64_t ticks = Timer::Tick();
+
+        ProfileTimeRecord outerRecord;
+        {
+            outerRecord.annotation      = "CommandBuffer";
+            outerRecord.cpuTicksStart   = ticks;
+            outerRecord.cpuTicksEnd     = ticks + 100;
+            outerRecord.elapsedTime     = 5000;
+        }
+        frameProfile.timeRecords.push_back(outerRecord);
+
+        ProfileTimeRecord innerRecord;
+        {
+            innerRecord.annotation      = "Group \"Scene\"";
+            innerRecord.cpuTicksStart   = ticks + 10;
+            innerRecord.cpuTicksEnd     = ticks + 90;
+            innerRecord.elapsedTime     = 4000;
+        }
+        frameProfile.timeRecords.push_back(innerRecord);
+
+        frameProfile.commandBufferRecord.drawCommands       = 42;
+        frameProfile.commandQueueRecord.fenceSubmissions    = 1;
+    }
+
+    // Write 5 frames with 2 frames per file, which must produce 3 files
+    constexpr std::uint32_t numFrames       = 5;
+    constexpr std::uint32_t framesPerFile   = 2;
+    constexpr std::uint32_t numFiles        = 3;
+
+    const std::string filenames[numFiles] =
+    {
+        opt.outputDir + "ProfileTrace.0.json",
+        opt.outputDir + "ProfileTrace.1.json",
+        opt.outputDir + "ProfileTrace.2.json",
+    };
+
+    {
+        ProfileTraceWriter traceWriter{ (opt.outputDir + "ProfileTrace.json").c_str(), framesPerFile };
+        if (!traceWriter.IsOpen())
+        {
+            Log::Errorf("Failed to open profile trace file: %s\n", filenames[0].c_str());
+            return TestResult::FailedErrors;
+        }
+
+        for (std::uint32_t i = 0; i < numFrames; ++i)
+        {
+            if (!traceWriter.WriteFrame(frameProfile))
+            {
+                Log::Errorf("Failed to write frame %u to profile trace\n", i);
+                return TestResult::FailedErrors;
+            }
+        }
+
+        if (traceWriter.GetNumFrames() != numFrames)
+        {
+            Log::Errorf("Mismatch between number of written frames in profile trace (%u) and expected value (%u)\n", static_cast<unsigned>(traceWriter.GetNumFrames()), numFrames);
+            return TestResult::FailedMismatch;
+        }
+    }
+
+    // Validate content of each file
+    for (std::uint32_t i = 0; i < numFiles; ++i)
+    {
+        const std::string content = ReadFileContent(filenames[i]);
+        const std::size_t expectedFrames = (i + 1 < numFiles ? framesPerFile : numFrames - framesPerFile * i);
+
+        if (content.compare(0, 1, "{") != 0 || content.find("\n]}\n") == std::string::npos)
+        {
+            Log::Errorf("Profile trace file is incomplete: %s\n", filenames[i].c_str());
+            return TestResult::FailedMismatch;
+        }
+
+        const std::size_t numFrameEvents = CountOccurrences(content, "\"name\":\"Frame\"");
+        const std::size_t numGroupEvents = CountOccurrences(content, "\"name\":\"Group \\\"Scene\\\"\"");
+        const std::size_t numDrawCounters = CountOccurrences(content, "\"drawCommands\":42");
+
+        if (numFrameEvents != expectedFrames || numGroupEvents != expectedFrames || numDrawCounters != expectedFrames)
+        {
+            Log::Errorf(
+                "Mismatch between events in profile trace file %s (frames: %zu, groups: %zu, counters: %zu) and expected value (%zu)\n",
+                filenames[i].c_str(), numFrameEvents, numGroupEvents, numDrawCounters, expectedFrames
+            );
+            return TestResult::FailedMismatch;
+        }
+    }
+
+    return TestResult::Passed;
+}
+
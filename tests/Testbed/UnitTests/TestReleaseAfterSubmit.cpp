@@ -0,0 +1,92 @@
+/*
+ * TestReleaseAfterSubmit.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+
+
+/*
+Submit a command buffer and release the resources it refers to right away.
+The backend must not destroy these resources before the submission has been executed,
+e.g. when the Null renderer runs with deferred submission ('--deferred').
+*/
+DEF_TEST( ReleaseAfterSubmit )
+{
+    const std::uint32_t initialData[4] = { 0xDEADBEEF, 0x01234567, 0x89ABCDEF, 0xFEEDFACE };
+
+    // Create intermediate buffers and texture that are released before the result is read
+    BufferDescriptor srcBufDesc;
+    {
+        srcBufDesc.size         = sizeof(initialData);
+        srcBufDesc.bindFlags    = BindFlags::CopySrc;
+    }
+    CREATE_BUFFER(srcBuf, srcBufDesc, "ReleaseAfterSubmit.srcBuf", initialData);
+
+    BufferDescriptor midBufDesc;
+    {
+        midBufDesc.size         = sizeof(initialData);
+        midBufDesc.bindFlags    = BindFlags::CopySrc | BindFlags::CopyDst;
+    }
+    CREATE_BUFFER(midBuf, midBufDesc, "ReleaseAfterSubmit.midBuf", nullptr);
+
+    TextureDescriptor texDesc;
+    {
+        texDesc.type        = TextureType::Texture2D;
+        texDesc.bindFlags   = BindFlags::CopySrc | BindFlags::CopyDst;
+        texDesc.format      = Format::RGBA8UInt;
+        texDesc.extent      = Extent3D{ 4, 1, 1 };
+        texDesc.mipLevels   = 1;
+    }
+    CREATE_TEXTURE(midTex, texDesc, "ReleaseAfterSubmit.midTex", nullptr);
+
+    // Create destination buffer to read the result from
+    BufferDescriptor dstBufDesc;
+    {
+        dstBufDesc.size         = sizeof(initialData);
+        dstBufDesc.bindFlags    = BindFlags::CopyDst;
+    }
+    CREATE_BUFFER(dstBuf, dstBufDesc, "ReleaseAfterSubmit.dstBuf", nullptr);
+
+    // Encode copy chain srcBuf -> midBuf -> midTex -> dstBuf into a deferred command buffer
+    CommandBuffer* cmdBuf = renderer->CreateCommandBuffer();
+
+    const TextureRegion texRegion{ Offset3D{ 0, 0, 0 }, texDesc.extent };
+
+    cmdBuf->Begin();
+    {
+        cmdBuf->CopyBuffer(*midBuf, 0, *srcBuf, 0, sizeof(initialData));
+        cmdBuf->CopyTextureFromBuffer(*midTex, texRegion, *midBuf, 0);
+        cmdBuf->CopyBufferFromTexture(*dstBuf, 0, *midTex, texRegion);
+    }
+    cmdBuf->End();
+
+    // Submit and release all intermediate resources immediately
+    cmdQueue->Submit(*cmdBuf);
+
+    renderer->Release(*srcBuf);
+    renderer->Release(*midBuf);
+    renderer->Release(*midTex);
+    renderer->Release(*cmdBuf);
+
+    // Read result; the copy chain must have been executed with valid resources
+    std::uint32_t feedbackData[4] = {};
+    renderer->ReadBuffer(*dstBuf, 0, feedbackData, sizeof(feedbackData));
+
+    renderer->Release(*dstBuf);
+
+    if (::memcmp(feedbackData, initialData, sizeof(initialData)) != 0)
+    {
+        Log::Errorf(
+            "Mismatch between feedback data [0x%08X, 0x%08X, 0x%08X, 0x%08X] and initial data [0x%08X, 0x%08X, 0x%08X, 0x%08X]\n",
+            feedbackData[0], feedbackData[1], feedbackData[2], feedbackData[3],
+            initialData[0], initialData[1], initialData[2], initialData[3]
+        );
+        return TestResult::FailedMismatch;
+    }
+
+    return TestResult::Passed;
+}
+
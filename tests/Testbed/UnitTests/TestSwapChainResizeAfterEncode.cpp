@@ -0,0 +1,171 @@
+/*
+ * TestSwapChainResizeAfterEncode.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+
+
+/*
+Encode a render pass into the swap-chain, resize the swap-chain, and then submit the command buffer.
+The render pass must be executed with the resized swap-chain buffers.
+The draw command uses two viewports that are selected by the per-vertex viewport index, so each half of the framebuffer gets its own color.
+Only the Null renderer supports this, since all other backends require command buffers to be encoded again after a swap-chain has been resized,
+and the Null renderer reads the viewport index from the vertex attribute named "viewportIndex" instead of a shader output.
+*/
+DEF_TEST( SwapChainResizeAfterEncode )
+{
+    if (renderer->GetRendererID() != RendererID::Null)
+        return TestResult::Skipped;
+
+    struct ViewportVertex
+    {
+        float position[4];
+        float color[4];
+        float viewportIndex;
+    };
+
+    const ViewportVertex vertices[] =
+    {
+        // Fullscreen triangle in red for viewport 0
+        { { -1.0f, -1.0f, 0.5f, 1.0f }, { 1.0f, 0.0f, 0.0f, 1.0f }, 0.0f },
+        { { -1.0f,  3.0f, 0.5f, 1.0f }, { 1.0f, 0.0f, 0.0f, 1.0f }, 0.0f },
+        { {  3.0f, -1.0f, 0.5f, 1.0f }, { 1.0f, 0.0f, 0.0f, 1.0f }, 0.0f },
+
+        // Fullscreen triangle in blue for viewport 1
+        { { -1.0f, -1.0f, 0.5f, 1.0f }, { 0.0f, 0.0f, 1.0f, 1.0f }, 1.0f },
+        { { -1.0f,  3.0f, 0.5f, 1.0f }, { 0.0f, 0.0f, 1.0f, 1.0f }, 1.0f },
+        { {  3.0f, -1.0f, 0.5f, 1.0f }, { 0.0f, 0.0f, 1.0f, 1.0f }, 1.0f },
+    };
+
+    VertexFormat vertexFormat;
+    vertexFormat.AppendAttribute({ "position",      Format::RGBA32Float });
+    vertexFormat.AppendAttribute({ "color",         Format::RGBA32Float });
+    vertexFormat.AppendAttribute({ "viewportIndex", Format::R32Float    });
+
+    ShaderDescriptor vsDesc;
+    {
+        vsDesc.type                 = ShaderType::Vertex;
+        vsDesc.source               = "";
+        vsDesc.sourceType           = ShaderSourceType::CodeString;
+        vsDesc.vertex.inputAttribs  = vertexFormat.attributes;
+    }
+    Shader* vs = renderer->CreateShader(vsDesc);
+
+    BufferDescriptor vertexBufferDesc;
+    {
+        vertexBufferDesc.size           = sizeof(vertices);
+        vertexBufferDesc.bindFlags      = BindFlags::VertexBuffer;
+        vertexBufferDesc.vertexAttribs  = vertexFormat.attributes;
+    }
+    CREATE_BUFFER(vertexBuffer, vertexBufferDesc, "SwapChainResizeAfterEncode.vertexBuffer", vertices);
+
+    GraphicsPipelineDescriptor psoDesc;
+    {
+        psoDesc.renderPass      = swapChain->GetRenderPass();
+        psoDesc.vertexShader    = vs;
+    }
+    CREATE_GRAPHICS_PSO(pso, psoDesc, "SwapChainResizeAfterEncode.pso");
+
+    // Resize swap-chain to a resolution that differs from the current one in both dimensions
+    const Extent2D oldResolution = swapChain->GetResolution();
+    const Extent2D newResolution{ oldResolution.width + 64, oldResolution.height + 32 };
+
+    TextureDescriptor readbackTexDesc;
+    {
+        readbackTexDesc.bindFlags   = BindFlags::CopyDst;
+        readbackTexDesc.format      = swapChain->GetColorFormat();
+        readbackTexDesc.extent      = Extent3D{ newResolution.width, newResolution.height, 1 };
+        readbackTexDesc.mipLevels   = 1;
+    }
+    CREATE_TEXTURE(readbackTex, readbackTexDesc, "SwapChainResizeAfterEncode.readbackTex", nullptr);
+
+    const TextureRegion readbackRegion{ Offset3D{ 0, 0, 0 }, readbackTexDesc.extent };
+
+    const float halfWidth = static_cast<float>(newResolution.width / 2);
+    const Viewport viewports[2] =
+    {
+        Viewport{ 0.0f,      0.0f, halfWidth, static_cast<float>(newResolution.height) },
+        Viewport{ halfWidth, 0.0f, halfWidth, static_cast<float>(newResolution.height) },
+    };
+
+    // Encode render pass with the old swap-chain resolution
+    CommandBuffer* cmdBuf = renderer->CreateCommandBuffer();
+
+    cmdBuf->Begin();
+    {
+        cmdBuf->BeginRenderPass(*swapChain);
+        {
+            cmdBuf->Clear(ClearFlags::Color, ClearValue{ 0.0f, 1.0f, 0.0f, 1.0f });
+            cmdBuf->SetViewports(2, viewports);
+            cmdBuf->SetVertexBuffer(*vertexBuffer);
+            cmdBuf->SetPipelineState(*pso);
+            cmdBuf->Draw(6, 0);
+            cmdBuf->CopyTextureFromFramebuffer(*readbackTex, readbackRegion, Offset2D{ 0, 0 });
+        }
+        cmdBuf->EndRenderPass();
+    }
+    cmdBuf->End();
+
+    // Resize swap-chain, then submit the encoded command buffer
+    swapChain->ResizeBuffers(newResolution);
+
+    cmdQueue->Submit(*cmdBuf);
+    cmdQueue->WaitIdle();
+
+    // Read back framebuffer and restore original resolution
+    std::vector<ColorRGBAub> readbackColors(newResolution.width * newResolution.height);
+    MutableImageView readbackImage;
+    {
+        readbackImage.format    = ImageFormat::RGBA;
+        readbackImage.dataType  = DataType::UInt8;
+        readbackImage.data      = readbackColors.data();
+        readbackImage.dataSize  = readbackColors.size() * sizeof(ColorRGBAub);
+    }
+    renderer->ReadTexture(*readbackTex, readbackRegion, readbackImage);
+
+    swapChain->ResizeBuffers(oldResolution);
+
+    renderer->Release(*cmdBuf);
+    renderer->Release(*readbackTex);
+    renderer->Release(*pso);
+    renderer->Release(*vertexBuffer);
+    renderer->Release(*vs);
+
+    // Left half must be red and right half must be blue, including the area outside of the old resolution
+    struct ExpectedPixel
+    {
+        std::uint32_t   x;
+        std::uint32_t   y;
+        ColorRGBAub     color;
+        const char*     name;
+    };
+
+    const ExpectedPixel expectedPixels[] =
+    {
+        { 0,                        0,                          ColorRGBAub{ 255, 0,   0, 255 }, "top-left"     },
+        { newResolution.width - 1,  0,                          ColorRGBAub{ 0,   0, 255, 255 }, "top-right"    },
+        { 0,                        newResolution.height - 1,   ColorRGBAub{ 255, 0,   0, 255 }, "bottom-left"  },
+        { newResolution.width - 1,  newResolution.height - 1,   ColorRGBAub{ 0,   0, 255, 255 }, "bottom-right" },
+    };
+
+    for (const ExpectedPixel& expected : expectedPixels)
+    {
+        const ColorRGBAub& actual = readbackColors[expected.y * newResolution.width + expected.x];
+        if (actual != expected.color)
+        {
+            Log::Errorf(
+                "Mismatch between framebuffer %s pixel [%u, %u] color [%02X %02X %02X %02X] and expected color [%02X %02X %02X %02X]\n",
+                expected.name, expected.x, expected.y,
+                actual.r, actual.g, actual.b, actual.a,
+                expected.color.r, expected.color.g, expected.color.b, expected.color.a
+            );
+            return TestResult::FailedMismatch;
+        }
+    }
+
+    return TestResult::Passed;
+}
+
@@ -0,0 +1,252 @@
+/*
+ * TestTextureCopyPaths.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <vector>
+
+
+/*
+Copies between buffers and a 2D-array texture with each variant of the copy commands:
+ - CopyTextureFromBuffer() with a padded row stride and with tightly packed data for the entire subresource.
+ - CopyBufferFromTexture() with a padded row stride for a sub-region and with tightly packed data for the entire subresource.
+ - CopyTexture() between two textures of the same format and between two array layers of the same texture.
+ - CopyTexture() between two textures of different formats (Null renderer only, which converts the texels).
+All results are compared against a CPU-side model of each resource.
+*/
+DEF_TEST( TextureCopyPaths )
+{
+    constexpr std::uint32_t width       = 16;
+    constexpr std::uint32_t height      = 8;
+    constexpr std::uint32_t layers      = 2;
+    constexpr std::uint32_t numTexels   = width * height * layers;
+    constexpr std::uint32_t rowStride   = 256; // Padded row stride, which is also the recommended alignment for D3D12
+    constexpr std::uint32_t layerStride = rowStride * height;
+
+    using Texels = std::vector<std::uint32_t>;
+
+    auto TexelIndex = [](std::uint32_t x, std::uint32_t y, std::uint32_t layer) -> std::size_t
+    {
+        return (static_cast<std::size_t>(layer) * height + y) * width + x;
+    };
+
+    // Unique RGBA8 value per texel; 'seed' distinguishes the initial data of different resources
+    auto MakeTexel = [](std::uint32_t x, std::uint32_t y, std::uint32_t layer, std::uint32_t seed) -> std::uint32_t
+    {
+        return (x * 16u) | ((y * 32u) << 8) | ((layer * 128u + seed) << 16) | (0xFFu << 24);
+    };
+
+    // Copies a region of texels within the CPU-side model of the textures
+    auto CopyModelRegion = [&TexelIndex](Texels& dst, const Offset3D& dstOffset, std::uint32_t dstLayer, const Texels& src, const Offset3D& srcOffset, std::uint32_t srcLayer, const Extent3D& extent)
+    {
+        for_range(y, extent.height)
+        {
+            for_range(x, extent.width)
+            {
+                dst[TexelIndex(dstOffset.x + x, dstOffset.y + y, dstLayer)] = src[TexelIndex(srcOffset.x + x, srcOffset.y + y, srcLayer)];
+            }
+        }
+    };
+
+    auto CompareTexels = [](const char* name, const Texels& actual, const Texels& expected) -> TestResult
+    {
+        for_range(i, expected.size())
+        {
+            if (actual[i] != expected[i])
+            {
+                Log::Errorf(
+                    "Mismatch between %s texel [%u] (0x%08X) and expected value (0x%08X)\n",
+                    name, static_cast<unsigned>(i), actual[i], expected[i]
+                );
+                return TestResult::FailedMismatch;
+            }
+        }
+        return TestResult::Passed;
+    };
+
+    // Initialize padded and tightly packed source buffer data; the padding must remain untouched by all copies
+    std::vector<std::uint32_t> paddedData(layerStride * layers / sizeof(std::uint32_t), 0xDEADBEEF);
+    Texels packedData(numTexels);
+
+    for_range(layer, layers)
+    {
+        for_range(y, height)
+        {
+            for_range(x, width)
+            {
+                paddedData[(layer * layerStride + y * rowStride) / sizeof(std::uint32_t) + x] = MakeTexel(x, y, layer, 1);
+                packedData[TexelIndex(x, y, layer)] = MakeTexel(x, y, layer, 2);
+            }
+        }
+    }
+
+    BufferDescriptor paddedBufDesc;
+    {
+        paddedBufDesc.size      = paddedData.size() * sizeof(std::uint32_t);
+        paddedBufDesc.bindFlags = BindFlags::CopySrc | BindFlags::CopyDst;
+    }
+    CREATE_BUFFER(paddedBuf, paddedBufDesc, "TextureCopyPaths.paddedBuf", paddedData.data());
+
+    BufferDescriptor packedBufDesc;
+    {
+        packedBufDesc.size      = packedData.size() * sizeof(std::uint32_t);
+        packedBufDesc.bindFlags = BindFlags::CopySrc | BindFlags::CopyDst;
+    }
+    CREATE_BUFFER(packedBuf, packedBufDesc, "TextureCopyPaths.packedBuf", packedData.data());
+
+    BufferDescriptor readbackBufDesc;
+    {
+        readbackBufDesc.size        = paddedBufDesc.size;
+        readbackBufDesc.bindFlags   = BindFlags::CopyDst;
+    }
+    CREATE_BUFFER(paddedReadbackBuf, readbackBufDesc, "TextureCopyPaths.paddedReadbackBuf", paddedData.data());
+    {
+        readbackBufDesc.size        = packedBufDesc.size;
+    }
+    CREATE_BUFFER(packedReadbackBuf, readbackBufDesc, "TextureCopyPaths.packedReadbackBuf", nullptr);
+
+    // Create textures with the same format and one with a different format for the Null renderer
+    const bool isFormatConversionSupported = (renderer->GetRendererID() == RendererID::Null);
+
+    TextureDescriptor texDesc;
+    {
+        texDesc.type        = TextureType::Texture2DArray;
+        texDesc.bindFlags   = BindFlags::CopySrc | BindFlags::CopyDst;
+        texDesc.format      = Format::RGBA8UNorm;
+        texDesc.extent      = Extent3D{ width, height, 1 };
+        texDesc.arrayLayers = layers;
+        texDesc.mipLevels   = 1;
+    }
+    CREATE_TEXTURE(texA, texDesc, "TextureCopyPaths.texA", nullptr);
+    CREATE_TEXTURE(texB, texDesc, "TextureCopyPaths.texB", nullptr);
+    {
+        texDesc.format      = Format::BGRA8UNorm;
+    }
+    CREATE_TEXTURE_COND(isFormatConversionSupported, texBGRA, texDesc, "TextureCopyPaths.texBGRA", nullptr);
+
+    const TextureRegion wholeRegion{ TextureSubresource{ 0, layers, 0, 1 }, Offset3D{ 0, 0, 0 }, Extent3D{ width, height, 1 } };
+
+    // Sub-regions for the copies between textures and into the padded buffer
+    const Offset3D  subSrcOffset{ 3, 2, 0 };
+    const Offset3D  subDstOffset{ 1, 1, 0 };
+    const Offset3D  layerDstOffset{ 8, 0, 0 };
+    const Extent3D  subExtent{ 5, 4, 1 };
+    const Extent3D  layerExtent{ 4, 4, 1 };
+
+    // Expected content of each resource
+    Texels expectedA(numTexels), expectedB(packedData), expectedPadded(paddedData), expectedBGRA;
+    for_range(layer, layers)
+    {
+        for_range(y, height)
+        {
+            for_range(x, width)
+                expectedA[TexelIndex(x, y, layer)] = MakeTexel(x, y, layer, 1);
+        }
+    }
+
+    CopyModelRegion(expectedB, subDstOffset, 0, expectedA, subSrcOffset, 1, subExtent);
+    CopyModelRegion(expectedA, layerDstOffset, 0, expectedA, Offset3D{ 0, 0, 0 }, 1, layerExtent);
+    expectedBGRA = expectedA;
+
+    for_range(y, subExtent.height)
+    {
+        for_range(x, subExtent.width)
+            expectedPadded[y * rowStride / sizeof(std::uint32_t) + x] = expectedB[TexelIndex(subDstOffset.x + x, subDstOffset.y + y, 0)];
+    }
+
+    // Encode all copy commands
+    CommandBuffer* cmdBuf = renderer->CreateCommandBuffer();
+
+    cmdBuf->Begin();
+    {
+        // Buffer to texture: padded rows into A and tightly packed whole subresource into B
+        cmdBuf->CopyTextureFromBuffer(*texA, wholeRegion, *paddedBuf, 0, rowStride, layerStride);
+        cmdBuf->CopyTextureFromBuffer(*texB, wholeRegion, *packedBuf, 0);
+
+        // Texture to texture with the same format: sub-region of A (layer 1) into B (layer 0)
+        cmdBuf->CopyTexture(
+            *texB, TextureLocation{ subDstOffset, 0, 0 },
+            *texA, TextureLocation{ subSrcOffset, 1, 0 },
+            subExtent
+        );
+
+        // Texture to texture within the same texture: A (layer 1) into A (layer 0)
+        cmdBuf->CopyTexture(
+            *texA, TextureLocation{ layerDstOffset, 0, 0 },
+            *texA, TextureLocation{ Offset3D{ 0, 0, 0 }, 1, 0 },
+            layerExtent
+        );
+
+        // Texture to texture with format conversion: A into BGRA
+        if (texBGRA != nullptr)
+            cmdBuf->CopyTexture(*texBGRA, TextureLocation{}, *texA, TextureLocation{}, Extent3D{ width, height, layers });
+
+        // Texture to buffer: sub-region of B with padded rows and tightly packed whole subresource of B
+        const TextureRegion subRegion{ TextureSubresource{ 0, 0 }, subDstOffset, subExtent };
+        cmdBuf->CopyBufferFromTexture(*paddedReadbackBuf, 0, *texB, subRegion, rowStride);
+        cmdBuf->CopyBufferFromTexture(*packedReadbackBuf, 0, *texB, wholeRegion);
+    }
+    cmdBuf->End();
+
+    cmdQueue->Submit(*cmdBuf);
+    cmdQueue->WaitIdle();
+
+    // Read back all resources
+    auto ReadTexels = [this, &wholeRegion](Texture& tex, Texels& outTexels)
+    {
+        outTexels.resize(numTexels);
+        MutableImageView dstImage;
+        {
+            dstImage.format     = ImageFormat::RGBA;
+            dstImage.dataType   = DataType::UInt8;
+            dstImage.data       = outTexels.data();
+            dstImage.dataSize   = outTexels.size() * sizeof(std::uint32_t);
+        }
+        renderer->ReadTexture(tex, wholeRegion, dstImage);
+    };
+
+    Texels actualA, actualB, actualBGRA;
+    ReadTexels(*texA, actualA);
+    ReadTexels(*texB, actualB);
+    if (texBGRA != nullptr)
+        ReadTexels(*texBGRA, actualBGRA);
+
+    Texels actualPadded(paddedData.size());
+    renderer->ReadBuffer(*paddedReadbackBuf, 0, actualPadded.data(), paddedBufDesc.size);
+
+    Texels actualPacked(numTexels);
+    renderer->ReadBuffer(*packedReadbackBuf, 0, actualPacked.data(), packedBufDesc.size);
+
+    renderer->Release(*cmdBuf);
+    renderer->Release(*paddedBuf);
+    renderer->Release(*packedBuf);
+    renderer->Release(*paddedReadbackBuf);
+    renderer->Release(*packedReadbackBuf);
+    renderer->Release(*texA);
+    renderer->Release(*texB);
+    if (texBGRA != nullptr)
+        renderer->Release(*texBGRA);
+
+    // Compare all results against the CPU-side model
+    TestResult result = TestResult::Passed;
+
+    if ((result = CompareTexels("texA", actualA, expectedA)) != TestResult::Passed)
+        return result;
+    if ((result = CompareTexels("texB", actualB, expectedB)) != TestResult::Passed)
+        return result;
+    if ((result = CompareTexels("packed readback buffer", actualPacked, expectedB)) != TestResult::Passed)
+        return result;
+    if ((result = CompareTexels("padded readback buffer", actualPadded, expectedPadded)) != TestResult::Passed)
+        return result;
+    if (isFormatConversionSupported)
+    {
+        if ((result = CompareTexels("texBGRA", actualBGRA, expectedBGRA)) != TestResult::Passed)
+            return result;
+    }
+
+    return TestResult::Passed;
+}
+
@@ -0,0 +1,104 @@
+/*
+ * TestTextureReadAsync.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include "Testset.h"
+
+
+/*
+Read the left and right half of a texture asynchronously, both guarded by the same fence,
+and check that both halves have been written to their destination once the fence has been signaled.
+*/
+DEF_TEST( TextureReadAsync )
+{
+    constexpr std::uint32_t texSize = 64;
+    constexpr std::uint32_t halfSize = texSize / 2;
+    constexpr std::uint64_t timeout = 1000000000ull; // 1 second in nanoseconds
+
+    // Create texture with unique color per texel
+    const std::vector<ColorRGBAub> colors = Testset::GenerateColorsRgbaUb(texSize * texSize);
+
+    const ImageView initialImage
+    {
+        ImageFormat::RGBA,
+        DataType::UInt8,
+        colors.data(),
+        colors.size() * sizeof(ColorRGBAub)
+    };
+
+    TextureDescriptor texDesc;
+    {
+        texDesc.type        = TextureType::Texture2D;
+        texDesc.format      = Format::RGBA8UNorm;
+        texDesc.extent      = { texSize, texSize, 1 };
+        texDesc.mipLevels   = 1;
+        texDesc.bindFlags   = BindFlags::Sampled | BindFlags::CopySrc;
+    }
+    Texture* tex = nullptr;
+    TestResult result = CreateTexture(texDesc, "TextureReadAsync.tex", &tex, &initialImage);
+    if (result != TestResult::Passed)
+        return result;
+
+    Fence* fence = renderer->CreateFence();
+
+    // Read both halves of the texture without waiting in between
+    std::vector<ColorRGBAub> halves[2];
+    for_range(i, 2)
+    {
+        halves[i].resize(halfSize * texSize, ColorRGBAub{ 0xFF, 0xFF, 0xFF, 0xFF });
+
+        const TextureRegion region
+        {
+            Offset3D{ static_cast<std::int32_t>(i * halfSize), 0, 0 },
+            Extent3D{ halfSize, texSize, 1 }
+        };
+        const MutableImageView dstImage
+        {
+            ImageFormat::RGBA,
+            DataType::UInt8,
+            halves[i].data(),
+            halves[i].size() * sizeof(ColorRGBAub)
+        };
+        renderer->ReadTextureAsync(*tex, region, dstImage, *fence);
+    }
+
+    const bool isSignaled = cmdQueue->WaitFence(*fence, timeout);
+
+    renderer->Release(*fence);
+    renderer->Release(*tex);
+
+    if (!isSignaled)
+    {
+        Log::Errorf("Waiting for fence after asynchronous texture readback timed out\n");
+        return TestResult::FailedErrors;
+    }
+
+    // Match both halves with the initial texture data
+    for_range(i, 2)
+    {
+        for_range(y, texSize)
+        {
+            const ColorRGBAub* expected = &colors[y * texSize + i * halfSize];
+            const ColorRGBAub* actual   = &halves[i][y * halfSize];
+            if (::memcmp(expected, actual, halfSize * sizeof(ColorRGBAub)) != 0)
+            {
+                const std::string expectedStr   = TestbedContext::FormatByteArray(expected, halfSize * sizeof(ColorRGBAub), 4);
+                const std::string actualStr     = TestbedContext::FormatByteArray(actual, halfSize * sizeof(ColorRGBAub), 4);
+                Log::Errorf(
+                    "Mismatch between asynchronous readback of texture half [%u] and initial data in row %u:\n"
+                    " -> Expected: [%s]\n"
+                    " -> Actual:   [%s]\n",
+                    static_cast<unsigned>(i), static_cast<unsigned>(y), expectedStr.c_str(), actualStr.c_str()
+                );
+                return TestResult::FailedMismatch;
+            }
+        }
+    }
+
+    return TestResult::Passed;
+}
+
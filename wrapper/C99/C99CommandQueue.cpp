@@ -24,6 +24,12 @@ LLGL_C_EXPORT void llglSubmitCommandBuffer(LLGLCommandBuffer commandBuffer)
     g_CurrentCmdQueue->Submit(LLGL_REF(CommandBuffer, commandBuffer));
 }
 
+LLGL_C_EXPORT void llglSubmitCommandBuffers(uint32_t numCommandBuffers, const LLGLCommandBuffer* commandBuffers)
+{
+    LLGL_ASSERT_PTR(commandBuffers);
+    g_CurrentCmdQueue->Submit(ArrayView<CommandBuffer*>{ reinterpret_cast<CommandBuffer* const*>(commandBuffers), numCommandBuffers });
+}
+
 LLGL_C_EXPORT bool llglQueryResult(LLGLQueryHeap queryHeap, uint32_t firstQuery, uint32_t numQueries, void* data, size_t dataSize)
 {
     return g_CurrentCmdQueue->QueryResult(LLGL_REF(QueryHeap, queryHeap), firstQuery, numQueries, data, dataSize);
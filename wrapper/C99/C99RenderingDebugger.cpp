@@ -36,6 +36,16 @@ LLGL_C_EXPORT bool llglGetDebuggerTimeRecording(LLGLRenderingDebugger debugger)
     return LLGL_PTR(RenderingDebugger, debugger)->GetTimeRecording();
 }
 
+LLGL_C_EXPORT void llglSetDebuggerValidation(LLGLRenderingDebugger debugger, bool enabled)
+{
+    LLGL_PTR(RenderingDebugger, debugger)->SetValidation(enabled);
+}
+
+LLGL_C_EXPORT bool llglGetDebuggerValidation(LLGLRenderingDebugger debugger)
+{
+    return LLGL_PTR(RenderingDebugger, debugger)->GetValidation();
+}
+
 LLGL_C_EXPORT void llglFlushDebuggerProfile(LLGLRenderingDebugger debugger, LLGLFrameProfile* outFrameProfile)
 {
     LLGL_ASSERT_PTR(outFrameProfile);
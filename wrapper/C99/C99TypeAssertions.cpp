@@ -721,6 +721,7 @@ LLGL_STATIC_ASSERT_FLAG(Misc, GenerateMips);
 LLGL_STATIC_ASSERT_FLAG(Misc, NoInitialData);
 LLGL_STATIC_ASSERT_FLAG(Misc, Append);
 LLGL_STATIC_ASSERT_FLAG(Misc, Counter);
+LLGL_STATIC_ASSERT_FLAG(Misc, Streaming);
 
 LLGL_STATIC_ASSERT_FLAG(StdOut, Colored);
 
@@ -1112,6 +1113,7 @@ LLGL_STATIC_ASSERT_OFFSET(ProfileCommandQueueRecord, textureWrites);
 LLGL_STATIC_ASSERT_OFFSET(ProfileCommandQueueRecord, textureReads);
 LLGL_STATIC_ASSERT_OFFSET(ProfileCommandQueueRecord, commandBufferSubmittions);
 LLGL_STATIC_ASSERT_OFFSET(ProfileCommandQueueRecord, fenceSubmissions);
+LLGL_STATIC_ASSERT_OFFSET(ProfileCommandQueueRecord, transferSubmissions);
 
 LLGL_STATIC_ASSERT_SIZE(ProfileCommandBufferRecord);
 LLGL_STATIC_ASSERT_OFFSET(ProfileCommandBufferRecord, encodings);
@@ -1138,12 +1140,17 @@ LLGL_STATIC_ASSERT_OFFSET(ProfileCommandBufferRecord, querySections);
 LLGL_STATIC_ASSERT_OFFSET(ProfileCommandBufferRecord, renderConditionSections);
 LLGL_STATIC_ASSERT_OFFSET(ProfileCommandBufferRecord, drawCommands);
 LLGL_STATIC_ASSERT_OFFSET(ProfileCommandBufferRecord, dispatchCommands);
+LLGL_STATIC_ASSERT_OFFSET(ProfileCommandBufferRecord, descriptorSetCacheHits);
+LLGL_STATIC_ASSERT_OFFSET(ProfileCommandBufferRecord, descriptorSetCacheMisses);
+LLGL_STATIC_ASSERT_OFFSET(ProfileCommandBufferRecord, encodingStalls);
+LLGL_STATIC_ASSERT_OFFSET(ProfileCommandBufferRecord, eliminatedCommands);
 
 LLGL_STATIC_ASSERT_SIZE(ProfileTimeRecord);
 LLGL_STATIC_ASSERT_OFFSET(ProfileTimeRecord, annotation);
 LLGL_STATIC_ASSERT_OFFSET(ProfileTimeRecord, cpuTicksStart);
 LLGL_STATIC_ASSERT_OFFSET(ProfileTimeRecord, cpuTicksEnd);
 LLGL_STATIC_ASSERT_OFFSET(ProfileTimeRecord, elapsedTime);
+LLGL_STATIC_ASSERT_OFFSET(ProfileTimeRecord, resolveLatency);
 
 LLGL_STATIC_ASSERT_SIZE(ColorCodes);
 LLGL_STATIC_ASSERT_OFFSET(ColorCodes, textFlags);
@@ -923,6 +923,7 @@ namespace LLGL
         NoInitialData = (1 << 3),
         Append        = (1 << 4),
         Counter       = (1 << 5),
+        Streaming     = (1 << 6),
     }
 
     [Flags]
@@ -1281,10 +1282,11 @@ namespace LLGL
 
     public class ProfileTimeRecord
     {
-        public AnsiString Annotation { get; set; }    = "";
-        public long       CPUTicksStart { get; set; } = 0;
-        public long       CPUTicksEnd { get; set; }   = 0;
-        public long       ElapsedTime { get; set; }   = 0;
+        public AnsiString Annotation { get; set; }     = "";
+        public long       CPUTicksStart { get; set; }  = 0;
+        public long       CPUTicksEnd { get; set; }    = 0;
+        public long       ElapsedTime { get; set; }    = 0;
+        public int        ResolveLatency { get; set; } = 0;
 
         public ProfileTimeRecord() { }
 
@@ -1304,9 +1306,10 @@ namespace LLGL
                     {
                         native.annotation = annotationPtr;
                     }
-                    native.cpuTicksStart = CPUTicksStart;
-                    native.cpuTicksEnd   = CPUTicksEnd;
-                    native.elapsedTime   = ElapsedTime;
+                    native.cpuTicksStart  = CPUTicksStart;
+                    native.cpuTicksEnd    = CPUTicksEnd;
+                    native.elapsedTime    = ElapsedTime;
+                    native.resolveLatency = ResolveLatency;
                 }
                 return native;
             }
@@ -1314,10 +1317,11 @@ namespace LLGL
             {
                 unsafe
                 {
-                    Annotation    = Marshal.PtrToStringAnsi((IntPtr)value.annotation);
-                    CPUTicksStart = value.cpuTicksStart;
-                    CPUTicksEnd   = value.cpuTicksEnd;
-                    ElapsedTime   = value.elapsedTime;
+                    Annotation     = Marshal.PtrToStringAnsi((IntPtr)value.annotation);
+                    CPUTicksStart  = value.cpuTicksStart;
+                    CPUTicksEnd    = value.cpuTicksEnd;
+                    ElapsedTime    = value.elapsedTime;
+                    ResolveLatency = value.resolveLatency;
                 }
             }
         }
@@ -1332,6 +1336,7 @@ namespace LLGL
         public int TextureReads { get; set; }             = 0;
         public int CommandBufferSubmittions { get; set; } = 0;
         public int FenceSubmissions { get; set; }         = 0;
+        public int TransferSubmissions { get; set; }      = 0;
 
         public ProfileCommandQueueRecord() { }
 
@@ -1351,6 +1356,7 @@ namespace LLGL
                 TextureReads             = value.textureReads;
                 CommandBufferSubmittions = value.commandBufferSubmittions;
                 FenceSubmissions         = value.fenceSubmissions;
+                TransferSubmissions      = value.transferSubmissions;
             }
         }
     }
@@ -1381,6 +1387,10 @@ namespace LLGL
         public int RenderConditionSections { get; set; }  = 0;
         public int DrawCommands { get; set; }             = 0;
         public int DispatchCommands { get; set; }         = 0;
+        public int DescriptorSetCacheHits { get; set; }   = 0;
+        public int DescriptorSetCacheMisses { get; set; } = 0;
+        public int EncodingStalls { get; set; }           = 0;
+        public int EliminatedCommands { get; set; }       = 0;
 
         public ProfileCommandBufferRecord() { }
 
@@ -1417,6 +1427,10 @@ namespace LLGL
                 RenderConditionSections  = value.renderConditionSections;
                 DrawCommands             = value.drawCommands;
                 DispatchCommands         = value.dispatchCommands;
+                DescriptorSetCacheHits   = value.descriptorSetCacheHits;
+                DescriptorSetCacheMisses = value.descriptorSetCacheMisses;
+                EncodingStalls           = value.encodingStalls;
+                EliminatedCommands       = value.eliminatedCommands;
             }
         }
     }
@@ -3659,10 +3673,11 @@ namespace LLGL
 
         public unsafe struct ProfileTimeRecord
         {
-            public byte* annotation;    /* = "" */
-            public long  cpuTicksStart; /* = 0 */
-            public long  cpuTicksEnd;   /* = 0 */
-            public long  elapsedTime;   /* = 0 */
+            public byte* annotation;     /* = "" */
+            public long  cpuTicksStart;  /* = 0 */
+            public long  cpuTicksEnd;    /* = 0 */
+            public long  elapsedTime;    /* = 0 */
+            public int   resolveLatency; /* = 0 */
         }
 
         public unsafe struct ProfileCommandQueueRecord
@@ -3674,6 +3689,7 @@ namespace LLGL
             public int textureReads;             /* = 0 */
             public int commandBufferSubmittions; /* = 0 */
             public int fenceSubmissions;         /* = 0 */
+            public int transferSubmissions;      /* = 0 */
         }
 
         public unsafe struct ProfileCommandBufferRecord
@@ -3702,6 +3718,10 @@ namespace LLGL
             public int renderConditionSections;  /* = 0 */
             public int drawCommands;             /* = 0 */
             public int dispatchCommands;         /* = 0 */
+            public int descriptorSetCacheHits;   /* = 0 */
+            public int descriptorSetCacheMisses; /* = 0 */
+            public int encodingStalls;           /* = 0 */
+            public int eliminatedCommands;       /* = 0 */
         }
 
         public unsafe struct RendererInfo
@@ -4635,6 +4655,9 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglSubmitCommandBuffer", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void SubmitCommandBuffer(CommandBuffer commandBuffer);
 
+        [DllImport(DllName, EntryPoint="llglSubmitCommandBuffers", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SubmitCommandBuffers(int numCommandBuffers, CommandBuffer* commandBuffers);
+
         [DllImport(DllName, EntryPoint="llglQueryResult", CallingConvention=CallingConvention.Cdecl)]
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern unsafe bool QueryResult(QueryHeap queryHeap, int firstQuery, int numQueries, void* data, IntPtr dataSize);
@@ -4749,6 +4772,13 @@ namespace LLGL
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern unsafe bool GetDebuggerTimeRecording(RenderingDebugger debugger);
 
+        [DllImport(DllName, EntryPoint="llglSetDebuggerValidation", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetDebuggerValidation(RenderingDebugger debugger, [MarshalAs(UnmanagedType.I1)] bool enabled);
+
+        [DllImport(DllName, EntryPoint="llglGetDebuggerValidation", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool GetDebuggerValidation(RenderingDebugger debugger);
+
         [DllImport(DllName, EntryPoint="llglFlushDebuggerProfile", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void FlushDebuggerProfile(RenderingDebugger debugger, ref FrameProfile outFrameProfile);
 
@@ -36,6 +36,18 @@ namespace LLGL
             }
         }
 
+        public bool Validation
+        {
+            get
+            {
+                return NativeLLGL.GetDebuggerValidation(Native);
+            }
+            set
+            {
+                NativeLLGL.SetDebuggerValidation(Native, value);
+            }
+        }
+
         public FrameProfile FlushProfile()
         {
             var nativeFrameProfile = new NativeLLGL.FrameProfile();
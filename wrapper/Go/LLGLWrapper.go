@@ -914,6 +914,7 @@ const (
     MiscNoInitialData = (1 << 3)
     MiscAppend        = (1 << 4)
     MiscCounter       = (1 << 5)
+    MiscStreaming     = (1 << 6)
 )
 
 type ShaderCompileFlags int
@@ -1075,6 +1076,7 @@ type ProfileCommandQueueRecord struct {
     TextureReads             uint32 /* = 0 */
     CommandBufferSubmittions uint32 /* = 0 */
     FenceSubmissions         uint32 /* = 0 */
+    TransferSubmissions      uint32 /* = 0 */
 }
 
 type ProfileCommandBufferRecord struct {
@@ -1102,6 +1104,10 @@ type ProfileCommandBufferRecord struct {
     RenderConditionSections  uint32 /* = 0 */
     DrawCommands             uint32 /* = 0 */
     DispatchCommands         uint32 /* = 0 */
+    DescriptorSetCacheHits   uint32 /* = 0 */
+    DescriptorSetCacheMisses uint32 /* = 0 */
+    EncodingStalls           uint32 /* = 0 */
+    EliminatedCommands       uint32 /* = 0 */
 }
 
 type RendererInfo struct {